@@ -0,0 +1,261 @@
+#include "config.h"
+#include "core_stubs.h"
+#include "feedSlots.h"
+#include "feeding.h"
+#include "flashStats.h"
+#include "host_hal.h"
+#include "logs.h"
+#include "moistureSensor.h"
+#include "pumps.h"
+#include "rtc.h"
+#include "runoffSensor.h"
+
+#include <Arduino.h>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Times the control core's hot paths on the host: log appends and the boot
+// scan over a full ring, the daily-total query cold and cached, an idle
+// feeding tick, a sensor tick, an RTC read and a config save. Alongside the
+// wall time each row shows the flash traffic one call causes, which is the
+// number that matters on the device.
+
+static const int kDefaultIterations = 2000;
+static const int kQuickDivisor = 20;
+
+struct OpResult {
+  uint32_t calls;
+  uint64_t total_ns;
+  uint64_t min_ns;
+  uint64_t max_ns;
+  uint32_t writes;
+  uint32_t erase_blocks;
+};
+
+/*
+ * now_ns
+ * Returns a monotonic timestamp in nanoseconds.
+ * Example:
+ *   uint64_t start = now_ns();
+ */
+static uint64_t now_ns() {
+  auto since = std::chrono::steady_clock::now().time_since_epoch();
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(since).count());
+}
+
+/*
+ * flash_totals
+ * Sums write calls and estimated erase blocks over every tracked file.
+ * Example:
+ *   uint32_t writes = 0, erased = 0;
+ *   flash_totals(&writes, &erased);
+ */
+static void flash_totals(uint32_t *writes, uint32_t *erase_blocks) {
+  *writes = 0;
+  *erase_blocks = 0;
+  for (uint8_t i = 0; i < FLASH_FILE_COUNT; ++i) {
+    const FlashIoCounters &c = flashStatsFile(static_cast<FlashFile>(i));
+    *writes += c.writes;
+    *erase_blocks += c.eraseBlocks;
+  }
+}
+
+/*
+ * OpTimer
+ * Times one call and the flash traffic it causes into an OpResult.
+ * Example:
+ *   { OpTimer t(&result); add_log(entry); }
+ */
+struct OpTimer {
+  explicit OpTimer(OpResult *r) : result(r) {
+    flash_totals(&writes, &erase_blocks);
+    start = now_ns();
+  }
+  ~OpTimer() {
+    uint64_t ns = now_ns() - start;
+    uint32_t writes_after = 0;
+    uint32_t erase_after = 0;
+    flash_totals(&writes_after, &erase_after);
+    if (result->calls == 0 || ns < result->min_ns) result->min_ns = ns;
+    if (ns > result->max_ns) result->max_ns = ns;
+    result->calls++;
+    result->total_ns += ns;
+    result->writes += writes_after - writes;
+    result->erase_blocks += erase_after - erase_blocks;
+  }
+  OpResult *result;
+  uint64_t start;
+  uint32_t writes;
+  uint32_t erase_blocks;
+};
+
+/*
+ * sample_entry
+ * Returns a moisture sample stamped with the current RTC time.
+ * Example:
+ *   add_log(sample_entry(42));
+ */
+static LogEntry sample_entry(uint8_t moisture) {
+  LogEntry entry = {};
+  clearLogEntry(&entry);
+  entry.entryType = 2;
+  entry.soilMoistureBefore = moisture;
+  rtcReadEpoch(&entry.startTime);
+  return entry;
+}
+
+/*
+ * boot_core
+ * Brings the core up the way setup() does, on a blank filesystem with a
+ * set clock, calibrated probe and one slot that never fires.
+ * Example:
+ *   boot_core();
+ */
+static void boot_core() {
+  host_fs_reset();
+  host_pin_reset();
+  host_clock_set_manual(true);
+  host_rtc_set_present(true);
+  host_rtc_set_epoch(epochFromFields(25, 6, 1, 12, 0, 0));
+  host_pin_set_analog(SOIL_MOISTURE_SENSOR_PIN, 550);
+  host_soil_temp_set(true, 215);
+
+  initConfig();
+  config.flags |= CONFIG_FLAG_DRIPPER_CALIBRATED;
+  config.moistSensorCalibrationDry = 800;
+  config.moistSensorCalibrationSoaked = 300;
+  config.lightsOnMinutes = 6 * 60;
+  config.lightsOffMinutes = 22 * 60;
+  FeedSlot slot = {};
+  slot.flags = FEED_SLOT_ENABLED | FEED_SLOT_HAS_TIME_WINDOW | FEED_SLOT_HAS_MOISTURE_BELOW;
+  slot.windowStartMinutes = 0;
+  slot.windowDurationMinutes = 30;
+  slot.moistureBelow = 10;
+  slot.maxVolumeMl = 200;
+  packFeedSlot(config.feedSlotsPacked[0], &slot);
+  saveConfig();
+
+  flashStatsInit();
+  initRtc();
+  initPumps();
+  initRunoffSensor();
+  initMoistureSensor();
+  logs_init();
+  feedingInit();
+}
+
+/*
+ * print_row
+ * Writes one result line of the table.
+ * Example:
+ *   print_row("add_log", result);
+ */
+static void print_row(const char *name, const OpResult &r) {
+  if (r.calls == 0) return;
+  printf("%-14s %7u %10.2f %10.2f %10.2f %9.3f %9.3f\n", name, r.calls, r.total_ns / 1000.0 / r.calls,
+         r.min_ns / 1000.0, r.max_ns / 1000.0, static_cast<double>(r.writes) / r.calls,
+         static_cast<double>(r.erase_blocks) / r.calls);
+}
+
+/*
+ * usage
+ * Prints the command line help.
+ * Example:
+ *   usage(argv[0]);
+ */
+static void usage(const char *argv0) {
+  printf("usage: %s [--iterations N] [--quick]\n", argv0);
+  printf("  --iterations N  calls per operation (default %d; the boot scan runs N/100)\n", kDefaultIterations);
+  printf("  --quick         1/%d of the iterations, for a smoke run under ctest\n", kQuickDivisor);
+}
+
+int main(int argc, char **argv) {
+  int iterations = kDefaultIterations;
+  bool quick = false;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+      iterations = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--quick") == 0) {
+      quick = true;
+    } else {
+      usage(argv[0]);
+      return 2;
+    }
+  }
+  if (quick) iterations /= kQuickDivisor;
+  if (iterations < 1) iterations = 1;
+
+  // Core modules log over Serial; keep the table readable.
+  Serial.enabled = false;
+  boot_core();
+
+  OpResult add_result = {};
+  OpResult boot_result = {};
+  OpResult daily_cold = {};
+  OpResult daily_hot = {};
+  OpResult feeding_result = {};
+  OpResult sensor_result = {};
+  OpResult rtc_result = {};
+  OpResult config_result = {};
+
+  // Appends run long enough to wrap the ring, so the boot scan and the
+  // daily query below walk a full store.
+  int appends = iterations < 1500 ? 1500 : iterations;
+  for (int i = 0; i < appends; ++i) {
+    host_clock_advance_ms(60000);
+    LogEntry entry = sample_entry(static_cast<uint8_t>(i % 100));
+    OpTimer t(&add_result);
+    add_log(entry);
+  }
+
+  int boots = iterations / 100 < 1 ? 1 : iterations / 100;
+  for (int i = 0; i < boots; ++i) {
+    OpTimer t(&boot_result);
+    logs_init();
+  }
+
+  for (int i = 0; i < iterations; ++i) {
+    // A new entry drops the cached day so the next query walks the ring.
+    add_log(sample_entry(50));
+    {
+      OpTimer t(&daily_cold);
+      getDailyFeedTotalMlNow();
+    }
+    OpTimer t(&daily_hot);
+    getDailyFeedTotalMlNow();
+  }
+
+  for (int i = 0; i < iterations; ++i) {
+    host_clock_advance_ms(250);
+    {
+      OpTimer t(&sensor_result);
+      runSoilSensorLazyReadings();
+    }
+    {
+      OpTimer t(&feeding_result);
+      feedingTick();
+    }
+    OpTimer t(&rtc_result);
+    rtcNowMs();
+  }
+
+  for (int i = 0; i < iterations; ++i) {
+    config.baselineY = static_cast<uint8_t>(i % 50 + 1);
+    OpTimer t(&config_result);
+    saveConfig();
+  }
+
+  printf("%-14s %7s %10s %10s %10s %9s %9s\n", "op", "calls", "mean_us", "min_us", "max_us", "writes", "erase_blk");
+  print_row("add_log", add_result);
+  print_row("logs_init", boot_result);
+  print_row("daily_cold", daily_cold);
+  print_row("daily_cached", daily_hot);
+  print_row("sensor_tick", sensor_result);
+  print_row("feeding_tick", feeding_result);
+  print_row("rtc_now", rtc_result);
+  print_row("save_config", config_result);
+  printf("%d iterations | rtc hardware reads %u\n", iterations, static_cast<unsigned>(rtcHardwareReadCount()));
+  return 0;
+}
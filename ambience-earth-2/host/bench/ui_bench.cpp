@@ -0,0 +1,335 @@
+#include "app_state.h"
+#include "config.h"
+#include "host_stubs.h"
+#include "ui_flow.h"
+#include "ui_fonts.h"
+#include "ui_screens.h"
+
+#include <Arduino.h>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Builds every ScreenId against a memory framebuffer and reports how long the
+// widget tree takes to build, how long a full and an incremental render take,
+// how many objects the tree holds and how much of the LVGL heap it needs.
+
+static const int kDefaultIterations = 20;
+static const uint32_t kIncrementalStepSeconds = 60;
+
+struct ScreenResult {
+  uint32_t objects;
+  uint64_t build_us;
+  uint64_t full_us;
+  uint64_t incremental_us;
+  uint32_t full_px;
+  uint32_t incremental_px;
+  uint32_t heap_used;
+  uint32_t heap_peak;
+};
+
+static uint16_t g_framebuffer[kScreenWidth * kScreenHeight];
+alignas(4) static uint16_t g_draw_buf[kScreenWidth * kBufferLines];
+static lv_display_t *g_disp = nullptr;
+static lv_obj_t *g_blank_screen = nullptr;
+static uint32_t g_flushed_px = 0;
+static uint32_t g_heap_sample_peak = 0;
+
+/*
+ * now_us
+ * Returns a monotonic timestamp in microseconds.
+ * Example:
+ *   uint64_t start = now_us();
+ */
+static uint64_t now_us() {
+  auto since = std::chrono::steady_clock::now().time_since_epoch();
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(since).count());
+}
+
+/*
+ * host_tick
+ * LVGL tick source backed by the host millis().
+ * Example:
+ *   lv_tick_set_cb(host_tick);
+ */
+static uint32_t host_tick() {
+  return static_cast<uint32_t>(millis());
+}
+
+/*
+ * framebuffer_flush
+ * Display flush callback that copies the rendered area into g_framebuffer.
+ * Example:
+ *   lv_display_set_flush_cb(disp, framebuffer_flush);
+ */
+static void framebuffer_flush(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
+  int32_t width = lv_area_get_width(area);
+  const uint16_t *src = reinterpret_cast<const uint16_t *>(px_map);
+  for (int32_t y = area->y1; y <= area->y2; ++y) {
+    memcpy(&g_framebuffer[y * kScreenWidth + area->x1], src, static_cast<size_t>(width) * sizeof(uint16_t));
+    src += width;
+  }
+  g_flushed_px += static_cast<uint32_t>(width * lv_area_get_height(area));
+  lv_display_flush_ready(disp);
+}
+
+/*
+ * heap_used_bytes
+ * Returns LVGL heap bytes in use and folds the sample into g_heap_sample_peak.
+ * Example:
+ *   uint32_t used = heap_used_bytes();
+ */
+static uint32_t heap_used_bytes() {
+  lv_mem_monitor_t mon = {};
+  lv_mem_monitor(&mon);
+  uint32_t used = static_cast<uint32_t>(mon.total_size - mon.free_size);
+  if (used > g_heap_sample_peak) g_heap_sample_peak = used;
+  return used;
+}
+
+/*
+ * init_display
+ * Creates the 320x240 RGB565 display with the firmware's partial buffer
+ * height and the same theme build_ui() applies.
+ * Example:
+ *   init_display();
+ */
+static void init_display() {
+  lv_init();
+  lv_tick_set_cb(host_tick);
+
+  g_disp = lv_display_create(kScreenWidth, kScreenHeight);
+  lv_display_set_color_format(g_disp, LV_COLOR_FORMAT_RGB565);
+  lv_display_set_flush_cb(g_disp, framebuffer_flush);
+  lv_display_set_buffers(g_disp, g_draw_buf, nullptr, sizeof(g_draw_buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+  lv_display_set_default(g_disp);
+
+  lv_theme_t *theme = lv_theme_default_init(g_disp, kColorAccent, kColorMuted, true, UI_FONT_14);
+  lv_display_set_theme(g_disp, theme);
+
+  g_blank_screen = lv_screen_active();
+  lv_refr_now(g_disp);
+}
+
+/*
+ * prepare_screen
+ * Sets up the context the matching open_*_event handler would leave behind.
+ * Example:
+ *   prepare_screen(SCREEN_NUMBER_INPUT);
+ */
+static void prepare_screen(ScreenId id) {
+  g_active_screen = id;
+  g_host.feedingActive = (id == SCREEN_FEEDING_STATUS);
+  switch (id) {
+    case SCREEN_SLOT_SUMMARY:
+      g_selected_slot = 0;
+      break;
+    case SCREEN_SLOT_WIZARD:
+      g_selected_slot = 0;
+      g_edit_slot = g_slots[0];
+      g_wizard_step = 0;
+      break;
+    case SCREEN_TIME_DATE: {
+      EpochFields fields = epochToFields(g_sim.now);
+      g_time_date_edit = {2000 + fields.year, fields.month, fields.day, fields.hour, fields.minute, 0};
+      g_time_date_step = 0;
+      break;
+    }
+    case SCREEN_NUMBER_INPUT:
+      g_number_ctx = {"Max daily", config.maxDailyWaterMl, 100, 5000, 100, "ml", nullptr, nullptr};
+      break;
+    case SCREEN_TIME_RANGE_INPUT:
+      g_time_range_ctx = {"Lights on/off", config.lightsOnMinutes / 60, config.lightsOnMinutes % 60,
+                          config.lightsOffMinutes / 60, config.lightsOffMinutes % 60, nullptr};
+      break;
+    case SCREEN_HISTORY:
+      g_history_range = 2;
+      break;
+    default:
+      break;
+  }
+}
+
+/*
+ * bench_screen
+ * Builds, fully renders, updates and re-renders one screen, then deletes it.
+ * Example:
+ *   ScreenResult r = {};
+ *   bench_screen(SCREEN_INFO, &r);
+ */
+static void bench_screen(ScreenId id, ScreenResult *out) {
+  prepare_screen(id);
+  g_heap_sample_peak = 0;
+  uint32_t heap_before = heap_used_bytes();
+
+  uint64_t start = now_us();
+  lv_obj_t *root = build_screen(id);
+  out->build_us += now_us() - start;
+  out->objects = count_obj_tree(root);
+  uint32_t heap_built = heap_used_bytes();
+
+  lv_screen_load(root);
+  g_flushed_px = 0;
+  start = now_us();
+  lv_obj_invalidate(root);
+  lv_refr_now(g_disp);
+  out->full_us += now_us() - start;
+  out->full_px = g_flushed_px;
+  heap_used_bytes();
+
+  host_stubs_advance(kIncrementalStepSeconds);
+  g_flushed_px = 0;
+  start = now_us();
+  update_active_screen();
+  lv_refr_now(g_disp);
+  out->incremental_us += now_us() - start;
+  out->incremental_px = g_flushed_px;
+  heap_used_bytes();
+
+  lv_screen_load(g_blank_screen);
+  lv_obj_delete(root);
+  lv_refr_now(g_disp);
+
+  out->heap_used = heap_built - heap_before;
+  if (g_heap_sample_peak - heap_before > out->heap_peak) out->heap_peak = g_heap_sample_peak - heap_before;
+}
+
+/*
+ * screen_name
+ * Returns a short label for a ScreenId.
+ * Example:
+ *   printf("%s\n", screen_name(SCREEN_INFO));
+ */
+static const char *screen_name(ScreenId id) {
+  switch (id) {
+    case SCREEN_INFO: return "info";
+    case SCREEN_FEEDING_STATUS: return "feeding_status";
+    case SCREEN_MENU: return "menu";
+    case SCREEN_LOGS: return "logs";
+    case SCREEN_FEEDING_MENU: return "feeding_menu";
+    case SCREEN_SLOTS_LIST: return "slots_list";
+    case SCREEN_SLOT_SUMMARY: return "slot_summary";
+    case SCREEN_SLOT_WIZARD: return "slot_wizard";
+    case SCREEN_SETTINGS_MENU: return "settings_menu";
+    case SCREEN_TIME_DATE: return "time_date";
+    case SCREEN_CAL_MENU: return "cal_menu";
+    case SCREEN_CAL_MOIST: return "cal_moist";
+    case SCREEN_CAL_FLOW: return "cal_flow";
+    case SCREEN_TEST_MENU: return "test_menu";
+    case SCREEN_TEST_SENSORS: return "test_sensors";
+    case SCREEN_TEST_PUMPS: return "test_pumps";
+    case SCREEN_RESET_MENU: return "reset_menu";
+    case SCREEN_INITIAL_SETUP: return "initial_setup";
+    case SCREEN_NUMBER_INPUT: return "number_input";
+    case SCREEN_TIME_RANGE_INPUT: return "time_range";
+    case SCREEN_HISTORY: return "history";
+    case SCREEN_UI_MEMORY: return "ui_memory";
+    case SCREEN_PROFILER: return "profiler";
+    case SCREEN_FLASH_STATS: return "flash_stats";
+    default: return "?";
+  }
+}
+
+/*
+ * write_ppm
+ * Dumps the framebuffer as a binary PPM so a run can be eyeballed.
+ * Example:
+ *   write_ppm("out/info.ppm");
+ */
+static bool write_ppm(const char *path) {
+  FILE *file = fopen(path, "wb");
+  if (!file) return false;
+  fprintf(file, "P6\n%u %u\n255\n", kScreenWidth, kScreenHeight);
+  for (uint32_t i = 0; i < static_cast<uint32_t>(kScreenWidth) * kScreenHeight; ++i) {
+    uint16_t px = g_framebuffer[i];
+    uint8_t rgb[3] = {static_cast<uint8_t>((px >> 11) << 3), static_cast<uint8_t>(((px >> 5) & 0x3F) << 2),
+                      static_cast<uint8_t>((px & 0x1F) << 3)};
+    fwrite(rgb, 1, sizeof(rgb), file);
+  }
+  fclose(file);
+  return true;
+}
+
+/*
+ * usage
+ * Prints the command line help.
+ * Example:
+ *   usage(argv[0]);
+ */
+static void usage(const char *argv0) {
+  printf("usage: %s [--iterations N] [--max-render-us US] [--ppm-dir DIR]\n", argv0);
+  printf("  --iterations N      builds per screen, averaged (default %d)\n", kDefaultIterations);
+  printf("  --max-render-us US  exit 1 if any screen's mean full render exceeds US\n");
+  printf("  --ppm-dir DIR       write DIR/<screen>.ppm after the full render\n");
+}
+
+int main(int argc, char **argv) {
+  int iterations = kDefaultIterations;
+  uint64_t max_render_us = 0;
+  const char *ppm_dir = nullptr;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+      iterations = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--max-render-us") == 0 && i + 1 < argc) {
+      max_render_us = strtoull(argv[++i], nullptr, 10);
+    } else if (strcmp(argv[i], "--ppm-dir") == 0 && i + 1 < argc) {
+      ppm_dir = argv[++i];
+    } else {
+      usage(argv[0]);
+      return 2;
+    }
+  }
+  if (iterations < 1) iterations = 1;
+
+  // UI modules log memory and events over Serial; keep the table readable.
+  Serial.enabled = false;
+  randomSeed(1);
+  init_display();
+
+  printf("%-15s %6s %9s %9s %9s %7s %7s %8s %8s %8s\n", "screen", "objs", "build_us", "full_us", "incr_us",
+         "full_px", "incr_px", "heap_b", "peak_b", "budget_b");
+  bool over_budget = false;
+  uint64_t total_full_us = 0;
+  for (int s = 0; s < SCREEN_COUNT; ++s) {
+    ScreenId id = static_cast<ScreenId>(s);
+    ScreenResult result = {};
+    for (int i = 0; i < iterations; ++i) {
+      host_stubs_init();
+      bench_screen(id, &result);
+      if (i == 0 && ppm_dir) {
+        // The tree is gone by now, so re-render once more for the snapshot.
+        prepare_screen(id);
+        lv_obj_t *root = build_screen(id);
+        lv_screen_load(root);
+        lv_refr_now(g_disp);
+        char path[256];
+        snprintf(path, sizeof(path), "%s/%s.ppm", ppm_dir, screen_name(id));
+        if (!write_ppm(path)) fprintf(stderr, "cannot write %s\n", path);
+        lv_screen_load(g_blank_screen);
+        lv_obj_delete(root);
+      }
+    }
+    uint64_t full_us = result.full_us / static_cast<uint64_t>(iterations);
+    total_full_us += full_us;
+    bool slow = max_render_us && full_us > max_render_us;
+    // Same per-screen heap budget the firmware checks in UI_MEM_CHECKS builds.
+    uint32_t heap_budget = screen_mem_budget(id);
+    bool heavy = result.heap_used > heap_budget;
+    if (slow || heavy) over_budget = true;
+    printf("%-15s %6u %9llu %9llu %9llu %7u %7u %8u %8u %8u%s%s\n", screen_name(id), result.objects,
+           static_cast<unsigned long long>(result.build_us / static_cast<uint64_t>(iterations)),
+           static_cast<unsigned long long>(full_us),
+           static_cast<unsigned long long>(result.incremental_us / static_cast<uint64_t>(iterations)),
+           result.full_px, result.incremental_px, result.heap_used, result.heap_peak, heap_budget,
+           slow ? "  OVER" : "", heavy ? "  HEAP" : "");
+  }
+
+  lv_mem_monitor_t mon = {};
+  lv_mem_monitor(&mon);
+  printf("lvgl heap: total=%u max_used=%u frag=%u%% | mean full render %llu us | %d iterations\n",
+         static_cast<unsigned>(mon.total_size), static_cast<unsigned>(mon.max_used),
+         static_cast<unsigned>(mon.frag_pct),
+         static_cast<unsigned long long>(total_full_us / SCREEN_COUNT), iterations);
+  return over_budget ? 1 : 0;
+}
@@ -0,0 +1,132 @@
+#pragma once
+
+// Minimal Arduino core surface for building firmware modules on Linux.
+// Only what the UI and the control core use; extend as modules are added.
+// host_hal.h has the matching knobs for driving pins and the clock.
+
+#include <math.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LOW 0x0
+#define HIGH 0x1
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+
+#define IRAM_ATTR
+
+typedef uint8_t byte;
+
+/*
+ * millis
+ * Returns milliseconds since the host process started (wraps like the ESP32).
+ * Example:
+ *   unsigned long now = millis();
+ */
+unsigned long millis();
+
+/*
+ * micros
+ * Returns microseconds since the host process started (wraps like the ESP32).
+ * Example:
+ *   unsigned long start = micros();
+ */
+unsigned long micros();
+
+/*
+ * delay
+ * Sleeps the calling thread for ms milliseconds.
+ * Example:
+ *   delay(10);
+ */
+void delay(unsigned long ms);
+
+/*
+ * delayMicroseconds
+ * Sleeps the calling thread for us microseconds.
+ * Example:
+ *   delayMicroseconds(480);
+ */
+void delayMicroseconds(unsigned int us);
+
+/*
+ * pinMode
+ * Records the pin mode; INPUT_PULLUP inputs read HIGH until driven.
+ * Example:
+ *   pinMode(9, OUTPUT);
+ */
+void pinMode(uint8_t pin, uint8_t mode);
+
+/*
+ * digitalWrite
+ * Latches an output level that host_pin_level() reports.
+ * Example:
+ *   digitalWrite(9, LOW);
+ */
+void digitalWrite(uint8_t pin, uint8_t value);
+
+/*
+ * digitalRead
+ * Returns the level set with host_pin_set_input(), else the pull-up/latched level.
+ * Example:
+ *   if (!digitalRead(7)) { ... }
+ */
+int digitalRead(uint8_t pin);
+
+/*
+ * analogRead
+ * Returns the pin's analog source or the value set with host_pin_set_analog().
+ * Example:
+ *   uint16_t raw = analogRead(1);
+ */
+uint16_t analogRead(uint8_t pin);
+
+/*
+ * analogReadResolution
+ * Accepted for API parity; host values are returned as set.
+ * Example:
+ *   analogReadResolution(10);
+ */
+void analogReadResolution(uint8_t bits);
+
+/*
+ * random
+ * Returns a pseudo-random value in [minValue, maxValue).
+ * Example:
+ *   long x = random(0, 100);
+ */
+long random(long minValue, long maxValue);
+
+/*
+ * randomSeed
+ * Seeds the generator behind random() so runs are repeatable.
+ * Example:
+ *   randomSeed(1);
+ */
+void randomSeed(unsigned long seed);
+
+/*
+ * psramFound
+ * Host builds have no PSRAM.
+ * Example:
+ *   if (psramFound()) { ... }
+ */
+bool psramFound();
+
+class HardwareSerial {
+ public:
+  void begin(unsigned long baud);
+  int printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+  size_t print(const char *text);
+  size_t println(const char *text = "");
+
+  // When false, output is dropped so benchmarks are not skewed by stdout.
+  bool enabled = true;
+};
+
+extern HardwareSerial Serial;
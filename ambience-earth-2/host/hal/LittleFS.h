@@ -0,0 +1,99 @@
+#pragma once
+
+// In-memory stand-in for the ESP32 LittleFS/FS API. Files live in a map
+// keyed by path and vanish with the process; host_hal.h can reset them and
+// cut writes short to model a power loss. Opening with "w" truncates at
+// once, which is harsher than LittleFS (it commits on close), so crash
+// tests here cover the worst case.
+
+#include <Arduino.h>
+
+#include <memory>
+#include <vector>
+
+typedef std::vector<uint8_t> HostFileBytes;
+
+class File {
+ public:
+  File() = default;
+  File(std::shared_ptr<HostFileBytes> data, bool readable, bool writable, bool append);
+
+  explicit operator bool() const { return static_cast<bool>(data_); }
+
+  /*
+   * read
+   * Copies up to len bytes from the current position.
+   * Example:
+   *   size_t got = f.read(buffer, sizeof(buffer));
+   */
+  size_t read(uint8_t *buffer, size_t len);
+
+  /*
+   * read
+   * Returns the next byte, or -1 at the end of the file.
+   * Example:
+   *   int b = f.read();
+   */
+  int read();
+
+  /*
+   * write
+   * Writes len bytes at the current position, zero-filling any gap left by
+   * a seek past the end.
+   * Example:
+   *   f.write(buffer, sizeof(buffer));
+   */
+  size_t write(const uint8_t *buffer, size_t len);
+
+  /*
+   * write
+   * Writes one byte.
+   * Example:
+   *   f.write(static_cast<uint8_t>(0));
+   */
+  size_t write(uint8_t value);
+
+  /*
+   * seek
+   * Moves the position; past the end is allowed, as on the device.
+   * Example:
+   *   if (!f.seek(offset)) return false;
+   */
+  bool seek(uint32_t pos);
+
+  size_t position() const { return pos_; }
+  size_t size() const;
+  int available();
+  void flush() {}
+  void close();
+
+ private:
+  std::shared_ptr<HostFileBytes> data_;
+  size_t pos_ = 0;
+  bool readable_ = false;
+  bool writable_ = false;
+  bool append_ = false;
+};
+
+class LittleFSFS {
+ public:
+  bool begin(bool formatOnFail = false, const char *basePath = "/littlefs", uint8_t maxOpenFiles = 10,
+             const char *partitionLabel = "spiffs");
+  void end() {}
+  bool format();
+
+  /*
+   * open
+   * Opens a file with an fopen-style mode: "r", "r+", "w", "w+", "a" or "a+".
+   * Example:
+   *   File f = LittleFS.open("/config_a.bin", "w");
+   */
+  File open(const char *path, const char *mode = "r");
+  bool exists(const char *path);
+  bool remove(const char *path);
+  bool rename(const char *from, const char *to);
+  size_t totalBytes();
+  size_t usedBytes();
+};
+
+extern LittleFSFS LittleFS;
@@ -0,0 +1,51 @@
+#pragma once
+
+// Host I2C bus with a DS1307 model at HOST_RTC_ADDRESS; every other address
+// NAKs. The RTC's registers follow its datasheet: seven BCD time registers,
+// a control byte and 56 bytes of battery-backed RAM behind an
+// auto-incrementing register pointer.
+
+#include <Arduino.h>
+
+class TwoWire {
+ public:
+  bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0);
+  void beginTransmission(uint8_t address);
+
+  /*
+   * write
+   * Queues one byte for the transmission opened by beginTransmission().
+   * Example:
+   *   Wire.write(0x00);
+   */
+  size_t write(uint8_t value);
+
+  /*
+   * endTransmission
+   * Delivers the queued bytes; returns 0 on ACK and 2 when the address NAKs.
+   * Example:
+   *   if (Wire.endTransmission() != 0) return false;
+   */
+  uint8_t endTransmission(bool sendStop = true);
+
+  /*
+   * requestFrom
+   * Reads quantity bytes from the device into the receive buffer; returns
+   * how many arrived.
+   * Example:
+   *   if (Wire.requestFrom(0x68, 7) != 7) return false;
+   */
+  uint8_t requestFrom(uint8_t address, uint8_t quantity);
+  int available();
+  int read();
+
+ private:
+  uint8_t address_ = 0;
+  uint8_t tx_[32] = {};
+  uint8_t txLen_ = 0;
+  uint8_t rx_[32] = {};
+  uint8_t rxLen_ = 0;
+  uint8_t rxPos_ = 0;
+};
+
+extern TwoWire Wire;
@@ -0,0 +1,175 @@
+#include <Arduino.h>
+
+#include "host_hal.h"
+
+#include <chrono>
+#include <thread>
+
+HardwareSerial Serial;
+
+struct HostPin {
+  uint8_t mode;
+  uint8_t level;
+  bool driven;
+  uint8_t input;
+  uint16_t analog;
+  HostAnalogSource source;
+  uint32_t writes;
+};
+
+static const std::chrono::steady_clock::time_point kStartedAt = std::chrono::steady_clock::now();
+static uint32_t g_random_state = 1;
+static bool g_manual_clock = false;
+static uint64_t g_manual_us = 0;
+static HostPin g_pins[HOST_PIN_COUNT] = {};
+
+/*
+ * clock_us
+ * Returns microseconds on the active clock: wall time, or the manual one.
+ * Example:
+ *   uint64_t us = clock_us();
+ */
+static uint64_t clock_us() {
+  if (g_manual_clock) return g_manual_us;
+  auto elapsed = std::chrono::steady_clock::now() - kStartedAt;
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+}
+
+unsigned long millis() {
+  return static_cast<uint32_t>(clock_us() / 1000ULL);
+}
+
+unsigned long micros() {
+  return static_cast<uint32_t>(clock_us());
+}
+
+void delay(unsigned long ms) {
+  if (g_manual_clock) {
+    g_manual_us += static_cast<uint64_t>(ms) * 1000ULL;
+    return;
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(unsigned int us) {
+  if (g_manual_clock) {
+    g_manual_us += us;
+    return;
+  }
+  std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  if (pin >= HOST_PIN_COUNT) return;
+  g_pins[pin].mode = mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+  if (pin >= HOST_PIN_COUNT) return;
+  uint8_t level = value ? HIGH : LOW;
+  if (g_pins[pin].level != level) g_pins[pin].writes++;
+  g_pins[pin].level = level;
+}
+
+int digitalRead(uint8_t pin) {
+  if (pin >= HOST_PIN_COUNT) return LOW;
+  const HostPin &p = g_pins[pin];
+  if (p.driven) return p.input;
+  if (p.mode == INPUT_PULLUP) return HIGH;
+  return p.level;
+}
+
+uint16_t analogRead(uint8_t pin) {
+  if (pin >= HOST_PIN_COUNT) return 0;
+  const HostPin &p = g_pins[pin];
+  return p.source ? p.source(pin) : p.analog;
+}
+
+void analogReadResolution(uint8_t) {}
+
+void host_clock_set_manual(bool manual) {
+  if (manual == g_manual_clock) return;
+  // Carry the current reading over so millis() never jumps backwards.
+  uint64_t now = clock_us();
+  g_manual_clock = manual;
+  if (manual) g_manual_us = now;
+}
+
+void host_clock_advance_ms(uint32_t ms) {
+  g_manual_us += static_cast<uint64_t>(ms) * 1000ULL;
+}
+
+uint64_t host_clock_ms() {
+  return clock_us() / 1000ULL;
+}
+
+void host_pin_reset() {
+  memset(g_pins, 0, sizeof(g_pins));
+}
+
+uint8_t host_pin_level(uint8_t pin) {
+  return (pin < HOST_PIN_COUNT) ? g_pins[pin].level : LOW;
+}
+
+uint8_t host_pin_mode(uint8_t pin) {
+  return (pin < HOST_PIN_COUNT) ? g_pins[pin].mode : 0;
+}
+
+uint32_t host_pin_writes(uint8_t pin) {
+  return (pin < HOST_PIN_COUNT) ? g_pins[pin].writes : 0;
+}
+
+void host_pin_set_input(uint8_t pin, uint8_t level) {
+  if (pin >= HOST_PIN_COUNT) return;
+  g_pins[pin].driven = true;
+  g_pins[pin].input = level ? HIGH : LOW;
+}
+
+void host_pin_set_analog(uint8_t pin, uint16_t value) {
+  if (pin >= HOST_PIN_COUNT) return;
+  g_pins[pin].analog = value;
+}
+
+void host_pin_set_analog_source(uint8_t pin, HostAnalogSource source) {
+  if (pin >= HOST_PIN_COUNT) return;
+  g_pins[pin].source = source;
+}
+
+long random(long minValue, long maxValue) {
+  if (maxValue <= minValue) return minValue;
+  // xorshift32: deterministic across libcs so runs compare cleanly.
+  g_random_state ^= g_random_state << 13;
+  g_random_state ^= g_random_state >> 17;
+  g_random_state ^= g_random_state << 5;
+  return minValue + static_cast<long>(g_random_state % static_cast<uint32_t>(maxValue - minValue));
+}
+
+void randomSeed(unsigned long seed) {
+  g_random_state = seed ? static_cast<uint32_t>(seed) : 1;
+}
+
+bool psramFound() {
+  return false;
+}
+
+void HardwareSerial::begin(unsigned long) {}
+
+int HardwareSerial::printf(const char *format, ...) {
+  if (!enabled) return 0;
+  va_list args;
+  va_start(args, format);
+  int written = vprintf(format, args);
+  va_end(args);
+  return written;
+}
+
+size_t HardwareSerial::print(const char *text) {
+  if (!enabled || !text) return 0;
+  return fwrite(text, 1, strlen(text), stdout);
+}
+
+size_t HardwareSerial::println(const char *text) {
+  size_t written = print(text);
+  if (enabled) written += fwrite("\r\n", 1, 2, stdout);
+  return written;
+}
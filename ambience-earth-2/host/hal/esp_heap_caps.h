@@ -0,0 +1,32 @@
+#pragma once
+
+// Host stand-in for ESP-IDF capability-based allocation: every region is
+// plain malloc, so internal/PSRAM placement is not modelled.
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_SPIRAM (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+
+/*
+ * heap_caps_malloc
+ * Allocates size bytes; caps are ignored on the host.
+ * Example:
+ *   void *mem = heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+ */
+static inline void *heap_caps_malloc(size_t size, uint32_t caps) {
+  (void)caps;
+  return malloc(size);
+}
+
+/*
+ * heap_caps_free
+ * Releases memory from heap_caps_malloc().
+ * Example:
+ *   heap_caps_free(mem);
+ */
+static inline void heap_caps_free(void *ptr) {
+  free(ptr);
+}
@@ -0,0 +1,168 @@
+#pragma once
+
+// Host-side controls for the shims in this directory: a virtual clock,
+// GPIO/ADC levels, the in-memory LittleFS and the DS1307 on the I2C bus.
+// Firmware code never includes this; tests and benchmarks do.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define HOST_PIN_COUNT 64
+#define HOST_FS_TOTAL_BYTES 0x160000UL
+#define HOST_RTC_ADDRESS 0x68
+
+typedef uint16_t (*HostAnalogSource)(uint8_t pin);
+
+/*
+ * host_clock_set_manual
+ * In manual mode millis()/micros() only move through host_clock_advance_ms()
+ * and delay(), so tests run hours of firmware time in microseconds.
+ * Example:
+ *   host_clock_set_manual(true);
+ */
+void host_clock_set_manual(bool manual);
+
+/*
+ * host_clock_advance_ms
+ * Moves the manual clock forward.
+ * Example:
+ *   host_clock_advance_ms(1000);
+ */
+void host_clock_advance_ms(uint32_t ms);
+
+/*
+ * host_clock_ms
+ * Returns the 64-bit host clock behind millis(), in either mode.
+ * Example:
+ *   uint64_t now = host_clock_ms();
+ */
+uint64_t host_clock_ms();
+
+/*
+ * host_pin_reset
+ * Returns every pin to an unconfigured, LOW, zero-ADC state.
+ * Example:
+ *   host_pin_reset();
+ */
+void host_pin_reset();
+
+/*
+ * host_pin_level
+ * Returns the last level written to an output pin.
+ * Example:
+ *   bool pumpOn = host_pin_level(9) == LOW;
+ */
+uint8_t host_pin_level(uint8_t pin);
+
+/*
+ * host_pin_mode
+ * Returns the mode last passed to pinMode().
+ * Example:
+ *   if (host_pin_mode(7) == INPUT_PULLUP) { ... }
+ */
+uint8_t host_pin_mode(uint8_t pin);
+
+/*
+ * host_pin_writes
+ * Counts digitalWrite() calls that changed a pin's level.
+ * Example:
+ *   uint32_t toggles = host_pin_writes(9);
+ */
+uint32_t host_pin_writes(uint8_t pin);
+
+/*
+ * host_pin_set_input
+ * Drives an input pin externally; digitalRead() returns level.
+ * Example:
+ *   host_pin_set_input(7, LOW);
+ */
+void host_pin_set_input(uint8_t pin, uint8_t level);
+
+/*
+ * host_pin_set_analog
+ * Sets the value analogRead() returns for a pin.
+ * Example:
+ *   host_pin_set_analog(1, 512);
+ */
+void host_pin_set_analog(uint8_t pin, uint16_t value);
+
+/*
+ * host_pin_set_analog_source
+ * Routes analogRead() for a pin through a callback (nullptr to clear).
+ * Example:
+ *   host_pin_set_analog_source(1, plant_probe_raw);
+ */
+void host_pin_set_analog_source(uint8_t pin, HostAnalogSource source);
+
+/*
+ * host_fs_reset
+ * Erases every file and clears injected faults.
+ * Example:
+ *   host_fs_reset();
+ */
+void host_fs_reset();
+
+/*
+ * host_fs_set_write_budget
+ * Lets only bytes more bytes reach files, then drops writes as if power
+ * was cut mid-save. Pass SIZE_MAX to lift the limit.
+ * Example:
+ *   host_fs_set_write_budget(20);
+ */
+void host_fs_set_write_budget(size_t bytes);
+
+/*
+ * host_fs_file_size
+ * Returns a file's size, or 0 when it does not exist.
+ * Example:
+ *   size_t bytes = host_fs_file_size("/logs.bin");
+ */
+size_t host_fs_file_size(const char *path);
+
+/*
+ * host_fs_file_data
+ * Returns a pointer to a file's bytes for corruption tests, or nullptr.
+ * Example:
+ *   uint8_t *bytes = host_fs_file_data("/config_a.bin");
+ */
+uint8_t *host_fs_file_data(const char *path);
+
+/*
+ * host_rtc_set_epoch
+ * Sets the DS1307 to seconds since 2000-01-01 and starts it running.
+ * Example:
+ *   host_rtc_set_epoch(epochFromFields(25, 6, 1, 8, 0, 0));
+ */
+void host_rtc_set_epoch(uint32_t epochSec);
+
+/*
+ * host_rtc_epoch
+ * Returns the DS1307's current time in seconds since 2000-01-01.
+ * Example:
+ *   uint32_t rtcSec = host_rtc_epoch();
+ */
+uint32_t host_rtc_epoch();
+
+/*
+ * host_rtc_set_present
+ * Detaches (NAKs every transfer) or reattaches the RTC.
+ * Example:
+ *   host_rtc_set_present(false);
+ */
+void host_rtc_set_present(bool present);
+
+/*
+ * host_rtc_set_drift_ppm
+ * Makes the RTC crystal run fast (positive) or slow against millis().
+ * Example:
+ *   host_rtc_set_drift_ppm(50);
+ */
+void host_rtc_set_drift_ppm(int32_t ppm);
+
+/*
+ * host_i2c_transactions
+ * Counts completed I2C transfers (writes and reads) on the bus.
+ * Example:
+ *   uint32_t before = host_i2c_transactions();
+ */
+uint32_t host_i2c_transactions();
@@ -0,0 +1,148 @@
+#include <LittleFS.h>
+
+#include "host_hal.h"
+
+#include <map>
+#include <string>
+
+LittleFSFS LittleFS;
+
+static std::map<std::string, std::shared_ptr<HostFileBytes>> g_files;
+static size_t g_write_budget = SIZE_MAX;
+
+File::File(std::shared_ptr<HostFileBytes> data, bool readable, bool writable, bool append)
+    : data_(std::move(data)), readable_(readable), writable_(writable), append_(append) {}
+
+size_t File::read(uint8_t *buffer, size_t len) {
+  if (!data_ || !readable_ || !buffer) return 0;
+  size_t have = (pos_ < data_->size()) ? data_->size() - pos_ : 0;
+  if (len > have) len = have;
+  memcpy(buffer, data_->data() + pos_, len);
+  pos_ += len;
+  return len;
+}
+
+int File::read() {
+  uint8_t value = 0;
+  return read(&value, 1) == 1 ? value : -1;
+}
+
+size_t File::write(const uint8_t *buffer, size_t len) {
+  if (!data_ || !writable_ || !buffer) return 0;
+  // Past the budget the bytes are lost, but the caller is told they landed:
+  // a power cut gives the firmware no error to react to either.
+  size_t keep = (len < g_write_budget) ? len : g_write_budget;
+  if (g_write_budget != SIZE_MAX) g_write_budget -= keep;
+  if (append_) pos_ = data_->size();
+  if (keep > 0) {
+    if (data_->size() < pos_ + keep) data_->resize(pos_ + keep, 0);
+    memcpy(data_->data() + pos_, buffer, keep);
+  }
+  pos_ += len;
+  return len;
+}
+
+size_t File::write(uint8_t value) {
+  return write(&value, 1);
+}
+
+bool File::seek(uint32_t pos) {
+  if (!data_) return false;
+  pos_ = pos;
+  return true;
+}
+
+size_t File::size() const {
+  return data_ ? data_->size() : 0;
+}
+
+int File::available() {
+  if (!data_ || pos_ >= data_->size()) return 0;
+  return static_cast<int>(data_->size() - pos_);
+}
+
+void File::close() {
+  data_.reset();
+  pos_ = 0;
+}
+
+bool LittleFSFS::begin(bool, const char *, uint8_t, const char *) {
+  return true;
+}
+
+bool LittleFSFS::format() {
+  g_files.clear();
+  return true;
+}
+
+File LittleFSFS::open(const char *path, const char *mode) {
+  if (!path || !mode) return File();
+  bool plus = strchr(mode, '+') != nullptr;
+  auto it = g_files.find(path);
+  switch (mode[0]) {
+    case 'r':
+      if (it == g_files.end()) return File();
+      return File(it->second, true, plus, false);
+    case 'w': {
+      if (it == g_files.end()) it = g_files.emplace(path, std::make_shared<HostFileBytes>()).first;
+      else it->second->clear();
+      return File(it->second, plus, true, false);
+    }
+    case 'a': {
+      if (it == g_files.end()) it = g_files.emplace(path, std::make_shared<HostFileBytes>()).first;
+      File f(it->second, plus, true, true);
+      f.seek(static_cast<uint32_t>(it->second->size()));
+      return f;
+    }
+    default:
+      return File();
+  }
+}
+
+bool LittleFSFS::exists(const char *path) {
+  return path && g_files.count(path) != 0;
+}
+
+bool LittleFSFS::remove(const char *path) {
+  return path && g_files.erase(path) != 0;
+}
+
+bool LittleFSFS::rename(const char *from, const char *to) {
+  if (!from || !to) return false;
+  auto it = g_files.find(from);
+  if (it == g_files.end()) return false;
+  std::shared_ptr<HostFileBytes> data = it->second;
+  g_files.erase(it);
+  g_files[to] = data;
+  return true;
+}
+
+size_t LittleFSFS::totalBytes() {
+  return HOST_FS_TOTAL_BYTES;
+}
+
+size_t LittleFSFS::usedBytes() {
+  size_t used = 0;
+  for (const auto &entry : g_files) used += entry.second->size();
+  return used;
+}
+
+void host_fs_reset() {
+  g_files.clear();
+  g_write_budget = SIZE_MAX;
+}
+
+void host_fs_set_write_budget(size_t bytes) {
+  g_write_budget = bytes;
+}
+
+size_t host_fs_file_size(const char *path) {
+  auto it = path ? g_files.find(path) : g_files.end();
+  return (it != g_files.end()) ? it->second->size() : 0;
+}
+
+uint8_t *host_fs_file_data(const char *path) {
+  auto it = path ? g_files.find(path) : g_files.end();
+  if (it == g_files.end() || it->second->empty()) return nullptr;
+  return it->second->data();
+}
@@ -0,0 +1,172 @@
+#include <Wire.h>
+
+#include "epochTime.h"
+#include "host_hal.h"
+
+TwoWire Wire;
+
+namespace {
+constexpr uint8_t kRtcRegisterCount = 64;
+constexpr uint8_t kRtcRamStart = 8;
+
+struct HostRtc {
+  bool present;
+  // Time the registers held at setHostMs, on the RTC's own crystal.
+  uint32_t setEpochSec;
+  uint64_t setHostMs;
+  int32_t driftPpm;
+  uint8_t pointer;
+  uint8_t control;
+  uint8_t ram[kRtcRegisterCount - kRtcRamStart];
+};
+
+static HostRtc g_rtc = {true, 0, 0, 0, 0, 0, {}};
+static uint32_t g_transactions = 0;
+
+uint8_t to_bcd(uint8_t value) {
+  return static_cast<uint8_t>(((value / 10) << 4) | (value % 10));
+}
+
+uint8_t from_bcd(uint8_t value) {
+  return static_cast<uint8_t>((value >> 4) * 10 + (value & 0x0F));
+}
+
+/*
+ * rtc_now
+ * Returns the DS1307's current epoch second, crystal drift included.
+ * Example:
+ *   uint32_t sec = rtc_now();
+ */
+uint32_t rtc_now() {
+  int64_t elapsedMs = static_cast<int64_t>(host_clock_ms() - g_rtc.setHostMs);
+  elapsedMs += elapsedMs * g_rtc.driftPpm / 1000000;
+  return g_rtc.setEpochSec + static_cast<uint32_t>(elapsedMs / 1000);
+}
+
+/*
+ * rtc_read_register
+ * Returns one register as the chip would report it right now.
+ * Example:
+ *   uint8_t seconds = rtc_read_register(0);
+ */
+uint8_t rtc_read_register(uint8_t reg) {
+  if (reg >= kRtcRamStart) return g_rtc.ram[reg - kRtcRamStart];
+  if (reg == 7) return g_rtc.control;
+  EpochFields f = epochToFields(rtc_now());
+  switch (reg) {
+    case 0: return to_bcd(f.second);
+    case 1: return to_bcd(f.minute);
+    case 2: return to_bcd(f.hour);
+    case 3: return static_cast<uint8_t>(((rtc_now() / kEpochSecondsPerDay + 6) % 7) + 1);
+    case 4: return to_bcd(f.day);
+    case 5: return to_bcd(f.month);
+    default: return to_bcd(f.year);
+  }
+}
+
+/*
+ * rtc_write
+ * Applies a register-pointer write followed by optional data bytes. A write
+ * covering the time registers restarts the clock from the new fields.
+ * Example:
+ *   rtc_write(buffer, length);
+ */
+void rtc_write(const uint8_t *data, uint8_t len) {
+  if (len == 0) return;
+  uint8_t reg = data[0] % kRtcRegisterCount;
+  uint8_t regs[7];
+  for (uint8_t i = 0; i < 7; ++i) regs[i] = rtc_read_register(i);
+  bool timeWritten = false;
+  for (uint8_t i = 1; i < len; ++i) {
+    if (reg < 7) {
+      regs[reg] = data[i];
+      timeWritten = true;
+    } else if (reg == 7) {
+      g_rtc.control = data[i];
+    } else {
+      g_rtc.ram[reg - kRtcRamStart] = data[i];
+    }
+    reg = static_cast<uint8_t>((reg + 1) % kRtcRegisterCount);
+  }
+  g_rtc.pointer = reg;
+  if (!timeWritten) return;
+  uint8_t year = from_bcd(regs[6]);
+  uint8_t month = from_bcd(regs[5] & 0x1F);
+  uint8_t day = from_bcd(regs[4] & 0x3F);
+  uint8_t hour = from_bcd(regs[2] & 0x3F);
+  uint8_t minute = from_bcd(regs[1] & 0x7F);
+  uint8_t second = from_bcd(regs[0] & 0x7F);
+  if (!epochFieldsValid(year, month, day, hour, minute, second)) return;
+  host_rtc_set_epoch(epochFromFields(year, month, day, hour, minute, second));
+}
+} // namespace
+
+bool TwoWire::begin(int, int, uint32_t) {
+  return true;
+}
+
+void TwoWire::beginTransmission(uint8_t address) {
+  address_ = address;
+  txLen_ = 0;
+}
+
+size_t TwoWire::write(uint8_t value) {
+  if (txLen_ >= sizeof(tx_)) return 0;
+  tx_[txLen_++] = value;
+  return 1;
+}
+
+uint8_t TwoWire::endTransmission(bool) {
+  if (address_ != HOST_RTC_ADDRESS || !g_rtc.present) return 2;
+  rtc_write(tx_, txLen_);
+  txLen_ = 0;
+  g_transactions++;
+  return 0;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t address, uint8_t quantity) {
+  rxLen_ = 0;
+  rxPos_ = 0;
+  if (address != HOST_RTC_ADDRESS || !g_rtc.present) return 0;
+  if (quantity > sizeof(rx_)) quantity = sizeof(rx_);
+  for (uint8_t i = 0; i < quantity; ++i) {
+    rx_[i] = rtc_read_register(g_rtc.pointer);
+    g_rtc.pointer = static_cast<uint8_t>((g_rtc.pointer + 1) % kRtcRegisterCount);
+  }
+  rxLen_ = quantity;
+  g_transactions++;
+  return quantity;
+}
+
+int TwoWire::available() {
+  return rxLen_ - rxPos_;
+}
+
+int TwoWire::read() {
+  if (rxPos_ >= rxLen_) return -1;
+  return rx_[rxPos_++];
+}
+
+void host_rtc_set_epoch(uint32_t epochSec) {
+  g_rtc.setEpochSec = epochSec;
+  g_rtc.setHostMs = host_clock_ms();
+}
+
+uint32_t host_rtc_epoch() {
+  return rtc_now();
+}
+
+void host_rtc_set_present(bool present) {
+  g_rtc.present = present;
+}
+
+void host_rtc_set_drift_ppm(int32_t ppm) {
+  // Re-anchor so the new rate only applies from now on.
+  g_rtc.setEpochSec = rtc_now();
+  g_rtc.setHostMs = host_clock_ms();
+  g_rtc.driftPpm = ppm;
+}
+
+uint32_t host_i2c_transactions() {
+  return g_transactions;
+}
@@ -0,0 +1,129 @@
+#include "plant_model.h"
+
+#include <math.h>
+
+static PlantParams g_params = {};
+static PlantState g_state = {};
+static uint32_t g_noise_state = 1;
+
+/*
+ * lights_on
+ * Returns true when minute_of_day falls inside the photoperiod, which may
+ * wrap midnight.
+ * Example:
+ *   if (lights_on(minute)) { ... }
+ */
+static bool lights_on(uint16_t minute_of_day) {
+  uint16_t on = g_params.lights_on_min;
+  uint16_t off = g_params.lights_off_min;
+  if (on == off) return false;
+  if (on < off) return minute_of_day >= on && minute_of_day < off;
+  return minute_of_day >= on || minute_of_day < off;
+}
+
+/*
+ * next_noise
+ * Returns a deterministic value in [-probe_noise, probe_noise].
+ * Example:
+ *   int noise = next_noise();
+ */
+static int next_noise() {
+  g_noise_state = g_noise_state * 1664525UL + 1013904223UL;
+  int span = 2 * g_params.probe_noise + 1;
+  return static_cast<int>((g_noise_state >> 16) % static_cast<uint32_t>(span)) - g_params.probe_noise;
+}
+
+PlantParams plant_default_params() {
+  PlantParams params = {};
+  params.saturation_ml = 4000.0f;
+  params.field_capacity_ml = 3200.0f;
+  params.wilting_ml = 800.0f;
+  params.drain_per_min = 0.15f;
+  params.runoff_wet_ml_min = 5.0f;
+  params.infiltration_tau_s = 90.0f;
+  params.dripper_ml_h = 6000.0f;
+  params.et_lights_ml_h = 30.0f;
+  params.et_growth_per_day = 0.03f;
+  params.et_max_ml_h = 90.0f;
+  params.et_dark_fraction = 0.1f;
+  params.lights_on_min = 6 * 60;
+  params.lights_off_min = 18 * 60;
+  params.probe_raw_dry = 800;
+  params.probe_raw_wet = 300;
+  params.probe_noise = 2;
+  params.temp_dark_deci_c = 190;
+  params.temp_lights_deci_c = 240;
+  return params;
+}
+
+void plant_init(const PlantParams &params, float start_percent, uint32_t seed) {
+  g_params = params;
+  g_state = {};
+  g_state.root_ml = params.saturation_ml * start_percent / 100.0f;
+  g_noise_state = seed ? seed : 1;
+}
+
+void plant_step(uint32_t dt_ms, bool pump_on, uint16_t minute_of_day, float age_days) {
+  float dt_s = dt_ms / 1000.0f;
+  if (pump_on) {
+    float in = g_params.dripper_ml_h * dt_s / 3600.0f;
+    g_state.surface_ml += in;
+    g_state.pumped_ml += in;
+  }
+
+  float soak = g_state.surface_ml * (1.0f - expf(-dt_s / g_params.infiltration_tau_s));
+  g_state.surface_ml -= soak;
+  g_state.root_ml += soak;
+
+  float drain = 0.0f;
+  if (g_state.root_ml > g_params.field_capacity_ml) {
+    float excess = g_state.root_ml - g_params.field_capacity_ml;
+    drain = excess * (1.0f - expf(-g_params.drain_per_min * dt_s / 60.0f));
+  }
+  // A saturated pot passes anything more straight through.
+  if (g_state.root_ml - drain > g_params.saturation_ml) drain = g_state.root_ml - g_params.saturation_ml;
+  g_state.root_ml -= drain;
+  g_state.drained_ml += drain;
+  g_state.drain_ml_min = dt_s > 0.0f ? drain * 60.0f / dt_s : 0.0f;
+
+  float rate = g_params.et_lights_ml_h * powf(1.0f + g_params.et_growth_per_day, age_days);
+  if (rate > g_params.et_max_ml_h) rate = g_params.et_max_ml_h;
+  if (!lights_on(minute_of_day)) rate *= g_params.et_dark_fraction;
+  // Stomata close as the substrate dries: full rate down to halfway
+  // between field capacity and wilting point, then tapering to zero.
+  float knee = g_params.wilting_ml + 0.5f * (g_params.field_capacity_ml - g_params.wilting_ml);
+  float avail = (g_state.root_ml - g_params.wilting_ml) / (knee - g_params.wilting_ml);
+  if (avail > 1.0f) avail = 1.0f;
+  if (avail < 0.0f) avail = 0.0f;
+  float et = rate * avail * dt_s / 3600.0f;
+  g_state.root_ml -= et;
+  g_state.transpired_ml += et;
+}
+
+const PlantState &plant_state() {
+  return g_state;
+}
+
+float plant_moisture_percent() {
+  float pct = g_state.root_ml * 100.0f / g_params.saturation_ml;
+  if (pct < 0.0f) return 0.0f;
+  if (pct > 100.0f) return 100.0f;
+  return pct;
+}
+
+uint16_t plant_probe_raw(uint8_t) {
+  float dry = g_params.probe_raw_dry;
+  float wet = g_params.probe_raw_wet;
+  float raw = dry + (wet - dry) * plant_moisture_percent() / 100.0f + static_cast<float>(next_noise());
+  if (raw < 0.0f) raw = 0.0f;
+  if (raw > 1023.0f) raw = 1023.0f;
+  return static_cast<uint16_t>(lroundf(raw));
+}
+
+bool plant_runoff() {
+  return g_state.drain_ml_min >= g_params.runoff_wet_ml_min;
+}
+
+int16_t plant_soil_temp_deci_c(uint16_t minute_of_day) {
+  return lights_on(minute_of_day) ? g_params.temp_lights_deci_c : g_params.temp_dark_deci_c;
+}
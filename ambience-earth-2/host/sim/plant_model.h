@@ -0,0 +1,106 @@
+#pragma once
+
+#include <stdint.h>
+
+// Water balance of one pot for the virtual-time runner. Drip water lands on
+// the surface and soaks into the root zone; water above field capacity
+// drains out of the bottom, and a steady drain wets the runoff switch. The
+// plant transpires under the lights, more as it grows and less as the
+// substrate dries towards wilting point. The probe sees the root zone
+// through the firmware's dry/soaked calibration plus a little ADC noise.
+
+struct PlantParams {
+  float saturation_ml;       // root-zone water at 100 % on the probe
+  float field_capacity_ml;   // held against gravity; anything above drains
+  float wilting_ml;          // transpiration stops here
+  float drain_per_min;       // share of the water above field capacity draining per minute
+  float runoff_wet_ml_min;   // drain flow at which the runoff switch closes
+  float infiltration_tau_s;  // surface water into the root zone
+  float dripper_ml_h;        // real emitter flow, whatever the calibration says
+  float et_lights_ml_h;      // transpiration under the lights on day 0
+  float et_growth_per_day;   // daily growth of that rate
+  float et_max_ml_h;         // ceiling once the plant is grown
+  float et_dark_fraction;    // night-time share of the lights rate
+  uint16_t lights_on_min;    // photoperiod, minutes after midnight
+  uint16_t lights_off_min;
+  uint16_t probe_raw_dry;    // ADC counts at 0 % and 100 %
+  uint16_t probe_raw_wet;
+  uint8_t probe_noise;       // +/- counts per read
+  int16_t temp_dark_deci_c;  // substrate temperature with lights off/on
+  int16_t temp_lights_deci_c;
+};
+
+struct PlantState {
+  float root_ml;
+  float surface_ml;
+  float drain_ml_min;
+  float pumped_ml;           // running totals since plant_init()
+  float drained_ml;
+  float transpired_ml;
+};
+
+/*
+ * plant_default_params
+ * Returns a 4 L-substrate pot on a 6 L/h dripper with lights 06:00-18:00,
+ * matching the firmware's sim defaults.
+ * Example:
+ *   PlantParams params = plant_default_params();
+ */
+PlantParams plant_default_params();
+
+/*
+ * plant_init
+ * Starts the model at start_percent root-zone moisture with a seeded noise source.
+ * Example:
+ *   plant_init(params, 55.0f, 1);
+ */
+void plant_init(const PlantParams &params, float start_percent, uint32_t seed);
+
+/*
+ * plant_step
+ * Advances the pot by dt_ms with the pump on or off. minute_of_day picks
+ * lights or dark; age_days scales transpiration with growth.
+ * Example:
+ *   plant_step(250, pump_on, epochMinuteOfDay(now), 3.5f);
+ */
+void plant_step(uint32_t dt_ms, bool pump_on, uint16_t minute_of_day, float age_days);
+
+/*
+ * plant_state
+ * Returns the current water balance.
+ * Example:
+ *   float drained = plant_state().drained_ml;
+ */
+const PlantState &plant_state();
+
+/*
+ * plant_moisture_percent
+ * Returns the root zone's moisture on the probe's 0-100 % scale.
+ * Example:
+ *   float pct = plant_moisture_percent();
+ */
+float plant_moisture_percent();
+
+/*
+ * plant_probe_raw
+ * Returns one noisy ADC read of the probe; fits host_pin_set_analog_source().
+ * Example:
+ *   host_pin_set_analog_source(SOIL_MOISTURE_SENSOR_PIN, plant_probe_raw);
+ */
+uint16_t plant_probe_raw(uint8_t pin);
+
+/*
+ * plant_runoff
+ * Returns true while the drain flow is enough to wet the runoff switch.
+ * Example:
+ *   host_pin_set_input(RUNOFF_SENSOR_PIN, plant_runoff() ? LOW : HIGH);
+ */
+bool plant_runoff();
+
+/*
+ * plant_soil_temp_deci_c
+ * Returns the substrate temperature for a minute of the day.
+ * Example:
+ *   host_soil_temp_set(true, plant_soil_temp_deci_c(minute));
+ */
+int16_t plant_soil_temp_deci_c(uint16_t minute_of_day);
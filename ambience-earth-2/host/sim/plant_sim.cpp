@@ -0,0 +1,314 @@
+#include "config.h"
+#include "controlLoop.h"
+#include "core_stubs.h"
+#include "feeding.h"
+#include "flashStats.h"
+#include "host_hal.h"
+#include "logs.h"
+#include "moistureSensor.h"
+#include "plant_model.h"
+#include "pumps.h"
+#include "rtc.h"
+#include "runoffSensor.h"
+#include "soilTempSensor.h"
+
+#include <Arduino.h>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Runs the firmware's control loop (feeding, baseline, sensors, logs and
+// config) against plant_model.cpp on the manual clock, so weeks of
+// operation take seconds. The clock jumps straight to the next moment the
+// loop has work, as light sleep does on the device, and steps finely while
+// the probe samples or a feed runs. One row is printed per calendar day.
+
+static const int kDefaultDays = 30;
+static const uint32_t kFeedStepMs = 100;
+static const uint32_t kMinStepMs = SENSOR_SAMPLE_INTERVAL;
+static const uint32_t kMaxStepMs = 60000;
+static const float kDefaultStartPercent = 55.0f;
+
+struct DaySummary {
+  EpochTime day_start;
+  uint16_t feeds;
+  uint16_t refusals;
+  uint16_t runoff_warnings;
+  uint16_t runoff_events;
+  float pumped_ml;
+  uint32_t logged_ml;
+  float drained_ml;
+  float transpired_ml;
+  float min_percent;
+  float max_percent;
+};
+
+struct RunTotals {
+  uint32_t days;
+  uint32_t feeds;
+  uint32_t refusals;
+  uint32_t runoff_events;
+  uint32_t dry_days;
+  uint32_t idle_days;
+  float min_percent;
+};
+
+static uint16_t g_last_seen_seq = 0;
+
+/*
+ * now_us
+ * Returns a monotonic wall-clock timestamp in microseconds.
+ * Example:
+ *   uint64_t start = now_us();
+ */
+static uint64_t now_us() {
+  auto since = std::chrono::steady_clock::now().time_since_epoch();
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(since).count());
+}
+
+/*
+ * pump_on
+ * Returns true while the inlet pump is driven (active low).
+ * Example:
+ *   plant_step(step, pump_on(), minute, age);
+ */
+static bool pump_on() {
+  return host_pin_level(PUMP_IN_DEVICE) == LOW;
+}
+
+/*
+ * boot_firmware
+ * Brings the control core up in sim_init() order on a blank flash, with
+ * the example INIT/SOAK/REC schedule and the RTC at start.
+ * Example:
+ *   boot_firmware(epochFromFields(25, 3, 1, 5, 0, 0));
+ */
+static void boot_firmware(EpochTime start) {
+  host_fs_reset();
+  host_pin_reset();
+  host_rtc_set_present(true);
+  host_rtc_set_epoch(start);
+  host_pin_set_analog_source(SOIL_MOISTURE_SENSOR_PIN, plant_probe_raw);
+
+  initConfig();
+  initRtc();
+  initRunoffSensor();
+  initPumps();
+  initMoistureSensor();
+  initSoilTempSensor();
+  if (seedDefaultSlotsIfEmpty()) flushConfig();
+  flashStatsInit();
+  logs_init();
+
+  feedingInit();
+  feedingBaselineInit();
+  setSoilSensorLazy();
+  controlLoopInit();
+  add_log(build_boot_log());
+  g_last_seen_seq = g_logs[0].seq;
+}
+
+/*
+ * collect_logs
+ * Folds log entries written since the last call into the day's counts.
+ * Example:
+ *   collect_logs(&today);
+ */
+static void collect_logs(DaySummary *day) {
+  int fresh = 0;
+  while (fresh < g_log_count && g_logs[fresh].seq != g_last_seen_seq) fresh++;
+  for (int i = fresh - 1; i >= 0; --i) {
+    const LogEntry &entry = g_logs[i];
+    if (entry.entryType != 1) continue;
+    bool refused = entry.feedMl == 0 && (entry.stopReason == LOG_STOP_MAX_DAILY_FEED_REACHED ||
+                                         entry.stopReason == LOG_STOP_FEED_NOT_CALIBRATED);
+    if (refused) {
+      day->refusals++;
+      continue;
+    }
+    day->feeds++;
+    day->logged_ml += entry.feedMl;
+    if (entry.flags & LOG_FLAG_RUNOFF_ANY) day->runoff_warnings++;
+  }
+  if (g_log_count > 0) g_last_seen_seq = g_logs[0].seq;
+}
+
+/*
+ * start_day
+ * Opens a new summary row at the day containing now.
+ * Example:
+ *   start_day(&today, now);
+ */
+static void start_day(DaySummary *day, EpochTime now) {
+  const PlantState &state = plant_state();
+  *day = {};
+  day->day_start = now - now % kEpochSecondsPerDay;
+  day->pumped_ml = -state.pumped_ml;
+  day->drained_ml = -state.drained_ml;
+  day->transpired_ml = -state.transpired_ml;
+  day->min_percent = plant_moisture_percent();
+  day->max_percent = day->min_percent;
+}
+
+/*
+ * finish_day
+ * Closes the running totals and prints the row.
+ * Example:
+ *   finish_day(&today, &totals, wilting_percent);
+ */
+static void finish_day(DaySummary *day, RunTotals *totals, float wilting_percent) {
+  const PlantState &state = plant_state();
+  day->pumped_ml += state.pumped_ml;
+  day->drained_ml += state.drained_ml;
+  day->transpired_ml += state.transpired_ml;
+
+  EpochFields date = epochToFields(day->day_start);
+  bool dry = day->min_percent <= wilting_percent;
+  printf("%3u  20%02u-%02u-%02u %5u %7u %8.0f %9u %7u %8.0f %7.0f %5.1f %5.1f %5u%s\n",
+         static_cast<unsigned>(totals->days + 1), date.year, date.month, date.day, day->feeds, day->refusals,
+         day->pumped_ml, static_cast<unsigned>(day->logged_ml), day->runoff_events, day->drained_ml,
+         day->transpired_ml, day->min_percent, day->max_percent, day->runoff_warnings, dry ? "  DRY" : "");
+
+  totals->days++;
+  totals->feeds += day->feeds;
+  totals->refusals += day->refusals;
+  totals->runoff_events += day->runoff_events;
+  if (dry) totals->dry_days++;
+  if (day->feeds == 0) totals->idle_days++;
+  if (day->min_percent < totals->min_percent) totals->min_percent = day->min_percent;
+}
+
+/*
+ * usage
+ * Prints the command line help.
+ * Example:
+ *   usage(argv[0]);
+ */
+static void usage(const char *argv0) {
+  printf("usage: %s [--days N] [--seed N] [--start-percent P] [--et-ml-h ML] [--check] [-v]\n", argv0);
+  printf("  --days N           virtual days to run (default %d)\n", kDefaultDays);
+  printf("  --seed N           probe noise seed (default 1)\n");
+  printf("  --start-percent P  root-zone moisture at boot (default %.0f)\n", kDefaultStartPercent);
+  printf("  --et-ml-h ML       transpiration under the lights on day 0\n");
+  printf("  --check            exit 1 if the pot reached wilting point or a day had no feed\n");
+  printf("  -v                 keep the firmware's [TAG] serial lines\n");
+}
+
+int main(int argc, char **argv) {
+  int days = kDefaultDays;
+  uint32_t seed = 1;
+  float start_percent = kDefaultStartPercent;
+  bool check = false;
+  bool verbose = false;
+  PlantParams params = plant_default_params();
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--days") == 0 && i + 1 < argc) {
+      days = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+      seed = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+    } else if (strcmp(argv[i], "--start-percent") == 0 && i + 1 < argc) {
+      start_percent = static_cast<float>(atof(argv[++i]));
+    } else if (strcmp(argv[i], "--et-ml-h") == 0 && i + 1 < argc) {
+      params.et_lights_ml_h = static_cast<float>(atof(argv[++i]));
+    } else if (strcmp(argv[i], "--check") == 0) {
+      check = true;
+    } else if (strcmp(argv[i], "-v") == 0) {
+      verbose = true;
+    } else {
+      usage(argv[0]);
+      return 2;
+    }
+  }
+  if (days < 1) days = 1;
+
+  Serial.enabled = verbose;
+  host_clock_set_manual(true);
+  // Boot an hour before lights-on so the first day starts with the SOAK.
+  EpochTime start = epochFromFields(25, 3, 1, 5, 0, 0);
+  boot_firmware(start);
+  params.lights_on_min = config.lightsOnMinutes;
+  params.lights_off_min = config.lightsOffMinutes;
+  params.probe_raw_dry = config.moistSensorCalibrationDry;
+  params.probe_raw_wet = config.moistSensorCalibrationSoaked;
+  plant_init(params, start_percent, seed);
+  float wilting_percent = params.wilting_ml * 100.0f / params.saturation_ml;
+
+  printf("day  date       feeds refused pumped_ml logged_ml runoffs drain_ml  et_ml  min%%  max%%  warn\n");
+  DaySummary today = {};
+  RunTotals totals = {};
+  totals.min_percent = 100.0f;
+  start_day(&today, start);
+  bool runoff_was = false;
+  uint64_t run_ms = static_cast<uint64_t>(days) * kEpochSecondsPerDay * 1000ULL;
+  uint64_t started_ms = host_clock_ms();
+  uint64_t wall_start = now_us();
+  uint64_t steps = 0;
+
+  while (host_clock_ms() - started_ms < run_ms) {
+    uint32_t step = kFeedStepMs;
+    if (!feedingIsActive()) {
+      step = controlLoopIdleMs();
+      if (step < kMinStepMs) step = kMinStepMs;
+      if (step > kMaxStepMs) step = kMaxStepMs;
+    }
+
+    EpochTime rtc = host_rtc_epoch();
+    uint16_t minute = epochMinuteOfDay(rtc);
+    float age_days = static_cast<float>(host_clock_ms() - started_ms) / (kEpochSecondsPerDay * 1000.0f);
+    plant_step(step, pump_on(), minute, age_days);
+    host_clock_advance_ms(step);
+    bool runoff = plant_runoff();
+    host_pin_set_input(RUNOFF_SENSOR_PIN, runoff ? LOW : HIGH);
+    host_soil_temp_set(true, plant_soil_temp_deci_c(minute));
+    if (runoff && !runoff_was) today.runoff_events++;
+    runoff_was = runoff;
+
+    EpochTime now = EPOCH_UNSET;
+    rtcReadEpoch(&now);
+    controlLoopTick(now);
+    steps++;
+
+    collect_logs(&today);
+    float pct = plant_moisture_percent();
+    if (pct < today.min_percent) today.min_percent = pct;
+    if (pct > today.max_percent) today.max_percent = pct;
+
+    EpochTime day_now = host_rtc_epoch();
+    if (day_now - today.day_start >= kEpochSecondsPerDay) {
+      finish_day(&today, &totals, wilting_percent);
+      start_day(&today, day_now);
+    }
+  }
+
+  double wall_s = (now_us() - wall_start) / 1e6;
+  FlashWearStats wear = {};
+  flashStatsGetWear(&wear);
+  printf("%u days: %u feeds, %u refused, %u runoff events, min moisture %.1f%% (wilting %.1f%%)\n",
+         static_cast<unsigned>(totals.days), static_cast<unsigned>(totals.feeds),
+         static_cast<unsigned>(totals.refusals), static_cast<unsigned>(totals.runoff_events), totals.min_percent,
+         wilting_percent);
+  // The average skips the boot day, whose log file format dwarfs a normal day.
+  printf("flash: %u blocks erased, ~%u/day after boot | logs written %u | soil sensor %s\n",
+         static_cast<unsigned>(wear.lifetimeEraseBlocks), static_cast<unsigned>(wear.avgDailyEraseBlocks),
+         static_cast<unsigned>(getAbsoluteLogNumber()),
+         soilSensorHealth() == SENSOR_OK ? "ok" : (soilSensorHealth() == SENSOR_SUSPECT ? "suspect" : "FAILED"));
+  printf("ran %.2f s wall for %d virtual days (%.0fx real time, %llu loop passes)\n", wall_s, days,
+         wall_s > 0 ? (run_ms / 1000.0) / wall_s : 0.0, static_cast<unsigned long long>(steps));
+
+  if (!check) return 0;
+  bool failed = false;
+  if (totals.dry_days) {
+    printf("check: pot reached wilting point on %u day(s)\n", static_cast<unsigned>(totals.dry_days));
+    failed = true;
+  }
+  if (totals.idle_days) {
+    printf("check: %u day(s) without a feed\n", static_cast<unsigned>(totals.idle_days));
+    failed = true;
+  }
+  if (soilSensorHealth() == SENSOR_FAILED) {
+    printf("check: soil sensor ended up failed\n");
+    failed = true;
+  }
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,40 @@
+#include "core_stubs.h"
+
+#include "logs.h"
+#include "soilTempSensor.h"
+
+// Owned by app_state.cpp on the device, which the core build leaves out.
+LogEntry g_logs[kMaxLogs] = {};
+LogEntry newLogEntry = {};
+int g_log_count = 0;
+int g_log_index = 0;
+unsigned long int millisAtEndOfLastFeed = 0;
+uint16_t lastFeedMl = 0;
+
+static bool g_temp_present = false;
+static int16_t g_temp_deci_c = SOIL_TEMP_REFERENCE_DECI_C;
+
+void host_soil_temp_set(bool present, int16_t deciC) {
+  g_temp_present = present;
+  g_temp_deci_c = deciC;
+}
+
+void initSoilTempSensor() {}
+
+void runSoilTempSensor() {}
+
+uint32_t soilTempIdleMs() {
+  return SOIL_TEMP_READ_INTERVAL;
+}
+
+bool soilTempReady() {
+  return g_temp_present;
+}
+
+bool soilTempPresent() {
+  return g_temp_present;
+}
+
+int16_t getSoilTempDeciC() {
+  return g_temp_deci_c;
+}
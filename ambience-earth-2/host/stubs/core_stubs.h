@@ -0,0 +1,15 @@
+#pragma once
+
+#include <stdint.h>
+
+// The control core links every firmware module it can; the DS18B20 driver
+// bit-bangs 1-Wire with microsecond timing and a critical section, so the
+// host gets this model instead. Tests and benchmarks set what it reports.
+
+/*
+ * host_soil_temp_set
+ * Sets whether a probe is present and the temperature it reports.
+ * Example:
+ *   host_soil_temp_set(true, 180);
+ */
+void host_soil_temp_set(bool present, int16_t deciC);
@@ -0,0 +1,412 @@
+#include "host_stubs.h"
+
+#include "config.h"
+#include "flashStats.h"
+#include "logs.h"
+#include "loopPacing.h"
+#include "moistureSensor.h"
+#include "platform_display.h"
+#include "pumps.h"
+#include "rtc.h"
+#include "runoffSensor.h"
+#include "sim.h"
+#include "soilTempSensor.h"
+#include <string.h>
+
+// Stand-ins for the hardware, storage and feeding modules the UI calls into.
+// They report whatever g_host / g_sim hold; nothing touches pins or flash.
+
+static const uint16_t kStubRawSoaked = 300;
+static const uint16_t kStubRawDry = 900;
+static const uint8_t kStubFeedHourOfDay = 8;
+static const uint8_t kStubMoistureAfterFeed = 68;
+static const uint8_t kStubMoistureFloor = 45;
+
+HostStubs g_host = {};
+Config config;
+
+/*
+ * raw_for_percent
+ * Returns the raw sensor reading that maps to percent under the stub calibration.
+ * Example:
+ *   g_host.soilRaw = raw_for_percent(55);
+ */
+static uint16_t raw_for_percent(int percent) {
+  return static_cast<uint16_t>(kStubRawDry - (percent * (kStubRawDry - kStubRawSoaked)) / 100);
+}
+
+/*
+ * stub_history_moisture
+ * Synthetic hourly moisture: a daily feed at kStubFeedHourOfDay followed by
+ * a linear dryback.
+ * Example:
+ *   uint8_t m = stub_history_moisture(hour);
+ */
+static uint8_t stub_history_moisture(uint32_t hour) {
+  uint32_t since_feed = (hour + 24u - kStubFeedHourOfDay) % 24u;
+  int moisture = kStubMoistureAfterFeed - static_cast<int>(since_feed);
+  return static_cast<uint8_t>(moisture < kStubMoistureFloor ? kStubMoistureFloor : moisture);
+}
+
+/*
+ * seed_slot
+ * Fills one schedule slot with a plausible configuration.
+ * Example:
+ *   seed_slot(0, "Morning", 8, 500);
+ */
+static void seed_slot(int index, const char *name, int start_hour, int max_ml) {
+  Slot &slot = g_slots[index];
+  slot = {};
+  slot.enabled = true;
+  strncpy(slot.name, name, sizeof(slot.name) - 1);
+  slot.use_window = true;
+  slot.start_hour = start_hour;
+  slot.start_min = 0;
+  slot.window_duration_min = 60;
+  slot.start_mode = MODE_PERCENT;
+  slot.start_value = 50;
+  slot.target_mode = MODE_PERCENT;
+  slot.target_value = 68;
+  slot.max_ml = max_ml;
+  slot.stop_on_runoff = true;
+  slot.runoff_mode = RUNOFF_NEITHER;
+  slot.min_gap_min = 60;
+}
+
+void host_stubs_init() {
+  memset(&config, 0, sizeof(config));
+  config.version = CONFIG_VERSION;
+  config.flags = CONFIG_FLAG_DRIPPER_CALIBRATED | CONFIG_FLAG_TIME_SET | CONFIG_FLAG_LIGHTS_ON_SET |
+                 CONFIG_FLAG_LIGHTS_OFF_SET | CONFIG_FLAG_MAX_DAILY_SET;
+  config.moistSensorCalibrationSoaked = kStubRawSoaked;
+  config.moistSensorCalibrationDry = kStubRawDry;
+  config.dripperMsPerLiter = 600000;
+  config.lightsOnMinutes = 6 * 60;
+  config.lightsOffMinutes = 0;
+  config.maxDailyWaterMl = 1000;
+  config.pulseOnSeconds = 10;
+  config.pulseOffSeconds = 5;
+  config.pulseTargetUnits = 20;
+  config.baselineX = 10;
+  config.baselineY = 5;
+  config.baselineDelayMinutes = 1;
+
+  g_sim = {};
+  g_sim.now = epochFromFields(25, 6, 14, 13, 37, 0);
+  g_sim.moisture = 55;
+  g_sim.moisture_raw = raw_for_percent(g_sim.moisture);
+  g_sim.moisture_raw_dry = kStubRawDry;
+  g_sim.moisture_raw_wet = kStubRawSoaked;
+  g_sim.dripper_ml_per_hour = 6000;
+  g_sim.sensor_health = SENSOR_OK;
+  g_sim.soil_temp_ready = true;
+  g_sim.soil_temp_deci_c = 215;
+  g_setup = {true, true, true, true, true};
+
+  seed_slot(0, "Morning", kStubFeedHourOfDay, 500);
+  seed_slot(1, "Top-up", 16, 250);
+  g_slots[1].enabled = false;
+
+  g_host = {};
+  g_host.feedingEnabled = true;
+  g_host.baselineSet = true;
+  g_host.baselinePercent = 62;
+  g_host.drybackPercent = 13;
+  g_host.dailyTotalMl = 450;
+  g_host.dayMinPercent = 52;
+  g_host.dayMaxPercent = kStubMoistureAfterFeed;
+  g_host.soilRaw = static_cast<uint16_t>(g_sim.moisture_raw);
+  g_host.feedStatus.slotIndex = 0;
+  g_host.feedStatus.pumpOn = true;
+  g_host.feedStatus.moistureReady = true;
+  g_host.feedStatus.moisturePercent = static_cast<uint8_t>(g_sim.moisture);
+  g_host.feedStatus.hasMoistureTarget = true;
+  g_host.feedStatus.moistureTarget = kStubMoistureAfterFeed;
+  g_host.feedStatus.maxVolumeMl = 500;
+
+  millisAtEndOfLastFeed = 1;
+  lastFeedMl = 450;
+
+  logs_wipe();
+  for (int i = 0; i < 6; ++i) {
+    LogEntry entry = {};
+    entry.entryType = (i % 3 == 0) ? 1 : 2;
+    entry.slotIndex = 0;
+    entry.soilMoistureBefore = static_cast<uint8_t>(50 + i);
+    entry.soilMoistureAfter = (entry.entryType == 1) ? kStubMoistureAfterFeed : 0;
+    entry.baselinePercent = g_host.baselinePercent;
+    entry.drybackPercent = g_host.drybackPercent;
+    entry.feedMl = (entry.entryType == 1) ? 450 : 0;
+    entry.soilTempDeciC = static_cast<int16_t>(200 + i * 3);
+    entry.startTime = g_sim.now - static_cast<uint32_t>(6 - i) * kEpochSecondsPerHour;
+    entry.endTime = entry.startTime + ((entry.entryType == 1) ? 270u : 0u);
+    add_log(entry);
+  }
+}
+
+void host_stubs_advance(uint32_t seconds) {
+  g_sim.now += seconds;
+  g_sim.uptime_sec += seconds;
+  g_sim.moisture = (g_sim.moisture <= kStubMoistureFloor) ? kStubMoistureAfterFeed : g_sim.moisture - 1;
+  g_sim.moisture_raw = raw_for_percent(g_sim.moisture);
+  g_sim.soil_temp_deci_c = 200 + (g_sim.soil_temp_deci_c - 199) % 50;
+  g_host.soilRaw = static_cast<uint16_t>(g_sim.moisture_raw);
+  g_host.drybackPercent = static_cast<uint8_t>(kStubMoistureAfterFeed - g_sim.moisture);
+  g_host.dailyTotalMl = static_cast<uint16_t>(g_host.dailyTotalMl + 5);
+  g_host.feedStatus.moisturePercent = static_cast<uint8_t>(g_sim.moisture);
+  g_host.feedStatus.elapsedSeconds = static_cast<uint16_t>(g_host.feedStatus.elapsedSeconds + seconds);
+  g_host.feedStatus.pumpOn = !g_host.feedStatus.pumpOn;
+  g_host.historyRevision++;
+  g_host.historyChangedHour = epochHours(g_sim.now);
+}
+
+void saveConfig() {
+  g_host.configSaves++;
+}
+
+void markConfigDirty(uint16_t) {}
+
+void flushConfig() {}
+
+void feedingTick() {}
+
+bool feedingIsActive() {
+  return g_host.feedingActive;
+}
+
+bool feedingRunoffWarning() {
+  return g_host.runoffWarning;
+}
+
+void feedingClearRunoffWarning() {
+  g_host.runoffWarning = false;
+}
+
+bool feedingIsEnabled() {
+  return g_host.feedingEnabled;
+}
+
+void feedingSetEnabled(bool enabled) {
+  g_host.feedingEnabled = enabled;
+}
+
+void feedingPauseForUi() {}
+
+void feedingResumeAfterUi() {}
+
+void feedingForceFeed(uint8_t slotIndex) {
+  g_host.feedingActive = true;
+  g_host.feedStatus.slotIndex = slotIndex;
+  g_host.feedStatus.elapsedSeconds = 0;
+}
+
+bool feedingGetBaselinePercent(uint8_t *outPercent) {
+  if (!g_host.baselineSet) return false;
+  if (outPercent) *outPercent = g_host.baselinePercent;
+  return true;
+}
+
+bool feedingGetStatus(FeedStatus *outStatus) {
+  if (!g_host.feedingActive) return false;
+  if (outStatus) {
+    *outStatus = g_host.feedStatus;
+    outStatus->active = true;
+  }
+  return true;
+}
+
+void logs_wipe() {
+  memset(g_logs, 0, sizeof(g_logs));
+  g_log_count = 0;
+  g_log_index = 0;
+}
+
+void add_log(const LogEntry &entry) {
+  int count = (g_log_count < kMaxLogs) ? g_log_count + 1 : kMaxLogs;
+  for (int i = count - 1; i > 0; --i) {
+    g_logs[i] = g_logs[i - 1];
+  }
+  g_logs[0] = entry;
+  g_logs[0].seq = static_cast<uint16_t>((g_log_count > 0 ? g_logs[1].seq : 0) + 1);
+  g_log_count = count;
+}
+
+LogEntry build_boot_log() {
+  LogEntry entry = {};
+  entry.soilMoistureBefore = static_cast<uint8_t>(g_sim.moisture);
+  entry.baselinePercent = LOG_BASELINE_UNSET;
+  entry.soilTempDeciC = LOG_SOIL_TEMP_UNSET;
+  entry.startTime = g_sim.now;
+  return entry;
+}
+
+uint16_t getDailyFeedTotalMlNow(uint8_t *outMin, uint8_t *outMax) {
+  if (outMin) *outMin = g_host.dayMinPercent;
+  if (outMax) *outMax = g_host.dayMaxPercent;
+  return g_host.dailyTotalMl;
+}
+
+bool getDrybackPercent(uint8_t *outPercent) {
+  if (outPercent) *outPercent = g_host.drybackPercent;
+  return true;
+}
+
+bool getMoistureHistoryHour(uint32_t hour, uint8_t *outMoisture, uint16_t *outFeedMl) {
+  uint32_t now_hour = epochHours(g_sim.now);
+  if (hour > now_hour || now_hour - hour >= LOG_HISTORY_HOURS) return false;
+  if (outMoisture) {
+    *outMoisture = (hour == now_hour) ? static_cast<uint8_t>(g_sim.moisture) : stub_history_moisture(hour);
+  }
+  if (outFeedMl) {
+    *outFeedMl = (hour % 24u == kStubFeedHourOfDay) ? static_cast<uint16_t>(350u + (hour / 24u % 3u) * 50u) : 0;
+  }
+  return true;
+}
+
+uint16_t getMoistureHistoryRevision(uint32_t *outChangedHour) {
+  if (outChangedHour) *outChangedHour = g_host.historyChangedHour;
+  return g_host.historyRevision;
+}
+
+void setSoilSensorLazy() {}
+
+void setSoilSensorRealTime() {}
+
+uint16_t getSoilMoisture() {
+  return g_host.soilRaw;
+}
+
+uint16_t soilSensorGetRealtimeRaw() {
+  return g_host.soilRaw;
+}
+
+void soilSensorWindowStart() {}
+
+bool soilSensorWindowTick(SoilSensorWindowStats *out) {
+  if (out) {
+    out->minRaw = static_cast<uint16_t>(g_host.soilRaw - 4);
+    out->maxRaw = static_cast<uint16_t>(g_host.soilRaw + 4);
+    out->avgRaw = g_host.soilRaw;
+    out->count = static_cast<uint16_t>(SENSOR_CAL_WINDOW_DURATION / SENSOR_SAMPLE_INTERVAL);
+  }
+  return true;
+}
+
+uint16_t soilSensorWindowLastRaw() {
+  return g_host.soilRaw;
+}
+
+uint32_t soilSensorCalWindowRemainingMs() {
+  return 0;
+}
+
+uint8_t soilMoistureAsPercentage(uint16_t soilMoisture) {
+  int32_t dry = config.moistSensorCalibrationDry;
+  int32_t soaked = config.moistSensorCalibrationSoaked;
+  if (dry == soaked) return 0;
+  int32_t percent = ((dry - static_cast<int32_t>(soilMoisture)) * 100) / (dry - soaked);
+  if (percent < 0) percent = 0;
+  if (percent > 100) percent = 100;
+  return static_cast<uint8_t>(percent);
+}
+
+SoilSensorHealth soilSensorHealth() {
+  return static_cast<SoilSensorHealth>(g_sim.sensor_health);
+}
+
+bool soilTempReady() {
+  return g_sim.soil_temp_ready;
+}
+
+bool soilTempPresent() {
+  return g_sim.soil_temp_ready;
+}
+
+int16_t getSoilTempDeciC() {
+  return static_cast<int16_t>(g_sim.soil_temp_deci_c);
+}
+
+bool runoffDetected() {
+  return g_host.runoff;
+}
+
+void openLineIn() {}
+
+void closeLineIn() {}
+
+bool rtcReadEpoch(EpochTime *outTime) {
+  if (outTime) *outTime = g_sim.now;
+  return g_sim.now != EPOCH_UNSET;
+}
+
+bool rtcSetDateTime(uint8_t hour, uint8_t minute, uint8_t second, uint8_t day, uint8_t month, uint8_t year) {
+  if (!epochFieldsValid(year, month, day, hour, minute, second)) return false;
+  g_sim.now = epochFromFields(year, month, day, hour, minute, second);
+  return true;
+}
+
+bool rtcIsWithinWindow(uint16_t nowMinutes, uint16_t startMinutes, uint16_t durationMinutes) {
+  if (durationMinutes == 0) return false;
+  if (durationMinutes > 1439) durationMinutes = 1439;
+  if (startMinutes > 1439) startMinutes = 1439;
+  uint16_t endMinutes = static_cast<uint16_t>(startMinutes + durationMinutes);
+  if (endMinutes >= 1440) endMinutes = static_cast<uint16_t>(endMinutes - 1440);
+  if (startMinutes <= endMinutes) {
+    return nowMinutes >= startMinutes && nowMinutes < endMinutes;
+  }
+  return nowMinutes >= startMinutes || nowMinutes < endMinutes;
+}
+
+void sim_tick() {}
+
+uint32_t sim_idle_ms() {
+  return LOOP_PACING_IDLE_MAX_MS;
+}
+
+void sim_factory_reset() {
+  host_stubs_init();
+}
+
+uint32_t platform_touch_i2c_reads() {
+  return 0;
+}
+
+void platform_display_frame_stats(uint32_t *lastUs, uint32_t *maxUs, uint32_t *frames, uint32_t *spiBusyUs) {
+  if (lastUs) *lastUs = 0;
+  if (maxUs) *maxUs = 0;
+  if (frames) *frames = 0;
+  if (spiBusyUs) *spiBusyUs = 0;
+}
+
+const FlashIoCounters &flashStatsFile(FlashFile) {
+  static const FlashIoCounters kCounters = {6, 40, 1200, 12, 720, 12, 96};
+  return kCounters;
+}
+
+const FlashIoCounters &flashStatsTag(FlashTag) {
+  static const FlashIoCounters kCounters = {3, 20, 600, 6, 360, 6, 48};
+  return kCounters;
+}
+
+void flashStatsGetWear(FlashWearStats *out) {
+  if (!out) return;
+  *out = {};
+  out->partitionBlocks = 352;
+  out->lifetimeEraseBlocks = 120000;
+  out->todayEraseBlocks = 96;
+  out->todayWriteBytes = 720;
+  out->avgDailyEraseBlocks = 1100;
+  out->daysTracked = 7;
+  out->budgetLeftPermille = 996;
+  out->daysLeft = 31890;
+}
+
+const char *flashStatsFileName(FlashFile file) {
+  static const char *kNames[] = {"logs", "config", "stats"};
+  return file < FLASH_FILE_COUNT ? kNames[file] : "?";
+}
+
+const char *flashStatsTagName(FlashTag tag) {
+  static const char *kNames[] = {"entry", "head", "meta", "patch", "format", "config", "stats"};
+  return tag < FLASH_TAG_COUNT ? kNames[tag] : "?";
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "app_state.h"
+#include "feeding.h"
+
+// Values the stubbed sensor/feeding/log modules report. Host programs seed
+// them with host_stubs_init() and poke them directly to drive UI updates.
+struct HostStubs {
+  bool feedingEnabled;
+  bool feedingActive;
+  FeedStatus feedStatus;
+  bool runoff;
+  bool runoffWarning;
+  bool baselineSet;
+  uint8_t baselinePercent;
+  uint8_t drybackPercent;
+  uint16_t dailyTotalMl;
+  uint8_t dayMinPercent;
+  uint8_t dayMaxPercent;
+  uint16_t soilRaw;
+  uint16_t historyRevision;
+  uint32_t historyChangedHour;
+  uint32_t configSaves;
+};
+
+extern HostStubs g_host;
+
+/*
+ * host_stubs_init
+ * Seeds config, g_sim, slots, logs and stub values with a calibrated,
+ * mid-cycle plant so every screen has realistic content.
+ * Example:
+ *   host_stubs_init();
+ */
+void host_stubs_init();
+
+/*
+ * host_stubs_advance
+ * Moves the stub clock forward and perturbs sensor and feed values so the
+ * next update_active_screen() has label, chart and status changes to apply.
+ * Example:
+ *   host_stubs_advance(60);
+ */
+void host_stubs_advance(uint32_t seconds);
@@ -0,0 +1,49 @@
+#include "host_test.h"
+
+#include <Arduino.h>
+
+#include "host_hal.h"
+
+namespace {
+struct HostTestCase {
+  const char *name;
+  HostTestFn fn;
+};
+
+constexpr int kMaxTests = 64;
+static HostTestCase g_tests[kMaxTests];
+static int g_test_count = 0;
+static int g_failures = 0;
+} // namespace
+
+HostTestRegistrar::HostTestRegistrar(const char *name, HostTestFn fn) {
+  if (g_test_count < kMaxTests) g_tests[g_test_count++] = {name, fn};
+}
+
+void host_test_fail(const char *file, int line, const char *expr) {
+  printf("    FAIL %s:%d: %s\n", file, line, expr);
+  g_failures++;
+}
+
+/*
+ * main
+ * Runs every registered test on the manual clock with firmware logging
+ * silenced; pass -v to keep the [TAG] lines.
+ * Example:
+ *   ./test_logs -v
+ */
+int main(int argc, char **argv) {
+  bool verbose = argc > 1 && strcmp(argv[1], "-v") == 0;
+  Serial.enabled = verbose;
+  host_clock_set_manual(true);
+  int failedTests = 0;
+  for (int i = 0; i < g_test_count; ++i) {
+    int before = g_failures;
+    g_tests[i].fn();
+    bool ok = g_failures == before;
+    if (!ok) failedTests++;
+    printf("%s %s\n", ok ? "ok  " : "FAIL", g_tests[i].name);
+  }
+  printf("%d/%d passed\n", g_test_count - failedTests, g_test_count);
+  return failedTests ? 1 : 0;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+// Tiny test registry for the host build: HOST_TEST bodies run in
+// declaration order, CHECK failures are counted and printed, and the
+// process exits non-zero if any failed so ctest reports it.
+
+#include <stdint.h>
+#include <stdio.h>
+
+typedef void (*HostTestFn)();
+
+struct HostTestRegistrar {
+  HostTestRegistrar(const char *name, HostTestFn fn);
+};
+
+/*
+ * host_test_fail
+ * Records one failed check with its location.
+ * Example:
+ *   host_test_fail(__FILE__, __LINE__, "x == 1");
+ */
+void host_test_fail(const char *file, int line, const char *expr);
+
+#define HOST_TEST(name)                                         \
+  static void name();                                           \
+  static HostTestRegistrar name##_registrar(#name, name);       \
+  static void name()
+
+#define CHECK(expr)                                             \
+  do {                                                          \
+    if (!(expr)) host_test_fail(__FILE__, __LINE__, #expr);     \
+  } while (0)
+
+#define CHECK_EQ(actual, expected)                                                          \
+  do {                                                                                      \
+    long long check_actual = static_cast<long long>(actual);                                \
+    long long check_expected = static_cast<long long>(expected);                            \
+    if (check_actual != check_expected) {                                                   \
+      printf("    %s = %lld, expected %lld\n", #actual, check_actual, check_expected);      \
+      host_test_fail(__FILE__, __LINE__, #actual " == " #expected);                         \
+    }                                                                                       \
+  } while (0)
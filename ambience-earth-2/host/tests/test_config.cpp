@@ -0,0 +1,242 @@
+#include "host_test.h"
+
+#include <Arduino.h>
+#include <LittleFS.h>
+
+#include "config.h"
+#include "flashStats.h"
+#include "host_hal.h"
+
+// A/B records, torn writes, layout migration and the save debounce.
+
+static const char *kSlotA = "/config_a.bin";
+static const char *kSlotB = "/config_b.bin";
+
+// Layout of CONFIG_VERSION 17 as units in the field still have it.
+struct LegacyConfigV17 {
+  uint8_t checksum;
+  uint8_t version;
+  uint8_t flags;
+  uint16_t moistSensorCalibrationSoaked;
+  uint16_t moistSensorCalibrationDry;
+  uint32_t dripperMsPerLiter;
+  uint16_t lightsOnMinutes;
+  uint16_t lightsOffMinutes;
+  uint16_t maxDailyWaterMl;
+  uint8_t pulseOnSeconds;
+  uint8_t pulseOffSeconds;
+  uint8_t pulseTargetUnits;
+  uint8_t baselineX;
+  uint8_t baselineY;
+  uint8_t baselineDelayMinutes;
+  uint8_t runoffExpectation[FEED_SLOT_COUNT];
+  uint16_t kbdUp;
+  uint16_t kbdDown;
+  uint16_t kbdLeft;
+  uint16_t kbdRight;
+  uint16_t kbdOk;
+  char feedSlotNames[FEED_SLOT_COUNT][FEED_SLOT_NAME_LENGTH + 1];
+  uint8_t feedSlotsPacked[FEED_SLOT_COUNT][FEED_SLOT_PACKED_SIZE];
+};
+
+/*
+ * write_legacy
+ * Stores bytes as the pre-A/B /config.bin with its XOR checksum in byte 0.
+ * Example:
+ *   write_legacy(&old, sizeof(old));
+ */
+static void write_legacy(void *bytes, size_t len) {
+  uint8_t *data = static_cast<uint8_t *>(bytes);
+  uint8_t hash = 0xA5;
+  for (size_t i = 1; i < len; ++i) hash ^= data[i];
+  data[0] = hash;
+  File f = LittleFS.open("/config.bin", "w");
+  f.write(data, len);
+  f.close();
+}
+
+/*
+ * config_writes
+ * Returns how many config writes reached flash so far.
+ * Example:
+ *   uint32_t before = config_writes();
+ */
+static uint32_t config_writes() {
+  return flashStatsTag(FLASH_TAG_CONFIG).writes;
+}
+
+/*
+ * newest_slot
+ * Returns the path of the record with the higher sequence number.
+ * Example:
+ *   uint8_t *bytes = host_fs_file_data(newest_slot());
+ */
+static const char *newest_slot() {
+  uint32_t seqA = 0;
+  uint32_t seqB = 0;
+  // The sequence number follows the 4-byte magic.
+  if (host_fs_file_size(kSlotA) >= 8) memcpy(&seqA, host_fs_file_data(kSlotA) + 4, sizeof(seqA));
+  if (host_fs_file_size(kSlotB) >= 8) memcpy(&seqB, host_fs_file_data(kSlotB) + 4, sizeof(seqB));
+  return (seqB > seqA) ? kSlotB : kSlotA;
+}
+
+HOST_TEST(empty_flash_gets_defaults_in_slot_a) {
+  host_fs_reset();
+  initConfig();
+  CHECK(host_fs_file_size(kSlotA) > 0);
+  CHECK_EQ(config.version, CONFIG_VERSION);
+  CHECK_EQ(config.maxDailyWaterMl, 1000);
+  CHECK(loadConfig());
+}
+
+HOST_TEST(saves_alternate_and_skip_unchanged_bytes) {
+  host_fs_reset();
+  initConfig();
+  uint32_t before = config_writes();
+  saveConfig();
+  CHECK_EQ(config_writes(), before);
+
+  config.baselineX = 12;
+  saveConfig();
+  CHECK_EQ(config_writes(), before + 1);
+  CHECK(host_fs_file_size(kSlotB) > 0);
+  config.baselineX = 14;
+  saveConfig();
+  config.baselineX = 0;
+  CHECK(loadConfig());
+  CHECK_EQ(config.baselineX, 14);
+}
+
+HOST_TEST(torn_save_keeps_previous_record) {
+  host_fs_reset();
+  initConfig();
+  config.baselineX = 8;
+  saveConfig();
+  config.baselineX = 18;
+  host_fs_set_write_budget(12);
+  saveConfig();
+  host_fs_set_write_budget(SIZE_MAX);
+  config.baselineX = 0;
+  CHECK(loadConfig());
+  CHECK_EQ(config.baselineX, 8);
+}
+
+HOST_TEST(crc_mismatch_falls_back_to_other_slot) {
+  host_fs_reset();
+  initConfig();
+  config.lightsOnMinutes = 300;
+  saveConfig();
+  config.lightsOnMinutes = 420;
+  saveConfig();
+  const char *newest = newest_slot();
+  uint8_t *bytes = host_fs_file_data(newest);
+  CHECK(bytes != nullptr);
+  if (bytes) bytes[host_fs_file_size(newest) - 1] ^= 0x5A;
+  CHECK(loadConfig());
+  CHECK_EQ(config.lightsOnMinutes, 300);
+}
+
+HOST_TEST(v17_config_migrates_without_losing_calibration) {
+  host_fs_reset();
+  LegacyConfigV17 old = {};
+  old.version = 17;
+  old.moistSensorCalibrationSoaked = 333;
+  old.moistSensorCalibrationDry = 777;
+  old.dripperMsPerLiter = 420000;
+  old.lightsOnMinutes = 360;
+  old.lightsOffMinutes = 1080;
+  old.maxDailyWaterMl = 1500;
+  old.baselineX = 6;
+  old.runoffExpectation[2] = 1;
+  old.kbdOk = 42;
+  memcpy(old.feedSlotNames[3], "NIGHT", 6);
+  old.feedSlotsPacked[7][11] = 0x80;
+  write_legacy(&old, sizeof(old));
+
+  initConfig();
+  CHECK_EQ(config.version, CONFIG_VERSION);
+  CHECK_EQ(config.moistSensorCalibrationSoaked, 333);
+  CHECK_EQ(config.moistSensorCalibrationDry, 777);
+  CHECK_EQ(config.maxDailyWaterMl, 1500);
+  CHECK_EQ(config.baselineX, 6);
+  CHECK_EQ(config.moistTempCompPer10C, 0);
+  CHECK_EQ(config.runoffExpectation[2], 1);
+  CHECK_EQ(config.kbdOk, 42);
+  CHECK(strcmp(config.feedSlotNames[3], "NIGHT") == 0);
+  CHECK_EQ(config.feedSlotsPacked[7][11], 0x80);
+  CHECK(!LittleFS.exists("/config.bin"));
+  CHECK(host_fs_file_size(kSlotA) > 0);
+}
+
+HOST_TEST(current_layout_legacy_file_is_adopted) {
+  host_fs_reset();
+  restoreDefaultConfig();
+  config.moistSensorCalibrationDry = 640;
+  config.moistTempCompPer10C = -3;
+  Config copy = config;
+  write_legacy(&copy, sizeof(copy));
+  memset(&config, 0, sizeof(config));
+  initConfig();
+  CHECK_EQ(config.moistSensorCalibrationDry, 640);
+  CHECK_EQ(config.moistTempCompPer10C, -3);
+  CHECK(!LittleFS.exists("/config.bin"));
+}
+
+HOST_TEST(unknown_legacy_version_restores_defaults) {
+  host_fs_reset();
+  uint8_t junk[64] = {};
+  junk[1] = 9;
+  write_legacy(junk, sizeof(junk));
+  initConfig();
+  CHECK_EQ(config.version, CONFIG_VERSION);
+  CHECK_EQ(config.maxDailyWaterMl, 1000);
+}
+
+HOST_TEST(dirty_config_waits_for_quiet_period) {
+  host_fs_reset();
+  initConfig();
+  uint32_t before = config_writes();
+  for (int i = 0; i < 5; ++i) {
+    config.baselineY = static_cast<uint8_t>(i + 10);
+    markConfigDirty(CONFIG_FIELD_BASELINE);
+    host_clock_advance_ms(2000);
+    configTick(millis());
+  }
+  CHECK_EQ(config_writes(), before);
+  CHECK(configIsDirty());
+  CHECK(configSaveIdleMs(millis()) <= CONFIG_SAVE_QUIET_MS);
+  host_clock_advance_ms(CONFIG_SAVE_QUIET_MS);
+  configTick(millis());
+  CHECK_EQ(config_writes(), before + 1);
+  CHECK(!configIsDirty());
+  CHECK_EQ(configSaveIdleMs(millis()), UINT32_MAX);
+}
+
+HOST_TEST(steady_edits_save_by_max_delay) {
+  host_fs_reset();
+  initConfig();
+  uint32_t before = config_writes();
+  for (uint32_t elapsed = 0; elapsed <= CONFIG_SAVE_MAX_DELAY_MS; elapsed += 5000) {
+    config.lightsOffMinutes = static_cast<uint16_t>(1000 + elapsed / 5000);
+    markConfigDirty(CONFIG_FIELD_LIGHTS);
+    configTick(millis());
+    host_clock_advance_ms(5000);
+  }
+  configTick(millis());
+  CHECK_EQ(config_writes(), before + 1);
+}
+
+static uint16_t g_seen_fields = 0;
+
+static void record_fields(uint16_t fields) {
+  g_seen_fields |= fields;
+}
+
+HOST_TEST(listeners_see_changed_fields) {
+  CHECK(addConfigListener(record_fields));
+  g_seen_fields = 0;
+  markConfigDirty(CONFIG_FIELD_SLOTS | CONFIG_FIELD_TIME);
+  CHECK_EQ(g_seen_fields, CONFIG_FIELD_SLOTS | CONFIG_FIELD_TIME);
+  flushConfig();
+  CHECK(!configIsDirty());
+}
@@ -0,0 +1,82 @@
+#include "host_test.h"
+
+#include "feedSlots.h"
+#include "volume.h"
+
+#include <string.h>
+
+// Packed slots live in the config record, so the bit layout is part of the
+// on-flash format; volume conversions decide how long the pump runs.
+
+HOST_TEST(slot_round_trips_every_field) {
+  FeedSlot slot = {};
+  slot.windowStartMinutes = 1439;
+  slot.windowDurationMinutes = 1200;
+  slot.moistureBelow = 127;
+  slot.moistureTarget = 64;
+  slot.minGapMinutes = 4095;
+  slot.maxVolumeMl = 8191;
+  slot.runoffHold5s = 100;
+  slot.flags = FEED_SLOT_ENABLED | FEED_SLOT_HAS_TIME_WINDOW | FEED_SLOT_RUNOFF_AVOID;
+
+  uint8_t packed[FEED_SLOT_PACKED_SIZE];
+  packFeedSlot(packed, &slot);
+  FeedSlot out = {};
+  unpackFeedSlot(&out, packed);
+  CHECK_EQ(out.windowStartMinutes, 1439);
+  CHECK_EQ(out.windowDurationMinutes, 1200);
+  CHECK_EQ(out.moistureBelow, 127);
+  CHECK_EQ(out.moistureTarget, 64);
+  CHECK_EQ(out.minGapMinutes, 4095);
+  CHECK_EQ(out.maxVolumeMl, 8191);
+  CHECK_EQ(out.runoffHold5s, 100);
+  CHECK_EQ(out.flags, slot.flags);
+}
+
+HOST_TEST(slot_pack_is_stable) {
+  // Changing these bytes breaks every stored config; bump CONFIG_VERSION
+  // and add a migration instead.
+  FeedSlot slot = {};
+  slot.windowStartMinutes = 60;
+  slot.windowDurationMinutes = 30;
+  slot.maxVolumeMl = 250;
+  slot.flags = FEED_SLOT_ENABLED | FEED_SLOT_HAS_TIME_WINDOW;
+  uint8_t packed[FEED_SLOT_PACKED_SIZE];
+  packFeedSlot(packed, &slot);
+  const uint8_t expected[FEED_SLOT_PACKED_SIZE] = {0x3C, 0xF0, 0x00, 0x00, 0x00, 0x00,
+                                                   0x00, 0x40, 0x1F, 0x00, 0x06, 0x00};
+  CHECK(memcmp(packed, expected, sizeof(expected)) == 0);
+}
+
+HOST_TEST(slot_fields_are_masked_to_their_width) {
+  FeedSlot slot = {};
+  slot.windowStartMinutes = 0xFFFF;
+  slot.moistureBelow = 0xFF;
+  uint8_t packed[FEED_SLOT_PACKED_SIZE];
+  packFeedSlot(packed, &slot);
+  FeedSlot out = {};
+  unpackFeedSlot(&out, packed);
+  CHECK_EQ(out.windowStartMinutes, 2047);
+  CHECK_EQ(out.moistureBelow, 127);
+  CHECK_EQ(out.windowDurationMinutes, 0);
+  CHECK_EQ(out.moistureTarget, 0);
+}
+
+HOST_TEST(volume_conversions_round_trip) {
+  const uint32_t kRates[] = {50000, 600000, 1234567};
+  for (uint32_t rate : kRates) {
+    for (uint16_t ml = 1; ml < 5000; ml = static_cast<uint16_t>(ml * 3 + 1)) {
+      uint32_t ms = volumeMlToMs(ml, rate);
+      uint16_t back = msToVolumeMl(ms, rate);
+      CHECK(back + 1 >= ml && back <= ml);
+    }
+  }
+}
+
+HOST_TEST(volume_conversions_saturate) {
+  CHECK_EQ(volumeMlToMs(0, 600000), 0);
+  CHECK_EQ(volumeMlToMs(10, 0), 0);
+  CHECK_EQ(volumeMlToMs(1, 999), 1);
+  CHECK_EQ(msToVolumeMl(0xFFFFFFFFUL, 50000), 0xFFFF);
+  CHECK_EQ(msToVolumeMl(600000, 600000), 1000);
+}
@@ -0,0 +1,325 @@
+#include "host_test.h"
+
+#include <Arduino.h>
+
+#include "config.h"
+#include "feedSlots.h"
+#include "feeding.h"
+#include "host_hal.h"
+#include "logs.h"
+#include "moistureSensor.h"
+#include "pumps.h"
+#include "rtc.h"
+#include "runoffSensor.h"
+
+// The feeding runtime end to end: slots trigger on time and moisture, stop
+// on volume, moisture target, runoff, the daily cap and the enable switch,
+// and refusals are logged once. A pot model answers the probe and a runoff
+// switch closes once enough water went in. Tests run in order on one day.
+
+// Probe calibration the pot model is written against.
+static const uint16_t kRawDry = 800;
+static const uint16_t kRawSoaked = 300;
+// 1 ml every 600 ms of pump time.
+static const uint32_t kDripperMsPerLiter = 600000;
+
+struct Pot {
+  float moisturePercent;
+  // Percent gained per second of pump time.
+  float wettingPerSec;
+  // Pump seconds after which runoff closes the switch; 0 never.
+  float runoffAfterSec;
+  float pumpedSec;
+};
+
+static Pot g_pot = {25.0f, 0.5f, 0.0f, 0.0f};
+
+/*
+ * pot_probe
+ * Maps the pot's moisture onto the calibrated probe range, one count of
+ * noise per median triple so the stuck-probe check stays quiet.
+ * Example:
+ *   host_pin_set_analog_source(SOIL_MOISTURE_SENSOR_PIN, pot_probe);
+ */
+static uint16_t pot_probe(uint8_t) {
+  static uint32_t reads = 0;
+  float raw = kRawDry - (kRawDry - kRawSoaked) * g_pot.moisturePercent / 100.0f;
+  return static_cast<uint16_t>(raw + (reads++ / 3) % 2);
+}
+
+/*
+ * pump_on
+ * Returns true while the inlet pump is driven (active low).
+ * Example:
+ *   CHECK(pump_on());
+ */
+static bool pump_on() {
+  return host_pin_level(PUMP_IN_DEVICE) == LOW;
+}
+
+/*
+ * run
+ * Runs the main loop's sensor and feeding ticks for ms, 250 ms at a time,
+ * letting the pot soak up whatever the pump delivers.
+ * Example:
+ *   run(60000);
+ */
+static void run(uint32_t ms) {
+  const uint32_t step = 250;
+  for (uint32_t t = 0; t < ms; t += step) {
+    host_clock_advance_ms(step);
+    if (pump_on()) {
+      g_pot.pumpedSec += step / 1000.0f;
+      g_pot.moisturePercent += g_pot.wettingPerSec * step / 1000.0f;
+      if (g_pot.moisturePercent > 100.0f) g_pot.moisturePercent = 100.0f;
+    }
+    bool runoff = g_pot.runoffAfterSec > 0 && g_pot.pumpedSec >= g_pot.runoffAfterSec;
+    host_pin_set_input(RUNOFF_SENSOR_PIN, runoff ? LOW : HIGH);
+    runSoilSensorLazyReadings();
+    feedingTick();
+  }
+}
+
+/*
+ * set_slot
+ * Stores one slot into the packed config, clearing every other slot.
+ * Example:
+ *   set_slot(0, slot);
+ */
+static void set_slot(uint8_t index, const FeedSlot &slot) {
+  memset(config.feedSlotsPacked, 0, sizeof(config.feedSlotsPacked));
+  packFeedSlot(config.feedSlotsPacked[index], &slot);
+}
+
+/*
+ * set_clock
+ * Sets the RTC to hh:mm:ss on the test day.
+ * Example:
+ *   set_clock(6, 59, 50);
+ */
+static void set_clock(uint8_t hour, uint8_t minute, uint8_t second) {
+  rtcSetDateTime(hour, minute, second, 1, 6, 25);
+}
+
+HOST_TEST(boot_idles_with_no_slots) {
+  host_fs_reset();
+  host_pin_reset();
+  host_rtc_set_present(true);
+  host_pin_set_analog_source(SOIL_MOISTURE_SENSOR_PIN, pot_probe);
+
+  restoreDefaultConfig();
+  config.flags = CONFIG_FLAG_DRIPPER_CALIBRATED | CONFIG_FLAG_TIME_SET;
+  config.moistSensorCalibrationDry = kRawDry;
+  config.moistSensorCalibrationSoaked = kRawSoaked;
+  config.dripperMsPerLiter = kDripperMsPerLiter;
+  config.lightsOnMinutes = 6 * 60;
+  config.lightsOffMinutes = 22 * 60;
+  config.pulseOnSeconds = 0;
+  config.pulseOffSeconds = 0;
+  saveConfig();
+
+  initRtc();
+  initPumps();
+  initRunoffSensor();
+  initMoistureSensor();
+  logs_init();
+  feedingInit();
+  set_clock(6, 0, 0);
+
+  run(60000);
+  CHECK(!feedingIsActive());
+  CHECK(!pump_on());
+  CHECK(soilSensorReady());
+  CHECK_EQ(soilMoistureAsPercentage(getSoilMoisture()), 25);
+  CHECK(noLogs());
+}
+
+HOST_TEST(time_slot_stops_at_max_volume) {
+  FeedSlot slot = {};
+  slot.flags = FEED_SLOT_ENABLED | FEED_SLOT_HAS_TIME_WINDOW;
+  slot.windowStartMinutes = 60;
+  slot.windowDurationMinutes = 30;
+  slot.minGapMinutes = 60;
+  slot.maxVolumeMl = 100;
+  set_slot(0, slot);
+  set_clock(6, 59, 50);
+
+  run(5000);
+  CHECK(!feedingIsActive());
+  run(10000);
+  CHECK(feedingIsActive());
+  CHECK(pump_on());
+  FeedStatus status = {};
+  CHECK(feedingGetStatus(&status));
+  CHECK_EQ(status.slotIndex, 0);
+  CHECK_EQ(status.maxVolumeMl, 100);
+
+  run(60000);
+  CHECK(!feedingIsActive());
+  CHECK(!pump_on());
+  const LogEntry &entry = g_logs[0];
+  CHECK_EQ(entry.entryType, 1);
+  CHECK_EQ(entry.stopReason, LOG_STOP_MAX_RUNTIME);
+  CHECK_EQ(entry.startReason, LOG_START_TIME);
+  CHECK(entry.feedMl >= 100 && entry.feedMl <= 101);
+  CHECK_EQ(entry.dailyTotalMl, entry.feedMl);
+
+  // Still inside the window, but the minimum gap holds the next feed off.
+  run(5UL * 60000UL);
+  CHECK(!feedingIsActive());
+  CHECK_EQ(g_logs[0].seq, entry.seq);
+}
+
+HOST_TEST(moisture_slot_stops_at_target) {
+  g_pot.moisturePercent = 25.0f;
+  FeedSlot slot = {};
+  slot.flags = FEED_SLOT_ENABLED | FEED_SLOT_HAS_MOISTURE_BELOW | FEED_SLOT_HAS_MOISTURE_TARGET;
+  slot.moistureBelow = 30;
+  slot.moistureTarget = 45;
+  slot.maxVolumeMl = 500;
+  set_slot(1, slot);
+  set_clock(12, 0, 0);
+
+  // The first lazy window after the last feed has to finish before the
+  // slot sees a reading.
+  run(2UL * 60000UL);
+  CHECK(!feedingIsActive());
+  const LogEntry &entry = g_logs[0];
+  CHECK_EQ(entry.slotIndex, 1);
+  CHECK_EQ(entry.stopReason, LOG_STOP_MOISTURE);
+  CHECK_EQ(entry.startReason, LOG_START_MOISTURE);
+  CHECK(entry.soilMoistureBefore <= 30);
+  CHECK(entry.soilMoistureAfter >= 45);
+  // Probe lag overshoots the pot a little, but nowhere near the volume cap.
+  CHECK(g_pot.moisturePercent < 55.0f);
+  CHECK(entry.feedMl > 50 && entry.feedMl < 150);
+}
+
+HOST_TEST(runoff_slot_stops_after_hold) {
+  g_pot.pumpedSec = 0.0f;
+  g_pot.runoffAfterSec = 30.0f;
+  g_pot.wettingPerSec = 0.0f;
+  FeedSlot slot = {};
+  slot.flags = FEED_SLOT_ENABLED | FEED_SLOT_HAS_TIME_WINDOW | FEED_SLOT_RUNOFF_REQUIRED;
+  slot.windowStartMinutes = 600;
+  slot.windowDurationMinutes = 5;
+  slot.minGapMinutes = 60;
+  slot.maxVolumeMl = 500;
+  slot.runoffHold5s = 1;
+  set_slot(2, slot);
+  // An hour of wall time first, so the minimum gap since the last feed
+  // has passed when the window opens.
+  set_clock(15, 0, 0);
+  run(61UL * 60000UL);
+  CHECK(!feedingIsActive());
+  const LogEntry &entry = g_logs[0];
+  CHECK_EQ(entry.slotIndex, 2);
+  CHECK_EQ(entry.stopReason, LOG_STOP_RUNOFF);
+  CHECK(entry.flags & LOG_FLAG_RUNOFF_SEEN);
+  CHECK(!(entry.flags & LOG_FLAG_RUNOFF_MISSING));
+  // 30 s to runoff plus the 5 s hold.
+  CHECK(entry.feedMl >= 57 && entry.feedMl <= 60);
+  CHECK(!feedingRunoffWarning());
+  g_pot.runoffAfterSec = 0.0f;
+}
+
+HOST_TEST(daily_cap_refuses_once) {
+  config.maxDailyWaterMl = 150;
+  FeedSlot slot = {};
+  slot.flags = FEED_SLOT_ENABLED | FEED_SLOT_HAS_TIME_WINDOW;
+  slot.windowStartMinutes = 660;
+  slot.windowDurationMinutes = 10;
+  slot.maxVolumeMl = 100;
+  set_slot(3, slot);
+  set_clock(17, 0, 0);
+
+  run(5000);
+  CHECK(!feedingIsActive());
+  const LogEntry &entry = g_logs[0];
+  CHECK_EQ(entry.stopReason, LOG_STOP_MAX_DAILY_FEED_REACHED);
+  CHECK_EQ(entry.feedMl, 0);
+  CHECK(entry.dailyTotalMl >= 150);
+  uint16_t seq = entry.seq;
+  run(3UL * 60000UL);
+  CHECK_EQ(g_logs[0].seq, seq);
+  config.maxDailyWaterMl = 0;
+}
+
+HOST_TEST(uncalibrated_dripper_refuses) {
+  config.flags &= static_cast<uint8_t>(~CONFIG_FLAG_DRIPPER_CALIBRATED);
+  run(5000);
+  CHECK(!feedingIsActive());
+  CHECK_EQ(g_logs[0].stopReason, LOG_STOP_FEED_NOT_CALIBRATED);
+  config.flags |= CONFIG_FLAG_DRIPPER_CALIBRATED;
+}
+
+HOST_TEST(pulses_count_only_pump_time_and_disable_stops) {
+  config.pulseOnSeconds = 2;
+  config.pulseOffSeconds = 3;
+  FeedSlot slot = {};
+  slot.flags = FEED_SLOT_ENABLED | FEED_SLOT_HAS_TIME_WINDOW;
+  slot.windowStartMinutes = 720;
+  slot.windowDurationMinutes = 10;
+  slot.maxVolumeMl = 500;
+  set_slot(4, slot);
+  set_clock(18, 0, 0);
+
+  uint32_t toggles = host_pin_writes(PUMP_IN_DEVICE);
+  run(20000);
+  CHECK(feedingIsActive());
+  // Four on/off cycles in 20 s.
+  CHECK(host_pin_writes(PUMP_IN_DEVICE) - toggles >= 7);
+
+  feedingSetEnabled(false);
+  CHECK(!feedingIsActive());
+  CHECK(!pump_on());
+  CHECK(!feedingIsEnabled());
+  const LogEntry &entry = g_logs[0];
+  CHECK_EQ(entry.stopReason, LOG_STOP_DISABLED);
+  // 8 s of pump time out of 20 s.
+  CHECK(entry.feedMl >= 12 && entry.feedMl <= 15);
+
+  run(60000);
+  CHECK(!feedingIsActive());
+  feedingSetEnabled(true);
+  config.pulseOnSeconds = 0;
+  config.pulseOffSeconds = 0;
+}
+
+HOST_TEST(lights_off_blocks_slots_but_not_force_feed) {
+  FeedSlot slot = {};
+  slot.flags = FEED_SLOT_ENABLED | FEED_SLOT_HAS_TIME_WINDOW;
+  slot.windowStartMinutes = 17 * 60;
+  slot.windowDurationMinutes = 30;
+  slot.maxVolumeMl = 20;
+  set_slot(5, slot);
+  set_clock(23, 0, 0);
+
+  uint16_t seq = g_logs[0].seq;
+  run(60000);
+  CHECK(!feedingIsActive());
+  CHECK_EQ(g_logs[0].seq, seq);
+
+  feedingForceFeed(5);
+  CHECK(feedingIsActive());
+  run(30000);
+  CHECK(!feedingIsActive());
+  CHECK_EQ(g_logs[0].startReason, LOG_START_USER);
+  CHECK_EQ(g_logs[0].stopReason, LOG_STOP_MAX_RUNTIME);
+  CHECK_EQ(g_logs[0].feedMl, 20);
+}
+
+HOST_TEST(ui_pause_stops_and_blocks) {
+  feedingForceFeed(5);
+  CHECK(feedingIsActive());
+  feedingPauseForUi();
+  CHECK(!feedingIsActive());
+  CHECK_EQ(g_logs[0].stopReason, LOG_STOP_UI_PAUSE);
+  feedingForceFeed(5);
+  CHECK(!feedingIsActive());
+  feedingResumeAfterUi();
+  feedingForceFeed(5);
+  CHECK(feedingIsActive());
+  run(30000);
+  CHECK(!feedingIsActive());
+}
@@ -0,0 +1,147 @@
+#include "host_test.h"
+
+#include <Arduino.h>
+
+#include "config.h"
+#include "host_hal.h"
+#include "logs.h"
+
+// The flash log ring: appending, reboot recovery, wrap-around, the daily
+// totals cache, the hourly rollup and a write cut short by power loss.
+// Tests run in order and share the logs.cpp state.
+
+static const EpochTime kDay = epochFromFields(25, 6, 1, 0, 0, 0);
+
+/*
+ * feed_entry
+ * Returns a finished feed entry at t carrying the running day total.
+ * Example:
+ *   add_log(feed_entry(kDay + 3600, 250, 250));
+ */
+static LogEntry feed_entry(EpochTime t, uint16_t ml, uint16_t dailyTotal) {
+  LogEntry entry = {};
+  clearLogEntry(&entry);
+  entry.entryType = 1;
+  entry.startTime = t;
+  entry.endTime = t + 60;
+  entry.feedMl = ml;
+  entry.dailyTotalMl = dailyTotal;
+  return entry;
+}
+
+/*
+ * value_entry
+ * Returns a periodic moisture sample at t.
+ * Example:
+ *   add_log(value_entry(kDay + 600, 42));
+ */
+static LogEntry value_entry(EpochTime t, uint8_t moisture) {
+  LogEntry entry = {};
+  clearLogEntry(&entry);
+  entry.entryType = 2;
+  entry.startTime = t;
+  entry.soilMoistureBefore = moisture;
+  return entry;
+}
+
+HOST_TEST(fresh_store_is_empty) {
+  host_fs_reset();
+  config.lightsOnMinutes = 6 * 60;
+  logs_init();
+  CHECK_EQ(host_fs_file_size("/logs.bin"), kLogStoreBytes);
+  CHECK(noLogs());
+  CHECK_EQ(g_log_count, 0);
+  CHECK_EQ(getCurrentLogSlot(), -1);
+}
+
+HOST_TEST(entries_survive_reboot) {
+  add_log(value_entry(kDay + 7 * 3600, 40));
+  add_log(feed_entry(kDay + 8 * 3600, 200, 200));
+  add_log(value_entry(kDay + 9 * 3600, 55));
+  CHECK_EQ(g_log_count, 3);
+  CHECK_EQ(g_logs[0].seq, 3);
+  CHECK_EQ(g_logs[0].entryType, 2);
+
+  logs_init();
+  CHECK_EQ(g_log_count, 3);
+  for (int i = 0; i < 3; ++i) CHECK_EQ(g_logs[i].seq, 3 - i);
+  CHECK_EQ(g_logs[1].feedMl, 200);
+  CHECK_EQ(g_logs[1].lightDayKey, epochLightDayKey(kDay + 8 * 3600 + 60, config.lightsOnMinutes));
+}
+
+HOST_TEST(day_totals_follow_lights_on) {
+  add_log(feed_entry(kDay + 12 * 3600, 150, 350));
+  uint8_t minVal = 0;
+  uint8_t maxVal = 0;
+  CHECK_EQ(getDailyFeedTotalMlAt(kDay + 13 * 3600, &minVal, &maxVal), 350);
+  CHECK_EQ(minVal, 40);
+  CHECK_EQ(maxVal, 55);
+
+  // Before lights-on the same calendar date still belongs to the previous day.
+  CHECK_EQ(getDailyFeedTotalMlAt(kDay + 5 * 3600), 0);
+  // A new log invalidates the cached answer.
+  add_log(feed_entry(kDay + 14 * 3600, 100, 450));
+  CHECK_EQ(getDailyFeedTotalMlAt(kDay + 13 * 3600), 450);
+}
+
+HOST_TEST(hourly_history_rolls_up) {
+  uint8_t moisture = 0;
+  uint16_t feedMl = 0;
+  uint32_t hour = epochHours(kDay + 8 * 3600);
+  CHECK(getMoistureHistoryHour(hour, &moisture, &feedMl));
+  CHECK_EQ(feedMl, 200);
+  CHECK(getMoistureHistoryHour(epochHours(kDay + 7 * 3600), &moisture, nullptr));
+  CHECK_EQ(moisture, 40);
+  CHECK(!getMoistureHistoryHour(epochHours(kDay + 3 * 3600), &moisture, &feedMl));
+  CHECK_EQ(moisture, LOG_HISTORY_UNSET);
+
+  // The rollup is rebuilt from flash on boot.
+  uint16_t revision = getMoistureHistoryRevision();
+  logs_init();
+  CHECK(getMoistureHistoryHour(hour, nullptr, &feedMl));
+  CHECK_EQ(feedMl, 200);
+  CHECK(getMoistureHistoryRevision() != revision);
+}
+
+HOST_TEST(baseline_patch_lands_in_place) {
+  int16_t slot = getCurrentLogSlot();
+  CHECK(patchLogBaselinePercent(slot, 62));
+  logs_init();
+  CHECK_EQ(g_logs[0].baselinePercent, 62);
+  CHECK(!patchLogBaselinePercent(-1, 1));
+}
+
+HOST_TEST(ring_wraps_and_keeps_order) {
+  logs_wipe();
+  CHECK(noLogs());
+  // More entries than the 48 KB file has slots for.
+  const uint16_t total = 1500;
+  for (uint16_t i = 0; i < total; ++i) add_log(value_entry(kDay + i * 60, static_cast<uint8_t>(i % 100)));
+  logs_init();
+  CHECK_EQ(g_log_count, kMaxLogs);
+  for (int i = 0; i < kMaxLogs; ++i) CHECK_EQ(g_logs[i].seq, total - i);
+  CHECK_EQ(getAbsoluteLogNumber(), total);
+
+  // Walking back stops at the oldest surviving entry, not at the wrap.
+  goToLatestSlot();
+  uint16_t steps = 0;
+  while (goToPreviousLogSlot()) steps++;
+  CHECK(steps > kMaxLogs);
+  CHECK(steps < total - 1);
+}
+
+HOST_TEST(torn_entry_write_is_ignored) {
+  uint16_t newest = g_logs[0].seq;
+  // Power fails after the slot is written but before its head record.
+  host_fs_set_write_budget(sizeof(LogEntry));
+  add_log(value_entry(kDay + 30 * 86400, 77));
+  host_fs_set_write_budget(SIZE_MAX);
+
+  logs_init();
+  CHECK_EQ(g_logs[0].seq, newest);
+  add_log(value_entry(kDay + 30 * 86400, 78));
+  logs_init();
+  CHECK_EQ(g_logs[0].seq, newest + 1);
+  CHECK_EQ(g_logs[0].soilMoistureBefore, 78);
+  CHECK_EQ(g_logs[1].seq, newest);
+}
@@ -0,0 +1,178 @@
+#include "host_test.h"
+
+#include <Arduino.h>
+
+#include "config.h"
+#include "core_stubs.h"
+#include "host_hal.h"
+#include "moistureSensor.h"
+
+// The soil probe driver against a scripted ADC: lazy windows and probe
+// power, median-of-3 spike rejection, calibration and temperature
+// compensation, the real-time filter and the rail/stuck/no-response fault scoring.
+
+static uint16_t g_probe_raw = 600;
+static uint32_t g_probe_reads = 0;
+static bool g_probe_spikes = false;
+
+/*
+ * probe_source
+ * A live-looking probe: each median-of-3 triple reads the same level, one
+ * count apart from the next, and optionally one read per triple spikes.
+ * Example:
+ *   host_pin_set_analog_source(SOIL_MOISTURE_SENSOR_PIN, probe_source);
+ */
+static uint16_t probe_source(uint8_t) {
+  uint32_t n = g_probe_reads++;
+  if (g_probe_spikes && n % 3 == 1) return 1023;
+  return static_cast<uint16_t>(g_probe_raw + (n / 3) % 2);
+}
+
+/*
+ * run_sensor
+ * Ticks the lazy state machine every stepMs for totalMs.
+ * Example:
+ *   run_sensor(SENSOR_WINDOW_DURATION, 50);
+ */
+static void run_sensor(uint32_t totalMs, uint32_t stepMs) {
+  for (uint32_t t = 0; t < totalMs; t += stepMs) {
+    host_clock_advance_ms(stepMs);
+    runSoilSensorLazyReadings();
+  }
+}
+
+HOST_TEST(lazy_window_powers_probe_only_while_sampling) {
+  host_pin_reset();
+  host_pin_set_analog_source(SOIL_MOISTURE_SENSOR_PIN, probe_source);
+  initMoistureSensor();
+  CHECK(soilSensorIsActive());
+  CHECK_EQ(host_pin_level(SOIL_MOISTURE_SENSOR_POWER), HIGH);
+  CHECK(!soilSensorReady());
+
+  run_sensor(SENSOR_STABILIZATION_TIME + SENSOR_WINDOW_DURATION + 100, 50);
+  CHECK(soilSensorReady());
+  CHECK(!soilSensorIsActive());
+  CHECK_EQ(host_pin_level(SOIL_MOISTURE_SENSOR_POWER), LOW);
+  uint16_t value = getSoilMoisture();
+  CHECK(value >= 600 && value <= 601);
+  uint32_t idle = soilSensorIdleMs();
+  CHECK(idle > 0 && idle <= SENSOR_SLEEP_INTERVAL);
+  CHECK_EQ(soilSensorHealth(), SENSOR_OK);
+}
+
+HOST_TEST(median_of_three_drops_single_spikes) {
+  g_probe_spikes = true;
+  g_probe_raw = 450;
+  run_sensor(SENSOR_SLEEP_INTERVAL + SENSOR_STABILIZATION_TIME + SENSOR_WINDOW_DURATION + 100, 50);
+  g_probe_spikes = false;
+  uint16_t value = getSoilMoisture();
+  CHECK(value >= 450 && value <= 451);
+  CHECK_EQ(soilSensorFault(), SENSOR_FAULT_NONE);
+}
+
+HOST_TEST(percentage_uses_calibration_and_temperature) {
+  config.moistSensorCalibrationDry = 800;
+  config.moistSensorCalibrationSoaked = 300;
+  config.moistTempCompPer10C = 0;
+  CHECK_EQ(soilMoistureAsPercentage(800), 0);
+  CHECK_EQ(soilMoistureAsPercentage(300), 100);
+  CHECK_EQ(soilMoistureAsPercentage(550), 50);
+  CHECK_EQ(soilMoistureAsPercentage(1000), 0);
+  CHECK_EQ(soilMoistureAsPercentage(100), 100);
+
+  // Capacitive probes read wetter when warm; 35.0 C at 4 %/10 C takes 4 off.
+  config.moistTempCompPer10C = 4;
+  host_soil_temp_set(true, 350);
+  CHECK_EQ(soilMoistureAsPercentage(550), 46);
+  host_soil_temp_set(false, 0);
+  CHECK_EQ(soilMoistureAsPercentage(550), 50);
+  config.moistTempCompPer10C = 0;
+
+  config.moistSensorCalibrationSoaked = config.moistSensorCalibrationDry;
+  CHECK_EQ(soilMoistureAsPercentage(550), 0);
+}
+
+HOST_TEST(realtime_filter_tracks_a_feed) {
+  g_probe_raw = 600;
+  setSoilSensorLazySeed(600);
+  setSoilSensorRealTime();
+  CHECK(soilSensorIsActive());
+  CHECK(!soilSensorRealtimeReady());
+  host_clock_advance_ms(SENSOR_STABILIZATION_TIME);
+  CHECK(soilSensorRealtimeReady());
+
+  // Water arrives as a step; the slow EMA is ~63 % there after one tau.
+  g_probe_raw = 400;
+  run_sensor(SENSOR_FEED_TAU_SLOW_MS, SENSOR_SAMPLE_INTERVAL);
+  uint16_t avg = soilSensorGetRealtimeAvg();
+  CHECK(avg > 450 && avg < 500);
+  run_sensor(5 * SENSOR_FEED_TAU_SLOW_MS, SENSOR_SAMPLE_INTERVAL);
+  avg = soilSensorGetRealtimeAvg();
+  CHECK(avg >= 400 && avg <= 403);
+  CHECK(soilSensorGetRealtimeRaw() >= 400 && soilSensorGetRealtimeRaw() <= 401);
+
+  setSoilSensorLazy();
+  CHECK(!soilSensorIsActive());
+  CHECK(!soilSensorReady());
+}
+
+HOST_TEST(probe_on_rail_fails) {
+  initMoistureSensor();
+  host_pin_set_analog_source(SOIL_MOISTURE_SENSOR_PIN, nullptr);
+  host_pin_set_analog(SOIL_MOISTURE_SENSOR_PIN, 1023);
+  uint32_t cycle = SENSOR_STABILIZATION_TIME + SENSOR_WINDOW_DURATION + SENSOR_SLEEP_INTERVAL;
+  run_sensor(SENSOR_STABILIZATION_TIME + SENSOR_WINDOW_DURATION + 100, 50);
+  CHECK_EQ(soilSensorHealth(), SENSOR_SUSPECT);
+  CHECK_EQ(soilSensorFault(), SENSOR_FAULT_RAIL_HIGH);
+  run_sensor(cycle, 50);
+  CHECK_EQ(soilSensorHealth(), SENSOR_FAILED);
+
+  // One clean window clears it.
+  host_pin_set_analog_source(SOIL_MOISTURE_SENSOR_PIN, probe_source);
+  run_sensor(cycle, 50);
+  CHECK_EQ(soilSensorHealth(), SENSOR_OK);
+}
+
+HOST_TEST(flat_probe_is_suspected) {
+  // A disconnected probe reading a steady mid-scale voltage never varies.
+  host_pin_set_analog_source(SOIL_MOISTURE_SENSOR_PIN, nullptr);
+  host_pin_set_analog(SOIL_MOISTURE_SENSOR_PIN, 512);
+  uint32_t cycle = SENSOR_STABILIZATION_TIME + SENSOR_WINDOW_DURATION + SENSOR_SLEEP_INTERVAL;
+  run_sensor(SENSOR_FLAT_SUSPECT_WINDOWS * cycle, 50);
+  CHECK_EQ(soilSensorFault(), SENSOR_FAULT_STUCK);
+  CHECK_EQ(soilSensorHealth(), SENSOR_SUSPECT);
+  run_sensor((SENSOR_FLAT_FAILED_WINDOWS - SENSOR_FLAT_SUSPECT_WINDOWS) * cycle, 50);
+  CHECK_EQ(soilSensorHealth(), SENSOR_FAILED);
+  host_pin_set_analog_source(SOIL_MOISTURE_SENSOR_PIN, probe_source);
+}
+
+HOST_TEST(no_response_clears_once_readings_move) {
+  config.moistSensorCalibrationDry = 800;
+  config.moistSensorCalibrationSoaked = 300;
+  config.moistTempCompPer10C = 0;
+  host_pin_set_analog_source(SOIL_MOISTURE_SENSOR_PIN, probe_source);
+  g_probe_raw = 600;
+  initMoistureSensor();
+  uint32_t window = SENSOR_STABILIZATION_TIME + SENSOR_WINDOW_DURATION + 100;
+
+  // Water that never reaches the probe: the reading stays put through each feed.
+  for (uint8_t feed = 0; feed < SENSOR_NO_RESPONSE_FAILED_FEEDS; ++feed) {
+    run_sensor(window, 50);
+    CHECK(soilSensorReady());
+    soilSensorFeedStarted();
+    setSoilSensorRealTime();
+    host_clock_advance_ms(SENSOR_STABILIZATION_TIME);
+    soilSensorFeedProgress(SENSOR_RESPONSE_WINDOW_MS);
+    soilSensorFeedEnded();
+    setSoilSensorLazy();
+  }
+  run_sensor(window, 50);
+  CHECK_EQ(soilSensorHealth(), SENSOR_FAILED);
+  CHECK_EQ(soilSensorFault(), SENSOR_FAULT_NO_RESPONSE);
+
+  // The soil drying out by more than the clear threshold shows the probe is alive.
+  g_probe_raw = 640;
+  run_sensor(SENSOR_SLEEP_INTERVAL + window, 50);
+  CHECK_EQ(soilSensorFault(), SENSOR_FAULT_NONE);
+  CHECK_EQ(soilSensorHealth(), SENSOR_OK);
+}
@@ -0,0 +1,99 @@
+#include "host_test.h"
+
+#include <Arduino.h>
+
+#include "host_hal.h"
+#include "rtc.h"
+
+// The software clock over the DS1307 model: boot without a chip, anchoring,
+// discipline cadence, drift estimation and setting the time.
+// Tests run in order and share the rtc.cpp clock state.
+
+/*
+ * run_clock
+ * Advances the manual clock in steps, reading the RTC like the feeding
+ * loop does, and returns the largest |soft clock - DS1307| seen in ms.
+ * Example:
+ *   int64_t worst = run_clock(3600000UL, 1000);
+ */
+static int64_t run_clock(uint32_t totalMs, uint32_t stepMs) {
+  int64_t worst = 0;
+  for (uint32_t t = 0; t < totalMs; t += stepMs) {
+    host_clock_advance_ms(stepMs);
+    uint64_t soft = rtcNowMs();
+    int64_t error = static_cast<int64_t>(soft) - static_cast<int64_t>(host_rtc_epoch()) * 1000;
+    if (error < 0) error = -error;
+    if (error > worst) worst = error;
+  }
+  return worst;
+}
+
+HOST_TEST(missing_rtc_reports_no_time) {
+  host_rtc_set_present(false);
+  initRtc();
+  EpochTime now = EPOCH_UNSET;
+  CHECK(!rtcReadEpoch(&now));
+  uint32_t reads = rtcHardwareReadCount();
+  // Retries are rate limited rather than hammering the bus.
+  host_clock_advance_ms(RTC_RETRY_INTERVAL_MS / 2);
+  CHECK(!rtcReadEpoch(&now));
+  CHECK_EQ(rtcHardwareReadCount(), reads);
+}
+
+HOST_TEST(clock_anchors_once_rtc_answers) {
+  host_rtc_set_present(true);
+  host_rtc_set_epoch(epochFromFields(25, 6, 1, 8, 0, 0));
+  host_clock_advance_ms(RTC_RETRY_INTERVAL_MS);
+  EpochTime now = EPOCH_UNSET;
+  CHECK(rtcReadEpoch(&now));
+  CHECK_EQ(now, host_rtc_epoch());
+  CHECK_EQ(epochMinuteOfDay(now), 8 * 60);
+}
+
+HOST_TEST(hardware_is_read_once_per_discipline_interval) {
+  uint32_t reads = rtcHardwareReadCount();
+  int64_t worst = run_clock(3600000UL, 250);
+  uint32_t expected = 3600000UL / RTC_DISCIPLINE_INTERVAL_MS;
+  CHECK(rtcHardwareReadCount() - reads <= expected + 1);
+  // Whole-second registers plus the mid-second guess.
+  CHECK(worst <= 1500);
+}
+
+HOST_TEST(drift_is_measured_and_trimmed) {
+  host_rtc_set_drift_ppm(1000);
+  int64_t worst = run_clock(6UL * 3600000UL, 1000);
+  // The rate is averaged since the first anchor, an hour before the chip
+  // started running fast, so six of seven hours at 1000 ppm reads ~857.
+  int32_t ppm = rtcDriftPpm();
+  CHECK(ppm > 800 && ppm < 920);
+  // Without trimming the soft clock would be 21.6 s behind after six hours.
+  CHECK(worst <= RTC_STEP_THRESHOLD_MS);
+  host_rtc_set_drift_ppm(0);
+}
+
+HOST_TEST(rtc_loss_free_runs_then_recovers) {
+  host_rtc_set_present(false);
+  uint64_t before = rtcNowMs();
+  host_clock_advance_ms(RTC_DISCIPLINE_INTERVAL_MS * 2);
+  uint64_t after = rtcNowMs();
+  CHECK(after > before);
+  host_rtc_set_present(true);
+  CHECK(run_clock(RTC_DISCIPLINE_INTERVAL_MS * 2, 1000) <= RTC_STEP_THRESHOLD_MS);
+}
+
+HOST_TEST(set_date_time_writes_the_chip) {
+  CHECK(!rtcSetDateTime(24, 0, 0, 1, 1, 25));
+  CHECK(rtcSetDateTime(21, 30, 15, 29, 2, 28));
+  CHECK_EQ(host_rtc_epoch(), epochFromFields(28, 2, 29, 21, 30, 15));
+  EpochTime now = EPOCH_UNSET;
+  CHECK(rtcReadEpoch(&now));
+  CHECK_EQ(now, epochFromFields(28, 2, 29, 21, 30, 15));
+}
+
+HOST_TEST(window_wraps_midnight) {
+  CHECK(rtcIsWithinWindow(23 * 60, 22 * 60, 180));
+  CHECK(rtcIsWithinWindow(30, 22 * 60, 180));
+  CHECK(!rtcIsWithinWindow(60, 22 * 60, 180));
+  CHECK(!rtcIsWithinWindow(600, 600, 0));
+  CHECK(rtcIsWithinWindow(600, 600, 1));
+}
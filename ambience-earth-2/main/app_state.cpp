@@ -21,10 +21,13 @@ uint16_t lastFeedMl = 0;
 
 ScreenNode g_screen_stack[kScreenStackMax] = {};
 int g_screen_stack_size = 0;
+ScreenCacheEntry g_screen_cache[kScreenCacheSlots] = {};
+uint32_t g_screen_cache_clock = 0;
 ScreenId g_active_screen = SCREEN_INFO;
 
 InfoRefs g_info_refs = {};
 LogsRefs g_logs_refs = {};
+HistoryRefs g_history_refs = {};
 FeedingRefs g_feeding_refs = {};
 SlotSummaryRefs g_slot_summary_refs = {};
 WizardRefs g_wizard_refs = {};
@@ -33,6 +36,9 @@ CalMoistRefs g_cal_moist_refs = {};
 CalFlowRefs g_cal_flow_refs = {};
 TestSensorsRefs g_test_sensors_refs = {};
 PumpTestRefs g_pump_test_refs = {};
+UiMemoryRefs g_ui_memory_refs = {};
+ProfilerRefs g_profiler_refs = {};
+FlashStatsRefs g_flash_stats_refs = {};
 NumberInputContext g_number_ctx = {};
 TimeRangeContext g_time_range_ctx = {};
 PromptContext g_prompt = {};
@@ -44,6 +50,7 @@ int g_option_group_count = 0;
 OptionButtonData g_option_button_data[kOptionButtonSize] = {};
 int g_option_button_count = 0;
 
+int g_history_range = 0;
 int g_wizard_step = 0;
 int g_time_date_step = 0;
 DateTime g_time_date_edit = {};
@@ -4,6 +4,9 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "epochTime.h"
+#include "logs.h"
+
 constexpr uint16_t kScreenWidth = 320;
 constexpr uint16_t kScreenHeight = 240;
 constexpr uint16_t kTouchWidth = 240;
@@ -16,15 +19,36 @@ constexpr uint16_t kBufferLines = 20;
 
 constexpr uint32_t kScreensaverDelayMs = 15000;
 constexpr uint32_t kScreensaverMoveMs = 2000;
-constexpr uint32_t kLogValuesIntervalMs = 3600000;
+constexpr uint32_t kPacingActiveHoldMs = 3000;
+#ifdef WOKWI_SIM
+constexpr uint32_t kUiTimerPeriodMs = 1200;
+constexpr uint32_t kUiTimerIdlePeriodMs = 1200;
+#else
+constexpr uint32_t kUiTimerPeriodMs = 200;
+constexpr uint32_t kUiTimerIdlePeriodMs = 1000;
+#endif
+
+// Screen heap budgets are checked after every build in sim (debug) builds;
+// pass -DUI_MEM_CHECKS to check them on hardware too.
+#if defined(WOKWI_SIM) && !defined(UI_MEM_CHECKS)
+#define UI_MEM_CHECKS
+#endif
 
 constexpr int kSlotCount = 8;
-constexpr int kMaxLogs = 24;
-constexpr size_t kLogStoreBytes = 48 * 1024;
 constexpr int kScreenStackMax = 10;
+constexpr int kScreenCacheSlots = 4;
+constexpr uint32_t kScreenCacheBudgetBytes = 16 * 1024;
+constexpr uint32_t kScreenCacheMinFreeBytes = 12 * 1024;
+constexpr uint32_t kUiMemSampleMs = 5000;
+constexpr uint32_t kUiMemTrendMs = 60000;
+constexpr int kUiMemTrendSamples = 16;
+// With -DUI_LVGL_PSRAM_POOL the LVGL heap grows by PSRAM chunks on demand.
+constexpr uint32_t kLvglPsramPoolBytes = 64 * 1024;
+constexpr int kLvglPsramPoolMax = 4;
 constexpr int kBindingPoolSize = 20;
 constexpr int kOptionGroupSize = 10;
 constexpr int kOptionButtonSize = 20;
+constexpr int kHistoryRangeCount = 3;
 
 extern const lv_color_t kColorBg;
 extern const lv_color_t kColorHeader;
@@ -52,6 +76,11 @@ enum ScreenId {
   SCREEN_INITIAL_SETUP,
   SCREEN_NUMBER_INPUT,
   SCREEN_TIME_RANGE_INPUT,
+  SCREEN_HISTORY,
+  SCREEN_UI_MEMORY,
+  SCREEN_PROFILER,
+  SCREEN_FLASH_STATS,
+  SCREEN_COUNT
 };
 
 enum MoistureMode {
@@ -81,7 +110,7 @@ struct DateTime {
 };
 
 struct SimState {
-  DateTime now;
+  EpochTime now;
   uint32_t uptime_sec;
   int moisture;
   int dryback;
@@ -108,6 +137,9 @@ struct SimState {
   int dripper_ml_per_hour;
   int moisture_raw_dry;
   int moisture_raw_wet;
+  uint8_t sensor_health;
+  bool soil_temp_ready;
+  int soil_temp_deci_c;
   uint32_t last_values_log_uptime;
 };
 
@@ -137,37 +169,16 @@ struct Slot {
   int min_gap_min;
 };
 
-struct LogEntry {
-  uint16_t seq;
-  uint8_t entryType;
-  uint8_t stopReason;
-  uint8_t startReason;
-  uint8_t slotIndex;
-  uint8_t flags;
-  uint8_t soilMoistureBefore;
-  uint8_t soilMoistureAfter;
-  uint8_t baselinePercent;
-  uint8_t drybackPercent;
-  uint16_t feedMl;
-  uint16_t dailyTotalMl;
-  uint16_t lightDayKey;
-  uint8_t startYear;
-  uint8_t startMonth;
-  uint8_t startDay;
-  uint8_t startHour;
-  uint8_t startMinute;
-  uint8_t endYear;
-  uint8_t endMonth;
-  uint8_t endDay;
-  uint8_t endHour;
-  uint8_t endMinute;
-  uint32_t millisStart;
-  uint32_t millisEnd;
+struct ScreenNode {
+  ScreenId id;
+  lv_obj_t *root;
 };
 
-struct ScreenNode {
+struct ScreenCacheEntry {
   ScreenId id;
   lv_obj_t *root;
+  uint32_t bytes;
+  uint32_t last_used;
 };
 
 struct InfoRefs {
@@ -188,6 +199,7 @@ struct InfoRefs {
   lv_obj_t *night_icon;
   lv_obj_t *last_value;
   lv_obj_t *totals_value;
+  lv_obj_t *soil_temp_value;
   lv_obj_t *screensaver_root;
   lv_obj_t *screensaver_plant;
   lv_obj_t *screensaver_icon;
@@ -201,6 +213,18 @@ struct LogsRefs {
   lv_obj_t *index_label;
 };
 
+struct HistoryRefs {
+  lv_obj_t *chart;
+  lv_chart_series_t *moisture_series;
+  lv_chart_series_t *feed_series;
+  lv_obj_t *summary_label;
+  lv_obj_t *range_btns[kHistoryRangeCount];
+  bool drawn;
+  uint16_t drawn_revision;
+  uint32_t drawn_edge_point;
+  uint16_t drawn_feed_max;
+};
+
 struct FeedingRefs {
   lv_obj_t *header_value;
   lv_obj_t *pulse_value;
@@ -256,12 +280,29 @@ struct TestSensorsRefs {
   lv_obj_t *raw_label;
   lv_obj_t *percent_label;
   lv_obj_t *runoff_label;
+  lv_obj_t *temp_label;
 };
 
 struct PumpTestRefs {
   lv_obj_t *status_label;
 };
 
+struct UiMemoryRefs {
+  lv_obj_t *summary_label;
+  lv_obj_t *screens_label;
+};
+
+struct ProfilerRefs {
+  lv_obj_t *table_label;
+  uint32_t last_update_ms;
+};
+
+struct FlashStatsRefs {
+  lv_obj_t *summary_label;
+  lv_obj_t *table_label;
+  uint32_t last_update_ms;
+};
+
 struct NumberInputContext {
   const char *title;
   int value;
@@ -316,10 +357,6 @@ extern SimState g_sim;
 extern SetupFlags g_setup;
 extern Slot g_slots[kSlotCount];
 extern Slot g_edit_slot;
-extern LogEntry g_logs[kMaxLogs];
-extern LogEntry newLogEntry;
-extern int g_log_count;
-extern int g_log_index;
 extern int g_selected_slot;
 extern bool g_force_feed_mode;
 extern unsigned long int millisAtEndOfLastFeed;
@@ -327,10 +364,13 @@ extern uint16_t lastFeedMl;
 
 extern ScreenNode g_screen_stack[kScreenStackMax];
 extern int g_screen_stack_size;
+extern ScreenCacheEntry g_screen_cache[kScreenCacheSlots];
+extern uint32_t g_screen_cache_clock;
 extern ScreenId g_active_screen;
 
 extern InfoRefs g_info_refs;
 extern LogsRefs g_logs_refs;
+extern HistoryRefs g_history_refs;
 extern FeedingRefs g_feeding_refs;
 extern SlotSummaryRefs g_slot_summary_refs;
 extern WizardRefs g_wizard_refs;
@@ -339,6 +379,9 @@ extern CalMoistRefs g_cal_moist_refs;
 extern CalFlowRefs g_cal_flow_refs;
 extern TestSensorsRefs g_test_sensors_refs;
 extern PumpTestRefs g_pump_test_refs;
+extern UiMemoryRefs g_ui_memory_refs;
+extern ProfilerRefs g_profiler_refs;
+extern FlashStatsRefs g_flash_stats_refs;
 extern NumberInputContext g_number_ctx;
 extern TimeRangeContext g_time_range_ctx;
 extern PromptContext g_prompt;
@@ -350,6 +393,7 @@ extern int g_option_group_count;
 extern OptionButtonData g_option_button_data[kOptionButtonSize];
 extern int g_option_button_count;
 
+extern int g_history_range;
 extern int g_wizard_step;
 extern int g_time_date_step;
 extern DateTime g_time_date_edit;
@@ -15,61 +15,6 @@ inline int clamp_int(int value, int min_value, int max_value) {
   return value;
 }
 
-/*
- * days_in_month
- * Returns the number of days in the given month (non-leap-year simulation).
- * Example:
- *   int dim = days_in_month(g_sim.now.month, g_sim.now.year);
- */
-inline int days_in_month(int month, int year) {
-  (void)year;
-  switch (month) {
-    case 1:
-    case 3:
-    case 5:
-    case 7:
-    case 8:
-    case 10:
-    case 12:
-      return 31;
-    case 4:
-    case 6:
-    case 9:
-    case 11:
-      return 30;
-    case 2:
-      return 28;
-    default:
-      return 30;
-  }
-}
-
-/*
- * advance_time_one_sec
- * Advances a DateTime by one second with simple calendar rollover.
- * Example:
- *   advance_time_one_sec(&g_sim.now);
- */
-inline void advance_time_one_sec(DateTime *dt) {
-  dt->second += 1;
-  if (dt->second < 60) return;
-  dt->second = 0;
-  dt->minute += 1;
-  if (dt->minute < 60) return;
-  dt->minute = 0;
-  dt->hour += 1;
-  if (dt->hour < 24) return;
-  dt->hour = 0;
-  dt->day += 1;
-  int dim = days_in_month(dt->month, dt->year);
-  if (dt->day <= dim) return;
-  dt->day = 1;
-  dt->month += 1;
-  if (dt->month <= 12) return;
-  dt->month = 1;
-  dt->year += 1;
-}
-
 /*
  * format_time
  * Formats time as HH:MM into the provided buffer.
@@ -77,8 +22,9 @@ inline void advance_time_one_sec(DateTime *dt) {
  *   char buf[8] = {0};
  *   format_time(g_sim.now, buf, sizeof(buf));
  */
-inline void format_time(const DateTime &dt, char *buf, size_t len) {
-  snprintf(buf, len, "%02d:%02d", dt.hour, dt.minute);
+inline void format_time(EpochTime t, char *buf, size_t len) {
+  uint16_t minutes = epochMinuteOfDay(t);
+  snprintf(buf, len, "%02u:%02u", static_cast<unsigned>(minutes / 60), static_cast<unsigned>(minutes % 60));
 }
 
 /*
@@ -88,8 +34,9 @@ inline void format_time(const DateTime &dt, char *buf, size_t len) {
  *   char buf[12] = {0};
  *   format_date(g_sim.now, buf, sizeof(buf));
  */
-inline void format_date(const DateTime &dt, char *buf, size_t len) {
-  snprintf(buf, len, "%02d/%02d/%04d", dt.month, dt.day, dt.year);
+inline void format_date(EpochTime t, char *buf, size_t len) {
+  EpochFields f = epochToFields(t);
+  snprintf(buf, len, "%02u/%02u/%04u", f.month, f.day, 2000u + f.year);
 }
 
 /*
@@ -97,7 +44,18 @@ inline void format_date(const DateTime &dt, char *buf, size_t len) {
  * Formats date/time as MM/DD HH:MM into the provided buffer.
  * Example:
  *   char buf[16] = {0};
- *   format_datetime(g_sim.now, buf, sizeof(buf));
+ *   format_datetime(entry.startTime, buf, sizeof(buf));
+ */
+inline void format_datetime(EpochTime t, char *buf, size_t len) {
+  EpochFields f = epochToFields(t);
+  snprintf(buf, len, "%02u/%02u %02u:%02u", f.month, f.day, f.hour, f.minute);
+}
+
+/*
+ * format_datetime
+ * Formats the time/date wizard's edit fields as MM/DD HH:MM.
+ * Example:
+ *   format_datetime(g_time_date_edit, buf, sizeof(buf));
  */
 inline void format_datetime(const DateTime &dt, char *buf, size_t len) {
   snprintf(buf, len, "%02d/%02d %02d:%02d", dt.month, dt.day, dt.hour, dt.minute);
@@ -121,3 +79,15 @@ inline void format_ago(uint32_t seconds, char *buf, size_t len) {
     snprintf(buf, len, "%luh%02lum", hours, minutes);
   }
 }
+
+/*
+ * format_deci_celsius
+ * Formats a tenths-of-a-degree temperature as e.g. 21.5C.
+ * Example:
+ *   char buf[10] = {0};
+ *   format_deci_celsius(g_sim.soil_temp_deci_c, buf, sizeof(buf));
+ */
+inline void format_deci_celsius(int deci_c, char *buf, size_t len) {
+  int magnitude = (deci_c < 0) ? -deci_c : deci_c;
+  snprintf(buf, len, "%s%d.%dC", (deci_c < 0) ? "-" : "", magnitude / 10, magnitude % 10);
+}
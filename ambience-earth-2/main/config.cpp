@@ -1,11 +1,45 @@
 #include "config.h"
 
+#include "flashStats.h"
 #include <Arduino.h>
 #include <LittleFS.h>
+#include <stddef.h>
 #include <string.h>
 
 namespace {
-const char *kConfigPath = "/config.bin";
+// Records alternate between two files so a power cut mid-save can only
+// damage the copy being written; the other still holds the previous save.
+const char *kConfigSlotPaths[2] = {"/config_a.bin", "/config_b.bin"};
+// Single-file format used up to CONFIG_VERSION 18; migrated on first boot.
+const char *kLegacyConfigPath = "/config.bin";
+constexpr uint32_t kRecordMagic = 0x31474643UL; // "CFG1"
+
+struct ConfigRecordHeader {
+  uint32_t magic;
+  uint32_t sequence;
+  uint16_t version;
+  uint16_t length;
+  // CRC32 of the header up to this field followed by the payload.
+  uint32_t crc;
+};
+
+struct ConfigRecord {
+  ConfigRecordHeader header;
+  uint8_t payload[sizeof(Config)];
+};
+
+// Last bytes written to or read from flash, so unchanged saves are skipped.
+static Config g_saved = {};
+static bool g_saved_valid = false;
+static bool g_dirty = false;
+static uint32_t g_first_change_ms = 0;
+static uint32_t g_last_change_ms = 0;
+static ConfigChangeListener g_listeners[CONFIG_LISTENER_COUNT] = {};
+// Slot holding the newest good record (-1 when there is none) and its
+// sequence number; saves go to the other slot.
+static int8_t g_active_slot = -1;
+static uint32_t g_sequence = 0;
+static bool g_legacy_present = false;
 
 /*
  * ensure_fs
@@ -45,6 +79,233 @@ static void computePulseSettings(uint8_t *outOn, uint8_t *outOff, uint8_t target
   *outOn = onSec;
   *outOff = static_cast<uint8_t>(offCalc);
 }
+
+/*
+ * crc32Update
+ * Feeds a buffer into a reflected CRC32 (IEEE 802.3 polynomial).
+ * Example:
+ *   uint32_t crc = crc32Update(0xFFFFFFFFUL, buf, len) ^ 0xFFFFFFFFUL;
+ */
+static uint32_t crc32Update(uint32_t crc, const uint8_t *data, size_t len) {
+  while (len--) {
+    crc ^= *data++;
+    for (uint8_t i = 0; i < 8; ++i) {
+      uint32_t mask = 0U - (crc & 1U);
+      crc = (crc >> 1) ^ (0xEDB88320UL & mask);
+    }
+  }
+  return crc;
+}
+
+/*
+ * recordCrc
+ * Computes the CRC stored in a record header.
+ * Example:
+ *   if (recordCrc(record) != record.header.crc) return false;
+ */
+static uint32_t recordCrc(const ConfigRecord &record) {
+  uint32_t crc = crc32Update(0xFFFFFFFFUL, reinterpret_cast<const uint8_t *>(&record.header),
+                             offsetof(ConfigRecordHeader, crc));
+  crc = crc32Update(crc, record.payload, record.header.length);
+  return crc ^ 0xFFFFFFFFUL;
+}
+
+/*
+ * ConfigV17
+ * Frozen layout of CONFIG_VERSION 17, before moistTempCompPer10C. When the
+ * Config struct changes, freeze the current one here as the next ConfigVnn
+ * and add a step to kMigrations.
+ */
+typedef struct {
+  uint8_t checksum;
+  uint8_t version;
+  uint8_t flags;
+
+  uint16_t moistSensorCalibrationSoaked;
+  uint16_t moistSensorCalibrationDry;
+
+  uint32_t dripperMsPerLiter;
+  uint16_t lightsOnMinutes;
+  uint16_t lightsOffMinutes;
+  uint16_t maxDailyWaterMl;
+  uint8_t pulseOnSeconds;
+  uint8_t pulseOffSeconds;
+  uint8_t pulseTargetUnits;
+  uint8_t baselineX;
+  uint8_t baselineY;
+  uint8_t baselineDelayMinutes;
+  uint8_t runoffExpectation[FEED_SLOT_COUNT];
+
+  uint16_t kbdUp;
+  uint16_t kbdDown;
+  uint16_t kbdLeft;
+  uint16_t kbdRight;
+  uint16_t kbdOk;
+  char feedSlotNames[FEED_SLOT_COUNT][FEED_SLOT_NAME_LENGTH + 1];
+  uint8_t feedSlotsPacked[FEED_SLOT_COUNT][FEED_SLOT_PACKED_SIZE];
+} ConfigV17;
+
+/*
+ * migrateV17
+ * Upgrades a version 17 layout to version 18 field by field.
+ * Example:
+ *   migrateV17(oldBytes, newBytes);
+ */
+static void migrateV17(const uint8_t *in, uint8_t *out) {
+  ConfigV17 from;
+  memcpy(&from, in, sizeof(from));
+  Config to;
+  memset(&to, 0, sizeof(to));
+  to.flags = from.flags;
+  to.moistSensorCalibrationSoaked = from.moistSensorCalibrationSoaked;
+  to.moistSensorCalibrationDry = from.moistSensorCalibrationDry;
+  to.dripperMsPerLiter = from.dripperMsPerLiter;
+  to.lightsOnMinutes = from.lightsOnMinutes;
+  to.lightsOffMinutes = from.lightsOffMinutes;
+  to.maxDailyWaterMl = from.maxDailyWaterMl;
+  to.pulseOnSeconds = from.pulseOnSeconds;
+  to.pulseOffSeconds = from.pulseOffSeconds;
+  to.pulseTargetUnits = from.pulseTargetUnits;
+  to.baselineX = from.baselineX;
+  to.baselineY = from.baselineY;
+  to.baselineDelayMinutes = from.baselineDelayMinutes;
+  to.moistTempCompPer10C = 0;
+  memcpy(to.runoffExpectation, from.runoffExpectation, sizeof(to.runoffExpectation));
+  to.kbdUp = from.kbdUp;
+  to.kbdDown = from.kbdDown;
+  to.kbdLeft = from.kbdLeft;
+  to.kbdRight = from.kbdRight;
+  to.kbdOk = from.kbdOk;
+  memcpy(to.feedSlotNames, from.feedSlotNames, sizeof(to.feedSlotNames));
+  memcpy(to.feedSlotsPacked, from.feedSlotsPacked, sizeof(to.feedSlotsPacked));
+  memcpy(out, &to, sizeof(to));
+}
+
+struct ConfigMigration {
+  uint16_t fromVersion;
+  uint16_t fromLength;
+  uint16_t toLength;
+  void (*upgrade)(const uint8_t *in, uint8_t *out);
+};
+
+// One step per layout change, each upgrading fromVersion to fromVersion + 1.
+const ConfigMigration kMigrations[] = {
+  {17, sizeof(ConfigV17), sizeof(Config), migrateV17},
+};
+
+static_assert(sizeof(ConfigV17) <= sizeof(Config), "migration buffers are sized for the current layout");
+
+/*
+ * migrateConfig
+ * Brings a stored layout up to CONFIG_VERSION through kMigrations and
+ * writes the result to out. Returns false for unknown or newer layouts.
+ * Example:
+ *   if (!migrateConfig(version, bytes, length, &config)) return false;
+ */
+static bool migrateConfig(uint16_t version, const uint8_t *data, uint16_t length, Config *out) {
+  if (version > CONFIG_VERSION || length > sizeof(Config)) return false;
+  uint8_t buffers[2][sizeof(Config)];
+  uint8_t current = 0;
+  memcpy(buffers[current], data, length);
+  while (version < CONFIG_VERSION) {
+    const ConfigMigration *step = nullptr;
+    for (const ConfigMigration &migration : kMigrations) {
+      if (migration.fromVersion == version) step = &migration;
+    }
+    if (!step || step->fromLength != length) return false;
+    memset(buffers[current ^ 1], 0, sizeof(buffers[0]));
+    step->upgrade(buffers[current], buffers[current ^ 1]);
+    current ^= 1;
+    length = step->toLength;
+    version++;
+    Serial.printf("[CONFIG] migrated layout v%u -> v%u\r\n", static_cast<unsigned>(version - 1),
+                  static_cast<unsigned>(version));
+  }
+  if (length != sizeof(Config)) return false;
+  memcpy(out, buffers[current], sizeof(Config));
+  out->version = CONFIG_VERSION;
+  return true;
+}
+
+/*
+ * readRecord
+ * Reads one A/B slot; returns true when its magic, length and CRC check out.
+ * Example:
+ *   ConfigRecord record;
+ *   if (readRecord(0, &record)) { ... }
+ */
+static bool readRecord(uint8_t slot, ConfigRecord *record) {
+  if (!LittleFS.exists(kConfigSlotPaths[slot])) return false;
+  flashStatsOpen(FLASH_FILE_CONFIG, FLASH_TAG_CONFIG);
+  File f = LittleFS.open(kConfigSlotPaths[slot], "r");
+  if (!f) return false;
+  size_t readLen = f.read(reinterpret_cast<uint8_t *>(&record->header), sizeof(record->header));
+  bool ok = readLen == sizeof(record->header) && record->header.magic == kRecordMagic &&
+            record->header.length <= sizeof(record->payload);
+  if (ok) {
+    size_t payloadLen = f.read(record->payload, record->header.length);
+    readLen += payloadLen;
+    ok = payloadLen == record->header.length && recordCrc(*record) == record->header.crc;
+  }
+  f.close();
+  flashStatsRead(FLASH_FILE_CONFIG, FLASH_TAG_CONFIG, readLen);
+  return ok;
+}
+
+/*
+ * writeRecord
+ * Writes the global config to a slot and reads it back; returns true only
+ * when the stored copy verifies.
+ * Example:
+ *   if (writeRecord(1, g_sequence + 1)) g_active_slot = 1;
+ */
+static bool writeRecord(uint8_t slot, uint32_t sequence) {
+  ConfigRecord record;
+  record.header.magic = kRecordMagic;
+  record.header.sequence = sequence;
+  record.header.version = CONFIG_VERSION;
+  record.header.length = sizeof(Config);
+  memcpy(record.payload, &config, sizeof(Config));
+  record.header.crc = recordCrc(record);
+
+  flashStatsOpen(FLASH_FILE_CONFIG, FLASH_TAG_CONFIG);
+  File f = LittleFS.open(kConfigSlotPaths[slot], "w");
+  if (!f) return false;
+  size_t written = f.write(reinterpret_cast<const uint8_t *>(&record), sizeof(record));
+  f.flush();
+  f.close();
+  flashStatsWrite(FLASH_FILE_CONFIG, FLASH_TAG_CONFIG, written);
+  flashStatsFlush(FLASH_FILE_CONFIG, FLASH_TAG_CONFIG, 0, sizeof(record));
+  if (written != sizeof(record)) return false;
+
+  ConfigRecord check;
+  return readRecord(slot, &check) && check.header.sequence == sequence &&
+         memcmp(check.payload, record.payload, sizeof(Config)) == 0;
+}
+
+/*
+ * loadLegacy
+ * Reads the pre-A/B /config.bin and migrates it into the global config.
+ * Example:
+ *   if (loadLegacy()) saveConfig();
+ */
+static bool loadLegacy() {
+  if (!LittleFS.exists(kLegacyConfigPath)) return false;
+  flashStatsOpen(FLASH_FILE_CONFIG, FLASH_TAG_CONFIG);
+  File f = LittleFS.open(kLegacyConfigPath, "r");
+  if (!f) return false;
+  g_legacy_present = true;
+  uint8_t buffer[sizeof(Config)];
+  size_t readLen = f.read(buffer, sizeof(buffer));
+  f.close();
+  flashStatsRead(FLASH_FILE_CONFIG, FLASH_TAG_CONFIG, readLen);
+  if (readLen < 2) return false;
+  // The old format carried an XOR checksum in byte 0 and the version in byte 1.
+  uint8_t hash = 0xA5;
+  for (size_t i = 1; i < readLen; ++i) hash ^= buffer[i];
+  if (hash != buffer[0]) return false;
+  return migrateConfig(buffer[1], buffer, static_cast<uint16_t>(readLen), &config);
+}
 } // namespace
 
 Config config;
@@ -84,6 +345,7 @@ void restoreDefaultConfig() {
   config.baselineX = 10;
   config.baselineY = 5;
   config.baselineDelayMinutes = 1;
+  config.moistTempCompPer10C = 0;
   memset(config.runoffExpectation, 0, sizeof(config.runoffExpectation));
   memset(config.feedSlotNames, 0, sizeof(config.feedSlotNames));
   memset(config.feedSlotsPacked, 0, sizeof(config.feedSlotsPacked));
@@ -91,28 +353,113 @@ void restoreDefaultConfig() {
 }
 
 void saveConfig() {
-  if (!ensure_fs()) return;
+  // A failed write is not retried until the next change; retrying from
+  // configTick() would spin the loop while the filesystem is unusable.
+  g_dirty = false;
   setConfigChecksum();
-  File f = LittleFS.open(kConfigPath, "w");
-  if (!f) return;
-  f.write(reinterpret_cast<const uint8_t *>(&config), sizeof(config));
-  f.flush();
-  f.close();
+  if (g_saved_valid && memcmp(&g_saved, &config, sizeof(config)) == 0) return;
+  if (!ensure_fs()) return;
+  uint8_t target = (g_active_slot == 0) ? 1 : 0;
+  uint32_t sequence = g_sequence + 1;
+  if (!writeRecord(target, sequence)) {
+    // The previous record in the other slot is untouched and still loads.
+    Serial.printf("[CONFIG] save to slot %c failed\r\n", 'A' + target);
+    return;
+  }
+  g_active_slot = static_cast<int8_t>(target);
+  g_sequence = sequence;
+  g_saved = config;
+  g_saved_valid = true;
+  if (g_legacy_present) {
+    LittleFS.remove(kLegacyConfigPath);
+    g_legacy_present = false;
+  }
+}
+
+void markConfigDirty(uint16_t fields) {
+  uint32_t now = millis();
+  if (!g_dirty) g_first_change_ms = now;
+  g_last_change_ms = now;
+  g_dirty = true;
+  for (uint8_t i = 0; i < CONFIG_LISTENER_COUNT; ++i) {
+    if (g_listeners[i]) g_listeners[i](fields);
+  }
+}
+
+void flushConfig() {
+  if (g_dirty) saveConfig();
+}
+
+void configTick(uint32_t nowMs) {
+  if (!g_dirty) return;
+  if (nowMs - g_last_change_ms >= CONFIG_SAVE_QUIET_MS || nowMs - g_first_change_ms >= CONFIG_SAVE_MAX_DELAY_MS) {
+    saveConfig();
+  }
+}
+
+uint32_t configSaveIdleMs(uint32_t nowMs) {
+  if (!g_dirty) return UINT32_MAX;
+  uint32_t sinceLast = nowMs - g_last_change_ms;
+  uint32_t sinceFirst = nowMs - g_first_change_ms;
+  if (sinceLast >= CONFIG_SAVE_QUIET_MS || sinceFirst >= CONFIG_SAVE_MAX_DELAY_MS) return 0;
+  uint32_t quietLeft = CONFIG_SAVE_QUIET_MS - sinceLast;
+  uint32_t maxLeft = CONFIG_SAVE_MAX_DELAY_MS - sinceFirst;
+  return quietLeft < maxLeft ? quietLeft : maxLeft;
+}
+
+bool configIsDirty() {
+  return g_dirty;
+}
+
+bool addConfigListener(ConfigChangeListener listener) {
+  if (!listener) return false;
+  for (uint8_t i = 0; i < CONFIG_LISTENER_COUNT; ++i) {
+    if (g_listeners[i] == listener) return true;
+    if (!g_listeners[i]) {
+      g_listeners[i] = listener;
+      return true;
+    }
+  }
+  return false;
 }
 
 bool loadConfig() {
   if (!ensure_fs()) return false;
-  File f = LittleFS.open(kConfigPath, "r");
-  if (!f) return false;
-  size_t read_len = f.read(reinterpret_cast<uint8_t *>(&config), sizeof(config));
-  f.close();
-  return read_len == sizeof(config);
+  g_saved_valid = false;
+  g_active_slot = -1;
+  g_sequence = 0;
+  ConfigRecord records[2];
+  bool valid[2] = {readRecord(0, &records[0]), readRecord(1, &records[1])};
+  // Newest first, by sequence distance so the counter may wrap.
+  uint8_t order[2] = {0, 1};
+  if (valid[0] && valid[1] && static_cast<int32_t>(records[1].header.sequence - records[0].header.sequence) > 0) {
+    order[0] = 1;
+    order[1] = 0;
+  }
+  for (uint8_t slot : order) {
+    if (!valid[slot]) continue;
+    const ConfigRecord &record = records[slot];
+    if (!migrateConfig(record.header.version, record.payload, record.header.length, &config)) continue;
+    g_active_slot = static_cast<int8_t>(slot);
+    g_sequence = record.header.sequence;
+    if (record.header.version == CONFIG_VERSION) {
+      setConfigChecksum();
+      g_saved = config;
+      g_saved_valid = true;
+    }
+    return true;
+  }
+  return loadLegacy();
 }
 
 void initConfig() {
-  if (!loadConfig() || !validateConfig()) {
+  if (!loadConfig()) {
     restoreDefaultConfig();
     saveConfig();
+  } else if (!g_saved_valid) {
+    // Migrated from an older layout; store it in the current one so the
+    // upgrade only runs once.
+    saveConfig();
   }
   applySimDefaults();
 }
@@ -197,3 +544,62 @@ void applySimDefaults() {
 
   if (changed) saveConfig();
 }
+
+bool seedDefaultSlotsIfEmpty() {
+  const uint8_t kMoistureBaselineSentinel = 127;
+  for (uint8_t i = 0; i < FEED_SLOT_COUNT; ++i) {
+    if (config.feedSlotNames[i][0] != '\0') return false;
+    for (uint8_t b = 0; b < FEED_SLOT_PACKED_SIZE; ++b) {
+      if (config.feedSlotsPacked[i][b] != 0) return false;
+    }
+  }
+
+  for (uint8_t i = 0; i < FEED_SLOT_COUNT; ++i) {
+    FeedSlot slot = {};
+    if (i == 0) {
+      slot.windowStartMinutes = 0;
+      slot.windowDurationMinutes = 0;
+      slot.minGapMinutes = 60;
+      slot.maxVolumeMl = 50;
+      slot.runoffHold5s = 0;
+      slot.flags = static_cast<uint8_t>(FEED_SLOT_ENABLED | FEED_SLOT_HAS_TIME_WINDOW |
+                                        FEED_SLOT_RUNOFF_AVOID);
+      config.runoffExpectation[i] = 2;
+      strncpy(config.feedSlotNames[i], "INIT", FEED_SLOT_NAME_LENGTH);
+      config.feedSlotNames[i][FEED_SLOT_NAME_LENGTH] = '\0';
+    } else if (i == 1) {
+      slot.windowStartMinutes = 30;
+      slot.windowDurationMinutes = 0;
+      // Shorter than the 30 minutes since INIT, or the gap swallows the SOAK.
+      slot.minGapMinutes = 20;
+      slot.maxVolumeMl = 800;
+      slot.runoffHold5s = 6;
+      slot.flags = static_cast<uint8_t>(FEED_SLOT_ENABLED | FEED_SLOT_HAS_TIME_WINDOW |
+                                        FEED_SLOT_RUNOFF_REQUIRED | FEED_SLOT_BASELINE_SETTER);
+      config.runoffExpectation[i] = 1;
+      strncpy(config.feedSlotNames[i], "SOAK", FEED_SLOT_NAME_LENGTH);
+      config.feedSlotNames[i][FEED_SLOT_NAME_LENGTH] = '\0';
+    } else if (i == 2) {
+      slot.windowStartMinutes = 120;
+      slot.windowDurationMinutes = 14 * 60;
+      slot.moistureBelow = kMoistureBaselineSentinel;
+      slot.moistureTarget = kMoistureBaselineSentinel;
+      slot.minGapMinutes = 60;
+      slot.maxVolumeMl = 50;
+      slot.runoffHold5s = 0;
+      slot.flags = static_cast<uint8_t>(FEED_SLOT_ENABLED | FEED_SLOT_HAS_TIME_WINDOW |
+                                        FEED_SLOT_HAS_MOISTURE_BELOW | FEED_SLOT_HAS_MOISTURE_TARGET |
+                                        FEED_SLOT_RUNOFF_AVOID | FEED_SLOT_BASELINE_SETTER);
+      config.runoffExpectation[i] = 2;
+      strncpy(config.feedSlotNames[i], "REC", FEED_SLOT_NAME_LENGTH);
+      config.feedSlotNames[i][FEED_SLOT_NAME_LENGTH] = '\0';
+    } else {
+      slot.flags = 0;
+      config.feedSlotNames[i][0] = '\0';
+      config.runoffExpectation[i] = 0;
+    }
+    packFeedSlot(config.feedSlotsPacked[i], &slot);
+  }
+  markConfigDirty(CONFIG_FIELD_SLOTS);
+  return true;
+}
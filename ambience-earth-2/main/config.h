@@ -3,7 +3,9 @@
 #include <stdint.h>
 #include "feedSlots.h"
 
-#define CONFIG_VERSION 17
+// Bump on any layout change and add a migration step in config.cpp; stored
+// configs are upgraded, never reset, on a version change.
+#define CONFIG_VERSION 18
 #define CONFIG_FLAG_MUST_RUN_INITIAL_SETUP 0x01
 #define CONFIG_FLAG_FEEDING_DISABLED 0x02
 #define CONFIG_FLAG_DRIPPER_CALIBRATED 0x04
@@ -13,6 +15,24 @@
 #define CONFIG_FLAG_MAX_DAILY_SET 0x40
 #define CONFIG_FLAG_PULSE_SET 0x80
 
+// Field groups passed to markConfigDirty() and on to change listeners.
+#define CONFIG_FIELD_FEEDING 0x0001      // CONFIG_FLAG_FEEDING_DISABLED
+#define CONFIG_FIELD_MOIST_CAL 0x0002    // moisture dry/soaked calibration
+#define CONFIG_FIELD_DRIPPER 0x0004      // dripper rate and pulse settings
+#define CONFIG_FIELD_LIGHTS 0x0008       // lights on/off minutes
+#define CONFIG_FIELD_MAX_DAILY 0x0010    // maxDailyWaterMl
+#define CONFIG_FIELD_BASELINE 0x0020     // baselineX/Y/delay
+#define CONFIG_FIELD_TEMP_COMP 0x0040    // moistTempCompPer10C
+#define CONFIG_FIELD_SLOTS 0x0080        // packed slots, names, runoff expectation
+#define CONFIG_FIELD_TIME 0x0100         // CONFIG_FLAG_TIME_SET
+#define CONFIG_FIELD_ALL 0xFFFF
+
+// A dirty config is saved once it has been left alone for the quiet period,
+// and never later than the max delay after the first unsaved change.
+#define CONFIG_SAVE_QUIET_MS 10000UL
+#define CONFIG_SAVE_MAX_DELAY_MS 60000UL
+#define CONFIG_LISTENER_COUNT 4
+
 typedef struct {
   uint8_t checksum;
   uint8_t version;
@@ -31,6 +51,7 @@ typedef struct {
   uint8_t baselineX;
   uint8_t baselineY;
   uint8_t baselineDelayMinutes;
+  int8_t moistTempCompPer10C;
   uint8_t runoffExpectation[FEED_SLOT_COUNT];
 
   uint16_t kbdUp;
@@ -44,6 +65,8 @@ typedef struct {
 
 extern Config config;
 
+typedef void (*ConfigChangeListener)(uint16_t fields);
+
 /*
  * calculateConfigChecksum
  * Computes the checksum used to validate persisted config data.
@@ -78,15 +101,71 @@ bool validateConfig();
 
 /*
  * saveConfig
- * Persists the current config to flash storage.
+ * Persists the current config to flash storage right away, as a CRC32
+ * record in whichever A/B slot does not hold the last good save. Skips the
+ * write when nothing changed since the last save. Prefer markConfigDirty().
  * Example:
  *   saveConfig();
  */
 void saveConfig();
 
+/*
+ * markConfigDirty
+ * Notes that fields of the global config changed, tells the listeners, and
+ * schedules a debounced save from configTick().
+ * Example:
+ *   config.baselineX = 12;
+ *   markConfigDirty(CONFIG_FIELD_BASELINE);
+ */
+void markConfigDirty(uint16_t fields);
+
+/*
+ * flushConfig
+ * Saves a dirty config now. Use for safety-critical changes and before a
+ * reboot.
+ * Example:
+ *   markConfigDirty(CONFIG_FIELD_FEEDING);
+ *   flushConfig();
+ */
+void flushConfig();
+
+/*
+ * configTick
+ * Saves a dirty config once its debounce has run out.
+ * Example:
+ *   configTick(millis());
+ */
+void configTick(uint32_t nowMs);
+
+/*
+ * configSaveIdleMs
+ * Returns how long the loop may sleep before configTick() has work to do.
+ * Example:
+ *   uint32_t idle = configSaveIdleMs(millis());
+ */
+uint32_t configSaveIdleMs(uint32_t nowMs);
+
+/*
+ * configIsDirty
+ * Returns true while changes are waiting for the debounced save.
+ * Example:
+ *   if (configIsDirty()) flushConfig();
+ */
+bool configIsDirty();
+
+/*
+ * addConfigListener
+ * Registers a callback run from markConfigDirty() with the changed field
+ * groups. Returns false when all CONFIG_LISTENER_COUNT slots are taken.
+ * Example:
+ *   addConfigListener(onConfigChanged);
+ */
+bool addConfigListener(ConfigChangeListener listener);
+
 /*
  * loadConfig
- * Loads the config from flash storage into the global struct.
+ * Loads the newest valid A/B record (or the old single-file config) into
+ * the global struct, migrating older layouts to CONFIG_VERSION.
  * Example:
  *   if (!loadConfig()) restoreDefaultConfig();
  */
@@ -94,7 +173,8 @@ bool loadConfig();
 
 /*
  * initConfig
- * Loads config from storage or restores defaults when invalid.
+ * Loads config from storage, re-saving it when it was migrated, or restores
+ * defaults when nothing readable is stored.
  * Example:
  *   initConfig();
  */
@@ -107,3 +187,12 @@ void initConfig();
  *   applySimDefaults();
  */
 void applySimDefaults();
+
+/*
+ * seedDefaultSlotsIfEmpty
+ * Fills the INIT/SOAK/REC example schedule into a config with no slots and
+ * marks it dirty; returns false and leaves the config alone otherwise.
+ * Example:
+ *   if (seedDefaultSlotsIfEmpty()) flushConfig();
+ */
+bool seedDefaultSlotsIfEmpty();
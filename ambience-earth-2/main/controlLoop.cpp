@@ -0,0 +1,70 @@
+#include "controlLoop.h"
+
+#include "config.h"
+#include "feeding.h"
+#include "flashStats.h"
+#include "logs.h"
+#include "moistureSensor.h"
+#include "profiler.h"
+#include "rtc.h"
+#include "soilTempSensor.h"
+
+namespace {
+uint32_t lastValuesLogMs = 0;
+SoilSensorHealth loggedSensorHealth = SENSOR_OK;
+} // namespace
+
+void controlLoopInit() {
+  lastValuesLogMs = millis();
+  loggedSensorHealth = SENSOR_OK;
+}
+
+void controlLoopTick(EpochTime now) {
+  uint32_t nowMs = millis();
+  flashStatsTick(now);
+  configTick(nowMs);
+
+  {
+    PROFILE_SCOPE(PROF_SENSORS);
+    runSoilSensorLazyReadings();
+    runSoilTempSensor();
+  }
+  {
+    PROFILE_SCOPE(PROF_FEEDING);
+    feedingTick();
+    feedingBaselineTick();
+  }
+
+  SoilSensorHealth health = soilSensorHealth();
+  bool healthChanged = (health == SENSOR_FAILED) != (loggedSensorHealth == SENSOR_FAILED);
+  if (healthChanged && (health != SENSOR_SUSPECT)) {
+    PROFILE_SCOPE(PROF_LOGGING);
+    loggedSensorHealth = health;
+    add_log(build_sensor_log());
+  }
+
+  if (soilSensorReady() && (nowMs - lastValuesLogMs >= kLogValuesIntervalMs)) {
+    PROFILE_SCOPE(PROF_LOGGING);
+    lastValuesLogMs = nowMs;
+    if (health != SENSOR_FAILED) add_log(build_value_log());
+  }
+}
+
+uint32_t controlLoopIdleMs() {
+  uint32_t idle = soilSensorIdleMs();
+  uint32_t tempIdle = soilTempIdleMs();
+  if (tempIdle < idle) idle = tempIdle;
+
+  uint32_t sinceValuesLog = millis() - lastValuesLogMs;
+  uint32_t valuesIdle = (sinceValuesLog >= kLogValuesIntervalMs) ? 0 : kLogValuesIntervalMs - sinceValuesLog;
+  if (valuesIdle < idle) idle = valuesIdle;
+
+  // Feed windows are evaluated per RTC minute, so never sleep across one.
+  uint64_t nowMs = rtcNowMs();
+  uint32_t minuteIdle = nowMs ? 60000UL - static_cast<uint32_t>(nowMs % 60000ULL) : 1000UL;
+  if (minuteIdle < idle) idle = minuteIdle;
+
+  uint32_t configIdle = configSaveIdleMs(millis());
+  if (configIdle < idle) idle = configIdle;
+  return idle;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "epochTime.h"
+
+/*
+ * controlLoopInit
+ * Restarts the hourly values log and sensor-health tracking from now.
+ * Call after the sensors, logs and feeding runtime are initialized.
+ * Example:
+ *   controlLoopInit();
+ */
+void controlLoopInit();
+
+/*
+ * controlLoopTick
+ * Runs one pass of the control work: the config save debounce, flash wear
+ * totals, soil sensors, feeding and its baseline, and the sensor-health and
+ * hourly values logs. now is the wall-clock time the UI shows.
+ * Example:
+ *   controlLoopTick(g_sim.now);
+ */
+void controlLoopTick(EpochTime now);
+
+/*
+ * controlLoopIdleMs
+ * Returns milliseconds until controlLoopTick next has work: a sensor window
+ * or conversion, the values log, a config save, or the next RTC minute.
+ * Example:
+ *   uint32_t idle = controlLoopIdleMs();
+ */
+uint32_t controlLoopIdleMs();
@@ -1,299 +0,0 @@
-#pragma once
-
-#include "lvgl_config.h"
-
-static const int16_t kIconSize = 32;
-
-static const uint16_t kSunPixels[32 * 32] = {
-  0x026F, 0x026E, 0x022E, 0x01EC, 0x020D, 0x022D, 0x020C, 0x022D,
-  0x0A4E, 0x0A4D, 0x0A4E, 0x0A4E, 0x0A8F, 0x0A4D, 0x0A6E, 0x0A6F,
-  0x0A8F, 0x0A6E, 0x0A6E, 0x0A4E, 0x024E, 0x024E, 0x024E, 0x024E,
-  0x024E, 0x024F, 0x024E, 0x022E, 0x024F, 0x022E, 0x024F, 0x022F,
-  0x0CBD, 0x0CBD, 0x0CDD, 0x0CDD, 0x0CDD, 0x14FE, 0x14FD, 0x14FD,
-  0x14DC, 0x1CDC, 0x1CDC, 0x1C58, 0x13D5, 0x1C16, 0x2458, 0x2C34,
-  0x24B9, 0x24BA, 0x1CDB, 0x1D1E, 0x14FE, 0x14FE, 0x14DE, 0x0CBD,
-  0x0C9D, 0x0C9D, 0x0C7D, 0x0C7D, 0x0C7D, 0x045D, 0x045C, 0x043C,
-  0x0C9B, 0x14BC, 0x147B, 0x1418, 0x1417, 0x13B5, 0x0A4D, 0x1332,
-  0x0A0B, 0x0946, 0x0967, 0x0083, 0x0000, 0x0041, 0x10E4, 0xDEE2,
-  0x63C6, 0x0063, 0x0905, 0x126D, 0x122C, 0x12D0, 0x13B5, 0x13F7,
-  0x147A, 0x149B, 0x149C, 0x0C7B, 0x0C5B, 0x0C3B, 0x041B, 0x041B,
-  0x147A, 0x13B6, 0x0A6E, 0x0083, 0x00C4, 0x00A3, 0x0000, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73C3, 0xFFE1,
-  0xD662, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0062, 0x0062,
-  0x00E5, 0x0A0B, 0x0A4D, 0x1419, 0x147B, 0x0C5B, 0x0C3B, 0x041B,
-  0x1353, 0x00C4, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0881, 0xDF22, 0xFFE0,
-  0xFFE0, 0x6302, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x09EB, 0x1396, 0x13D8, 0x0C3B, 0x0C1B,
-  0x00E5, 0x0021, 0x0000, 0x0000, 0x08A2, 0x3205, 0x0021, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5AC2, 0xFFC0, 0xFF00,
-  0xFF60, 0xDD82, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x21C6, 0x29E6, 0x0083, 0x0926, 0x09CA, 0x143A, 0x0C3B,
-  0x0021, 0x0000, 0x0000, 0x0000, 0x29C3, 0xFFE5, 0xD6A4, 0x8464,
-  0x2962, 0x0000, 0x0000, 0x0020, 0x0020, 0x20C0, 0x61C1, 0x61A1,
-  0x69C2, 0x4121, 0x0020, 0x0000, 0x0000, 0x0000, 0x0041, 0x52A2,
-  0xADA3, 0xF7A3, 0x83A4, 0x0021, 0x0061, 0x0021, 0x13D7, 0x0C5B,
-  0x0020, 0x0000, 0x0000, 0x0000, 0x0001, 0xD5E1, 0xFFE0, 0xFFE0,
-  0xFFE2, 0x9C82, 0x0020, 0x0000, 0x0000, 0x0000, 0x0040, 0x08A0,
-  0x0880, 0x0000, 0x0000, 0x0000, 0x0000, 0x39C1, 0xD6E2, 0xFFE2,
-  0xFFE0, 0xFEC1, 0x28C1, 0x0000, 0x0020, 0x0000, 0x1396, 0x147C,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7303, 0xFFA0, 0xF780,
-  0xFE40, 0x7A81, 0x0000, 0x31A1, 0x94A0, 0xD680, 0xF782, 0xFFC2,
-  0xFFA1, 0xE700, 0xAD40, 0x5281, 0x0000, 0x3101, 0xF5E1, 0xFF80,
-  0xFF80, 0xBBE1, 0x0000, 0x0000, 0x0000, 0x0000, 0x1312, 0x147C,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1061, 0xED62, 0xFD21,
-  0x5100, 0x0000, 0x9CA0, 0xFFE3, 0xFFEA, 0xFFF0, 0xFFF3, 0xFFF3,
-  0xFFF2, 0xFFEF, 0xFFE9, 0xFFE2, 0xC5E1, 0x2100, 0x2040, 0xCC01,
-  0xFDC1, 0x4121, 0x0000, 0x0000, 0x0000, 0x0000, 0x122C, 0x1C5A,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3902, 0x4122,
-  0x0880, 0xCE40, 0xFFE6, 0xFFF3, 0xFFD6, 0xFFF5, 0xFFF1, 0xFFEB,
-  0xFFE7, 0xFFC6, 0xFFC7, 0xFFC4, 0xFFE0, 0xF721, 0x41E1, 0x0000,
-  0x5982, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x08E5, 0x1BD7,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0xC5E0, 0xFFE6, 0xFFB4, 0xFFF4, 0xFFF1, 0xFFE7, 0xFFC0, 0xFFC0,
-  0xFFC0, 0xFFA0, 0xFFA0, 0xFF80, 0xFF40, 0xFF40, 0xFEA1, 0x3140,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0947, 0x2438,
-  0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x6B01,
-  0xFFE1, 0xFFD0, 0xFFF3, 0xFFF0, 0xFFC2, 0xFFC0, 0xFFA0, 0xFFA0,
-  0xFF80, 0xFF80, 0xFF80, 0xFF60, 0xFF40, 0xFF00, 0xFF00, 0xCD01,
-  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0905, 0x23F7,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3182, 0x39E2, 0x0000, 0xD620,
-  0xFFE5, 0xFFD1, 0xFFF0, 0xFFC3, 0xFFA0, 0xFFA0, 0xFF80, 0xFF80,
-  0xFF60, 0xFF60, 0xFF40, 0xFF40, 0xFF20, 0xFF00, 0xFEA0, 0xFE60,
-  0x41A1, 0x0000, 0x39C1, 0x10C1, 0x0000, 0x0000, 0x1167, 0x2C58,
-  0x0000, 0x0881, 0x6B62, 0xC622, 0xFFE3, 0xD602, 0x20C0, 0xFF00,
-  0xFFA2, 0xFFF0, 0xFFC8, 0xFF80, 0xFF80, 0xFF60, 0xFF60, 0xFF40,
-  0xFF40, 0xFF20, 0xFF20, 0xFF00, 0xFEE0, 0xFEC0, 0xFEA0, 0xFE60,
-  0x8301, 0x20C1, 0xFFC2, 0xEF42, 0x9D03, 0x39E2, 0x1A6C, 0x3478,
-  0x31A3, 0xEF03, 0xFFE0, 0xFFE0, 0xFFE0, 0xD500, 0x5201, 0xFF40,
-  0xFF40, 0xFFC8, 0xFF84, 0xFF60, 0xFF40, 0xFF40, 0xFF20, 0xFF20,
-  0xFF00, 0xFF00, 0xFEE0, 0xFEC0, 0xFEC0, 0xFEA0, 0xFE80, 0xFE20,
-  0xABA0, 0x3921, 0xFEC0, 0xFF80, 0xFFE0, 0xFFE0, 0xB567, 0x3417,
-  0x1880, 0x82A2, 0xDCA1, 0xFE20, 0xFFA0, 0xDD00, 0x51C1, 0xFEC0,
-  0xFF00, 0xFF40, 0xFF40, 0xFF20, 0xFF20, 0xFF00, 0xFF00, 0xFEE0,
-  0xFEE0, 0xFEC0, 0xFEC0, 0xFEA0, 0xFEA0, 0xFE80, 0xFE60, 0xFE00,
-  0xA360, 0x28C0, 0xFEA0, 0xFEC0, 0xF520, 0xBBA1, 0x5981, 0x1A6D,
-  0x0000, 0x0000, 0x0800, 0x40A1, 0x8A41, 0x7A01, 0x18C0, 0xFE00,
-  0xFEE0, 0xFF00, 0xFEE0, 0xFEE0, 0xFEE0, 0xFEC0, 0xFEC0, 0xFEC0,
-  0xFEA0, 0xFEA0, 0xFE80, 0xFE80, 0xFE60, 0xFE60, 0xFE40, 0xFDA0,
-  0x8AE1, 0x1060, 0xAB22, 0x7181, 0x2841, 0x0000, 0x0000, 0x1188,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0xD4E1,
-  0xFE40, 0xFEE0, 0xFEA0, 0xFEC0, 0xFEA0, 0xFEA0, 0xFE80, 0xFE80,
-  0xFE80, 0xFE80, 0xFE60, 0xFE40, 0xFE40, 0xFE40, 0xFDC0, 0xFD20,
-  0x4981, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x11A9,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x7AA1,
-  0xFDC0, 0xFE20, 0xFEA0, 0xFE60, 0xFE60, 0xFE60, 0xFE40, 0xFE40,
-  0xFE40, 0xFE40, 0xFE20, 0xFE20, 0xFE20, 0xFE00, 0xFD00, 0xD3E1,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x11EB,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1060, 0x0840,
-  0xDC61, 0xFD20, 0xFDE0, 0xFE60, 0xFE20, 0xFE00, 0xFE00, 0xFE00,
-  0xFE00, 0xFDE0, 0xFDE0, 0xFE00, 0xFE00, 0xFCC0, 0xFC80, 0x30E0,
-  0x1060, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0041, 0x1A0C,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A1, 0xE701, 0x8361,
-  0x1860, 0xE441, 0xFC80, 0xFD20, 0xFDE0, 0xFE00, 0xFE00, 0xFDE0,
-  0xFDE0, 0xFDE0, 0xFDC0, 0xFD60, 0xFC60, 0xFC40, 0x5161, 0x20C0,
-  0xEEE1, 0x8382, 0x0000, 0x0000, 0x0000, 0x0000, 0x0041, 0x11CA,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x83E2, 0xFFE0, 0xFF20,
-  0x72A0, 0x2080, 0xB321, 0xFBE0, 0xFC20, 0xFCA0, 0xFCE0, 0xFD00,
-  0xFD00, 0xFCC0, 0xFC40, 0xFBE0, 0xCB41, 0x3920, 0x2940, 0xEEC0,
-  0xFFA0, 0xF661, 0x18A1, 0x0000, 0x0000, 0x0000, 0x0021, 0x120B,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xDEC1, 0xFF60, 0xFEA0,
-  0xFD40, 0x2080, 0x0000, 0x4941, 0xA281, 0xD301, 0xEB20, 0xF320,
-  0xEB40, 0xDB00, 0xB2A1, 0x5981, 0x0020, 0x0000, 0xD4C2, 0xFF20,
-  0xFEE0, 0xFF60, 0x7B62, 0x0000, 0x0020, 0x0000, 0x0021, 0x1A6E,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x5262, 0xFF00, 0xF461, 0xA242,
-  0x3061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x30E1, 0x3900,
-  0x3921, 0x18A0, 0x0000, 0x0000, 0x0000, 0x0000, 0x1841, 0x8202,
-  0xDC01, 0xFDE0, 0xEDA1, 0x0861, 0x0000, 0x0000, 0x08A3, 0x22F1,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2922, 0x69C3, 0x2021, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x5A61, 0xEEE0, 0xEE60,
-  0xEEC0, 0xCCE1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0801, 0x48E2, 0x7A43, 0x1081, 0x0041, 0x0000, 0x0927, 0x2394,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2901, 0xFEA0, 0xFEE0,
-  0xFEE0, 0x9B01, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0041, 0x0041, 0x0000, 0x1A4D, 0x23D7,
-  0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xB402, 0xFF20,
-  0xF541, 0x2081, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x0000, 0x0021, 0x0062, 0x0082, 0x2333, 0x23D7,
-  0x0905, 0x0062, 0x0082, 0x0000, 0x0000, 0x0061, 0x0000, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3101, 0xFDE0,
-  0x92A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0021, 0x0041, 0x08C4, 0x0926, 0x1189, 0x2C18, 0x2418,
-  0x2B93, 0x2B52, 0x2310, 0x08E5, 0x1168, 0x1A0A, 0x0882, 0x19EA,
-  0x08A3, 0x08C4, 0x1988, 0x1126, 0x08C4, 0x1105, 0x224B, 0x7B4B,
-  0x4B2D, 0x2A4B, 0x19A8, 0x220A, 0x1146, 0x08A3, 0x08C4, 0x0882,
-  0x1147, 0x228E, 0x1A2C, 0x2312, 0x2B95, 0x23D7, 0x23F8, 0x23F8,
-  0x3499, 0x349A, 0x3458, 0x2BD5, 0x3458, 0x3438, 0x2BD5, 0x3437,
-  0x3416, 0x33B4, 0x3C58, 0x3C78, 0x3C37, 0x3C37, 0x44B9, 0x3C99,
-  0x4499, 0x44B9, 0x4499, 0x3C58, 0x3437, 0x2BD6, 0x2BF7, 0x2BF7,
-  0x2C38, 0x2C59, 0x2C59, 0x2C5A, 0x2C3A, 0x243A, 0x243A, 0x241A,
-  0x1A6E, 0x1AAF, 0x1AAF, 0x1A8E, 0x1AAF, 0x1AD0, 0x1A8F, 0x2311,
-  0x22F1, 0x22D0, 0x22AF, 0x22AF, 0x22AF, 0x22D0, 0x1A8F, 0x22D0,
-  0x22D0, 0x1A6E, 0x1A8F, 0x1AAF, 0x1A6E, 0x1AAF, 0x1A6E, 0x1AB0,
-  0x1A8F, 0x1A6F, 0x126E, 0x128F, 0x128F, 0x124E, 0x126F, 0x122E,
-};
-
-static const uint16_t kMoonPixels[32 * 32] = {
-  0x0086, 0x0087, 0x0087, 0x0087, 0x0087, 0x0087, 0x0087, 0x0087,
-  0x0087, 0x0087, 0x0087, 0x0087, 0x0087, 0x0087, 0x00A7, 0x00A7,
-  0x00A7, 0x0087, 0x0087, 0x0087, 0x0087, 0x0087, 0x0087, 0x0087,
-  0x0088, 0x0087, 0x0087, 0x0088, 0x0088, 0x0088, 0x0088, 0x0065,
-  0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EB, 0x00EB, 0x00EB,
-  0x00EB, 0x00EB, 0x00EB, 0x00EB, 0x010B, 0x00EB, 0x00AB, 0x006C,
-  0x00AC, 0x00EB, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC,
-  0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00ED, 0x00EC,
-  0x00EC, 0x00EC, 0x00EB, 0x00EB, 0x00EB, 0x00EB, 0x00EB, 0x00EB,
-  0x00EB, 0x00EB, 0x010A, 0x00CB, 0x004B, 0x00AB, 0x2189, 0x52E7,
-  0x4268, 0x00AB, 0x00EB, 0x00CB, 0x00EB, 0x00CB, 0x00CB, 0x00CB,
-  0x00CB, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00EC, 0x00CB,
-  0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EB, 0x00EB, 0x00EB, 0x00EB,
-  0x00EB, 0x00EA, 0x006B, 0x110A, 0x73C6, 0xCE42, 0xFFC0, 0xF700,
-  0x31E9, 0x00AB, 0x00EB, 0x00CB, 0x00EB, 0x00EC, 0x00CB, 0x196D,
-  0x00EC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00EC, 0x00CB,
-  0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EB, 0x00EB, 0x00EB, 0x00EB,
-  0x00EB, 0x006B, 0x6347, 0xE721, 0xFFE0, 0xFFE0, 0xFF40, 0x4248,
-  0x004C, 0x00EB, 0x00EB, 0x00CC, 0x00EC, 0x010C, 0x008B, 0x8C95,
-  0x092D, 0x00CC, 0x00EC, 0x00CC, 0x00EC, 0x00CC, 0x00ED, 0x00CC,
-  0x00ED, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EB, 0x00EB, 0x00CB,
-  0x00AB, 0x9D04, 0xFFE0, 0xFFE0, 0xF7C0, 0xFF60, 0xA464, 0x006C,
-  0x00EB, 0x00CC, 0x00EC, 0x00EC, 0x00AC, 0x000A, 0x21AE, 0xFFBF,
-  0x5B53, 0x000A, 0x00AC, 0x00EC, 0x00EC, 0x00EC, 0x00ED, 0x00CC,
-  0x00ED, 0x00ED, 0x00EC, 0x00EC, 0x00EC, 0x00EC, 0x00EB, 0x008B,
-  0xAD64, 0xFFE3, 0xFFC1, 0xFFE0, 0xFFA0, 0xFE80, 0x29CA, 0x00AC,
-  0x00EC, 0x00CC, 0x00EC, 0x00CC, 0x21AE, 0x6BB4, 0xDF1D, 0xFFFF,
-  0xF79E, 0x8C76, 0x320F, 0x00CC, 0x00ED, 0x00ED, 0x00ED, 0x00CC,
-  0x00ED, 0x00ED, 0x00ED, 0x00EC, 0x00EC, 0x00EC, 0x006C, 0x8CA4,
-  0xFFE6, 0xFFCB, 0xFFC2, 0xFFE0, 0xFF40, 0xBD03, 0x00AC, 0x00EC,
-  0x00CC, 0x00CC, 0x00EC, 0x00CC, 0x4270, 0xB5D9, 0xFFFF, 0xFFDF,
-  0xFFFF, 0xC65B, 0x4AD1, 0x00CD, 0x00ED, 0x00ED, 0x00ED, 0x00EC,
-  0x00ED, 0x00ED, 0x00ED, 0x00ED, 0x00EC, 0x006D, 0x42A8, 0xFFE4,
-  0xFFCC, 0xFFEB, 0xFFE1, 0xFFA0, 0xFEC0, 0x7366, 0x006D, 0x00EC,
-  0x00CC, 0x00CC, 0x00ED, 0x00ED, 0x00AC, 0x000B, 0x5B53, 0xFFFF,
-  0x8C96, 0x000B, 0x008C, 0x00ED, 0x00ED, 0x00ED, 0x00ED, 0x00EC,
-  0x00EE, 0x00ED, 0x00ED, 0x00ED, 0x00EC, 0x00AC, 0xD6A2, 0xFFEA,
-  0xFFCD, 0xFFE9, 0xFFE0, 0xFF60, 0xFE60, 0x4249, 0x008D, 0x00EC,
-  0x00CD, 0x00CD, 0x00ED, 0x00CD, 0x00ED, 0x00ED, 0x008C, 0xB5D9,
-  0x196E, 0x00AD, 0x010E, 0x00ED, 0x00ED, 0x00ED, 0x00EE, 0x00ED,
-  0x00EE, 0x00EE, 0x00ED, 0x010D, 0x006E, 0x5327, 0xFFE2, 0xFFCC,
-  0xFFED, 0xFFC5, 0xFFC0, 0xFF20, 0xFE20, 0x21CA, 0x00AD, 0x00ED,
-  0x00CD, 0x00ED, 0x00ED, 0x00ED, 0x00ED, 0x00EE, 0x00CD, 0x3A50,
-  0x090E, 0x00CD, 0x006C, 0x6393, 0x00AD, 0x00CD, 0x00EE, 0x00ED,
-  0x00EE, 0x00EE, 0x00EE, 0x00ED, 0x006E, 0xBDE2, 0xFFE4, 0xFFCC,
-  0xFFEC, 0xFFC3, 0xFFC0, 0xFF00, 0xF5E0, 0x198B, 0x00AD, 0x00ED,
-  0x00ED, 0x00ED, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00CD,
-  0x00CE, 0x08EE, 0x5333, 0xEF7E, 0x6394, 0x08ED, 0x00EE, 0x00ED,
-  0x00EE, 0x00EE, 0x00EE, 0x00CE, 0x196C, 0xF760, 0xFFE5, 0xFFCB,
-  0xFFEB, 0xFFA1, 0xFFA0, 0xFEE0, 0xF600, 0x198B, 0x00AD, 0x00ED,
-  0x00ED, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00CE, 0x00EE,
-  0x00CE, 0x218F, 0xB5B9, 0xFFFF, 0xBE1A, 0x218F, 0x00CE, 0x00ED,
-  0x00EE, 0x00EE, 0x010E, 0x008F, 0x428A, 0xFFE0, 0xFFA3, 0xFFEA,
-  0xFFE9, 0xFFA1, 0xFFA0, 0xFF00, 0xFE40, 0x29EB, 0x008D, 0x00ED,
-  0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE,
-  0x00EE, 0x00AE, 0x008D, 0x9D38, 0x090E, 0x008D, 0x00EE, 0x00ED,
-  0x00EE, 0x00EE, 0x010E, 0x006F, 0x6368, 0xFFE0, 0xFF60, 0xFFC8,
-  0xFFE9, 0xFF81, 0xFF80, 0xFF00, 0xFEA0, 0x52C9, 0x006E, 0x00EE,
-  0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE,
-  0x00EE, 0x00EE, 0x00EE, 0x196F, 0x00EE, 0x00EE, 0x00EE, 0x00ED,
-  0x00EF, 0x00EF, 0x010E, 0x006F, 0x6BC7, 0xFFE0, 0xFF20, 0xFF82,
-  0xFFE9, 0xFF81, 0xFF60, 0xFF20, 0xFEC0, 0x9446, 0x006E, 0x010E,
-  0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE,
-  0x00EE, 0x00EE, 0x00EE, 0x00CE, 0x00EE, 0x00EE, 0x00EE, 0x00ED,
-  0x00EF, 0x00EF, 0x010E, 0x006F, 0x6BC7, 0xFFC0, 0xFF20, 0xFF40,
-  0xFF81, 0xFF60, 0xFF40, 0xFF60, 0xFEC0, 0xDDE2, 0x00ED, 0x00EE,
-  0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE,
-  0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EF, 0x00ED,
-  0x00EF, 0x00EF, 0x010E, 0x0070, 0x6388, 0xFFC0, 0xFF00, 0xFF20,
-  0xFF20, 0xFF40, 0xFF20, 0xFF40, 0xFEE0, 0xFF00, 0x52E9, 0x006F,
-  0x010E, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE,
-  0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EE, 0x00EF, 0x00ED,
-  0x00EF, 0x00EF, 0x010F, 0x0090, 0x4AA9, 0xFFA0, 0xFEE0, 0xFF00,
-  0xFF00, 0xFF20, 0xFF00, 0xFF00, 0xFF20, 0xFEE0, 0xD602, 0x00CE,
-  0x00EE, 0x00EE, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF,
-  0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EE,
-  0x00EF, 0x00EF, 0x00EF, 0x00AF, 0x21AB, 0xFF40, 0xFEE0, 0xFEE0,
-  0xFEE0, 0xFF00, 0xFEE0, 0xFEE0, 0xFF00, 0xFEC0, 0xFF60, 0x8C86,
-  0x004F, 0x010E, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF,
-  0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EE,
-  0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00AD, 0xD621, 0xFF40, 0xFEA0,
-  0xFEC0, 0xFEE0, 0xFEC0, 0xFEC0, 0xFEC0, 0xFEE0, 0xFF00, 0xFFC0,
-  0x6369, 0x002F, 0x010E, 0x010F, 0x00EF, 0x00EF, 0x00EF, 0x00EF,
-  0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EE,
-  0x00EF, 0x00EF, 0x00EF, 0x010F, 0x006F, 0x8425, 0xFFA0, 0xFE60,
-  0xFEA0, 0xFEA0, 0xFEA0, 0xFEA0, 0xFEA0, 0xFEA0, 0xFEC0, 0xFF80,
-  0xFFE0, 0x6BA8, 0x004F, 0x00AF, 0x010E, 0x010F, 0x00EF, 0x00EF,
-  0x00EF, 0x00EF, 0x010F, 0x010F, 0x00EF, 0x00EF, 0x00EF, 0x00EE,
-  0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00AF, 0x218A, 0xFF40, 0xFEA0,
-  0xFE60, 0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xFE80, 0xFEA0,
-  0xFFA0, 0xFFE0, 0xAD65, 0x29AD, 0x0070, 0x0070, 0x00AF, 0x00CF,
-  0x00CF, 0x00AF, 0x0090, 0x0070, 0x00EF, 0x00EF, 0x00EF, 0x00EE,
-  0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x010F, 0x006F, 0x9444, 0xFFA0,
-  0xFE20, 0xFE40, 0xFE60, 0xFE40, 0xFE40, 0xFE40, 0xFE40, 0xFE40,
-  0xFE60, 0xFF20, 0xFFE0, 0xF7C0, 0xAD65, 0x6349, 0x320C, 0x198D,
-  0x198D, 0x21CD, 0x428B, 0x7BE8, 0x112E, 0x00CF, 0x00EF, 0x00EE,
-  0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x08CC, 0xDE41,
-  0xFF40, 0xFDE0, 0xFE20, 0xFE20, 0xFE20, 0xFE20, 0xFE20, 0xFE20,
-  0xFE20, 0xFE20, 0xFE60, 0xFF20, 0xFFE0, 0xFFE0, 0xFFE0, 0xF780,
-  0xF760, 0xF720, 0xFF80, 0x7BC7, 0x008F, 0x010E, 0x00EF, 0x00EE,
-  0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x010F, 0x00AF, 0x2989,
-  0xEEE0, 0xFF00, 0xFDC0, 0xFDC0, 0xFDE0, 0xFDE0, 0xFDE0, 0xFDE0,
-  0xFDE0, 0xFE00, 0xFDE0, 0xFDE0, 0xFDE0, 0xFE20, 0xFE40, 0xFE40,
-  0xFE00, 0xFEC0, 0x9426, 0x006F, 0x00EE, 0x00EF, 0x00EF, 0x00EE,
-  0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x010F, 0x008F,
-  0x31A8, 0xDE60, 0xFF40, 0xFDE0, 0xFD60, 0xFD80, 0xFDA0, 0xFDA0,
-  0xFDA0, 0xFDC0, 0xFDC0, 0xFDC0, 0xFDC0, 0xFDA0, 0xFD80, 0xFDC0,
-  0xFEA0, 0x8C26, 0x008F, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EE,
-  0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x010F,
-  0x00AF, 0x190A, 0xACE2, 0xFF40, 0xFEC0, 0xFDC0, 0xFD40, 0xFD20,
-  0xFD20, 0xFD20, 0xFD20, 0xFD20, 0xFD40, 0xFDC0, 0xFE80, 0xE641,
-  0x6308, 0x006F, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EE,
-  0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF,
-  0x010F, 0x00CF, 0x006D, 0x4227, 0xB502, 0xF680, 0xFEE0, 0xFEA0,
-  0xFE60, 0xFE60, 0xFE60, 0xFE80, 0xFEA0, 0xDE01, 0x8405, 0x194C,
-  0x006F, 0x00EE, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EE,
-  0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF,
-  0x00EF, 0x00EE, 0x010F, 0x008F, 0x006D, 0x194A, 0x52A7, 0x7BC5,
-  0x9444, 0x9C83, 0x8C24, 0x7386, 0x3A49, 0x090C, 0x006F, 0x00CF,
-  0x010E, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EF, 0x00EE,
-  0x0110, 0x0110, 0x00F0, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110,
-  0x0110, 0x0110, 0x010F, 0x010F, 0x0110, 0x00D0, 0x0090, 0x0070,
-  0x008F, 0x008F, 0x0090, 0x0070, 0x00B0, 0x00F0, 0x010F, 0x010F,
-  0x00F0, 0x00F0, 0x0110, 0x00F0, 0x0110, 0x0110, 0x0110, 0x00EF,
-  0x0088, 0x00A9, 0x00AA, 0x0089, 0x00AA, 0x0089, 0x00A9, 0x00A9,
-  0x00AA, 0x00AA, 0x00CA, 0x00AA, 0x00A9, 0x00CA, 0x00C9, 0x00CA,
-  0x00CA, 0x00CA, 0x00EA, 0x00CA, 0x00CA, 0x00CB, 0x00AA, 0x00CB,
-  0x00AA, 0x00A9, 0x00AA, 0x00AA, 0x00A9, 0x00A9, 0x0089, 0x0087,
-};
-
-static const lv_img_dsc_t kSunImage = {
-  .header = {
-    .magic = LV_IMAGE_HEADER_MAGIC,
-    .cf = LV_COLOR_FORMAT_RGB565,
-    .flags = 0,
-    .w = kIconSize,
-    .h = kIconSize,
-    .stride = kIconSize * 2,
-    .reserved_2 = 0
-  },
-  .data_size = sizeof(kSunPixels),
-  .data = reinterpret_cast<const uint8_t *>(kSunPixels),
-  .reserved = nullptr,
-  .reserved_2 = nullptr
-};
-
-static const lv_img_dsc_t kMoonImage = {
-  .header = {
-    .magic = LV_IMAGE_HEADER_MAGIC,
-    .cf = LV_COLOR_FORMAT_RGB565,
-    .flags = 0,
-    .w = kIconSize,
-    .h = kIconSize,
-    .stride = kIconSize * 2,
-    .reserved_2 = 0
-  },
-  .data_size = sizeof(kMoonPixels),
-  .data = reinterpret_cast<const uint8_t *>(kMoonPixels),
-  .reserved = nullptr,
-  .reserved_2 = nullptr
-};
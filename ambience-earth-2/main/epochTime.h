@@ -0,0 +1,154 @@
+#pragma once
+
+#include <stdint.h>
+
+// Seconds since 2000-01-01 00:00:00 local time. 0 marks an unset timestamp.
+typedef uint32_t EpochTime;
+
+#define EPOCH_UNSET 0UL
+
+constexpr uint32_t kEpochSecondsPerMinute = 60u;
+constexpr uint32_t kEpochSecondsPerHour = 3600u;
+constexpr uint32_t kEpochSecondsPerDay = 86400u;
+constexpr uint32_t kEpochDaysPer4Years = 1461u;
+constexpr uint16_t kEpochDaysBeforeMonth[12] = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
+
+struct EpochFields {
+  uint8_t year;
+  uint8_t month;
+  uint8_t day;
+  uint8_t hour;
+  uint8_t minute;
+  uint8_t second;
+};
+
+/*
+ * epochIsLeapYear
+ * Returns true for leap years in 2000..2099 (2-digit year).
+ * Example:
+ *   if (epochIsLeapYear(24)) { ... }
+ */
+constexpr bool epochIsLeapYear(uint8_t year) {
+  return (year % 4u) == 0;
+}
+
+/*
+ * epochDaysInMonth
+ * Returns the number of days in a month for a 2-digit year.
+ * Example:
+ *   uint8_t dim = epochDaysInMonth(2, 24);
+ */
+constexpr uint8_t epochDaysInMonth(uint8_t month, uint8_t year) {
+  return (month == 0 || month > 12) ? 31
+         : (month == 12) ? 31
+         : static_cast<uint8_t>(kEpochDaysBeforeMonth[month] - kEpochDaysBeforeMonth[month - 1] +
+                                ((month == 2 && epochIsLeapYear(year)) ? 1 : 0));
+}
+
+/*
+ * epochFieldsValid
+ * Returns true if the calendar fields describe a real date/time.
+ * Example:
+ *   if (!epochFieldsValid(y, mo, d, h, mi, s)) return false;
+ */
+constexpr bool epochFieldsValid(uint8_t year, uint8_t month, uint8_t day,
+                                uint8_t hour, uint8_t minute, uint8_t second) {
+  return year <= 99 && month >= 1 && month <= 12 && day >= 1 &&
+         day <= epochDaysInMonth(month, year) && hour <= 23 && minute <= 59 && second <= 59;
+}
+
+/*
+ * epochFromFields
+ * Converts validated calendar fields to an EpochTime.
+ * Example:
+ *   EpochTime t = epochFromFields(25, 2, 14, 9, 16, 0);
+ */
+constexpr EpochTime epochFromFields(uint8_t year, uint8_t month, uint8_t day,
+                                    uint8_t hour, uint8_t minute, uint8_t second) {
+  return (static_cast<uint32_t>(year) * 365u + (static_cast<uint32_t>(year) + 3u) / 4u +
+          kEpochDaysBeforeMonth[(month - 1) % 12] +
+          ((month > 2 && epochIsLeapYear(year)) ? 1u : 0u) + static_cast<uint32_t>(day - 1)) *
+             kEpochSecondsPerDay +
+         static_cast<uint32_t>(hour) * 3600u + static_cast<uint32_t>(minute) * 60u + second;
+}
+
+/*
+ * epochToFields
+ * Splits an EpochTime into calendar fields.
+ * Example:
+ *   EpochFields f = epochToFields(now);
+ */
+constexpr EpochFields epochToFields(EpochTime t) {
+  uint32_t days = t / kEpochSecondsPerDay;
+  uint32_t rem = t % kEpochSecondsPerDay;
+  // 2000..2099 has a leap year at the start of every 4-year cycle.
+  uint32_t cycleDay = days % kEpochDaysPer4Years;
+  uint32_t yearInCycle = (cycleDay < 366u) ? 0u : 1u + (cycleDay - 366u) / 365u;
+  uint32_t dayOfYear = (yearInCycle == 0) ? cycleDay : (cycleDay - 366u) % 365u;
+  bool leap = yearInCycle == 0;
+
+  uint8_t month = 12;
+  uint32_t before = 0;
+  for (; month > 1; --month) {
+    before = kEpochDaysBeforeMonth[month - 1] + ((leap && month > 2) ? 1u : 0u);
+    if (dayOfYear >= before) break;
+  }
+  if (month == 1) before = 0;
+
+  EpochFields fields = {};
+  fields.year = static_cast<uint8_t>((days / kEpochDaysPer4Years) * 4u + yearInCycle);
+  fields.month = month;
+  fields.day = static_cast<uint8_t>(dayOfYear - before + 1u);
+  fields.hour = static_cast<uint8_t>(rem / 3600u);
+  fields.minute = static_cast<uint8_t>((rem / 60u) % 60u);
+  fields.second = static_cast<uint8_t>(rem % 60u);
+  return fields;
+}
+
+/*
+ * epochMinutes
+ * Returns whole minutes since the epoch.
+ * Example:
+ *   uint32_t minutes = epochMinutes(now);
+ */
+constexpr uint32_t epochMinutes(EpochTime t) {
+  return t / kEpochSecondsPerMinute;
+}
+
+/*
+ * epochHours
+ * Returns whole hours since the epoch.
+ * Example:
+ *   uint32_t hour = epochHours(now);
+ */
+constexpr uint32_t epochHours(EpochTime t) {
+  return t / kEpochSecondsPerHour;
+}
+
+/*
+ * epochMinuteOfDay
+ * Returns minutes since local midnight (0..1439).
+ * Example:
+ *   uint16_t minutes = epochMinuteOfDay(now);
+ */
+constexpr uint16_t epochMinuteOfDay(EpochTime t) {
+  return static_cast<uint16_t>((t % kEpochSecondsPerDay) / kEpochSecondsPerMinute);
+}
+
+/*
+ * epochLightDayKey
+ * Returns a 1-based day number whose boundary is lights-on, or 0 when unset.
+ * Example:
+ *   uint16_t key = epochLightDayKey(now, config.lightsOnMinutes);
+ */
+constexpr uint16_t epochLightDayKey(EpochTime t, uint16_t lightsOnMinutes) {
+  return (t == EPOCH_UNSET) ? 0
+         : static_cast<uint16_t>(
+               (t + kEpochSecondsPerDay - static_cast<uint32_t>(lightsOnMinutes > 1439 ? 0 : lightsOnMinutes) * 60u) /
+               kEpochSecondsPerDay);
+}
+
+static_assert(epochFromFields(0, 1, 1, 0, 0, 0) == 0, "epoch origin");
+static_assert(epochFromFields(0, 3, 1, 0, 0, 0) == 60u * kEpochSecondsPerDay, "leap day in 2000");
+static_assert(epochFromFields(1, 1, 1, 0, 0, 0) == 366u * kEpochSecondsPerDay, "2000 has 366 days");
+static_assert(epochToFields(epochFromFields(24, 12, 31, 23, 59, 59)).day == 31, "round trip");
@@ -2,6 +2,15 @@
 
 #include <stdint.h>
 
+/*
+ * feedingInit
+ * Subscribes the feeding state machine to config changes. Call once after
+ * the config is loaded.
+ * Example:
+ *   feedingInit();
+ */
+void feedingInit();
+
 /*
  * feedingTick
  * Advances the feeding state machine (start/stop logic, pump pulses).
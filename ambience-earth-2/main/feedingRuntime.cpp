@@ -23,6 +23,8 @@ const uint8_t kTickSeconds = 5;
 const uint8_t kMoistureBaselineSentinel = 127;
 const unsigned long kRtcReadIntervalMs = 1000;
 const uint8_t kSessionFlagRunoffSeen = 1u << 0;
+const uint8_t kSessionFlagSensorFallback = 1u << 1;
+const uint16_t kSensorFallbackMaxMl = 250;
 
 enum FeedStopReason : uint8_t {
   FEED_STOP_NONE = 0,
@@ -51,19 +53,15 @@ struct FeedSession {
   uint32_t onElapsedMs;
   unsigned long runoffStartAt;
   uint8_t soilBeforePercent;
-  uint8_t startYear;
-  uint8_t startMonth;
-  uint8_t startDay;
-  uint8_t startHour;
-  uint8_t startMinute;
+  EpochTime startTime;
   uint8_t startReason;
   uint8_t flags;
 };
 
 static FeedSession session = {};
 static bool rtcValid = false;
+static EpochTime rtcNow = EPOCH_UNSET;
 static uint16_t rtcMinutes = 0;
-static uint16_t rtcDayKey = 0;
 static unsigned long rtcLastReadAt = 0;
 static uint16_t lastEvaluatedRtcMinutes = 0xFFFF;
 static uint16_t lastOffsetMinutes = 0;
@@ -134,6 +132,16 @@ static inline bool dripperCalibrated() {
   return (config.flags & CONFIG_FLAG_DRIPPER_CALIBRATED) != 0;
 }
 
+/*
+ * moistureUsable
+ * Returns false once the probe health monitor has declared the sensor failed.
+ * Example:
+ *   if (!moistureUsable()) { ... }
+ */
+static inline bool moistureUsable() {
+  return soilSensorHealth() != SENSOR_FAILED;
+}
+
 /*
  * minutesSinceLightsOn
  * Converts the RTC time to minutes since lights-on.
@@ -146,6 +154,22 @@ static uint16_t minutesSinceLightsOn() {
   return static_cast<uint16_t>(rtcMinutes + 1440 - lightsOn);
 }
 
+/*
+ * onConfigChanged
+ * Drops state derived from config fields that just changed, so the next
+ * tick re-evaluates against the new values instead of a cached minute.
+ * Example:
+ *   addConfigListener(onConfigChanged);
+ */
+static void onConfigChanged(uint16_t fields) {
+  if (fields & CONFIG_FIELD_FEEDING) feedingDisabledCached = feedingDisabledFlag();
+  if (fields & CONFIG_FIELD_TIME) rtcLastReadAt = 0;
+  if (fields & (CONFIG_FIELD_LIGHTS | CONFIG_FIELD_SLOTS | CONFIG_FIELD_TIME)) {
+    lastEvaluatedRtcMinutes = 0xFFFF;
+    lastOffsetValid = false;
+  }
+}
+
 /*
  * ticksToMs
  * Converts 5-second ticks to milliseconds.
@@ -169,44 +193,18 @@ static inline bool baselineGetPercent(uint8_t *outPercent) {
   return true;
 }
 
-/*
- * dateTimeToMinutes
- * Converts a date/time into absolute minutes for ordering.
- * Example:
- *   uint32_t minutes = 0;
- *   dateTimeToMinutes(y, m, d, h, min, &minutes);
- */
-static bool dateTimeToMinutes(uint8_t year, uint8_t month, uint8_t day,
-                              uint8_t hour, uint8_t minute, uint32_t *outMinutes) {
-  if (!outMinutes) return false;
-  if (month == 0 || month > 12 || day == 0 || day > 31) return false;
-  if (hour > 23 || minute > 59) return false;
-  uint8_t dim = daysInMonth(month, year);
-  if (day > dim) return false;
-  uint32_t days = static_cast<uint32_t>(year) * 365u + static_cast<uint32_t>((year + 3u) / 4u);
-  for (uint8_t m = 1; m < month; ++m) {
-    days += daysInMonth(m, year);
-  }
-  days += static_cast<uint32_t>(day - 1);
-  *outMinutes = days * 1440u + static_cast<uint32_t>(hour) * 60u + minute;
-  return true;
-}
-
 /*
  * getNowMinutes
- * Reads the current RTC time and returns absolute minutes.
+ * Reads the software clock and returns absolute minutes.
  * Example:
  *   uint32_t minutes = 0;
  *   getNowMinutes(&minutes);
  */
 static bool getNowMinutes(uint32_t *outMinutes) {
-  uint8_t hour = 0;
-  uint8_t minute = 0;
-  uint8_t day = 0;
-  uint8_t month = 0;
-  uint8_t year = 0;
-  if (!rtcReadDateTime(&hour, &minute, &day, &month, &year)) return false;
-  return dateTimeToMinutes(year, month, day, hour, minute, outMinutes);
+  EpochTime now = EPOCH_UNSET;
+  if (!rtcReadEpoch(&now)) return false;
+  *outMinutes = epochMinutes(now);
+  return true;
 }
 
 /*
@@ -217,9 +215,9 @@ static bool getNowMinutes(uint32_t *outMinutes) {
  *   logEntryEndMinutes(entry, &minutes);
  */
 static bool logEntryEndMinutes(const LogEntry *entry, uint32_t *outMinutes) {
-  if (!entry) return false;
-  return dateTimeToMinutes(entry->endYear, entry->endMonth, entry->endDay,
-                           entry->endHour, entry->endMinute, outMinutes);
+  if (!entry || entry->endTime == EPOCH_UNSET) return false;
+  *outMinutes = epochMinutes(entry->endTime);
+  return true;
 }
 
 /*
@@ -280,10 +278,27 @@ static bool updateRtcCache() {
   if (now - rtcLastReadAt < kRtcReadIntervalMs) return rtcValid;
 
   rtcLastReadAt = now;
-  rtcValid = rtcReadMinutesAndDay(&rtcMinutes, &rtcDayKey);
+  rtcValid = rtcReadEpoch(&rtcNow);
+  if (rtcValid) rtcMinutes = epochMinuteOfDay(rtcNow);
   return rtcValid;
 }
 
+/*
+ * applySensorFallback
+ * Drops the moisture target and bounds the feed by volume only.
+ * Example:
+ *   if (!moistureUsable()) applySensorFallback();
+ */
+static void applySensorFallback() {
+  if (session.flags & kSessionFlagSensorFallback) return;
+  session.flags |= kSessionFlagSensorFallback;
+  session.slot.flags &= static_cast<uint8_t>(~FEED_SLOT_HAS_MOISTURE_TARGET);
+  session.slot.moistureTarget = 0;
+  if (session.maxVolumeMs == 0) {
+    session.maxVolumeMs = volumeMlToMs(kSensorFallbackMaxMl, config.dripperMsPerLiter);
+  }
+}
+
 /*
  * startFeed
  * Starts a feeding session for the specified slot.
@@ -322,10 +337,12 @@ static void startFeed(uint8_t slotIndex, const FeedSlot *slot, bool timeTriggere
   session.startReason = timeTriggered ? LOG_START_TIME : LOG_START_MOISTURE;
   session.flags = 0;
 
-  session.startYear = session.startMonth = session.startDay = session.startHour = session.startMinute = 0;
-  rtcReadDateTime(&session.startHour, &session.startMinute, &session.startDay,
-                  &session.startMonth, &session.startYear);
+  session.startTime = EPOCH_UNSET;
+  rtcReadEpoch(&session.startTime);
 
+  if (!moistureUsable()) applySensorFallback();
+
+  soilSensorFeedStarted();
   setSoilSensorRealTime();
   openLineIn();
 
@@ -341,17 +358,8 @@ static void startFeed(uint8_t slotIndex, const FeedSlot *slot, bool timeTriggere
 static void logFeedRefusal(uint8_t slotIndex, bool timeTriggered, FeedStopReason reason) {
   uint32_t lightKey = 0xFFFFFFFFUL;
   if (rtcValid) {
-    uint16_t lightsOn = config.lightsOnMinutes;
-    if (lightsOn > 1439) lightsOn = 0;
-    uint16_t key = rtcDayKey;
-    if (rtcMinutes < lightsOn) {
-      if (key > 0) {
-        key--;
-        lightKey = key;
-      }
-    } else {
-      lightKey = key;
-    }
+    uint16_t key = epochLightDayKey(rtcNow, config.lightsOnMinutes);
+    if (key > 0) lightKey = key;
   }
   uint8_t reasonCode = static_cast<uint8_t>(reason);
   if (lightKey == lastRefusalLightKey && reasonCode == lastRefusalReason) return;
@@ -367,17 +375,10 @@ static void logFeedRefusal(uint8_t slotIndex, bool timeTriggered, FeedStopReason
   newLogEntry.millisStart = now;
   newLogEntry.millisEnd = now;
 
-  rtcReadDateTime(&newLogEntry.startHour, &newLogEntry.startMinute, &newLogEntry.startDay,
-                  &newLogEntry.startMonth, &newLogEntry.startYear);
-  newLogEntry.endYear = newLogEntry.startYear;
-  newLogEntry.endMonth = newLogEntry.startMonth;
-  newLogEntry.endDay = newLogEntry.startDay;
-  newLogEntry.endHour = newLogEntry.startHour;
-  newLogEntry.endMinute = newLogEntry.startMinute;
-
-  uint16_t dailyTotal = getDailyFeedTotalMlAt(newLogEntry.startYear, newLogEntry.startMonth,
-                                              newLogEntry.startDay, newLogEntry.startHour,
-                                              newLogEntry.startMinute);
+  rtcReadEpoch(&newLogEntry.startTime);
+  newLogEntry.endTime = newLogEntry.startTime;
+
+  uint16_t dailyTotal = getDailyFeedTotalMlAt(newLogEntry.startTime);
   newLogEntry.feedMl = 0;
   newLogEntry.dailyTotalMl = dailyTotal;
 
@@ -394,6 +395,7 @@ static void stopFeed(FeedStopReason reason, unsigned long now) {
   updatePulse(now);
   closeLineIn();
   session.pumpOn = false;
+  soilSensorFeedEnded();
 
   uint16_t realtimeAvg = soilSensorGetRealtimeAvg();
   uint8_t soilAfterPercent = soilMoistureAsPercentage(realtimeAvg);
@@ -417,24 +419,20 @@ static void stopFeed(FeedStopReason reason, unsigned long now) {
   if (session.flags & kSessionFlagRunoffSeen) {
     logFlags |= LOG_FLAG_RUNOFF_SEEN;
   }
+  if (session.flags & kSessionFlagSensorFallback) {
+    logFlags |= LOG_FLAG_SENSOR_FALLBACK;
+  }
   initLogEntryCommon(&newLogEntry, 1, static_cast<uint8_t>(reason), session.startReason,
                      session.slotIndex, logFlags, session.soilBeforePercent, soilAfterPercent);
   newLogEntry.millisStart = session.startMillis;
   newLogEntry.millisEnd = now;
   if (logFlags & LOG_FLAG_RUNOFF_ANY) runoffWarning = 1;
-  newLogEntry.startYear = session.startYear;
-  newLogEntry.startMonth = session.startMonth;
-  newLogEntry.startDay = session.startDay;
-  newLogEntry.startHour = session.startHour;
-  newLogEntry.startMinute = session.startMinute;
-
-  rtcReadDateTime(&newLogEntry.endHour, &newLogEntry.endMinute, &newLogEntry.endDay,
-                  &newLogEntry.endMonth, &newLogEntry.endYear);
+  newLogEntry.startTime = session.startTime;
+
+  rtcReadEpoch(&newLogEntry.endTime);
   uint16_t dailyTotal = 0;
-  if (newLogEntry.endMonth && newLogEntry.endDay) {
-    uint16_t previousTotal = getDailyFeedTotalMlAt(newLogEntry.endYear, newLogEntry.endMonth,
-                                                   newLogEntry.endDay, newLogEntry.endHour,
-                                                   newLogEntry.endMinute);
+  if (newLogEntry.endTime != EPOCH_UNSET) {
+    uint16_t previousTotal = getDailyFeedTotalMlAt(newLogEntry.endTime);
     if (UINT16_MAX - previousTotal < feedMl) dailyTotal = UINT16_MAX;
     else dailyTotal = static_cast<uint16_t>(previousTotal + feedMl);
   }
@@ -460,6 +458,8 @@ static void stopFeed(FeedStopReason reason, unsigned long now) {
  */
 static void tickActiveFeed(unsigned long now) {
   updatePulse(now);
+  soilSensorFeedProgress(session.onElapsedMs);
+  if (!moistureUsable()) applySensorFallback();
   uint8_t moisturePercent = soilMoistureAsPercentage(getSoilMoisture());
   bool moistureReady = soilSensorRealtimeReady();
 
@@ -530,6 +530,11 @@ static void tickActiveFeed(unsigned long now) {
 static bool startConditionsMet(const FeedSlot *slot, bool *timeOkOut, bool *moistureOkOut) {
   bool hasTime = slotFlag(slot, FEED_SLOT_HAS_TIME_WINDOW);
   bool hasMoisture = slotFlag(slot, FEED_SLOT_HAS_MOISTURE_BELOW);
+  if (hasMoisture && !moistureUsable()) {
+    // Without a trustworthy probe only the time window may trigger this slot.
+    if (!hasTime) return false;
+    hasMoisture = false;
+  }
   if (hasMoisture && !soilSensorReady()) return false;
 
   bool timeOk = false;
@@ -638,6 +643,11 @@ void feedingForceFeed(uint8_t slotIndex) {
   }
 }
 
+void feedingInit() {
+  feedingDisabledCached = feedingDisabledFlag();
+  addConfigListener(onConfigChanged);
+}
+
 void feedingTick() {
   unsigned long now = millis();
 
@@ -691,7 +701,7 @@ bool feedingGetStatus(FeedStatus *outStatus) {
   outStatus->active = true;
   outStatus->slotIndex = session.slotIndex;
   outStatus->pumpOn = session.pumpOn;
-  outStatus->moistureReady = soilSensorRealtimeReady();
+  outStatus->moistureReady = soilSensorRealtimeReady() && moistureUsable();
   outStatus->moisturePercent = soilMoistureAsPercentage(getSoilMoisture());
   outStatus->hasMoistureTarget = slotFlag(&session.slot, FEED_SLOT_HAS_MOISTURE_TARGET);
   outStatus->moistureTarget = session.slot.moistureTarget;
@@ -790,7 +800,10 @@ void feedingSetEnabled(bool enabled) {
   }
 
   setFeedingDisabledFlag(disable);
-  saveConfig();
+  markConfigDirty(CONFIG_FIELD_FEEDING);
+  // A pause must survive a power cut straight away; resuming can wait for
+  // the debounced save, since losing it only leaves feeding paused.
+  if (disable) flushConfig();
 }
 
 bool feedingIsPausedForUi() {
@@ -0,0 +1,228 @@
+#include "flashStats.h"
+
+#include <LittleFS.h>
+#include <string.h>
+
+namespace {
+const char *kStatsPath = "/flashstats.bin";
+constexpr uint8_t kStatsVersion = 1;
+// Between midnights the record is also saved this often, so a reboot loses
+// at most a few hours of counts; each save costs one block erase itself.
+constexpr uint32_t kStatsSaveIntervalSec = 6UL * 3600UL;
+
+struct DayTotals {
+  uint16_t day;
+  uint32_t eraseBlocks;
+  uint32_t writeBytes;
+};
+
+struct StoredStats {
+  uint8_t checksum;
+  uint8_t version;
+  uint32_t lifetimeEraseBlocks;
+  uint32_t lifetimeWriteBytes;
+  DayTotals today;
+  // Completed days, newest first; day == 0 marks an empty entry.
+  DayTotals days[FLASH_STATS_DAYS];
+};
+
+static StoredStats g_stored = {};
+static FlashIoCounters g_files[FLASH_FILE_COUNT] = {};
+static FlashIoCounters g_tags[FLASH_TAG_COUNT] = {};
+static uint32_t g_partition_blocks = 0;
+static EpochTime g_last_save = EPOCH_UNSET;
+static bool g_dirty = false;
+
+static uint8_t storedChecksum(const StoredStats &stats) {
+  uint8_t hash = 0xA5;
+  const uint8_t *ptr = reinterpret_cast<const uint8_t *>(&stats);
+  for (size_t i = 1; i < sizeof(stats); ++i) hash ^= ptr[i];
+  return hash;
+}
+
+static void saveStored() {
+  g_stored.version = kStatsVersion;
+  // Account for this save before writing so the saved totals include it.
+  flashStatsOpen(FLASH_FILE_STATS, FLASH_TAG_STATS);
+  flashStatsWrite(FLASH_FILE_STATS, FLASH_TAG_STATS, sizeof(g_stored));
+  flashStatsFlush(FLASH_FILE_STATS, FLASH_TAG_STATS, 0, sizeof(g_stored));
+  g_stored.checksum = storedChecksum(g_stored);
+  File f = LittleFS.open(kStatsPath, "w");
+  if (!f) return;
+  f.write(reinterpret_cast<const uint8_t *>(&g_stored), sizeof(g_stored));
+  f.flush();
+  f.close();
+  g_dirty = false;
+}
+
+static void rollDay(uint16_t day) {
+  if (g_stored.today.day != 0) {
+    memmove(&g_stored.days[1], &g_stored.days[0], sizeof(g_stored.days[0]) * (FLASH_STATS_DAYS - 1));
+    g_stored.days[0] = g_stored.today;
+  }
+  g_stored.today = {};
+  g_stored.today.day = day;
+}
+
+static void count(FlashFile file, FlashTag tag, uint32_t FlashIoCounters::*field, uint32_t amount) {
+  if (file < FLASH_FILE_COUNT) g_files[file].*field += amount;
+  if (tag < FLASH_TAG_COUNT) g_tags[tag].*field += amount;
+}
+} // namespace
+
+void flashStatsInit() {
+  g_partition_blocks = static_cast<uint32_t>(LittleFS.totalBytes() / FLASH_BLOCK_BYTES);
+  StoredStats loaded = {};
+  flashStatsOpen(FLASH_FILE_STATS, FLASH_TAG_STATS);
+  File f = LittleFS.open(kStatsPath, "r");
+  if (!f) return;
+  size_t readLen = f.read(reinterpret_cast<uint8_t *>(&loaded), sizeof(loaded));
+  f.close();
+  flashStatsRead(FLASH_FILE_STATS, FLASH_TAG_STATS, readLen);
+  if (readLen != sizeof(loaded) || loaded.version != kStatsVersion || storedChecksum(loaded) != loaded.checksum) return;
+  // Anything counted before this point (config load, log mount) belongs on
+  // top of the saved totals.
+  loaded.lifetimeEraseBlocks += g_stored.lifetimeEraseBlocks;
+  loaded.lifetimeWriteBytes += g_stored.lifetimeWriteBytes;
+  loaded.today.eraseBlocks += g_stored.today.eraseBlocks;
+  loaded.today.writeBytes += g_stored.today.writeBytes;
+  g_stored = loaded;
+}
+
+void flashStatsOpen(FlashFile file, FlashTag tag) {
+  count(file, tag, &FlashIoCounters::opens, 1);
+}
+
+void flashStatsRead(FlashFile file, FlashTag tag, size_t len) {
+  count(file, tag, &FlashIoCounters::reads, 1);
+  count(file, tag, &FlashIoCounters::readBytes, static_cast<uint32_t>(len));
+}
+
+void flashStatsWrite(FlashFile file, FlashTag tag, size_t len) {
+  count(file, tag, &FlashIoCounters::writes, 1);
+  count(file, tag, &FlashIoCounters::writeBytes, static_cast<uint32_t>(len));
+  g_stored.lifetimeWriteBytes += static_cast<uint32_t>(len);
+  g_stored.today.writeBytes += static_cast<uint32_t>(len);
+  g_dirty = true;
+}
+
+void flashStatsFlush(FlashFile file, FlashTag tag, uint32_t offset, uint32_t fileBytes) {
+  uint32_t firstBlock = offset / FLASH_BLOCK_BYTES;
+  uint32_t lastBlock = (fileBytes > 0) ? (fileBytes - 1) / FLASH_BLOCK_BYTES : 0;
+  uint32_t blocks = (lastBlock >= firstBlock) ? lastBlock - firstBlock + 1 : 1;
+  count(file, tag, &FlashIoCounters::flushes, 1);
+  count(file, tag, &FlashIoCounters::eraseBlocks, blocks);
+  g_stored.lifetimeEraseBlocks += blocks;
+  g_stored.today.eraseBlocks += blocks;
+  g_dirty = true;
+}
+
+void flashStatsTick(EpochTime now) {
+  if (now == EPOCH_UNSET) return;
+  uint16_t day = static_cast<uint16_t>(now / kEpochSecondsPerDay);
+  if (g_stored.today.day == 0) g_stored.today.day = day;
+  if (day != g_stored.today.day) {
+    rollDay(day);
+    saveStored();
+    g_last_save = now;
+    return;
+  }
+  if (g_last_save == EPOCH_UNSET) g_last_save = now;
+  if (g_dirty && now - g_last_save >= kStatsSaveIntervalSec) {
+    saveStored();
+    g_last_save = now;
+  }
+}
+
+const FlashIoCounters &flashStatsFile(FlashFile file) {
+  static const FlashIoCounters kEmpty = {};
+  return (file < FLASH_FILE_COUNT) ? g_files[file] : kEmpty;
+}
+
+const FlashIoCounters &flashStatsTag(FlashTag tag) {
+  static const FlashIoCounters kEmpty = {};
+  return (tag < FLASH_TAG_COUNT) ? g_tags[tag] : kEmpty;
+}
+
+void flashStatsGetWear(FlashWearStats *out) {
+  if (!out) return;
+  *out = {};
+  out->partitionBlocks = g_partition_blocks;
+  out->lifetimeEraseBlocks = g_stored.lifetimeEraseBlocks;
+  out->lifetimeWriteBytes = g_stored.lifetimeWriteBytes;
+  out->todayEraseBlocks = g_stored.today.eraseBlocks;
+  out->todayWriteBytes = g_stored.today.writeBytes;
+
+  uint64_t erased = 0;
+  uint8_t days = 0;
+  for (uint8_t i = 0; i < FLASH_STATS_DAYS; ++i) {
+    if (g_stored.days[i].day == 0) continue;
+    erased += g_stored.days[i].eraseBlocks;
+    days++;
+  }
+  out->daysTracked = days;
+  // Until a full day has been seen, today's partial count is the best rate.
+  out->avgDailyEraseBlocks = days ? static_cast<uint32_t>(erased / days) : g_stored.today.eraseBlocks;
+
+  // LittleFS levels wear across the whole partition, so the budget is
+  // every block's rated cycles, spent evenly.
+  uint64_t budget = static_cast<uint64_t>(g_partition_blocks) * FLASH_ERASE_CYCLES;
+  uint64_t used = g_stored.lifetimeEraseBlocks;
+  uint64_t left = (budget > used) ? budget - used : 0;
+  out->budgetLeftPermille = budget ? static_cast<uint16_t>((left * 1000ULL) / budget) : 0;
+  if (out->avgDailyEraseBlocks) {
+    uint64_t daysLeft = left / out->avgDailyEraseBlocks;
+    out->daysLeft = daysLeft > 0xFFFFFFFFULL ? 0xFFFFFFFFUL : static_cast<uint32_t>(daysLeft);
+  }
+}
+
+const char *flashStatsFileName(FlashFile file) {
+  switch (file) {
+    case FLASH_FILE_LOGS: return "logs";
+    case FLASH_FILE_CONFIG: return "config";
+    case FLASH_FILE_STATS: return "stats";
+    default: return "?";
+  }
+}
+
+const char *flashStatsTagName(FlashTag tag) {
+  switch (tag) {
+    case FLASH_TAG_LOG_ENTRY: return "entry";
+    case FLASH_TAG_LOG_HEAD: return "head";
+    case FLASH_TAG_LOG_META: return "meta";
+    case FLASH_TAG_LOG_PATCH: return "patch";
+    case FLASH_TAG_LOG_FORMAT: return "format";
+    case FLASH_TAG_CONFIG: return "config";
+    case FLASH_TAG_STATS: return "stats";
+    default: return "?";
+  }
+}
+
+void flashStatsPrint() {
+  Serial.printf("[FLASH] %-7s %6s %6s %8s %6s %8s %6s %6s\r\n", "name", "opens", "reads", "rd_bytes", "writes",
+                "wr_bytes", "flush", "erase");
+  for (uint8_t i = 0; i < FLASH_FILE_COUNT; ++i) {
+    const FlashIoCounters &c = g_files[i];
+    Serial.printf("[FLASH] %-7s %6u %6u %8u %6u %8u %6u %6u\r\n", flashStatsFileName(static_cast<FlashFile>(i)),
+                  static_cast<unsigned>(c.opens), static_cast<unsigned>(c.reads), static_cast<unsigned>(c.readBytes),
+                  static_cast<unsigned>(c.writes), static_cast<unsigned>(c.writeBytes),
+                  static_cast<unsigned>(c.flushes), static_cast<unsigned>(c.eraseBlocks));
+  }
+  for (uint8_t i = 0; i < FLASH_TAG_COUNT; ++i) {
+    const FlashIoCounters &c = g_tags[i];
+    Serial.printf("[FLASH] .%-6s %6u %6u %8u %6u %8u %6u %6u\r\n", flashStatsTagName(static_cast<FlashTag>(i)),
+                  static_cast<unsigned>(c.opens), static_cast<unsigned>(c.reads), static_cast<unsigned>(c.readBytes),
+                  static_cast<unsigned>(c.writes), static_cast<unsigned>(c.writeBytes),
+                  static_cast<unsigned>(c.flushes), static_cast<unsigned>(c.eraseBlocks));
+  }
+  FlashWearStats wear = {};
+  flashStatsGetWear(&wear);
+  Serial.printf("[FLASH] today erase=%u bytes=%u | avg erase/day=%u over %u days | lifetime erase=%u bytes=%u\r\n",
+                static_cast<unsigned>(wear.todayEraseBlocks), static_cast<unsigned>(wear.todayWriteBytes),
+                static_cast<unsigned>(wear.avgDailyEraseBlocks), static_cast<unsigned>(wear.daysTracked),
+                static_cast<unsigned>(wear.lifetimeEraseBlocks), static_cast<unsigned>(wear.lifetimeWriteBytes));
+  Serial.printf("[FLASH] budget %u blocks x %u cycles, %u.%u%% left, ~%u days at this rate\r\n",
+                static_cast<unsigned>(wear.partitionBlocks), static_cast<unsigned>(FLASH_ERASE_CYCLES),
+                static_cast<unsigned>(wear.budgetLeftPermille / 10), static_cast<unsigned>(wear.budgetLeftPermille % 10),
+                static_cast<unsigned>(wear.daysLeft));
+}
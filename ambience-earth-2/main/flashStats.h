@@ -0,0 +1,152 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "epochTime.h"
+
+#define FLASH_BLOCK_BYTES 4096UL
+#define FLASH_ERASE_CYCLES 100000UL
+#define FLASH_STATS_DAYS 7
+
+enum FlashFile : uint8_t {
+  FLASH_FILE_LOGS = 0,
+  FLASH_FILE_CONFIG,
+  FLASH_FILE_STATS,
+  FLASH_FILE_COUNT
+};
+
+// Who asked for the I/O, so a hot caller stands out from its file's total.
+enum FlashTag : uint8_t {
+  FLASH_TAG_LOG_ENTRY = 0, // log slot reads/writes
+  FLASH_TAG_LOG_HEAD,      // head ring records and the boot scan
+  FLASH_TAG_LOG_META,      // epoch and format version bytes
+  FLASH_TAG_LOG_PATCH,     // baseline patches into existing entries
+  FLASH_TAG_LOG_FORMAT,    // file sizing and wipes
+  FLASH_TAG_CONFIG,        // saveConfig()/loadConfig()
+  FLASH_TAG_STATS,         // this module's own daily record
+  FLASH_TAG_COUNT
+};
+
+struct FlashIoCounters {
+  uint32_t opens;
+  uint32_t reads;
+  uint32_t readBytes;
+  uint32_t writes;
+  uint32_t writeBytes;
+  uint32_t flushes;
+  uint32_t eraseBlocks;
+};
+
+struct FlashWearStats {
+  uint32_t partitionBlocks;
+  uint32_t lifetimeEraseBlocks;
+  uint32_t lifetimeWriteBytes;
+  uint32_t todayEraseBlocks;
+  uint32_t todayWriteBytes;
+  uint32_t avgDailyEraseBlocks;
+  uint8_t daysTracked;
+  // Tenths of a percent of the partition's erase budget still left.
+  uint16_t budgetLeftPermille;
+  // At the average daily rate; 0 while there is no rate yet.
+  uint32_t daysLeft;
+};
+
+/*
+ * flashStatsInit
+ * Loads the persisted daily totals and sizes the erase budget from the
+ * mounted LittleFS partition. Call after the filesystem is mounted.
+ * Example:
+ *   flashStatsInit();
+ */
+void flashStatsInit();
+
+/*
+ * flashStatsOpen
+ * Counts one file open.
+ * Example:
+ *   flashStatsOpen(FLASH_FILE_LOGS, FLASH_TAG_LOG_ENTRY);
+ */
+void flashStatsOpen(FlashFile file, FlashTag tag);
+
+/*
+ * flashStatsRead
+ * Counts one read call of len bytes.
+ * Example:
+ *   flashStatsRead(FLASH_FILE_CONFIG, FLASH_TAG_CONFIG, sizeof(config));
+ */
+void flashStatsRead(FlashFile file, FlashTag tag, size_t len);
+
+/*
+ * flashStatsWrite
+ * Counts one write call of len bytes.
+ * Example:
+ *   flashStatsWrite(FLASH_FILE_LOGS, FLASH_TAG_LOG_HEAD, 4);
+ */
+void flashStatsWrite(FlashFile file, FlashTag tag, size_t len);
+
+/*
+ * flashStatsFlush
+ * Counts one flush and the blocks it is estimated to erase. LittleFS is
+ * copy-on-write: flushing a write at offset rewrites every block from the
+ * one holding offset to the end of a fileBytes long file.
+ * Example:
+ *   flashStatsFlush(FLASH_FILE_LOGS, FLASH_TAG_LOG_ENTRY, offset, kLogStoreBytes);
+ */
+void flashStatsFlush(FlashFile file, FlashTag tag, uint32_t offset, uint32_t fileBytes);
+
+/*
+ * flashStatsTick
+ * Rolls the daily totals over at local midnight and persists them.
+ * Example:
+ *   flashStatsTick(now);
+ */
+void flashStatsTick(EpochTime now);
+
+/*
+ * flashStatsFile
+ * Returns the since-boot counters for one file.
+ * Example:
+ *   uint32_t erased = flashStatsFile(FLASH_FILE_LOGS).eraseBlocks;
+ */
+const FlashIoCounters &flashStatsFile(FlashFile file);
+
+/*
+ * flashStatsTag
+ * Returns the since-boot counters for one caller tag.
+ * Example:
+ *   uint32_t writes = flashStatsTag(FLASH_TAG_CONFIG).writes;
+ */
+const FlashIoCounters &flashStatsTag(FlashTag tag);
+
+/*
+ * flashStatsGetWear
+ * Fills the lifetime/daily totals and the erase budget estimate.
+ * Example:
+ *   FlashWearStats wear = {};
+ *   flashStatsGetWear(&wear);
+ */
+void flashStatsGetWear(FlashWearStats *out);
+
+/*
+ * flashStatsFileName
+ * Returns the short name printed for a file.
+ * Example:
+ *   Serial.println(flashStatsFileName(FLASH_FILE_LOGS));
+ */
+const char *flashStatsFileName(FlashFile file);
+
+/*
+ * flashStatsTagName
+ * Returns the short name printed for a caller tag.
+ * Example:
+ *   Serial.println(flashStatsTagName(FLASH_TAG_LOG_HEAD));
+ */
+const char *flashStatsTagName(FlashTag tag);
+
+/*
+ * flashStatsPrint
+ * Writes the per-file and per-tag counters and the wear estimate to Serial.
+ * Example:
+ *   flashStatsPrint();
+ */
+void flashStatsPrint();
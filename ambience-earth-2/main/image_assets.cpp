@@ -0,0 +1,127 @@
+#include "image_assets.h"
+
+#include <Arduino.h>
+#ifndef WOKWI_SIM
+#include <esp_heap_caps.h>
+#endif
+
+static lv_image_dsc_t g_image_dscs[IMAGE_ASSET_COUNT] = {};
+static uint8_t *g_image_pixels[IMAGE_ASSET_COUNT] = {};
+static uint32_t g_image_cache_bytes = 0;
+
+/*
+ * rle_decode
+ * Expands one packed plane into dst. in_size is the stored element width,
+ * out_size the decoded width; palette (if set) maps stored indices to RGB565.
+ * Control byte c < 0x80 is followed by c + 1 literals; c >= 0x80 repeats the
+ * next element (c & 0x7F) + 1 times. See tools/gen-image-assets.py.
+ * Example:
+ *   rle_decode(pack.alpha, pack.alphaBytes, 1, 1, nullptr, 0, dst, count);
+ */
+static bool rle_decode(const uint8_t *src, uint32_t src_bytes, uint8_t in_size, uint8_t out_size,
+                       const uint16_t *palette, uint16_t palette_count, uint8_t *dst, uint32_t count) {
+  uint32_t pos = 0;
+  uint32_t out = 0;
+  while (out < count) {
+    if (pos >= src_bytes) return false;
+    uint8_t ctrl = src[pos++];
+    uint32_t run = static_cast<uint32_t>(ctrl & 0x7F) + 1;
+    bool repeat = (ctrl & 0x80) != 0;
+    if (out + run > count) return false;
+
+    uint16_t value = 0;
+    for (uint32_t i = 0; i < run; ++i, ++out) {
+      if (i == 0 || !repeat) {
+        if (pos + in_size > src_bytes) return false;
+        value = (in_size == 2) ? static_cast<uint16_t>(src[pos] | (src[pos + 1] << 8)) : src[pos];
+        pos += in_size;
+        if (palette) {
+          if (value >= palette_count) return false;
+          value = palette[value];
+        }
+      }
+      if (out_size == 2) {
+        dst[out * 2] = static_cast<uint8_t>(value & 0xFF);
+        dst[out * 2 + 1] = static_cast<uint8_t>(value >> 8);
+      } else {
+        dst[out] = static_cast<uint8_t>(value);
+      }
+    }
+  }
+  return pos == src_bytes;
+}
+
+/*
+ * alloc_pixels
+ * Allocates a decode buffer, preferring internal RAM for blit speed and
+ * falling back to PSRAM for large art.
+ * Example:
+ *   uint8_t *pixels = alloc_pixels(bytes);
+ */
+static uint8_t *alloc_pixels(uint32_t bytes) {
+#ifdef WOKWI_SIM
+  return static_cast<uint8_t *>(malloc(bytes));
+#else
+  void *mem = heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  if (!mem && psramFound()) mem = heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM);
+  return static_cast<uint8_t *>(mem);
+#endif
+}
+
+/*
+ * free_pixels
+ * Releases a buffer from alloc_pixels().
+ * Example:
+ *   free_pixels(pixels);
+ */
+static void free_pixels(uint8_t *pixels) {
+#ifdef WOKWI_SIM
+  free(pixels);
+#else
+  heap_caps_free(pixels);
+#endif
+}
+
+const lv_image_dsc_t *image_asset(ImageAssetId id) {
+  if (id >= IMAGE_ASSET_COUNT) return nullptr;
+  if (g_image_pixels[id]) return &g_image_dscs[id];
+
+  const ImagePack &pack = kImagePacks[id];
+  uint32_t count = static_cast<uint32_t>(pack.w) * pack.h;
+  uint32_t bytes = count * (pack.hasAlpha ? 3 : 2);
+  uint8_t *pixels = alloc_pixels(bytes);
+  if (!pixels) {
+    Serial.printf("[IMG] no memory for asset %u (%u bytes)\r\n", static_cast<unsigned>(id),
+                  static_cast<unsigned>(bytes));
+    return nullptr;
+  }
+
+  bool ok = rle_decode(pack.color, pack.colorBytes, pack.palette ? 1 : 2, 2,
+                       pack.palette, pack.paletteCount, pixels, count);
+  // RGB565A8 keeps the A8 plane right after the color plane.
+  if (ok && pack.hasAlpha) {
+    ok = rle_decode(pack.alpha, pack.alphaBytes, 1, 1, nullptr, 0, pixels + count * 2, count);
+  }
+  if (!ok) {
+    Serial.printf("[IMG] corrupt asset %u\r\n", static_cast<unsigned>(id));
+    free_pixels(pixels);
+    return nullptr;
+  }
+
+  lv_image_dsc_t &dsc = g_image_dscs[id];
+  dsc.header.magic = LV_IMAGE_HEADER_MAGIC;
+  dsc.header.cf = pack.hasAlpha ? LV_COLOR_FORMAT_RGB565A8 : LV_COLOR_FORMAT_RGB565;
+  dsc.header.flags = 0;
+  dsc.header.w = pack.w;
+  dsc.header.h = pack.h;
+  dsc.header.stride = static_cast<uint32_t>(pack.w) * 2;
+  dsc.data_size = bytes;
+  dsc.data = pixels;
+  g_image_pixels[id] = pixels;
+  g_image_cache_bytes += bytes;
+  return &dsc;
+}
+
+uint32_t image_asset_cache_bytes() {
+  return g_image_cache_bytes;
+}
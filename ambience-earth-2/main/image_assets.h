@@ -0,0 +1,22 @@
+#pragma once
+
+#include "image_assets_data.h"
+#include "lvgl_config.h"
+
+/*
+ * image_asset
+ * Returns the LVGL descriptor for a packed image, decoding it into RAM on
+ * first use; later calls return the cached copy. Returns nullptr if the
+ * pixels could not be allocated or the packed data is corrupt.
+ * Example:
+ *   lv_img_set_src(img, image_asset(IMAGE_ASSET_PLANT));
+ */
+const lv_image_dsc_t *image_asset(ImageAssetId id);
+
+/*
+ * image_asset_cache_bytes
+ * Returns the RAM held by decoded images.
+ * Example:
+ *   uint32_t bytes = image_asset_cache_bytes();
+ */
+uint32_t image_asset_cache_bytes();
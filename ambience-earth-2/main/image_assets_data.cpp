@@ -0,0 +1,625 @@
+#include "image_assets_data.h"
+
+// Generated by tools/gen-image-assets.py from assets/*.png. Do not edit.
+
+static const uint8_t kPlantColor[] = {
+  0x85, 0x00, 0x00, 0x02, 0x00, 0x50, 0x00, 0x38, 0x00, 0x78, 0x8C, 0x00, 0x00, 0x81, 0x00, 0x38,
+  0xAA, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x78, 0x83, 0x00, 0x00, 0x02, 0x6C, 0x9E, 0xE1, 0x30,
+  0x20, 0x18, 0x86, 0x00, 0x10, 0x01, 0x60, 0x18, 0x43, 0x39, 0x83, 0x00, 0x00, 0x01, 0x00, 0x78,
+  0x00, 0x50, 0xA9, 0x00, 0x00, 0x01, 0x42, 0x39, 0x00, 0x18, 0x81, 0x00, 0x10, 0x04, 0x00, 0x18,
+  0x40, 0x20, 0xA1, 0x30, 0x03, 0x39, 0x64, 0x49, 0x82, 0xA5, 0x51, 0x07, 0x43, 0x41, 0x02, 0x39,
+  0x81, 0x28, 0x20, 0x20, 0x00, 0x18, 0x00, 0x10, 0x00, 0x18, 0x22, 0x31, 0xA8, 0x00, 0x00, 0x18,
+  0xA0, 0x10, 0x20, 0x20, 0x00, 0x18, 0x00, 0x20, 0x03, 0x39, 0x67, 0x62, 0xEA, 0x8B, 0x2D, 0xAD,
+  0x2E, 0xC6, 0xAF, 0xCE, 0x2F, 0xD7, 0x4D, 0xD7, 0x6D, 0xD7, 0x8E, 0xD7, 0x6D, 0xD7, 0x2D, 0xCF,
+  0x0E, 0xCF, 0x6D, 0xC6, 0xAC, 0xB5, 0x6A, 0x94, 0xE7, 0x72, 0x43, 0x41, 0x00, 0x20, 0x00, 0x18,
+  0xA1, 0x28, 0x81, 0x00, 0x00, 0x00, 0x00, 0x50, 0xA2, 0x00, 0x00, 0x0F, 0x61, 0x20, 0x60, 0x28,
+  0xE2, 0x38, 0x08, 0x73, 0x6C, 0xAD, 0xEE, 0xCE, 0xAC, 0xD7, 0xA9, 0xCF, 0x66, 0xBF, 0x24, 0xAF,
+  0x02, 0xA7, 0xC1, 0x9E, 0x2B, 0xBF, 0x72, 0xDF, 0xA2, 0x9E, 0xE7, 0xAE, 0x81, 0xB4, 0xE7, 0x09,
+  0xD3, 0xEF, 0xF3, 0xEF, 0xF2, 0xE7, 0xF0, 0xDF, 0x4F, 0xDF, 0x8E, 0xB5, 0x86, 0x62, 0x40, 0x28,
+  0x00, 0x20, 0xE2, 0x30, 0xA2, 0x00, 0x00, 0x09, 0x80, 0x18, 0x81, 0x28, 0xA0, 0x30, 0x44, 0x7D,
+  0xA8, 0xC7, 0x23, 0xAF, 0xA0, 0x9E, 0x80, 0x96, 0x60, 0x96, 0x80, 0x96, 0x81, 0x60, 0x96, 0x07,
+  0x60, 0x8E, 0xA5, 0xA6, 0x2B, 0xC7, 0xE2, 0xA6, 0x05, 0xAF, 0x6F, 0xD7, 0xB3, 0xE7, 0xD7, 0xF7,
+  0x81, 0xD8, 0xFF, 0x07, 0xD7, 0xF7, 0x2B, 0xBF, 0x69, 0xBF, 0xF1, 0xEF, 0x0F, 0xC6, 0xE4, 0x51,
+  0x00, 0x20, 0xA1, 0x28, 0xA1, 0x00, 0x00, 0x05, 0x00, 0x28, 0x81, 0x20, 0x61, 0x28, 0x00, 0x31,
+  0x80, 0x54, 0x60, 0x86, 0x81, 0xA0, 0x9E, 0x00, 0xC2, 0xAE, 0x81, 0x25, 0xBF, 0x14, 0x04, 0xB7,
+  0x83, 0xA6, 0x01, 0x8E, 0x80, 0x75, 0x60, 0x6D, 0x80, 0x75, 0x00, 0x7E, 0x80, 0x96, 0xE2, 0xAE,
+  0x06, 0xB7, 0x2B, 0xC7, 0x6F, 0xD7, 0xE7, 0xB6, 0x60, 0x8E, 0x81, 0x96, 0x8B, 0xCF, 0xF2, 0xF7,
+  0xA8, 0x83, 0x00, 0x20, 0x60, 0x28, 0xA2, 0x28, 0xA1, 0x00, 0x00, 0x04, 0x80, 0x20, 0x41, 0x28,
+  0x81, 0x30, 0x40, 0x4C, 0x20, 0x7E, 0x82, 0xA0, 0x9E, 0x17, 0xC1, 0xA6, 0x23, 0xB7, 0x65, 0xBF,
+  0x86, 0xCF, 0x86, 0xC7, 0xE5, 0xB6, 0x04, 0x96, 0x02, 0x6D, 0x80, 0x54, 0xC0, 0x5C, 0xC0, 0x7D,
+  0xA0, 0x9E, 0xC0, 0x9E, 0xA0, 0x96, 0x80, 0x9E, 0xA0, 0x9E, 0x60, 0x8E, 0xC5, 0xAE, 0xF2, 0xF7,
+  0xCB, 0x9C, 0x20, 0x20, 0x81, 0x28, 0xE3, 0x18, 0x00, 0x78, 0x9E, 0x00, 0x00, 0x06, 0x00, 0x30,
+  0x00, 0x00, 0xC1, 0x20, 0x61, 0x28, 0xA0, 0x30, 0x60, 0x4C, 0xE0, 0x75, 0x81, 0xA0, 0x9E, 0x00,
+  0x80, 0x9E, 0x81, 0x80, 0x96, 0x15, 0xA0, 0x9E, 0xE2, 0xA6, 0x44, 0xBF, 0xA5, 0xCF, 0xA6, 0xCF,
+  0x05, 0xB7, 0xA3, 0x85, 0x41, 0x4C, 0x00, 0x44, 0x20, 0x6D, 0x80, 0x9E, 0xE0, 0xA6, 0xA0, 0x9E,
+  0x80, 0x9E, 0x80, 0x96, 0x82, 0x9E, 0xF0, 0xF7, 0x8A, 0x94, 0x00, 0x20, 0xA1, 0x28, 0x00, 0x00,
+  0x00, 0x50, 0x9E, 0x00, 0x00, 0x07, 0x00, 0x30, 0x00, 0x00, 0xA1, 0x20, 0x41, 0x28, 0x00, 0x31,
+  0xE0, 0x4C, 0x00, 0x7E, 0xC0, 0xA6, 0x83, 0xA0, 0x9E, 0x81, 0x80, 0x96, 0x13, 0x80, 0x9E, 0xC1,
+  0x9E, 0x02, 0xAF, 0x63, 0xBF, 0x44, 0xBF, 0x03, 0x96, 0x21, 0x4C, 0x80, 0x33, 0x00, 0x65, 0xA0,
+  0x9E, 0xC0, 0xA6, 0x80, 0x9E, 0x80, 0x96, 0x62, 0x96, 0xEE, 0xE7, 0x05, 0x6B, 0x00, 0x20, 0xA1,
+  0x28, 0x00, 0x00, 0x00, 0x50, 0x9E, 0x00, 0x00, 0x07, 0x00, 0x30, 0x00, 0x00, 0xA0, 0x28, 0x21,
+  0x28, 0x20, 0x3A, 0x40, 0x55, 0xE0, 0x7D, 0xC0, 0xA6, 0x86, 0xA0, 0x9E, 0x81, 0x80, 0x96, 0x0E,
+  0xA0, 0x9E, 0xE0, 0xA6, 0x01, 0xAF, 0xA1, 0x85, 0x80, 0x33, 0x60, 0x2B, 0xA0, 0x7D, 0xE0, 0xA6,
+  0xA0, 0x9E, 0x80, 0x96, 0x02, 0x7E, 0x0A, 0xC7, 0x21, 0x39, 0x40, 0x20, 0xA1, 0x18, 0xA0, 0x00,
+  0x00, 0x07, 0x00, 0x50, 0x00, 0x00, 0x81, 0x28, 0x21, 0x28, 0x80, 0x43, 0x60, 0x55, 0x20, 0x86,
+  0xC0, 0xA6, 0x88, 0xA0, 0x9E, 0x0F, 0x80, 0x9E, 0x80, 0x96, 0xE0, 0xA6, 0xC0, 0xA6, 0xC0, 0x64,
+  0xE0, 0x1A, 0x40, 0x4C, 0x40, 0x86, 0x00, 0x7E, 0xE0, 0x4C, 0x63, 0x8E, 0xC5, 0x8C, 0x00, 0x20,
+  0xA1, 0x28, 0x00, 0x00, 0x00, 0x38, 0x8A, 0x00, 0x00, 0x82, 0x00, 0x38, 0x02, 0x00, 0x50, 0x00,
+  0x00, 0x00, 0x50, 0x82, 0x00, 0x38, 0x8C, 0x00, 0x00, 0x06, 0x61, 0x18, 0x61, 0x28, 0xA0, 0x28,
+  0x80, 0x4C, 0x20, 0x55, 0x20, 0x86, 0xC0, 0xA6, 0x89, 0xA0, 0x9E, 0x0C, 0x80, 0x9E, 0xA0, 0x9E,
+  0xE0, 0xA6, 0xE0, 0x85, 0x20, 0x2B, 0x00, 0x1B, 0x20, 0x55, 0x60, 0x5D, 0x00, 0x55, 0x62, 0x96,
+  0x61, 0x41, 0x40, 0x20, 0xE0, 0x18, 0x88, 0x00, 0x00, 0x00, 0x00, 0x38, 0x8C, 0x00, 0x00, 0x00,
+  0x00, 0x38, 0x88, 0x00, 0x00, 0x04, 0x00, 0x38, 0x00, 0x00, 0x81, 0x20, 0x41, 0x28, 0x40, 0x31,
+  0x81, 0x00, 0x55, 0x01, 0xE0, 0x7D, 0xC0, 0x9E, 0x8A, 0xA0, 0x9E, 0x0C, 0x80, 0x9E, 0xC0, 0x9E,
+  0x00, 0x8E, 0x80, 0x3B, 0xE0, 0x1A, 0x20, 0x5D, 0x00, 0x55, 0xC0, 0x6D, 0x61, 0x63, 0x01, 0x20,
+  0xA1, 0x20, 0x00, 0x00, 0x00, 0x38, 0x84, 0x00, 0x00, 0x00, 0x00, 0x50, 0x81, 0x00, 0x00, 0x01,
+  0xFF, 0xFF, 0x40, 0x18, 0x82, 0x00, 0x10, 0x00, 0x00, 0x18, 0x83, 0x00, 0x10, 0x02, 0x00, 0x08,
+  0x00, 0x10, 0xC6, 0x64, 0x8A, 0x00, 0x00, 0x09, 0x00, 0x50, 0x00, 0x00, 0x81, 0x28, 0x21, 0x28,
+  0xE0, 0x31, 0x40, 0x55, 0xE0, 0x4C, 0x60, 0x65, 0x60, 0x96, 0xC0, 0xA6, 0x89, 0xA0, 0x9E, 0x0B,
+  0xC0, 0xA6, 0x40, 0x65, 0xC0, 0x7D, 0x60, 0x3B, 0xC0, 0x12, 0x00, 0x55, 0x40, 0x55, 0x80, 0x64,
+  0x61, 0x28, 0x80, 0x20, 0x00, 0x00, 0x00, 0x50, 0x85, 0x00, 0x00, 0x00, 0x02, 0x31, 0x81, 0x00,
+  0x18, 0x04, 0xA1, 0x30, 0xC4, 0x51, 0xE6, 0x72, 0xA7, 0x83, 0x49, 0x94, 0x81, 0x6B, 0x94, 0x06,
+  0xC9, 0x8B, 0x08, 0x73, 0xE5, 0x51, 0xC2, 0x30, 0x00, 0x18, 0x00, 0x10, 0x40, 0x18, 0x8A, 0x00,
+  0x00, 0x09, 0x60, 0x08, 0x81, 0x28, 0x21, 0x28, 0x20, 0x3A, 0x40, 0x55, 0xE0, 0x4C, 0xE0, 0x54,
+  0xA0, 0x75, 0x60, 0x96, 0xC0, 0x9E, 0x81, 0xC0, 0xA6, 0x82, 0xA0, 0x9E, 0x0D, 0xC0, 0x9E, 0xC0,
+  0xA6, 0xE0, 0xA6, 0x40, 0x8E, 0xC0, 0x4C, 0xC0, 0x44, 0x80, 0x75, 0xC0, 0x22, 0x20, 0x23, 0x40,
+  0x55, 0xE0, 0x5C, 0xC1, 0x30, 0x60, 0x20, 0xE0, 0x03, 0x84, 0x00, 0x00, 0x14, 0xC2, 0x21, 0x60,
+  0x28, 0x00, 0x20, 0xA4, 0x51, 0x6B, 0x9C, 0x6D, 0xC6, 0x90, 0xDF, 0xF2, 0xEF, 0xF4, 0xEF, 0xEF,
+  0xDF, 0x86, 0xBF, 0xA6, 0xC7, 0xA7, 0xC7, 0x89, 0xC7, 0x6B, 0xCF, 0xAD, 0xC6, 0x2C, 0xAD, 0xC7,
+  0x6A, 0xA1, 0x30, 0x60, 0x20, 0x40, 0x20, 0x89, 0x00, 0x00, 0x0B, 0x41, 0x18, 0x81, 0x28, 0x21,
+  0x28, 0xC0, 0x31, 0xE0, 0x54, 0x40, 0x55, 0xC0, 0x4C, 0xE0, 0x4C, 0x60, 0x65, 0xC0, 0x75, 0x20,
+  0x86, 0x60, 0x96, 0x81, 0x80, 0x96, 0x02, 0x60, 0x8E, 0x20, 0x86, 0x80, 0x6D, 0x81, 0xC0, 0x4C,
+  0x08, 0xA0, 0x44, 0xE0, 0x4C, 0x60, 0x4C, 0x40, 0x0A, 0x00, 0x34, 0x00, 0x55, 0x00, 0x29, 0x40,
+  0x20, 0xC0, 0x18, 0x83, 0x00, 0x00, 0x15, 0xE1, 0x28, 0x20, 0x20, 0xA1, 0x30, 0xAB, 0x9C, 0x6E,
+  0xDF, 0x46, 0xB7, 0x4C, 0xC7, 0xD8, 0xF7, 0xD6, 0xF7, 0xB2, 0xE7, 0xE7, 0xAE, 0x20, 0x86, 0x00,
+  0x86, 0x40, 0x8E, 0x80, 0x9E, 0x80, 0x96, 0xC0, 0x9E, 0x23, 0xAF, 0xA7, 0xBF, 0xA2, 0x74, 0x60,
+  0x28, 0x61, 0x20, 0x8A, 0x00, 0x00, 0x0B, 0x00, 0x10, 0x80, 0x28, 0x41, 0x28, 0xE0, 0x30, 0xA0,
+  0x43, 0x40, 0x55, 0x20, 0x55, 0xC0, 0x4C, 0xA0, 0x44, 0xC0, 0x4C, 0xE0, 0x4C, 0x00, 0x55, 0x81,
+  0xE0, 0x4C, 0x01, 0xC0, 0x44, 0xA0, 0x44, 0x82, 0xC0, 0x4C, 0x07, 0xA0, 0x44, 0xC0, 0x4C, 0x20,
+  0x23, 0x60, 0x12, 0xA0, 0x4C, 0x20, 0x31, 0x40, 0x20, 0x40, 0x10, 0x82, 0x00, 0x00, 0x16, 0xE1,
+  0x28, 0x20, 0x20, 0x42, 0x41, 0x6B, 0xBE, 0x67, 0xBF, 0x80, 0x96, 0x60, 0x8E, 0x04, 0xAF, 0x06,
+  0xB7, 0xE1, 0x85, 0x00, 0x65, 0x20, 0x6D, 0x04, 0x96, 0xE7, 0xBE, 0x69, 0xD7, 0x26, 0xBF, 0x80,
+  0x96, 0xA0, 0x9E, 0x60, 0x8E, 0xE0, 0x54, 0x20, 0x31, 0x61, 0x28, 0x80, 0x20, 0x8C, 0x00, 0x00,
+  0x07, 0x80, 0x28, 0x61, 0x28, 0x41, 0x28, 0xC0, 0x31, 0x20, 0x4C, 0x20, 0x55, 0x40, 0x55, 0x00,
+  0x4D, 0x86, 0xC0, 0x4C, 0x82, 0xA0, 0x44, 0x1F, 0xC0, 0x44, 0x40, 0x3C, 0x40, 0x0A, 0x20, 0x2B,
+  0xE0, 0x30, 0x40, 0x20, 0x40, 0x10, 0x00, 0x00, 0x00, 0x50, 0x22, 0x21, 0x40, 0x20, 0x02, 0x39,
+  0xE7, 0x9D, 0xA2, 0x96, 0x60, 0x96, 0xE0, 0xA6, 0xA0, 0x9E, 0x00, 0x65, 0x20, 0x44, 0xE3, 0x74,
+  0x87, 0xB6, 0x89, 0xD7, 0xA9, 0xDF, 0x66, 0xC7, 0xC2, 0xA6, 0x80, 0x96, 0xA0, 0x9E, 0x80, 0x96,
+  0x60, 0x65, 0x41, 0x31, 0x21, 0x28, 0xC0, 0x20, 0x8E, 0x00, 0x00, 0x06, 0x80, 0x20, 0x80, 0x28,
+  0x41, 0x28, 0x61, 0x28, 0xA0, 0x31, 0x60, 0x43, 0xA0, 0x4C, 0x82, 0x20, 0x4D, 0x81, 0x00, 0x4D,
+  0x82, 0xE0, 0x4C, 0x00, 0x00, 0x4D, 0x81, 0x00, 0x45, 0x15, 0xE0, 0x33, 0xA0, 0x12, 0x00, 0x1A,
+  0x60, 0x28, 0x60, 0x20, 0x00, 0x20, 0x00, 0xF8, 0x00, 0x00, 0x60, 0x20, 0x41, 0x28, 0xC3, 0x7C,
+  0x60, 0x5D, 0x60, 0x65, 0x80, 0x96, 0xE0, 0x64, 0x40, 0x2B, 0x41, 0x54, 0x65, 0xA6, 0x86, 0xCF,
+  0x44, 0xBF, 0xE2, 0xAE, 0x80, 0x9E, 0x81, 0x80, 0x96, 0x81, 0xA0, 0x9E, 0x05, 0xE0, 0x6D, 0xA0,
+  0x3A, 0x21, 0x28, 0xA0, 0x28, 0x00, 0x00, 0x00, 0x28, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x50, 0x81,
+  0x00, 0x00, 0x09, 0xA0, 0x28, 0x81, 0x28, 0x21, 0x28, 0x41, 0x30, 0xC1, 0x30, 0xA0, 0x31, 0x80,
+  0x3A, 0x40, 0x43, 0xE0, 0x43, 0x20, 0x44, 0x81, 0x40, 0x44, 0x08, 0x00, 0x44, 0xA0, 0x43, 0xE0,
+  0x3A, 0xC0, 0x31, 0xA0, 0x20, 0x60, 0x12, 0x40, 0x12, 0x40, 0x20, 0x60, 0x20, 0x81, 0x00, 0x00,
+  0x0D, 0xC0, 0x18, 0x20, 0x20, 0x61, 0x52, 0x80, 0x65, 0x20, 0x55, 0xE0, 0x54, 0xE0, 0x1A, 0x40,
+  0x33, 0x60, 0x7D, 0xA0, 0x9E, 0xC0, 0x9E, 0x60, 0x96, 0x80, 0x96, 0x80, 0x9E, 0x82, 0xA0, 0x9E,
+  0x06, 0xC0, 0x9E, 0xE0, 0x75, 0x60, 0x4C, 0x81, 0x30, 0x81, 0x28, 0x00, 0x00, 0x00, 0x50, 0x92,
+  0x00, 0x00, 0x03, 0xC0, 0x20, 0xA1, 0x28, 0x61, 0x28, 0x20, 0x28, 0x81, 0x21, 0x28, 0x00, 0x41,
+  0x28, 0x82, 0x81, 0x30, 0x01, 0x61, 0x28, 0x41, 0x28, 0x81, 0x20, 0x20, 0x10, 0x40, 0x28, 0x60,
+  0x19, 0x20, 0x1B, 0xC0, 0x42, 0x40, 0x20, 0x60, 0x18, 0x00, 0x00, 0x60, 0x20, 0x61, 0x28, 0x40,
+  0x54, 0x60, 0x55, 0x40, 0x44, 0x60, 0x12, 0xC0, 0x43, 0xA0, 0x7D, 0x60, 0x65, 0x60, 0x96, 0x84,
+  0xA0, 0x9E, 0x08, 0xC0, 0x9E, 0xA0, 0x9E, 0xA0, 0x6D, 0x40, 0x55, 0xA0, 0x39, 0x41, 0x28, 0xC1,
+  0x20, 0x00, 0x00, 0x00, 0x50, 0x90, 0x00, 0x00, 0x00, 0x00, 0x50, 0x83, 0x00, 0x00, 0x02, 0x60,
+  0x11, 0xE0, 0x20, 0xA0, 0x28, 0x81, 0x81, 0x28, 0x81, 0x60, 0x28, 0x14, 0x81, 0x28, 0xA0, 0x28,
+  0xC1, 0x20, 0xE0, 0x07, 0x60, 0x20, 0x80, 0x28, 0xE0, 0x33, 0xA0, 0x8E, 0x80, 0x39, 0x00, 0x18,
+  0x00, 0x00, 0x20, 0x20, 0x20, 0x31, 0x40, 0x55, 0xE0, 0x3B, 0x20, 0x0A, 0xA0, 0x33, 0x20, 0x5D,
+  0x80, 0x3C, 0x80, 0x6D, 0xE0, 0xAE, 0x82, 0xA0, 0x9E, 0x81, 0xC0, 0xA6, 0x07, 0x40, 0x8E, 0x60,
+  0x65, 0x60, 0x55, 0x80, 0x3A, 0x41, 0x28, 0x80, 0x28, 0x00, 0x00, 0x00, 0x50, 0x94, 0x00, 0x00,
+  0x01, 0x00, 0x38, 0x00, 0x78, 0x8A, 0x00, 0x00, 0x0C, 0x80, 0x18, 0x20, 0x28, 0xA0, 0x32, 0x40,
+  0x7E, 0x40, 0x74, 0x00, 0x18, 0xE0, 0x18, 0x00, 0x20, 0x60, 0x3A, 0x40, 0x3C, 0x00, 0x0A, 0x80,
+  0x2B, 0xE0, 0x4C, 0x81, 0xA0, 0x44, 0x01, 0xE0, 0x4C, 0x00, 0x86, 0x81, 0x80, 0x96, 0x09, 0x60,
+  0x96, 0x00, 0x86, 0x60, 0x65, 0x40, 0x55, 0x20, 0x55, 0x60, 0x3A, 0x41, 0x30, 0x81, 0x28, 0x00,
+  0x00, 0x00, 0x50, 0x9A, 0x00, 0x00, 0x84, 0x00, 0x38, 0x82, 0x00, 0x00, 0x0B, 0x40, 0x11, 0x20,
+  0x20, 0x40, 0x29, 0x40, 0x5D, 0x40, 0x96, 0xE0, 0x28, 0x20, 0x18, 0x20, 0x20, 0x00, 0x2A, 0xA0,
+  0x12, 0x60, 0x23, 0x20, 0x4D, 0x81, 0xC0, 0x44, 0x82, 0xA0, 0x44, 0x02, 0xE0, 0x4C, 0x00, 0x55,
+  0x20, 0x55, 0x81, 0x20, 0x4D, 0x04, 0xC0, 0x4B, 0x40, 0x31, 0x41, 0x30, 0x81, 0x28, 0xA0, 0x10,
+  0xA3, 0x00, 0x00, 0x0E, 0x00, 0x50, 0x00, 0x00, 0x60, 0x20, 0x80, 0x28, 0x20, 0x44, 0xA0, 0x8E,
+  0x40, 0x5B, 0x00, 0x18, 0xA0, 0x20, 0x40, 0x23, 0xC0, 0x19, 0x60, 0x29, 0x00, 0x3B, 0x00, 0x44,
+  0xA0, 0x44, 0x81, 0xE0, 0x4C, 0x08, 0x00, 0x4D, 0xE0, 0x4C, 0xA0, 0x4C, 0x00, 0x44, 0xE0, 0x42,
+  0x60, 0x39, 0x41, 0x30, 0x41, 0x28, 0xA1, 0x28, 0xA5, 0x00, 0x00, 0x0F, 0x00, 0x38, 0x00, 0x00,
+  0x80, 0x20, 0x20, 0x28, 0x20, 0x3B, 0x00, 0x6E, 0x80, 0x85, 0x00, 0x18, 0xE0, 0x32, 0x60, 0x44,
+  0x40, 0x28, 0x20, 0x20, 0x00, 0x20, 0x60, 0x28, 0xC0, 0x28, 0x20, 0x31, 0x81, 0x60, 0x31, 0x06,
+  0x40, 0x31, 0xC0, 0x30, 0x61, 0x30, 0x21, 0x28, 0x41, 0x28, 0x80, 0x28, 0xA0, 0x20, 0xA8, 0x00,
+  0x00, 0x0D, 0xE0, 0x18, 0x20, 0x20, 0x20, 0x3A, 0x40, 0x55, 0x60, 0x8E, 0xE0, 0x39, 0xC0, 0x44,
+  0x40, 0x3A, 0x00, 0x20, 0xE0, 0x18, 0x40, 0x29, 0x60, 0x28, 0x20, 0x20, 0x00, 0x28, 0x81, 0x00,
+  0x20, 0x03, 0x21, 0x28, 0x41, 0x28, 0x80, 0x28, 0xE0, 0x20, 0x82, 0x00, 0x00, 0x00, 0x00, 0x50,
+  0xA7, 0x00, 0x00, 0x08, 0xE0, 0x01, 0x20, 0x20, 0x40, 0x31, 0xE0, 0x4C, 0x20, 0x86, 0x40, 0x6D,
+  0xA0, 0x44, 0xC0, 0x28, 0x40, 0x20, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x38, 0xA8, 0x00, 0x00, 0x0C,
+  0x00, 0x50, 0x00, 0x00, 0x40, 0x20, 0xC0, 0x30, 0xA0, 0x4C, 0xC0, 0x75, 0x80, 0x8E, 0xC0, 0x43,
+  0x40, 0x28, 0x60, 0x20, 0x00, 0x00, 0x00, 0x28, 0x00, 0x50, 0x86, 0x00, 0x38, 0xA5, 0x00, 0x00,
+  0x82, 0x00, 0x38, 0x00, 0x00, 0x50, 0x81, 0x00, 0x00, 0x09, 0x00, 0x78, 0x00, 0x00, 0x60, 0x20,
+  0x40, 0x28, 0x20, 0x44, 0x60, 0x5D, 0xA0, 0x96, 0x00, 0x3B, 0x00, 0x20, 0xC0, 0x20, 0x83, 0x00,
+  0x00, 0x00, 0x00, 0x50, 0x82, 0x00, 0x38, 0xA2, 0x00, 0x00, 0x01, 0x00, 0x38, 0x00, 0x50, 0x8A,
+  0x00, 0x00, 0x07, 0x40, 0x10, 0x20, 0x28, 0x80, 0x43, 0x40, 0x55, 0xA0, 0x96, 0x80, 0x42, 0x00,
+  0x18, 0x40, 0x08, 0x8A, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x38, 0x9A, 0x00, 0x00, 0x00, 0x00,
+  0x38, 0x83, 0x00, 0x00, 0x01, 0x20, 0x63, 0x00, 0x10, 0x82, 0x00, 0x08, 0x81, 0x00, 0x10, 0x0E,
+  0x20, 0x18, 0x40, 0x18, 0x60, 0x28, 0x80, 0x30, 0xC0, 0x30, 0x00, 0x20, 0xE0, 0x42, 0x00, 0x4D,
+  0x60, 0x86, 0x60, 0x42, 0x00, 0x20, 0xC0, 0x38, 0x80, 0x30, 0x60, 0x28, 0x40, 0x20, 0x82, 0x00,
+  0x10, 0x82, 0x00, 0x08, 0x01, 0x41, 0x18, 0xE0, 0xFF, 0x83, 0x00, 0x00, 0x00, 0x00, 0x38, 0x95,
+  0x00, 0x00, 0x00, 0x00, 0x50, 0x81, 0x00, 0x00, 0x01, 0x40, 0x6A, 0x40, 0x18, 0x81, 0x00, 0x10,
+  0x1D, 0x20, 0x18, 0x80, 0x30, 0x21, 0x49, 0x81, 0x61, 0x01, 0x7A, 0x81, 0x92, 0xE1, 0xAA, 0x21,
+  0xC3, 0x21, 0xCB, 0x21, 0xC3, 0x21, 0xB3, 0x81, 0x92, 0x00, 0x20, 0x60, 0x3A, 0xE0, 0x44, 0x00,
+  0x7E, 0x80, 0x4A, 0x20, 0x28, 0x01, 0xB3, 0x01, 0xBB, 0x21, 0xC3, 0x21, 0xCB, 0x01, 0xBB, 0xC1,
+  0xAA, 0x61, 0x8A, 0xE1, 0x71, 0x81, 0x59, 0xE1, 0x40, 0x60, 0x28, 0x20, 0x18, 0x81, 0x00, 0x10,
+  0x01, 0x40, 0x20, 0xE0, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x00, 0x50, 0x94, 0x00, 0x00, 0x0F, 0x80,
+  0x28, 0x20, 0x20, 0x00, 0x18, 0x80, 0x28, 0x81, 0x61, 0x81, 0x92, 0x22, 0xB3, 0x62, 0xCB, 0x61,
+  0xDB, 0x01, 0xE3, 0xC1, 0xE2, 0x60, 0xD2, 0xC0, 0xB1, 0x60, 0x89, 0x00, 0x61, 0xA0, 0x38, 0x81,
+  0x40, 0x20, 0x05, 0x00, 0x20, 0x00, 0x32, 0x40, 0x34, 0x20, 0x55, 0xE0, 0x4A, 0x00, 0x20, 0x81,
+  0x60, 0x28, 0x0F, 0xA0, 0x38, 0xE0, 0x58, 0x80, 0x89, 0xE0, 0xB9, 0x60, 0xDA, 0xA1, 0xE2, 0x01,
+  0xDB, 0x21, 0xD3, 0x41, 0xC3, 0xE1, 0xAA, 0x61, 0x82, 0x61, 0x51, 0x60, 0x28, 0x00, 0x18, 0x40,
+  0x20, 0xC1, 0x30, 0x94, 0x00, 0x00, 0x0E, 0x60, 0x28, 0x20, 0x20, 0xE1, 0x40, 0xA1, 0x9A, 0xE2,
+  0xDB, 0xA2, 0xE3, 0xA1, 0xD2, 0xE0, 0xC9, 0x60, 0xB9, 0x00, 0xA1, 0xC0, 0x88, 0x80, 0x60, 0x60,
+  0x38, 0xE1, 0x48, 0x02, 0x49, 0x81, 0x61, 0x28, 0x1A, 0x62, 0x69, 0xE3, 0x81, 0xC1, 0x48, 0xE0,
+  0x20, 0x20, 0x2B, 0x00, 0x34, 0x40, 0x32, 0x00, 0x20, 0x80, 0x30, 0xA1, 0x38, 0xC1, 0x40, 0x81,
+  0x30, 0x20, 0x18, 0x20, 0x20, 0x60, 0x40, 0xC0, 0x70, 0xE0, 0x90, 0x20, 0xA9, 0x60, 0xB9, 0xE0,
+  0xC9, 0xA1, 0xD2, 0x81, 0xDB, 0xE2, 0xD3, 0x81, 0x8A, 0xC1, 0x38, 0x20, 0x20, 0x60, 0x28, 0x90,
+  0x00, 0x00, 0x13, 0x00, 0x38, 0x00, 0x00, 0x60, 0x28, 0x40, 0x28, 0xA1, 0x69, 0x42, 0xF4, 0xA2,
+  0xFC, 0x21, 0xBA, 0xC0, 0x98, 0x00, 0xA9, 0xE0, 0x80, 0xA0, 0x50, 0x80, 0x30, 0xA1, 0x30, 0xA1,
+  0x38, 0xC3, 0x71, 0x26, 0xC3, 0xA5, 0xAA, 0x02, 0x51, 0xC3, 0x81, 0x81, 0x64, 0xA2, 0x05, 0xA4,
+  0xAA, 0x82, 0x71, 0x60, 0x28, 0x80, 0x20, 0x80, 0x28, 0xC1, 0x40, 0x81, 0x42, 0x61, 0x81, 0x22,
+  0x59, 0x11, 0xE1, 0x48, 0xA1, 0x40, 0xA1, 0x38, 0x61, 0x28, 0x60, 0x28, 0x80, 0x38, 0xE0, 0x60,
+  0xE0, 0x80, 0x00, 0xA1, 0x00, 0xA9, 0x00, 0xBA, 0x62, 0xFC, 0x42, 0xEC, 0xA1, 0x69, 0x40, 0x28,
+  0x60, 0x20, 0x00, 0x00, 0x00, 0x50, 0x8D, 0x00, 0x00, 0x0E, 0x00, 0x50, 0x00, 0x00, 0x81, 0x28,
+  0x40, 0x28, 0xA2, 0xD3, 0x82, 0xFC, 0x22, 0xFC, 0x00, 0xB2, 0xC0, 0x90, 0x80, 0x58, 0x40, 0x20,
+  0x60, 0x28, 0x81, 0x30, 0x42, 0x61, 0x42, 0x69, 0x81, 0x42, 0x61, 0x03, 0xE1, 0x48, 0x82, 0x71,
+  0x43, 0xA2, 0x03, 0x92, 0x81, 0x82, 0x71, 0x01, 0x43, 0x9A, 0x23, 0x92, 0x81, 0xE1, 0x50, 0x04,
+  0x01, 0x51, 0xC3, 0x81, 0xE3, 0x89, 0x01, 0x51, 0x02, 0x51, 0x81, 0x22, 0x59, 0x0E, 0x62, 0x71,
+  0x22, 0x61, 0x60, 0x28, 0xA1, 0x38, 0x42, 0x59, 0x61, 0x28, 0x40, 0x30, 0xA0, 0x78, 0x80, 0xA9,
+  0xE2, 0xF3, 0x82, 0xFC, 0x22, 0xEC, 0x80, 0x30, 0x60, 0x28, 0xE0, 0x39, 0x8E, 0x00, 0x00, 0x0D,
+  0x00, 0x38, 0x00, 0x00, 0x61, 0x28, 0x60, 0x28, 0x40, 0xB2, 0xC2, 0xFB, 0x62, 0xFC, 0xA3, 0xFC,
+  0xA2, 0xCB, 0xE1, 0x69, 0xC0, 0x38, 0x40, 0x20, 0x00, 0x18, 0x40, 0x28, 0x81, 0x81, 0x38, 0x07,
+  0xC1, 0x48, 0x02, 0x51, 0x22, 0x59, 0x62, 0x69, 0xA2, 0x79, 0x82, 0x71, 0x02, 0x51, 0x22, 0x59,
+  0x81, 0xA2, 0x79, 0x84, 0x22, 0x59, 0x05, 0x02, 0x59, 0xC1, 0x40, 0x60, 0x28, 0x61, 0x28, 0x41,
+  0x28, 0x20, 0x20, 0x81, 0x20, 0x18, 0x08, 0x80, 0x30, 0x40, 0x51, 0xE1, 0xA2, 0x83, 0xFC, 0xA3,
+  0xFC, 0x22, 0xFC, 0x21, 0xE3, 0xA0, 0x38, 0x60, 0x20, 0x8F, 0x00, 0x00, 0x11, 0x00, 0x38, 0x00,
+  0x00, 0x60, 0x28, 0x41, 0x20, 0xC0, 0x99, 0x80, 0xEA, 0x00, 0xC2, 0x22, 0xDB, 0x63, 0xFC, 0x24,
+  0xFD, 0xE4, 0xF4, 0x23, 0xCC, 0x23, 0x9B, 0x22, 0x72, 0x81, 0x51, 0xE1, 0x38, 0xA0, 0x30, 0x60,
+  0x28, 0x82, 0x40, 0x28, 0x00, 0x41, 0x30, 0x81, 0x61, 0x30, 0x02, 0x40, 0x28, 0x40, 0x30, 0x61,
+  0x30, 0x81, 0x41, 0x30, 0x81, 0x40, 0x28, 0x81, 0x20, 0x20, 0x0E, 0x60, 0x28, 0xC0, 0x38, 0x40,
+  0x49, 0xE1, 0x69, 0xC2, 0x92, 0xC3, 0xBB, 0xC5, 0xE4, 0x87, 0xFD, 0xA7, 0xFD, 0xE6, 0xFC, 0xC2,
+  0xD2, 0x60, 0xE2, 0xC0, 0xD2, 0x80, 0x28, 0x60, 0x28, 0x8F, 0x00, 0x00, 0x15, 0x00, 0x38, 0x00,
+  0x00, 0x60, 0x28, 0x40, 0x20, 0x80, 0x79, 0xC0, 0xF2, 0x40, 0xB1, 0x20, 0xB1, 0xC0, 0xC9, 0xE1,
+  0xE2, 0x82, 0xF3, 0x64, 0xFC, 0xE4, 0xFC, 0x86, 0xFD, 0xC7, 0xFD, 0x67, 0xF5, 0x06, 0xE5, 0x85,
+  0xCC, 0x25, 0xBC, 0xC4, 0xAB, 0x84, 0x9B, 0x03, 0x93, 0x81, 0xE3, 0x8A, 0x82, 0xC3, 0x82, 0x81,
+  0xE3, 0x8A, 0x10, 0x23, 0x9B, 0x84, 0xAB, 0xE4, 0xBB, 0x85, 0xD4, 0x07, 0xE5, 0x88, 0xF5, 0xEA,
+  0xFD, 0x2B, 0xFE, 0x4C, 0xFE, 0xC9, 0xFD, 0x28, 0xFD, 0x05, 0xF4, 0x42, 0xEB, 0xA0, 0xEA, 0x60,
+  0xB9, 0x60, 0xE2, 0x80, 0xC2, 0x81, 0x60, 0x28, 0x01, 0x00, 0x00, 0x00, 0x50, 0x8F, 0x00, 0x00,
+  0x13, 0x80, 0x20, 0x40, 0x20, 0x20, 0x59, 0xE0, 0xF2, 0xA0, 0xB9, 0x60, 0xB9, 0xA0, 0xC1, 0x60,
+  0xE2, 0x40, 0xE2, 0x40, 0xDA, 0x20, 0xDA, 0xE1, 0xEA, 0xE2, 0xFB, 0x03, 0xFC, 0x64, 0xFC, 0xA4,
+  0xFC, 0xE5, 0xFC, 0x25, 0xFD, 0x46, 0xFD, 0x66, 0xFD, 0x81, 0x86, 0xFD, 0x82, 0xA7, 0xFD, 0x16,
+  0x86, 0xFD, 0x0A, 0xFE, 0x6D, 0xFE, 0x2C, 0xFE, 0x4C, 0xFE, 0x2C, 0xFE, 0x0C, 0xFE, 0xCB, 0xFD,
+  0x69, 0xFD, 0x48, 0xFD, 0xC6, 0xFC, 0x61, 0xFB, 0xE0, 0xF2, 0x60, 0xEA, 0xA0, 0xEA, 0xC0, 0xEA,
+  0xA0, 0xB9, 0xA0, 0xEA, 0x40, 0xAA, 0x40, 0x20, 0x80, 0x28, 0x00, 0x00, 0x00, 0x38, 0x8F, 0x00,
+  0x00, 0x07, 0x60, 0x18, 0x40, 0x20, 0xA0, 0x38, 0xC0, 0xE2, 0x00, 0xD2, 0x60, 0xB1, 0x80, 0xB9,
+  0x60, 0xE2, 0x81, 0x80, 0xE2, 0x02, 0x60, 0xE2, 0xA0, 0xE2, 0x60, 0xFB, 0x85, 0x40, 0xFB, 0x00,
+  0x60, 0xFB, 0x82, 0x61, 0xFB, 0x81, 0x81, 0xFB, 0x05, 0x61, 0xFB, 0x82, 0xFB, 0xA2, 0xFB, 0x61,
+  0xFB, 0x64, 0xFC, 0xA4, 0xFC, 0x82, 0x84, 0xFC, 0x0D, 0xC4, 0xFC, 0x23, 0xFC, 0x80, 0xFB, 0x21,
+  0xF3, 0xC0, 0xEA, 0xE0, 0xEA, 0xA0, 0xE2, 0x80, 0xC1, 0xE0, 0xFA, 0xC0, 0x89, 0x41, 0x20, 0x60,
+  0x28, 0x00, 0x00, 0x00, 0x38, 0x90, 0x00, 0x00, 0x07, 0x61, 0x20, 0x61, 0x28, 0x00, 0x59, 0xC0,
+  0xA9, 0x80, 0xB9, 0x80, 0xC1, 0x60, 0xE2, 0x80, 0xE2, 0x81, 0x60, 0xDA, 0x01, 0x60, 0xE2, 0x61,
+  0xFB, 0x88, 0x81, 0xFB, 0x86, 0x60, 0xFB, 0x05, 0x64, 0xFC, 0xC5, 0xFC, 0xA5, 0xFC, 0xC5, 0xFC,
+  0xE5, 0xFC, 0xA5, 0xFC, 0x81, 0x81, 0xFB, 0x08, 0x00, 0xF3, 0xC0, 0xF2, 0x20, 0xFB, 0xC0, 0xEA,
+  0x80, 0xB9, 0xA0, 0x81, 0x80, 0x30, 0x60, 0x20, 0x81, 0x18, 0x93, 0x00, 0x00, 0x06, 0x61, 0x20,
+  0x40, 0x20, 0x40, 0x28, 0xA0, 0x40, 0xE0, 0x70, 0xE0, 0xB9, 0xA0, 0xE2, 0x81, 0xA0, 0xEA, 0x02,
+  0x60, 0xEA, 0x61, 0xFB, 0x81, 0xFB, 0x8C, 0x61, 0xFB, 0x02, 0x81, 0xFB, 0x40, 0xFB, 0x03, 0xFC,
+  0x82, 0xC5, 0xFC, 0x0B, 0x84, 0xFC, 0xC1, 0xFB, 0xA1, 0xFB, 0xE1, 0xFB, 0x00, 0xF3, 0xA0, 0xD2,
+  0x20, 0xAA, 0x20, 0x61, 0x60, 0x30, 0x40, 0x20, 0x60, 0x20, 0x60, 0x18, 0x93, 0x00, 0x00, 0x0B,
+  0x00, 0x50, 0x00, 0x00, 0x60, 0x20, 0x60, 0x30, 0x80, 0x38, 0x40, 0x20, 0x40, 0x18, 0xA0, 0x38,
+  0x20, 0x69, 0xA0, 0x91, 0x00, 0xBA, 0xE0, 0xDA, 0x81, 0xA1, 0xFB, 0x83, 0xC1, 0xFB, 0x86, 0xA1,
+  0xFB, 0x83, 0xC1, 0xFB, 0x0A, 0x43, 0xFC, 0x22, 0xFC, 0xA2, 0xF3, 0x21, 0xDB, 0xC1, 0xC2, 0x41,
+  0x9A, 0x80, 0x69, 0xE0, 0x40, 0x60, 0x20, 0x20, 0x18, 0x80, 0x30, 0x81, 0x60, 0x28, 0x96, 0x00,
+  0x00, 0x07, 0x00, 0x50, 0x60, 0x20, 0x40, 0x20, 0xA0, 0x89, 0x20, 0xCA, 0xE0, 0x78, 0xA0, 0x50,
+  0x60, 0x30, 0x81, 0x40, 0x18, 0x15, 0x60, 0x28, 0xC0, 0x38, 0x20, 0x51, 0x80, 0x69, 0xE0, 0x81,
+  0x41, 0x9A, 0x61, 0xAA, 0xA1, 0xB2, 0xA1, 0xBA, 0xC1, 0xC2, 0xE1, 0xC2, 0xC1, 0xC2, 0xC1, 0xBA,
+  0x81, 0xB2, 0x61, 0xAA, 0x41, 0x9A, 0x01, 0x8A, 0xA0, 0x71, 0x40, 0x59, 0xE0, 0x40, 0xA0, 0x30,
+  0x60, 0x20, 0x81, 0x20, 0x18, 0x04, 0x40, 0x30, 0xA0, 0x50, 0xE0, 0x78, 0x20, 0xC2, 0x40, 0xBA,
+  0x81, 0x60, 0x28, 0x01, 0x00, 0x00, 0x00, 0x28, 0x95, 0x00, 0x00, 0x0D, 0xA1, 0x28, 0x40, 0x20,
+  0x00, 0x59, 0xC0, 0xF2, 0xA0, 0xC9, 0x80, 0xC1, 0x80, 0xB9, 0x60, 0xA9, 0x20, 0x89, 0xE0, 0x70,
+  0xA0, 0x50, 0x60, 0x40, 0x40, 0x30, 0x20, 0x20, 0x86, 0x20, 0x18, 0x00, 0x20, 0x10, 0x82, 0x20,
+  0x18, 0x10, 0x20, 0x20, 0x40, 0x28, 0x60, 0x38, 0xA0, 0x50, 0xE0, 0x68, 0x20, 0x81, 0xA0, 0xA1,
+  0x00, 0xC2, 0xE0, 0xC9, 0xA0, 0xC9, 0xA0, 0xC1, 0xE0, 0xFA, 0xA0, 0x89, 0x41, 0x20, 0x80, 0x28,
+  0x00, 0x00, 0x00, 0x50, 0x96, 0x00, 0x00, 0x10, 0x60, 0x20, 0x81, 0x30, 0x80, 0xD2, 0xE0, 0xD1,
+  0x60, 0xB1, 0x80, 0xB9, 0x80, 0xC1, 0x00, 0xDA, 0x80, 0xEA, 0xA0, 0xEA, 0x80, 0xE2, 0x60, 0xDA,
+  0x20, 0xD2, 0x00, 0xC2, 0xE0, 0xB9, 0xC0, 0xB1, 0xA0, 0xA9, 0x82, 0xA0, 0xA1, 0x05, 0xC0, 0xA9,
+  0xE0, 0xB1, 0x00, 0xBA, 0x20, 0xC2, 0x40, 0xD2, 0x80, 0xDA, 0x81, 0xA0, 0xEA, 0x0A, 0x21, 0xF3,
+  0xC3, 0xFB, 0x21, 0xFB, 0x00, 0xFB, 0xE0, 0xC9, 0x60, 0xB9, 0xC0, 0xC1, 0xE0, 0xF2, 0xE0, 0x50,
+  0x40, 0x20, 0xA1, 0x28, 0x96, 0x00, 0x00, 0x0C, 0x00, 0x38, 0x00, 0x00, 0x61, 0x20, 0x41, 0x20,
+  0x00, 0xAA, 0x60, 0xEA, 0x60, 0xB1, 0x80, 0xB9, 0x60, 0xB9, 0x40, 0xDA, 0xE0, 0xF2, 0xE0, 0xEA,
+  0x20, 0xF3, 0x81, 0x40, 0xFB, 0x00, 0x60, 0xFB, 0x82, 0x81, 0xFB, 0x85, 0x61, 0xFB, 0x82, 0x81,
+  0xFB, 0x0D, 0xA1, 0xFB, 0x20, 0xF3, 0xE3, 0xFB, 0x03, 0xFC, 0x01, 0xF3, 0xC0, 0xEA, 0xA0, 0xC1,
+  0x60, 0xB9, 0x20, 0xDA, 0xA0, 0xDA, 0x80, 0x30, 0x61, 0x20, 0x00, 0x00, 0x00, 0x78, 0x97, 0x00,
+  0x00, 0x03, 0x81, 0x20, 0x40, 0x18, 0x40, 0x71, 0xC0, 0xF2, 0x81, 0x80, 0xB9, 0x08, 0x60, 0xB9,
+  0x00, 0xD2, 0xC0, 0xEA, 0xA0, 0xEA, 0xE0, 0xF2, 0x41, 0xFB, 0x64, 0xFC, 0x03, 0xFC, 0x61, 0xFB,
+  0x89, 0x81, 0xFB, 0x02, 0x61, 0xFB, 0x81, 0xFB, 0x20, 0xF3, 0x82, 0xE0, 0xF2, 0x00, 0x80, 0xE2,
+  0x81, 0x80, 0xB9, 0x05, 0xA0, 0xF2, 0x00, 0xA2, 0x41, 0x20, 0x60, 0x28, 0x00, 0x00, 0x00, 0x38,
+  0x97, 0x00, 0x00, 0x0F, 0x20, 0x21, 0x40, 0x20, 0xC0, 0x40, 0xC0, 0xE2, 0xE0, 0xC9, 0x60, 0xB9,
+  0x80, 0xB9, 0xA0, 0xC1, 0xC0, 0xEA, 0xA0, 0xEA, 0xC0, 0xEA, 0x20, 0xFB, 0xA5, 0xFC, 0xE6, 0xFC,
+  0x81, 0xFB, 0x61, 0xFB, 0x8A, 0x81, 0xFB, 0x0A, 0xE0, 0xF2, 0xC0, 0xEA, 0xE0, 0xEA, 0xE0, 0xF2,
+  0x20, 0xD2, 0x80, 0xB9, 0xA0, 0xC1, 0xE0, 0xF2, 0x40, 0x69, 0x41, 0x20, 0xA1, 0x28, 0x98, 0x00,
+  0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x81, 0x61, 0x28, 0x02, 0x40, 0xC2, 0x60, 0xE2, 0x60, 0xB1,
+  0x81, 0x80, 0xB9, 0x07, 0x80, 0xE2, 0xC0, 0xEA, 0xA0, 0xEA, 0xC0, 0xF2, 0xC2, 0xFB, 0xA5, 0xFC,
+  0x81, 0xFB, 0x61, 0xFB, 0x84, 0x81, 0xFB, 0x81, 0x61, 0xFB, 0x04, 0x81, 0xFB, 0x61, 0xFB, 0x81,
+  0xFB, 0x41, 0xFB, 0xC0, 0xEA, 0x82, 0xE0, 0xEA, 0x06, 0xC0, 0xC1, 0x60, 0xB9, 0x00, 0xD2, 0xC0,
+  0xE2, 0xA0, 0x38, 0x61, 0x20, 0x45, 0x51, 0x96, 0x00, 0x00, 0x07, 0xEF, 0x7B, 0xF7, 0xBD, 0x6D,
+  0x6B, 0x00, 0x00, 0x00, 0x10, 0x40, 0x18, 0x80, 0x89, 0xC0, 0xF2, 0x81, 0x80, 0xB9, 0x02, 0x60,
+  0xB9, 0x40, 0xDA, 0xC0, 0xEA, 0x81, 0xA0, 0xEA, 0x01, 0x21, 0xFB, 0x81, 0xFB, 0x8A, 0x61, 0xFB,
+  0x01, 0x81, 0xFB, 0xE0, 0xF2, 0x81, 0xC0, 0xEA, 0x01, 0xE0, 0xF2, 0x80, 0xE2, 0x81, 0x80, 0xB9,
+  0x08, 0x80, 0xEA, 0x40, 0xBA, 0x61, 0x28, 0x20, 0x20, 0x00, 0x00, 0x26, 0x9B, 0xF7, 0xFD, 0x55,
+  0xFD, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x01, 0xEF, 0x7B, 0x55, 0xFD, 0x83, 0x00, 0x00, 0x04, 0x6F,
+  0x9C, 0x61, 0x20, 0xC0, 0x50, 0xC0, 0xEA, 0xE0, 0xC9, 0x81, 0x60, 0xB9, 0x01, 0xE0, 0xC9, 0xC0,
+  0xEA, 0x81, 0xA0, 0xEA, 0x01, 0xC0, 0xEA, 0x41, 0xFB, 0x88, 0x61, 0xFB, 0x81, 0x81, 0xFB, 0x00,
+  0x00, 0xF3, 0x82, 0xC0, 0xEA, 0x08, 0xE0, 0xF2, 0x20, 0xD2, 0x60, 0xB9, 0x80, 0xB9, 0xC0, 0xF2,
+  0x80, 0x81, 0x40, 0x20, 0x27, 0x5A, 0x3C, 0xFF, 0x83, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x8E, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x09, 0x99, 0xE6, 0xD9, 0xE6, 0xB9, 0xE6, 0x98, 0xE6,
+  0x1A, 0xEF, 0x89, 0x62, 0x00, 0x20, 0x60, 0xCA, 0x60, 0xE2, 0x60, 0xB1, 0x81, 0x80, 0xB9, 0x00,
+  0xA0, 0xE2, 0x82, 0xA0, 0xEA, 0x01, 0xC0, 0xEA, 0x21, 0xFB, 0x85, 0x61, 0xFB, 0x81, 0x81, 0xFB,
+  0x02, 0x61, 0xFB, 0x00, 0xF3, 0xA0, 0xEA, 0x83, 0xC0, 0xEA, 0x06, 0xC0, 0xC1, 0x60, 0xB9, 0xE0,
+  0xC9, 0xE0, 0xEA, 0xA0, 0x40, 0xE3, 0x30, 0x57, 0xDE, 0x83, 0xB9, 0xE6, 0x00, 0x55, 0xD5, 0x8E,
+  0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x77, 0xDE, 0x81, 0xD9, 0xE6, 0x81, 0x1A, 0xEF, 0x0A,
+  0xD9, 0xEE, 0x9C, 0xFF, 0xB1, 0xA4, 0x00, 0x10, 0x00, 0x71, 0xE0, 0xD9, 0x20, 0xA9, 0x40, 0xB1,
+  0x60, 0xB9, 0x40, 0xDA, 0xC0, 0xEA, 0x83, 0xA0, 0xEA, 0x02, 0xE0, 0xEA, 0x20, 0xF3, 0x41, 0xFB,
+  0x81, 0x61, 0xFB, 0x04, 0x41, 0xFB, 0x41, 0xF3, 0x00, 0xF3, 0xC0, 0xEA, 0xA0, 0xEA, 0x83, 0xC0,
+  0xEA, 0x0D, 0x80, 0xE2, 0x80, 0xB9, 0x60, 0xB1, 0xE0, 0xD9, 0xA0, 0xA1, 0x00, 0x18, 0x68, 0x62,
+  0x5B, 0xF7, 0x1A, 0xEF, 0xFA, 0xEE, 0x3A, 0xF7, 0xF9, 0xEE, 0xD9, 0xE6, 0xB8, 0xE6, 0x82, 0xFF,
+  0xFF, 0x89, 0x00, 0x00, 0x04, 0xEF, 0x7B, 0xFF, 0xFF, 0x98, 0xDE, 0xB9, 0xE6, 0x3A, 0xF7, 0x82,
+  0xB9, 0xE6, 0x06, 0x98, 0xDE, 0xEE, 0x93, 0xA5, 0x59, 0x81, 0x30, 0x40, 0x28, 0xE0, 0x78, 0x20,
+  0xA9, 0x81, 0xE0, 0xA0, 0x05, 0x80, 0xB9, 0x60, 0xDA, 0x80, 0xE2, 0xA0, 0xE2, 0xA0, 0xEA, 0xC0,
+  0xEA, 0x81, 0xA0, 0xEA, 0x82, 0xC0, 0xEA, 0x83, 0xA0, 0xEA, 0x81, 0xC0, 0xEA, 0x13, 0xA0, 0xEA,
+  0x80, 0xE2, 0x60, 0xE2, 0xA0, 0xC9, 0x20, 0xB1, 0x20, 0xA9, 0x20, 0x91, 0x60, 0x38, 0x60, 0x20,
+  0xE2, 0x40, 0x68, 0x6A, 0x53, 0xBD, 0xD9, 0xE6, 0x98, 0xDE, 0xB8, 0xE6, 0xD9, 0xE6, 0x5B, 0xF7,
+  0xB8, 0xE6, 0x00, 0x00, 0xFF, 0xFF, 0x89, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0x00, 0x00, 0x98, 0xDE,
+  0xD9, 0xE6, 0xF9, 0xEE, 0xB9, 0xE6, 0xB8, 0xE6, 0xB9, 0xE6, 0x37, 0xD6, 0xE2, 0x40, 0x00, 0x30,
+  0x80, 0x38, 0x60, 0x28, 0x61, 0x20, 0x81, 0x38, 0xA0, 0x58, 0xC0, 0x78, 0xE0, 0x98, 0x80, 0xC1,
+  0xC0, 0xC9, 0xE0, 0xD1, 0x00, 0xDA, 0x40, 0xDA, 0x40, 0xE2, 0x60, 0xE2, 0x84, 0x80, 0xE2, 0x81,
+  0x60, 0xE2, 0x07, 0x40, 0xE2, 0x20, 0xDA, 0x00, 0xDA, 0xC0, 0xC9, 0xA0, 0xC1, 0x00, 0x91, 0xC0,
+  0x70, 0xA0, 0x48, 0x81, 0x61, 0x28, 0x0B, 0x81, 0x30, 0x80, 0x40, 0x00, 0x20, 0x47, 0x62, 0xFA,
+  0xEE, 0x98, 0xDE, 0xB9, 0xDE, 0xB9, 0xE6, 0x5B, 0xF7, 0xB8, 0xE6, 0x00, 0x00, 0xEF, 0x7B, 0x8A,
+  0x00, 0x00, 0x05, 0xEF, 0x7B, 0x00, 0x00, 0x78, 0xDE, 0xF9, 0xEE, 0xFA, 0xEE, 0x1A, 0xF7, 0x81,
+  0xD9, 0xE6, 0x10, 0x37, 0xD6, 0x6C, 0x83, 0x64, 0x51, 0x80, 0x30, 0x00, 0x28, 0x00, 0x20, 0x00,
+  0x18, 0x20, 0x20, 0x40, 0x30, 0xA0, 0x48, 0x00, 0x69, 0x40, 0x89, 0x60, 0x99, 0xA0, 0xA9, 0xA0,
+  0xB1, 0xC0, 0xC1, 0xE0, 0xC1, 0x81, 0xE0, 0xC9, 0x81, 0xC0, 0xC1, 0x12, 0xC0, 0xB9, 0xA0, 0xB1,
+  0x80, 0xA1, 0x60, 0x91, 0x20, 0x79, 0xE0, 0x58, 0x80, 0x38, 0x40, 0x28, 0x20, 0x18, 0x00, 0x18,
+  0x00, 0x20, 0x20, 0x28, 0xA1, 0x38, 0xA5, 0x59, 0xEE, 0x93, 0x78, 0xDE, 0xD9, 0xE6, 0xFA, 0xEE,
+  0x3A, 0xF7, 0x81, 0xD9, 0xE6, 0x00, 0x57, 0xD6, 0x81, 0xFF, 0xFF, 0x8B, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0x81, 0x00, 0x00, 0x82, 0xD9, 0xE6, 0x0A, 0xB9, 0xE6, 0x3B, 0xF7, 0x9C, 0xFF, 0x1A, 0xEF,
+  0xF6, 0xCD, 0x90, 0xA4, 0x4C, 0x83, 0x27, 0x62, 0x44, 0x49, 0xA1, 0x30, 0x20, 0x20, 0x82, 0x00,
+  0x10, 0x03, 0x00, 0x18, 0x00, 0x20, 0x00, 0x28, 0x00, 0x30, 0x81, 0x20, 0x30, 0x03, 0x00, 0x30,
+  0x00, 0x28, 0x00, 0x20, 0x00, 0x18, 0x83, 0x00, 0x10, 0x0A, 0x20, 0x20, 0xA1, 0x30, 0x44, 0x41,
+  0x27, 0x62, 0x4C, 0x83, 0xB1, 0xAC, 0x37, 0xD6, 0x5B, 0xF7, 0x9C, 0xFF, 0xFA, 0xEE, 0xB9, 0xE6,
+  0x81, 0xD9, 0xE6, 0x00, 0xB9, 0xE6, 0x90, 0x00, 0x00, 0x00, 0x55, 0xAD, 0x82, 0x00, 0x00, 0x05,
+  0xF7, 0xBD, 0xF9, 0xE6, 0x98, 0xE6, 0x78, 0xDE, 0xB9, 0xE6, 0x1A, 0xEF, 0x81, 0x3A, 0xEF, 0x09,
+  0x3A, 0xF7, 0x1A, 0xEF, 0x98, 0xE6, 0x16, 0xD6, 0x94, 0xC5, 0x12, 0xB5, 0x70, 0xA4, 0xEE, 0x93,
+  0xAD, 0x8B, 0x2B, 0x7B, 0x81, 0x0B, 0x73, 0x81, 0xEA, 0x72, 0x11, 0x0B, 0x73, 0x2B, 0x7B, 0xAD,
+  0x8B, 0xEE, 0x93, 0x70, 0xA4, 0xF2, 0xB4, 0x74, 0xC5, 0x16, 0xD6, 0x98, 0xE6, 0xFA, 0xEE, 0x1A,
+  0xEF, 0x3B, 0xF7, 0x3A, 0xF7, 0xFA, 0xEE, 0xB8, 0xE6, 0x78, 0xDE, 0x98, 0xE6, 0xD9, 0xE6, 0x82,
+  0x00, 0x00, 0x01, 0x55, 0xAD, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x01, 0xF5, 0xFF, 0xFF, 0xFF, 0x85,
+  0x00, 0x00, 0x07, 0xB4, 0xCD, 0x16, 0xD6, 0x57, 0xDE, 0xD9, 0xE6, 0x1A, 0xEF, 0x3B, 0xF7, 0x5B,
+  0xF7, 0x7B, 0xF7, 0x84, 0x5B, 0xF7, 0x83, 0x3B, 0xF7, 0x81, 0x5B, 0xF7, 0x09, 0x7B, 0xF7, 0x5B,
+  0xF7, 0x7B, 0xF7, 0x5B, 0xFF, 0x3B, 0xF7, 0xFA, 0xEE, 0xB8, 0xE6, 0x37, 0xD6, 0xB5, 0xCD, 0x26,
+  0x63, 0x84, 0x00, 0x00, 0x02, 0xEF, 0x7B, 0xF7, 0xBD, 0xEF, 0xFF, 0x94, 0x00, 0x00, 0x81, 0xFF,
+  0xFF, 0x02, 0xF7, 0xBD, 0xF7, 0xFF, 0xF5, 0xFF, 0x9D, 0x00, 0x00, 0x04, 0xEF, 0xFF, 0xF7, 0xFD,
+  0xF7, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x86, 0x00, 0x00,
+};
+
+static const uint8_t kPlantAlpha[] = {
+  0x84, 0x00, 0x03, 0x01, 0x03, 0x04, 0x02, 0x8C, 0x00, 0x81, 0x04, 0x00, 0x02, 0xA8, 0x00, 0x02,
+  0x01, 0x03, 0x02, 0x83, 0x00, 0x04, 0x05, 0x1A, 0x30, 0x40, 0x51, 0x82, 0x59, 0x03, 0x4C, 0x3E,
+  0x28, 0x12, 0x83, 0x00, 0x01, 0x02, 0x03, 0xA5, 0x00, 0x00, 0x03, 0x82, 0x00, 0x05, 0x18, 0x4D,
+  0x8A, 0xBA, 0xDE, 0xF5, 0x88, 0xFF, 0x04, 0xEE, 0xCE, 0x9D, 0x60, 0x20, 0x81, 0x00, 0x01, 0x01,
+  0x02, 0xA4, 0x00, 0x03, 0x0C, 0x5A, 0xB4, 0xEF, 0x84, 0xFF, 0x01, 0xFE, 0xFC, 0x83, 0xFB, 0x81,
+  0xFC, 0x00, 0xFE, 0x83, 0xFF, 0x02, 0xF5, 0xB5, 0x4F, 0x81, 0x00, 0x00, 0x03, 0xA1, 0x00, 0x02,
+  0x03, 0x5F, 0xDD, 0x82, 0xFF, 0x03, 0xFC, 0xFB, 0xFC, 0xFD, 0x84, 0xFE, 0x81, 0xFF, 0x81, 0xFE,
+  0x81, 0xFD, 0x00, 0xFC, 0x81, 0xFB, 0x82, 0xFF, 0x02, 0xC1, 0x3D, 0x00, 0x81, 0x01, 0x9F, 0x00,
+  0x00, 0x2A, 0x81, 0xFF, 0x02, 0xF9, 0xFB, 0xFE, 0x86, 0xFF, 0x00, 0xFE, 0x83, 0xFF, 0x84, 0xFE,
+  0x01, 0xFF, 0xFE, 0x81, 0xFB, 0x05, 0xFF, 0xFE, 0x87, 0x01, 0x00, 0x02, 0x9E, 0x00, 0x04, 0x06,
+  0x7A, 0xFD, 0xFF, 0xFD, 0x83, 0xFF, 0x81, 0xFE, 0x81, 0xFF, 0x00, 0xFE, 0x87, 0xFF, 0x00, 0xFE,
+  0x82, 0xFF, 0x07, 0xFE, 0xFB, 0xFC, 0xFF, 0xB4, 0x0C, 0x00, 0x01, 0x9D, 0x00, 0x05, 0x01, 0x00,
+  0x47, 0xF1, 0xFF, 0xFD, 0x85, 0xFF, 0x82, 0xFE, 0x81, 0xFF, 0x00, 0xFE, 0x89, 0xFF, 0x06, 0xFD,
+  0xF9, 0xFF, 0xC0, 0x08, 0x02, 0x01, 0x9D, 0x00, 0x05, 0x05, 0x00, 0x3D, 0xF6, 0xFD, 0xFE, 0x85,
+  0xFF, 0x00, 0xFE, 0x82, 0xFF, 0x82, 0xFE, 0x87, 0xFF, 0x81, 0xFE, 0x04, 0xF9, 0xFF, 0xA7, 0x00,
+  0x03, 0x9E, 0x00, 0x05, 0x05, 0x00, 0x53, 0xFF, 0xFB, 0xFE, 0x8B, 0xFF, 0x81, 0xFE, 0x87, 0xFF,
+  0x05, 0xFE, 0xFA, 0xFF, 0x65, 0x00, 0x03, 0x9E, 0x00, 0x04, 0x05, 0x00, 0x8E, 0xFF, 0xFB, 0x8D,
+  0xFF, 0x82, 0xFE, 0x85, 0xFF, 0x05, 0xFC, 0xFD, 0xEE, 0x18, 0x01, 0x02, 0x9D, 0x00, 0x05, 0x01,
+  0x03, 0x07, 0xD3, 0xFF, 0xFC, 0x8F, 0xFF, 0x00, 0xFE, 0x85, 0xFF, 0x04, 0xFA, 0xFF, 0x89, 0x00,
+  0x04, 0x88, 0x00, 0x01, 0x01, 0x02, 0x82, 0x04, 0x82, 0x03, 0x82, 0x04, 0x01, 0x02, 0x01, 0x88,
+  0x00, 0x05, 0x03, 0x00, 0x35, 0xFC, 0xFB, 0xFE, 0x8E, 0xFF, 0x00, 0xFE, 0x85, 0xFF, 0x05, 0xFD,
+  0xFE, 0xEB, 0x10, 0x00, 0x01, 0x85, 0x00, 0x01, 0x02, 0x04, 0x8C, 0x00, 0x01, 0x04, 0x03, 0x87,
+  0x00, 0x04, 0x04, 0x00, 0x7E, 0xFF, 0xFA, 0x91, 0xFF, 0x00, 0xFE, 0x83, 0xFF, 0x04, 0xFB, 0xFF,
+  0x5B, 0x00, 0x04, 0x83, 0x00, 0x01, 0x01, 0x03, 0x81, 0x00, 0x0C, 0x02, 0x2C, 0x5F, 0x88, 0xA4,
+  0xB1, 0xB6, 0xAB, 0x9B, 0x7F, 0x57, 0x2A, 0x05, 0x81, 0x00, 0x01, 0x01, 0x02, 0x85, 0x00, 0x05,
+  0x01, 0x03, 0x01, 0xBB, 0xFF, 0xFB, 0x91, 0xFF, 0x00, 0xFE, 0x82, 0xFF, 0x04, 0xFA, 0xFE, 0xA4,
+  0x00, 0x03, 0x82, 0x00, 0x00, 0x02, 0x81, 0x00, 0x03, 0x25, 0x85, 0xD3, 0xFE, 0x88, 0xFF, 0x03,
+  0xFD, 0xD9, 0x95, 0x3F, 0x81, 0x00, 0x00, 0x01, 0x85, 0x00, 0x05, 0x02, 0x01, 0x12, 0xD5, 0xFF,
+  0xFA, 0x90, 0xFF, 0x00, 0xFE, 0x82, 0xFF, 0x0B, 0xFD, 0xFF, 0xD5, 0x02, 0x00, 0x01, 0x00, 0x03,
+  0x00, 0x0D, 0x8C, 0xF5, 0x82, 0xFF, 0x00, 0xFB, 0x81, 0xFA, 0x85, 0xFB, 0x83, 0xFF, 0x02, 0xBC,
+  0x2F, 0x01, 0x86, 0x00, 0x05, 0x02, 0x00, 0x1D, 0xD8, 0xFF, 0xFA, 0x90, 0xFF, 0x00, 0xFE, 0x81,
+  0xFF, 0x09, 0xFE, 0xFF, 0xEE, 0x13, 0x00, 0x01, 0x03, 0x00, 0x2A, 0xD3, 0x81, 0xFF, 0x01, 0xFA,
+  0xFD, 0x83, 0xFE, 0x85, 0xFF, 0x06, 0xFE, 0xFD, 0xFB, 0xF9, 0xFF, 0xDB, 0x02, 0x87, 0x00, 0x06,
+  0x03, 0x00, 0x19, 0xC2, 0xFF, 0xFD, 0xFC, 0x91, 0xFF, 0x0B, 0xFE, 0xFF, 0xF6, 0x1C, 0x00, 0x04,
+  0x00, 0x2A, 0xEA, 0xFF, 0xF9, 0xFE, 0x87, 0xFF, 0x00, 0xFE, 0x84, 0xFF, 0x04, 0xFD, 0xFF, 0xE6,
+  0x4C, 0x01, 0x88, 0x00, 0x03, 0x02, 0x00, 0x06, 0x8F, 0x81, 0xFF, 0x81, 0xFC, 0x00, 0xFE, 0x8E,
+  0xFF, 0x09, 0xFE, 0xFF, 0xF4, 0x18, 0x00, 0x03, 0x0D, 0xD9, 0xFF, 0xFA, 0x86, 0xFF, 0x82, 0xFE,
+  0x84, 0xFF, 0x05, 0xFE, 0xFC, 0xF3, 0x30, 0x00, 0x02, 0x89, 0x00, 0x00, 0x02, 0x81, 0x00, 0x01,
+  0x44, 0xC6, 0x82, 0xFF, 0x03, 0xFB, 0xFC, 0xFD, 0xFE, 0x86, 0xFF, 0x01, 0xFE, 0xFD, 0x81, 0xFF,
+  0x08, 0xFD, 0xFF, 0xDB, 0x07, 0x01, 0x00, 0x94, 0xFF, 0xFA, 0x8F, 0xFF, 0x04, 0xFB, 0xFF, 0x6B,
+  0x00, 0x06, 0x8B, 0x00, 0x01, 0x01, 0x03, 0x81, 0x00, 0x02, 0x51, 0xB9, 0xFB, 0x83, 0xFF, 0x00,
+  0xFD, 0x83, 0xFB, 0x01, 0xFC, 0xFD, 0x83, 0xFF, 0x02, 0xFC, 0xFF, 0xC2, 0x81, 0x00, 0x03, 0x28,
+  0xFB, 0xFC, 0xFE, 0x83, 0xFF, 0x00, 0xFE, 0x89, 0xFF, 0x05, 0xFC, 0xFF, 0xCD, 0x02, 0x03, 0x01,
+  0x8D, 0x00, 0x00, 0x03, 0x82, 0x00, 0x04, 0x2A, 0x71, 0xB3, 0xE3, 0xFD, 0x86, 0xFF, 0x0B, 0xF5,
+  0xD5, 0xFC, 0xFF, 0xFE, 0xFD, 0xF9, 0x37, 0x00, 0x94, 0xFF, 0xFB, 0x8E, 0xFF, 0x05, 0xFE, 0xFB,
+  0xFF, 0x3B, 0x00, 0x03, 0x90, 0x00, 0x01, 0x03, 0x02, 0x82, 0x00, 0x14, 0x0B, 0x28, 0x45, 0x5B,
+  0x69, 0x72, 0x67, 0x56, 0x3D, 0x1E, 0x01, 0xBB, 0xFE, 0xFC, 0xFB, 0xFF, 0xA1, 0x00, 0xE0, 0xFF,
+  0xFD, 0x8E, 0xFF, 0x04, 0xFA, 0xFF, 0x8E, 0x00, 0x03, 0x93, 0x00, 0x02, 0x02, 0x04, 0x02, 0x8A,
+  0x00, 0x09, 0x53, 0xFF, 0xFC, 0xFE, 0xFF, 0xEA, 0x41, 0xF9, 0xFF, 0xFE, 0x8C, 0xFF, 0x06, 0xFE,
+  0xF9, 0xFF, 0xBA, 0x04, 0x03, 0x01, 0x96, 0x00, 0x02, 0x01, 0x02, 0x03, 0x84, 0x04, 0x81, 0x03,
+  0x08, 0x01, 0x0C, 0xE8, 0xFF, 0xFD, 0xFE, 0xFF, 0xB5, 0xF9, 0x81, 0xFF, 0x01, 0xFD, 0xFE, 0x87,
+  0xFF, 0x02, 0xFE, 0xFD, 0xFB, 0x81, 0xFF, 0x01, 0xB9, 0x0C, 0x81, 0x01, 0xA1, 0x00, 0x04, 0x03,
+  0x00, 0xA3, 0xFF, 0xFB, 0x81, 0xFF, 0x03, 0xFC, 0xFE, 0xFF, 0xFE, 0x81, 0xFF, 0x00, 0xFD, 0x85,
+  0xFB, 0x00, 0xFC, 0x82, 0xFF, 0x04, 0xF2, 0x7D, 0x03, 0x00, 0x01, 0xA2, 0x00, 0x04, 0x04, 0x01,
+  0x5B, 0xFF, 0xFC, 0x83, 0xFF, 0x03, 0xFE, 0xFF, 0xE2, 0xEC, 0x87, 0xFF, 0x03, 0xFC, 0xD0, 0x83,
+  0x22, 0x81, 0x00, 0x00, 0x01, 0xA3, 0x00, 0x05, 0x02, 0x00, 0x23, 0xFA, 0xFF, 0xFE, 0x81, 0xFF,
+  0x81, 0xFE, 0x0B, 0xF9, 0x29, 0x13, 0x44, 0x66, 0x83, 0x95, 0x96, 0x8A, 0x75, 0x54, 0x28, 0x82,
+  0x00, 0x00, 0x03, 0xA5, 0x00, 0x05, 0x01, 0x00, 0x04, 0xDB, 0xFF, 0xFD, 0x81, 0xFF, 0x02, 0xFC,
+  0xFF, 0xBA, 0x8B, 0x00, 0x01, 0x04, 0x02, 0xA6, 0x00, 0x05, 0x01, 0x03, 0x01, 0xB3, 0xFF, 0xFB,
+  0x81, 0xFF, 0x05, 0xFB, 0xFF, 0x74, 0x02, 0x06, 0x03, 0x86, 0x04, 0x01, 0x02, 0x01, 0xA0, 0x00,
+  0x02, 0x01, 0x02, 0x03, 0x82, 0x04, 0x11, 0x03, 0x01, 0x00, 0x02, 0x00, 0x84, 0xFF, 0xFB, 0xFF,
+  0xFE, 0xFD, 0xFF, 0x3B, 0x00, 0x01, 0x00, 0x01, 0x03, 0x82, 0x04, 0x02, 0x03, 0x02, 0x01, 0x9D,
+  0x00, 0x03, 0x01, 0x03, 0x04, 0x03, 0x87, 0x00, 0x0C, 0x02, 0x0A, 0x10, 0x6D, 0xFF, 0xFC, 0xFF,
+  0xFE, 0xFF, 0xF9, 0x2E, 0x0F, 0x07, 0x88, 0x00, 0x03, 0x03, 0x04, 0x02, 0x01, 0x97, 0x00, 0x01,
+  0x02, 0x04, 0x83, 0x00, 0x0B, 0x05, 0x22, 0x42, 0x64, 0x85, 0xA0, 0xB7, 0xC9, 0xD8, 0xDF, 0xEB,
+  0xF2, 0x84, 0xFF, 0x0C, 0xFD, 0xEE, 0xEA, 0xDE, 0xD3, 0xC6, 0xB3, 0x9C, 0x7D, 0x5C, 0x3B, 0x1B,
+  0x01, 0x83, 0x00, 0x01, 0x04, 0x01, 0x94, 0x00, 0x00, 0x03, 0x81, 0x00, 0x05, 0x07, 0x3A, 0x78,
+  0xB2, 0xDC, 0xF9, 0x99, 0xFF, 0x05, 0xF4, 0xD4, 0xA7, 0x6D, 0x31, 0x02, 0x81, 0x00, 0x00, 0x03,
+  0x92, 0x00, 0x04, 0x01, 0x00, 0x29, 0x8D, 0xDC, 0x84, 0xFF, 0x00, 0xFD, 0x82, 0xFB, 0x81, 0xFC,
+  0x81, 0xFD, 0x81, 0xFE, 0x85, 0xFF, 0x81, 0xFE, 0x81, 0xFD, 0x81, 0xFC, 0x82, 0xFB, 0x00, 0xFE,
+  0x84, 0xFF, 0x04, 0xD1, 0x7C, 0x1C, 0x00, 0x01, 0x90, 0x00, 0x81, 0x02, 0x01, 0x82, 0xF8, 0x81,
+  0xFF, 0x04, 0xFE, 0xFB, 0xFC, 0xFD, 0xFE, 0x83, 0xFF, 0x00, 0xFE, 0x94, 0xFF, 0x01, 0xFE, 0xFD,
+  0x81, 0xFB, 0x82, 0xFF, 0x03, 0xED, 0x70, 0x00, 0x02, 0x8E, 0x00, 0x06, 0x04, 0x00, 0x70, 0xFF,
+  0xFE, 0xFB, 0xFD, 0x88, 0xFF, 0x81, 0xFE, 0x98, 0xFF, 0x01, 0xFD, 0xFB, 0x81, 0xFF, 0x02, 0x79,
+  0x00, 0x03, 0x8D, 0x00, 0x04, 0x03, 0x00, 0xB3, 0xFC, 0xFA, 0x91, 0xFF, 0x00, 0xFE, 0x90, 0xFF,
+  0x00, 0xFE, 0x82, 0xFF, 0x05, 0xFB, 0xFD, 0xE0, 0x04, 0x00, 0x01, 0x8C, 0x00, 0x04, 0x04, 0x00,
+  0x9B, 0xFF, 0xFB, 0xA7, 0xFF, 0x05, 0xFD, 0xFF, 0xD9, 0x02, 0x00, 0x01, 0x8C, 0x00, 0x04, 0x04,
+  0x00, 0x7B, 0xFF, 0xFB, 0x86, 0xFF, 0x00, 0xFE, 0x9C, 0xFF, 0x00, 0xFE, 0x81, 0xFF, 0x04, 0xFC,
+  0xFF, 0xC6, 0x00, 0x01, 0x8D, 0x00, 0x04, 0x04, 0x00, 0x58, 0xFF, 0xFB, 0x88, 0xFF, 0x01, 0xFE,
+  0xFF, 0x81, 0xFE, 0x8E, 0xFF, 0x81, 0xFE, 0x89, 0xFF, 0x04, 0xFB, 0xFF, 0xAF, 0x00, 0x03, 0x8D,
+  0x00, 0x02, 0x02, 0x00, 0x35, 0x82, 0xFE, 0xA6, 0xFF, 0x04, 0xFB, 0xFE, 0x8F, 0x00, 0x04, 0x8D,
+  0x00, 0x05, 0x01, 0x00, 0x14, 0xF7, 0xFC, 0xFD, 0xA6, 0xFF, 0x04, 0xF8, 0xFF, 0x64, 0x00, 0x04,
+  0x8E, 0x00, 0x02, 0x02, 0x00, 0x98, 0x81, 0xFF, 0x00, 0xFE, 0x99, 0xFF, 0x82, 0xFE, 0x87, 0xFF,
+  0x05, 0xFD, 0xFF, 0xE9, 0x1C, 0x01, 0x02, 0x8E, 0x00, 0x06, 0x01, 0x02, 0x03, 0x7A, 0xF1, 0xFD,
+  0xFE, 0x9F, 0xFF, 0x00, 0xFE, 0x81, 0xFF, 0x05, 0xFD, 0xFE, 0xBA, 0x25, 0x00, 0x01, 0x91, 0x00,
+  0x04, 0x03, 0x00, 0x95, 0xFF, 0xFA, 0xA1, 0xFF, 0x02, 0xFD, 0xFF, 0xDA, 0x81, 0x00, 0x00, 0x02,
+  0x92, 0x00, 0x05, 0x04, 0x03, 0x51, 0xFF, 0xFC, 0xFE, 0xA0, 0xFF, 0x04, 0xFB, 0xFF, 0x96, 0x00,
+  0x06, 0x93, 0x00, 0x05, 0x01, 0x00, 0x19, 0xF4, 0xFF, 0xFE, 0xA0, 0xFF, 0x04, 0xFC, 0xFF, 0x50,
+  0x01, 0x03, 0x94, 0x00, 0x04, 0x02, 0x00, 0xC2, 0xFF, 0xFC, 0x9F, 0xFF, 0x05, 0xFE, 0xFF, 0xF2,
+  0x17, 0x00, 0x01, 0x94, 0x00, 0x04, 0x04, 0x00, 0x7D, 0xFF, 0xFB, 0x9F, 0xFF, 0x04, 0xFC, 0xFF,
+  0xBC, 0x00, 0x02, 0x95, 0x00, 0x02, 0x03, 0x00, 0x36, 0x82, 0xFE, 0x9E, 0xFF, 0x04, 0xFB, 0xFF,
+  0x77, 0x00, 0x04, 0x95, 0x00, 0x05, 0x01, 0x00, 0x07, 0xE0, 0xFF, 0xFD, 0x9D, 0xFF, 0x82, 0xFE,
+  0x02, 0x33, 0x00, 0x02, 0x96, 0x00, 0x04, 0x03, 0x00, 0xA0, 0xFF, 0xFB, 0x89, 0xFF, 0x00, 0xFE,
+  0x92, 0xFF, 0x03, 0xFD, 0xFF, 0xDB, 0x06, 0x81, 0x01, 0x94, 0x00, 0x06, 0x02, 0x04, 0x07, 0x00,
+  0x4B, 0xFF, 0xFC, 0x9D, 0xFF, 0x07, 0xFB, 0xFF, 0x91, 0x00, 0x05, 0x04, 0x03, 0x01, 0x90, 0x00,
+  0x01, 0x02, 0x03, 0x83, 0x00, 0x03, 0x29, 0xF1, 0xFF, 0xFE, 0x9C, 0xFF, 0x03, 0xFC, 0xFF, 0x6A,
+  0x0B, 0x83, 0x00, 0x00, 0x03, 0x8E, 0x00, 0x00, 0x01, 0x81, 0x00, 0x05, 0x1C, 0x5F, 0xA0, 0xD0,
+  0xF0, 0xFC, 0x9E, 0xFF, 0x81, 0xFE, 0x05, 0xF8, 0xE4, 0xBE, 0x86, 0x41, 0x06, 0x8E, 0x00, 0x04,
+  0x01, 0x00, 0x1F, 0xA1, 0xF0, 0x85, 0xFF, 0x00, 0xFE, 0x9D, 0xFF, 0x00, 0xFE, 0x84, 0xFF, 0x01,
+  0xD7, 0x6E, 0x82, 0x01, 0x89, 0x00, 0x03, 0x02, 0x01, 0x1D, 0xE4, 0x81, 0xFF, 0x81, 0xFB, 0x02,
+  0xFC, 0xFD, 0xFE, 0xA0, 0xFF, 0x01, 0xFE, 0xFD, 0x81, 0xFB, 0x00, 0xFD, 0x81, 0xFF, 0x02, 0xA1,
+  0x00, 0x02, 0x89, 0x00, 0x02, 0x02, 0x00, 0x28, 0x81, 0xFF, 0x02, 0xFA, 0xFB, 0xFD, 0x81, 0xFE,
+  0x9A, 0xFF, 0x00, 0xFE, 0x86, 0xFF, 0x02, 0xFE, 0xFD, 0xFC, 0x81, 0xFB, 0x03, 0xFF, 0xC2, 0x00,
+  0x02, 0x8A, 0x00, 0x03, 0x02, 0x00, 0x41, 0xCA, 0x83, 0xFF, 0x02, 0xFB, 0xFA, 0xFB, 0x81, 0xFD,
+  0x00, 0xFE, 0x98, 0xFF, 0x02, 0xFE, 0xFD, 0xFC, 0x81, 0xFB, 0x00, 0xFD, 0x82, 0xFF, 0x02, 0xF8,
+  0x9D, 0x13, 0x81, 0x01, 0x8B, 0x00, 0x06, 0x01, 0x00, 0x01, 0x49, 0x99, 0xD7, 0xFC, 0x85, 0xFF,
+  0x01, 0xFD, 0xFC, 0x86, 0xFB, 0x87, 0xFC, 0x85, 0xFB, 0x01, 0xFD, 0xFE, 0x85, 0xFF, 0x03, 0xED,
+  0xBE, 0x78, 0x27, 0x90, 0x00, 0x00, 0x03, 0x82, 0x00, 0x07, 0x04, 0x28, 0x56, 0x86, 0xB1, 0xD0,
+  0xEA, 0xFB, 0x98, 0xFF, 0x06, 0xF3, 0xDE, 0xC0, 0x9D, 0x6F, 0x3F, 0x14, 0x82, 0x00, 0x01, 0x03,
+  0x01, 0x8F, 0x00, 0x00, 0x01, 0x81, 0x03, 0x85, 0x00, 0x0C, 0x0E, 0x21, 0x36, 0x4A, 0x5E, 0x71,
+  0x80, 0x8C, 0x9C, 0xA5, 0xAA, 0xB5, 0xBB, 0x83, 0xBC, 0x0B, 0xB7, 0xAB, 0xA5, 0x99, 0x8C, 0x7F,
+  0x6B, 0x57, 0x42, 0x2D, 0x18, 0x05, 0x84, 0x00, 0x02, 0x02, 0x04, 0x02, 0x94, 0x00, 0x01, 0x01,
+  0x02, 0x81, 0x04, 0x00, 0x03, 0x9D, 0x00, 0x00, 0x02, 0x81, 0x04, 0x01, 0x03, 0x01, 0x86, 0x00,
+};
+
+static const uint8_t kSunColor[] = {
+  0x09, 0x6F, 0x02, 0x6E, 0x02, 0x2E, 0x02, 0xEC, 0x01, 0x0D, 0x02, 0x2D, 0x02, 0x0C, 0x02, 0x2D,
+  0x02, 0x4E, 0x0A, 0x4D, 0x0A, 0x81, 0x4E, 0x0A, 0x04, 0x8F, 0x0A, 0x4D, 0x0A, 0x6E, 0x0A, 0x6F,
+  0x0A, 0x8F, 0x0A, 0x81, 0x6E, 0x0A, 0x00, 0x4E, 0x0A, 0x84, 0x4E, 0x02, 0x06, 0x4F, 0x02, 0x4E,
+  0x02, 0x2E, 0x02, 0x4F, 0x02, 0x2E, 0x02, 0x4F, 0x02, 0x2F, 0x02, 0x81, 0xBD, 0x0C, 0x82, 0xDD,
+  0x0C, 0x00, 0xFE, 0x14, 0x81, 0xFD, 0x14, 0x00, 0xDC, 0x14, 0x81, 0xDC, 0x1C, 0x08, 0x58, 0x1C,
+  0xD5, 0x13, 0x16, 0x1C, 0x58, 0x24, 0x34, 0x2C, 0xB9, 0x24, 0xBA, 0x24, 0xDB, 0x1C, 0x1E, 0x1D,
+  0x81, 0xFE, 0x14, 0x01, 0xDE, 0x14, 0xBD, 0x0C, 0x81, 0x9D, 0x0C, 0x82, 0x7D, 0x0C, 0x20, 0x5D,
+  0x04, 0x5C, 0x04, 0x3C, 0x04, 0x9B, 0x0C, 0xBC, 0x14, 0x7B, 0x14, 0x18, 0x14, 0x17, 0x14, 0xB5,
+  0x13, 0x4D, 0x0A, 0x32, 0x13, 0x0B, 0x0A, 0x46, 0x09, 0x67, 0x09, 0x83, 0x00, 0x00, 0x00, 0x41,
+  0x00, 0xE4, 0x10, 0xE2, 0xDE, 0xC6, 0x63, 0x63, 0x00, 0x05, 0x09, 0x6D, 0x12, 0x2C, 0x12, 0xD0,
+  0x12, 0xB5, 0x13, 0xF7, 0x13, 0x7A, 0x14, 0x9B, 0x14, 0x9C, 0x14, 0x7B, 0x0C, 0x5B, 0x0C, 0x3B,
+  0x0C, 0x81, 0x1B, 0x04, 0x07, 0x7A, 0x14, 0xB6, 0x13, 0x6E, 0x0A, 0x83, 0x00, 0xC4, 0x00, 0xA3,
+  0x00, 0x00, 0x00, 0x21, 0x00, 0x85, 0x00, 0x00, 0x03, 0xC3, 0x73, 0xE1, 0xFF, 0x62, 0xD6, 0x20,
+  0x00, 0x83, 0x00, 0x00, 0x81, 0x62, 0x00, 0x0A, 0xE5, 0x00, 0x0B, 0x0A, 0x4D, 0x0A, 0x19, 0x14,
+  0x7B, 0x14, 0x5B, 0x0C, 0x3B, 0x0C, 0x1B, 0x04, 0x53, 0x13, 0xC4, 0x00, 0x21, 0x00, 0x83, 0x00,
+  0x00, 0x00, 0x20, 0x00, 0x84, 0x00, 0x00, 0x01, 0x81, 0x08, 0x22, 0xDF, 0x81, 0xE0, 0xFF, 0x02,
+  0x02, 0x63, 0x00, 0x00, 0x20, 0x00, 0x86, 0x00, 0x00, 0x06, 0xEB, 0x09, 0x96, 0x13, 0xD8, 0x13,
+  0x3B, 0x0C, 0x1B, 0x0C, 0xE5, 0x00, 0x21, 0x00, 0x81, 0x00, 0x00, 0x02, 0xA2, 0x08, 0x05, 0x32,
+  0x21, 0x00, 0x85, 0x00, 0x00, 0x05, 0xC2, 0x5A, 0xC0, 0xFF, 0x00, 0xFF, 0x60, 0xFF, 0x82, 0xDD,
+  0x20, 0x00, 0x85, 0x00, 0x00, 0x07, 0xC6, 0x21, 0xE6, 0x29, 0x83, 0x00, 0x26, 0x09, 0xCA, 0x09,
+  0x3A, 0x14, 0x3B, 0x0C, 0x21, 0x00, 0x82, 0x00, 0x00, 0x04, 0xC3, 0x29, 0xE5, 0xFF, 0xA4, 0xD6,
+  0x64, 0x84, 0x62, 0x29, 0x81, 0x00, 0x00, 0x81, 0x20, 0x00, 0x05, 0xC0, 0x20, 0xC1, 0x61, 0xA1,
+  0x61, 0xC2, 0x69, 0x21, 0x41, 0x20, 0x00, 0x82, 0x00, 0x00, 0x0A, 0x41, 0x00, 0xA2, 0x52, 0xA3,
+  0xAD, 0xA3, 0xF7, 0xA4, 0x83, 0x21, 0x00, 0x61, 0x00, 0x21, 0x00, 0xD7, 0x13, 0x5B, 0x0C, 0x20,
+  0x00, 0x82, 0x00, 0x00, 0x01, 0x01, 0x00, 0xE1, 0xD5, 0x81, 0xE0, 0xFF, 0x02, 0xE2, 0xFF, 0x82,
+  0x9C, 0x20, 0x00, 0x82, 0x00, 0x00, 0x02, 0x40, 0x00, 0xA0, 0x08, 0x80, 0x08, 0x83, 0x00, 0x00,
+  0x0A, 0xC1, 0x39, 0xE2, 0xD6, 0xE2, 0xFF, 0xE0, 0xFF, 0xC1, 0xFE, 0xC1, 0x28, 0x00, 0x00, 0x20,
+  0x00, 0x00, 0x00, 0x96, 0x13, 0x7C, 0x14, 0x84, 0x00, 0x00, 0x11, 0x03, 0x73, 0xA0, 0xFF, 0x80,
+  0xF7, 0x40, 0xFE, 0x81, 0x7A, 0x00, 0x00, 0xA1, 0x31, 0xA0, 0x94, 0x80, 0xD6, 0x82, 0xF7, 0xC2,
+  0xFF, 0xA1, 0xFF, 0x00, 0xE7, 0x40, 0xAD, 0x81, 0x52, 0x00, 0x00, 0x01, 0x31, 0xE1, 0xF5, 0x81,
+  0x80, 0xFF, 0x00, 0xE1, 0xBB, 0x83, 0x00, 0x00, 0x01, 0x12, 0x13, 0x7C, 0x14, 0x84, 0x00, 0x00,
+  0x08, 0x61, 0x10, 0x62, 0xED, 0x21, 0xFD, 0x00, 0x51, 0x00, 0x00, 0xA0, 0x9C, 0xE3, 0xFF, 0xEA,
+  0xFF, 0xF0, 0xFF, 0x81, 0xF3, 0xFF, 0x09, 0xF2, 0xFF, 0xEF, 0xFF, 0xE9, 0xFF, 0xE2, 0xFF, 0xE1,
+  0xC5, 0x00, 0x21, 0x40, 0x20, 0x01, 0xCC, 0xC1, 0xFD, 0x21, 0x41, 0x83, 0x00, 0x00, 0x01, 0x2C,
+  0x12, 0x5A, 0x1C, 0x85, 0x00, 0x00, 0x13, 0x02, 0x39, 0x22, 0x41, 0x80, 0x08, 0x40, 0xCE, 0xE6,
+  0xFF, 0xF3, 0xFF, 0xD6, 0xFF, 0xF5, 0xFF, 0xF1, 0xFF, 0xEB, 0xFF, 0xE7, 0xFF, 0xC6, 0xFF, 0xC7,
+  0xFF, 0xC4, 0xFF, 0xE0, 0xFF, 0x21, 0xF7, 0xE1, 0x41, 0x00, 0x00, 0x82, 0x59, 0x20, 0x00, 0x83,
+  0x00, 0x00, 0x01, 0xE5, 0x08, 0xD7, 0x1B, 0x86, 0x00, 0x00, 0x06, 0x20, 0x00, 0xE0, 0xC5, 0xE6,
+  0xFF, 0xB4, 0xFF, 0xF4, 0xFF, 0xF1, 0xFF, 0xE7, 0xFF, 0x82, 0xC0, 0xFF, 0x81, 0xA0, 0xFF, 0x00,
+  0x80, 0xFF, 0x81, 0x40, 0xFF, 0x01, 0xA1, 0xFE, 0x40, 0x31, 0x85, 0x00, 0x00, 0x01, 0x47, 0x09,
+  0x38, 0x24, 0x81, 0x00, 0x00, 0x00, 0x20, 0x00, 0x83, 0x00, 0x00, 0x06, 0x01, 0x6B, 0xE1, 0xFF,
+  0xD0, 0xFF, 0xF3, 0xFF, 0xF0, 0xFF, 0xC2, 0xFF, 0xC0, 0xFF, 0x81, 0xA0, 0xFF, 0x82, 0x80, 0xFF,
+  0x01, 0x60, 0xFF, 0x40, 0xFF, 0x81, 0x00, 0xFF, 0x01, 0x01, 0xCD, 0x20, 0x00, 0x84, 0x00, 0x00,
+  0x01, 0x05, 0x09, 0xF7, 0x23, 0x83, 0x00, 0x00, 0x07, 0x82, 0x31, 0xE2, 0x39, 0x00, 0x00, 0x20,
+  0xD6, 0xE5, 0xFF, 0xD1, 0xFF, 0xF0, 0xFF, 0xC3, 0xFF, 0x81, 0xA0, 0xFF, 0x81, 0x80, 0xFF, 0x81,
+  0x60, 0xFF, 0x81, 0x40, 0xFF, 0x07, 0x20, 0xFF, 0x00, 0xFF, 0xA0, 0xFE, 0x60, 0xFE, 0xA1, 0x41,
+  0x00, 0x00, 0xC1, 0x39, 0xC1, 0x10, 0x81, 0x00, 0x00, 0x0C, 0x67, 0x11, 0x58, 0x2C, 0x00, 0x00,
+  0x81, 0x08, 0x62, 0x6B, 0x22, 0xC6, 0xE3, 0xFF, 0x02, 0xD6, 0xC0, 0x20, 0x00, 0xFF, 0xA2, 0xFF,
+  0xF0, 0xFF, 0xC8, 0xFF, 0x81, 0x80, 0xFF, 0x81, 0x60, 0xFF, 0x81, 0x40, 0xFF, 0x81, 0x20, 0xFF,
+  0x0E, 0x00, 0xFF, 0xE0, 0xFE, 0xC0, 0xFE, 0xA0, 0xFE, 0x60, 0xFE, 0x01, 0x83, 0xC1, 0x20, 0xC2,
+  0xFF, 0x42, 0xEF, 0x03, 0x9D, 0xE2, 0x39, 0x6C, 0x1A, 0x78, 0x34, 0xA3, 0x31, 0x03, 0xEF, 0x82,
+  0xE0, 0xFF, 0x01, 0x00, 0xD5, 0x01, 0x52, 0x81, 0x40, 0xFF, 0x02, 0xC8, 0xFF, 0x84, 0xFF, 0x60,
+  0xFF, 0x81, 0x40, 0xFF, 0x81, 0x20, 0xFF, 0x81, 0x00, 0xFF, 0x00, 0xE0, 0xFE, 0x81, 0xC0, 0xFE,
+  0x06, 0xA0, 0xFE, 0x80, 0xFE, 0x20, 0xFE, 0xA0, 0xAB, 0x21, 0x39, 0xC0, 0xFE, 0x80, 0xFF, 0x81,
+  0xE0, 0xFF, 0x0A, 0x67, 0xB5, 0x17, 0x34, 0x80, 0x18, 0xA2, 0x82, 0xA1, 0xDC, 0x20, 0xFE, 0xA0,
+  0xFF, 0x00, 0xDD, 0xC1, 0x51, 0xC0, 0xFE, 0x00, 0xFF, 0x81, 0x40, 0xFF, 0x81, 0x20, 0xFF, 0x81,
+  0x00, 0xFF, 0x81, 0xE0, 0xFE, 0x81, 0xC0, 0xFE, 0x81, 0xA0, 0xFE, 0x0A, 0x80, 0xFE, 0x60, 0xFE,
+  0x00, 0xFE, 0x60, 0xA3, 0xC0, 0x28, 0xA0, 0xFE, 0xC0, 0xFE, 0x20, 0xF5, 0xA1, 0xBB, 0x81, 0x59,
+  0x6D, 0x1A, 0x81, 0x00, 0x00, 0x07, 0x00, 0x08, 0xA1, 0x40, 0x41, 0x8A, 0x01, 0x7A, 0xC0, 0x18,
+  0x00, 0xFE, 0xE0, 0xFE, 0x00, 0xFF, 0x82, 0xE0, 0xFE, 0x82, 0xC0, 0xFE, 0x81, 0xA0, 0xFE, 0x81,
+  0x80, 0xFE, 0x81, 0x60, 0xFE, 0x06, 0x40, 0xFE, 0xA0, 0xFD, 0xE1, 0x8A, 0x60, 0x10, 0x22, 0xAB,
+  0x81, 0x71, 0x41, 0x28, 0x81, 0x00, 0x00, 0x00, 0x88, 0x11, 0x85, 0x00, 0x00, 0x05, 0x20, 0x00,
+  0xE1, 0xD4, 0x40, 0xFE, 0xE0, 0xFE, 0xA0, 0xFE, 0xC0, 0xFE, 0x81, 0xA0, 0xFE, 0x83, 0x80, 0xFE,
+  0x00, 0x60, 0xFE, 0x82, 0x40, 0xFE, 0x02, 0xC0, 0xFD, 0x20, 0xFD, 0x81, 0x49, 0x85, 0x00, 0x00,
+  0x00, 0xA9, 0x11, 0x84, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00, 0xA1, 0x7A, 0xC0, 0xFD, 0x20,
+  0xFE, 0xA0, 0xFE, 0x82, 0x60, 0xFE, 0x83, 0x40, 0xFE, 0x82, 0x20, 0xFE, 0x02, 0x00, 0xFE, 0x00,
+  0xFD, 0xE1, 0xD3, 0x86, 0x00, 0x00, 0x00, 0xEB, 0x11, 0x85, 0x00, 0x00, 0x06, 0x60, 0x10, 0x40,
+  0x08, 0x61, 0xDC, 0x20, 0xFD, 0xE0, 0xFD, 0x60, 0xFE, 0x20, 0xFE, 0x83, 0x00, 0xFE, 0x81, 0xE0,
+  0xFD, 0x81, 0x00, 0xFE, 0x04, 0xC0, 0xFC, 0x80, 0xFC, 0xE0, 0x30, 0x60, 0x10, 0x40, 0x08, 0x83,
+  0x00, 0x00, 0x01, 0x41, 0x00, 0x0C, 0x1A, 0x84, 0x00, 0x00, 0x07, 0xA1, 0x10, 0x01, 0xE7, 0x61,
+  0x83, 0x60, 0x18, 0x41, 0xE4, 0x80, 0xFC, 0x20, 0xFD, 0xE0, 0xFD, 0x81, 0x00, 0xFE, 0x82, 0xE0,
+  0xFD, 0x07, 0xC0, 0xFD, 0x60, 0xFD, 0x60, 0xFC, 0x40, 0xFC, 0x61, 0x51, 0xC0, 0x20, 0xE1, 0xEE,
+  0x82, 0x83, 0x83, 0x00, 0x00, 0x01, 0x41, 0x00, 0xCA, 0x11, 0x82, 0x00, 0x00, 0x0B, 0x20, 0x00,
+  0x00, 0x00, 0xE2, 0x83, 0xE0, 0xFF, 0x20, 0xFF, 0xA0, 0x72, 0x80, 0x20, 0x21, 0xB3, 0xE0, 0xFB,
+  0x20, 0xFC, 0xA0, 0xFC, 0xE0, 0xFC, 0x81, 0x00, 0xFD, 0x09, 0xC0, 0xFC, 0x40, 0xFC, 0xE0, 0xFB,
+  0x41, 0xCB, 0x20, 0x39, 0x40, 0x29, 0xC0, 0xEE, 0xA0, 0xFF, 0x61, 0xF6, 0xA1, 0x18, 0x82, 0x00,
+  0x00, 0x01, 0x21, 0x00, 0x0B, 0x12, 0x83, 0x00, 0x00, 0x1B, 0x61, 0x08, 0xC1, 0xDE, 0x60, 0xFF,
+  0xA0, 0xFE, 0x40, 0xFD, 0x80, 0x20, 0x00, 0x00, 0x41, 0x49, 0x81, 0xA2, 0x01, 0xD3, 0x20, 0xEB,
+  0x20, 0xF3, 0x40, 0xEB, 0x00, 0xDB, 0xA1, 0xB2, 0x81, 0x59, 0x20, 0x00, 0x00, 0x00, 0xC2, 0xD4,
+  0x20, 0xFF, 0xE0, 0xFE, 0x60, 0xFF, 0x62, 0x7B, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x21, 0x00,
+  0x6E, 0x1A, 0x83, 0x00, 0x00, 0x04, 0x62, 0x52, 0x00, 0xFF, 0x61, 0xF4, 0x42, 0xA2, 0x61, 0x30,
+  0x83, 0x00, 0x00, 0x04, 0x20, 0x00, 0xE1, 0x30, 0x00, 0x39, 0x21, 0x39, 0xA0, 0x18, 0x83, 0x00,
+  0x00, 0x05, 0x41, 0x18, 0x02, 0x82, 0x01, 0xDC, 0xE0, 0xFD, 0xA1, 0xED, 0x61, 0x08, 0x81, 0x00,
+  0x00, 0x01, 0xA3, 0x08, 0xF1, 0x22, 0x83, 0x00, 0x00, 0x02, 0x22, 0x29, 0xC3, 0x69, 0x21, 0x20,
+  0x83, 0x00, 0x00, 0x06, 0x20, 0x00, 0x00, 0x00, 0x61, 0x5A, 0xE0, 0xEE, 0x60, 0xEE, 0xC0, 0xEE,
+  0xE1, 0xCC, 0x85, 0x00, 0x00, 0x07, 0x01, 0x08, 0xE2, 0x48, 0x43, 0x7A, 0x81, 0x10, 0x41, 0x00,
+  0x00, 0x00, 0x27, 0x09, 0x94, 0x23, 0x86, 0x00, 0x00, 0x00, 0x20, 0x00, 0x84, 0x00, 0x00, 0x01,
+  0x01, 0x29, 0xA0, 0xFE, 0x81, 0xE0, 0xFE, 0x00, 0x01, 0x9B, 0x88, 0x00, 0x00, 0x81, 0x41, 0x00,
+  0x03, 0x00, 0x00, 0x4D, 0x1A, 0xD7, 0x23, 0x21, 0x00, 0x8C, 0x00, 0x00, 0x03, 0x02, 0xB4, 0x20,
+  0xFF, 0x41, 0xF5, 0x81, 0x20, 0x86, 0x00, 0x00, 0x09, 0x20, 0x00, 0x00, 0x00, 0x21, 0x00, 0x62,
+  0x00, 0x82, 0x00, 0x33, 0x23, 0xD7, 0x23, 0x05, 0x09, 0x62, 0x00, 0x82, 0x00, 0x81, 0x00, 0x00,
+  0x02, 0x61, 0x00, 0x00, 0x00, 0x21, 0x00, 0x85, 0x00, 0x00, 0x02, 0x01, 0x31, 0xE0, 0xFD, 0xA2,
+  0x92, 0x86, 0x00, 0x00, 0x25, 0x20, 0x00, 0x21, 0x00, 0x41, 0x00, 0xC4, 0x08, 0x26, 0x09, 0x89,
+  0x11, 0x18, 0x2C, 0x18, 0x24, 0x93, 0x2B, 0x52, 0x2B, 0x10, 0x23, 0xE5, 0x08, 0x68, 0x11, 0x0A,
+  0x1A, 0x82, 0x08, 0xEA, 0x19, 0xA3, 0x08, 0xC4, 0x08, 0x88, 0x19, 0x26, 0x11, 0xC4, 0x08, 0x05,
+  0x11, 0x4B, 0x22, 0x4B, 0x7B, 0x2D, 0x4B, 0x4B, 0x2A, 0xA8, 0x19, 0x0A, 0x22, 0x46, 0x11, 0xA3,
+  0x08, 0xC4, 0x08, 0x82, 0x08, 0x47, 0x11, 0x8E, 0x22, 0x2C, 0x1A, 0x12, 0x23, 0x95, 0x2B, 0xD7,
+  0x23, 0x81, 0xF8, 0x23, 0x0B, 0x99, 0x34, 0x9A, 0x34, 0x58, 0x34, 0xD5, 0x2B, 0x58, 0x34, 0x38,
+  0x34, 0xD5, 0x2B, 0x37, 0x34, 0x16, 0x34, 0xB4, 0x33, 0x58, 0x3C, 0x78, 0x3C, 0x81, 0x37, 0x3C,
+  0x07, 0xB9, 0x44, 0x99, 0x3C, 0x99, 0x44, 0xB9, 0x44, 0x99, 0x44, 0x58, 0x3C, 0x37, 0x34, 0xD6,
+  0x2B, 0x81, 0xF7, 0x2B, 0x00, 0x38, 0x2C, 0x81, 0x59, 0x2C, 0x01, 0x5A, 0x2C, 0x3A, 0x2C, 0x81,
+  0x3A, 0x24, 0x01, 0x1A, 0x24, 0x6E, 0x1A, 0x81, 0xAF, 0x1A, 0x06, 0x8E, 0x1A, 0xAF, 0x1A, 0xD0,
+  0x1A, 0x8F, 0x1A, 0x11, 0x23, 0xF1, 0x22, 0xD0, 0x22, 0x82, 0xAF, 0x22, 0x01, 0xD0, 0x22, 0x8F,
+  0x1A, 0x81, 0xD0, 0x22, 0x09, 0x6E, 0x1A, 0x8F, 0x1A, 0xAF, 0x1A, 0x6E, 0x1A, 0xAF, 0x1A, 0x6E,
+  0x1A, 0xB0, 0x1A, 0x8F, 0x1A, 0x6F, 0x1A, 0x6E, 0x12, 0x81, 0x8F, 0x12, 0x02, 0x4E, 0x12, 0x6F,
+  0x12, 0x2E, 0x12,
+};
+
+static const uint16_t kMoonPalette[] = {
+  0x000A, 0x000B, 0x002F, 0x004B, 0x004C, 0x004F, 0x0065, 0x006B,
+  0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0086, 0x0087, 0x0088,
+  0x0089, 0x008B, 0x008C, 0x008D, 0x008F, 0x0090, 0x00A7, 0x00A9,
+  0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00C9,
+  0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF, 0x00D0, 0x00EA,
+  0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF, 0x00F0, 0x010A, 0x010B,
+  0x010C, 0x010D, 0x010E, 0x010F, 0x0110, 0x08CC, 0x08ED, 0x08EE,
+  0x090C, 0x090E, 0x092D, 0x110A, 0x112E, 0x190A, 0x194A, 0x194C,
+  0x196C, 0x196D, 0x196E, 0x196F, 0x198B, 0x198D, 0x2189, 0x218A,
+  0x218F, 0x21AB, 0x21AE, 0x21CA, 0x21CD, 0x2989, 0x29AD, 0x29CA,
+  0x29EB, 0x31A8, 0x31E9, 0x320C, 0x320F, 0x3A49, 0x3A50, 0x4227,
+  0x4248, 0x4249, 0x4268, 0x4270, 0x428A, 0x428B, 0x42A8, 0x4AA9,
+  0x4AD1, 0x52A7, 0x52C9, 0x52E7, 0x52E9, 0x5327, 0x5333, 0x5B53,
+  0x6308, 0x6347, 0x6349, 0x6368, 0x6369, 0x6388, 0x6393, 0x6394,
+  0x6BA8, 0x6BB4, 0x6BC7, 0x7366, 0x7386, 0x73C6, 0x7BC5, 0x7BC7,
+  0x7BE8, 0x8405, 0x8425, 0x8C24, 0x8C26, 0x8C76, 0x8C86, 0x8C95,
+  0x8C96, 0x8CA4, 0x9426, 0x9444, 0x9446, 0x9C83, 0x9D04, 0x9D38,
+  0xA464, 0xACE2, 0xAD64, 0xAD65, 0xB502, 0xB5B9, 0xB5D9, 0xBD03,
+  0xBDE2, 0xBE1A, 0xC65B, 0xCE42, 0xD602, 0xD621, 0xD6A2, 0xDDE2,
+  0xDE01, 0xDE41, 0xDE60, 0xDF1D, 0xE641, 0xE721, 0xEEE0, 0xEF7E,
+  0xF5E0, 0xF600, 0xF680, 0xF700, 0xF720, 0xF760, 0xF780, 0xF79E,
+  0xF7C0, 0xFD20, 0xFD40, 0xFD60, 0xFD80, 0xFDA0, 0xFDC0, 0xFDE0,
+  0xFE00, 0xFE20, 0xFE40, 0xFE60, 0xFE80, 0xFEA0, 0xFEC0, 0xFEE0,
+  0xFF00, 0xFF20, 0xFF40, 0xFF60, 0xFF80, 0xFF81, 0xFF82, 0xFFA0,
+  0xFFA1, 0xFFA3, 0xFFBF, 0xFFC0, 0xFFC1, 0xFFC2, 0xFFC3, 0xFFC5,
+  0xFFC8, 0xFFCB, 0xFFCC, 0xFFCD, 0xFFDF, 0xFFE0, 0xFFE1, 0xFFE2,
+  0xFFE3, 0xFFE4, 0xFFE5, 0xFFE6, 0xFFE9, 0xFFEA, 0xFFEB, 0xFFEC,
+  0xFFED, 0xFFFF,
+};
+
+static const uint8_t kMoonColor[] = {
+  0x00, 0x0D, 0x8C, 0x0E, 0x82, 0x16, 0x86, 0x0E, 0x00, 0x0F, 0x81, 0x0E, 0x83, 0x0F, 0x00, 0x06,
+  0x84, 0x29, 0x86, 0x28, 0x05, 0x2F, 0x28, 0x19, 0x08, 0x1A, 0x28, 0x8B, 0x29, 0x00, 0x2A, 0x82,
+  0x29, 0x87, 0x28, 0x0A, 0x2E, 0x21, 0x03, 0x19, 0x46, 0x63, 0x5A, 0x19, 0x28, 0x21, 0x28, 0x83,
+  0x21, 0x84, 0x22, 0x01, 0x29, 0x21, 0x83, 0x29, 0x84, 0x28, 0x0F, 0x27, 0x07, 0x3B, 0x75, 0x93,
+  0xC3, 0xA3, 0x52, 0x19, 0x28, 0x21, 0x28, 0x29, 0x21, 0x41, 0x29, 0x84, 0x22, 0x01, 0x29, 0x21,
+  0x83, 0x29, 0x84, 0x28, 0x02, 0x07, 0x69, 0x9D, 0x81, 0xCD, 0x02, 0xBA, 0x58, 0x04, 0x81, 0x28,
+  0x0D, 0x22, 0x29, 0x30, 0x11, 0x7F, 0x3A, 0x22, 0x29, 0x22, 0x29, 0x22, 0x2A, 0x22, 0x2A, 0x83,
+  0x29, 0x81, 0x28, 0x02, 0x21, 0x19, 0x86, 0x81, 0xCD, 0x05, 0xA8, 0xBB, 0x88, 0x08, 0x28, 0x22,
+  0x81, 0x29, 0x06, 0x1A, 0x00, 0x4A, 0xC2, 0x67, 0x00, 0x1A, 0x82, 0x29, 0x01, 0x2A, 0x22, 0x81,
+  0x2A, 0x83, 0x29, 0x15, 0x28, 0x11, 0x8A, 0xD0, 0xC4, 0xCD, 0xBF, 0xB4, 0x4F, 0x1A, 0x29, 0x22,
+  0x29, 0x22, 0x4A, 0x71, 0x9B, 0xD9, 0xA7, 0x7D, 0x54, 0x22, 0x82, 0x2A, 0x00, 0x22, 0x82, 0x2A,
+  0x82, 0x29, 0x09, 0x08, 0x81, 0xD3, 0xC9, 0xC5, 0xCD, 0xBA, 0x8F, 0x1A, 0x29, 0x81, 0x22, 0x09,
+  0x29, 0x22, 0x5B, 0x8E, 0xD9, 0xCC, 0xD9, 0x92, 0x60, 0x23, 0x82, 0x2A, 0x00, 0x29, 0x83, 0x2A,
+  0x0B, 0x29, 0x09, 0x5E, 0xD1, 0xCA, 0xD6, 0xCE, 0xBF, 0xB6, 0x73, 0x09, 0x29, 0x81, 0x22, 0x81,
+  0x2A, 0x06, 0x1A, 0x01, 0x67, 0xD9, 0x80, 0x01, 0x12, 0x83, 0x2A, 0x01, 0x29, 0x2B, 0x82, 0x2A,
+  0x0B, 0x29, 0x1A, 0x96, 0xD5, 0xCB, 0xD4, 0xCD, 0xBB, 0xB3, 0x59, 0x13, 0x29, 0x81, 0x23, 0x01,
+  0x2A, 0x23, 0x81, 0x2A, 0x04, 0x12, 0x8E, 0x42, 0x1B, 0x32, 0x82, 0x2A, 0x01, 0x2B, 0x2A, 0x81,
+  0x2B, 0x0E, 0x2A, 0x31, 0x0A, 0x65, 0xCF, 0xCA, 0xD8, 0xC7, 0xC3, 0xB9, 0xB1, 0x4B, 0x1B, 0x2A,
+  0x23, 0x83, 0x2A, 0x0A, 0x2B, 0x23, 0x56, 0x39, 0x23, 0x08, 0x6E, 0x1B, 0x23, 0x2B, 0x2A, 0x82,
+  0x2B, 0x0B, 0x2A, 0x0A, 0x90, 0xD1, 0xCA, 0xD7, 0xC6, 0xC3, 0xB8, 0xA0, 0x44, 0x1B, 0x82, 0x2A,
+  0x84, 0x2B, 0x08, 0x23, 0x24, 0x37, 0x66, 0x9F, 0x6F, 0x36, 0x2B, 0x2A, 0x82, 0x2B, 0x0B, 0x24,
+  0x40, 0xA5, 0xD2, 0xC9, 0xD6, 0xC0, 0xBF, 0xB7, 0xA1, 0x44, 0x1B, 0x81, 0x2A, 0x84, 0x2B, 0x09,
+  0x24, 0x2B, 0x24, 0x48, 0x8D, 0xD9, 0x91, 0x48, 0x24, 0x2A, 0x81, 0x2B, 0x0D, 0x32, 0x14, 0x5C,
+  0xCD, 0xC1, 0xD5, 0xD4, 0xC0, 0xBF, 0xB8, 0xB2, 0x50, 0x13, 0x2A, 0x88, 0x2B, 0x06, 0x1C, 0x13,
+  0x87, 0x39, 0x13, 0x2B, 0x2A, 0x81, 0x2B, 0x0C, 0x32, 0x0B, 0x6B, 0xCD, 0xBB, 0xC8, 0xD4, 0xBD,
+  0xBC, 0xB8, 0xB5, 0x62, 0x0A, 0x8B, 0x2B, 0x00, 0x43, 0x82, 0x2B, 0x00, 0x2A, 0x81, 0x2C, 0x0D,
+  0x32, 0x0B, 0x72, 0xCD, 0xB9, 0xBE, 0xD4, 0xBD, 0xBB, 0xB9, 0xB6, 0x84, 0x0A, 0x32, 0x8A, 0x2B,
+  0x00, 0x24, 0x82, 0x2B, 0x00, 0x2A, 0x81, 0x2C, 0x0C, 0x32, 0x0B, 0x72, 0xC3, 0xB9, 0xBA, 0xBD,
+  0xBB, 0xBA, 0xBB, 0xB6, 0x97, 0x2A, 0x8E, 0x2B, 0x01, 0x2C, 0x2A, 0x81, 0x2C, 0x04, 0x32, 0x0C,
+  0x6D, 0xC3, 0xB8, 0x81, 0xB9, 0x07, 0xBA, 0xB9, 0xBA, 0xB7, 0xB8, 0x64, 0x0B, 0x32, 0x8C, 0x2B,
+  0x01, 0x2C, 0x2A, 0x81, 0x2C, 0x04, 0x33, 0x15, 0x5F, 0xBF, 0xB7, 0x81, 0xB8, 0x00, 0xB9, 0x81,
+  0xB8, 0x03, 0xB9, 0xB7, 0x94, 0x24, 0x81, 0x2B, 0x8C, 0x2C, 0x00, 0x2B, 0x82, 0x2C, 0x02, 0x1D,
+  0x49, 0xBA, 0x82, 0xB7, 0x00, 0xB8, 0x81, 0xB7, 0x05, 0xB8, 0xB6, 0xBB, 0x7E, 0x05, 0x32, 0x8C,
+  0x2C, 0x00, 0x2B, 0x83, 0x2C, 0x05, 0x1B, 0x95, 0xBA, 0xB5, 0xB6, 0xB7, 0x82, 0xB6, 0x06, 0xB7,
+  0xB8, 0xC3, 0x6C, 0x02, 0x32, 0x33, 0x8A, 0x2C, 0x00, 0x2B, 0x82, 0x2C, 0x04, 0x33, 0x0B, 0x7A,
+  0xBF, 0xB3, 0x85, 0xB5, 0x07, 0xB6, 0xBC, 0xCD, 0x70, 0x05, 0x1D, 0x32, 0x33, 0x83, 0x2C, 0x81,
+  0x33, 0x82, 0x2C, 0x00, 0x2B, 0x83, 0x2C, 0x04, 0x1D, 0x47, 0xBA, 0xB5, 0xB3, 0x85, 0xB4, 0x04,
+  0xB5, 0xBF, 0xCD, 0x8B, 0x4E, 0x81, 0x0C, 0x00, 0x1D, 0x81, 0x25, 0x02, 0x1D, 0x15, 0x0C, 0x82,
+  0x2C, 0x00, 0x2B, 0x83, 0x2C, 0x06, 0x33, 0x0B, 0x83, 0xBF, 0xB1, 0xB2, 0xB3, 0x84, 0xB2, 0x06,
+  0xB3, 0xB9, 0xCD, 0xA8, 0x8B, 0x6A, 0x53, 0x81, 0x45, 0x06, 0x4C, 0x5D, 0x78, 0x3C, 0x25, 0x2C,
+  0x2B, 0x85, 0x2C, 0x03, 0x35, 0x99, 0xBA, 0xAF, 0x87, 0xB1, 0x01, 0xB3, 0xB9, 0x82, 0xCD, 0x08,
+  0xA6, 0xA5, 0xA4, 0xBC, 0x77, 0x14, 0x32, 0x2C, 0x2B, 0x84, 0x2C, 0x04, 0x33, 0x1D, 0x4D, 0x9E,
+  0xB8, 0x81, 0xAE, 0x84, 0xAF, 0x00, 0xB0, 0x82, 0xAF, 0x00, 0xB1, 0x81, 0xB2, 0x04, 0xB0, 0xB6,
+  0x82, 0x0B, 0x2B, 0x81, 0x2C, 0x00, 0x2B, 0x85, 0x2C, 0x07, 0x33, 0x14, 0x51, 0x9A, 0xBA, 0xAF,
+  0xAB, 0xAC, 0x82, 0xAD, 0x83, 0xAE, 0x05, 0xAD, 0xAC, 0xAE, 0xB5, 0x7C, 0x14, 0x83, 0x2C, 0x00,
+  0x2B, 0x86, 0x2C, 0x07, 0x33, 0x1D, 0x3D, 0x89, 0xBA, 0xB6, 0xAE, 0xAA, 0x84, 0xA9, 0x05, 0xAA,
+  0xAE, 0xB4, 0x9C, 0x68, 0x0B, 0x84, 0x2C, 0x00, 0x2B, 0x87, 0x2C, 0x07, 0x33, 0x25, 0x09, 0x57,
+  0x8C, 0xA2, 0xB7, 0xB5, 0x82, 0xB3, 0x06, 0xB4, 0xB5, 0x98, 0x79, 0x3F, 0x0B, 0x2B, 0x84, 0x2C,
+  0x00, 0x2B, 0x88, 0x2C, 0x0F, 0x2B, 0x33, 0x14, 0x09, 0x3E, 0x61, 0x76, 0x83, 0x85, 0x7B, 0x74,
+  0x55, 0x38, 0x0B, 0x25, 0x32, 0x85, 0x2C, 0x00, 0x2B, 0x81, 0x34, 0x00, 0x2D, 0x86, 0x34, 0x81,
+  0x33, 0x03, 0x34, 0x26, 0x15, 0x0C, 0x81, 0x14, 0x03, 0x15, 0x0C, 0x1E, 0x2D, 0x81, 0x33, 0x81,
+  0x2D, 0x01, 0x34, 0x2D, 0x82, 0x34, 0x06, 0x2C, 0x0F, 0x17, 0x18, 0x10, 0x18, 0x10, 0x81, 0x17,
+  0x81, 0x18, 0x04, 0x20, 0x18, 0x17, 0x20, 0x1F, 0x82, 0x20, 0x00, 0x27, 0x81, 0x20, 0x04, 0x21,
+  0x18, 0x21, 0x18, 0x17, 0x81, 0x18, 0x81, 0x17, 0x01, 0x10, 0x0E,
+};
+
+const ImagePack kImagePacks[IMAGE_ASSET_COUNT] = {
+  {64, 64, true, 0, nullptr, kPlantColor, sizeof(kPlantColor), kPlantAlpha, sizeof(kPlantAlpha)},
+  {32, 32, false, 0, nullptr, kSunColor, sizeof(kSunColor), nullptr, 0},
+  {32, 32, false, 218, kMoonPalette, kMoonColor, sizeof(kMoonColor), nullptr, 0},
+};
@@ -0,0 +1,33 @@
+#pragma once
+
+// Generated by tools/gen-image-assets.py from assets/*.png. Do not edit.
+
+#include <stdint.h>
+
+enum ImageAssetId : uint8_t {
+  IMAGE_ASSET_PLANT = 0,
+  IMAGE_ASSET_SUN,
+  IMAGE_ASSET_MOON,
+  IMAGE_ASSET_COUNT
+};
+
+constexpr int16_t kPlantW = 64;
+constexpr int16_t kPlantH = 64;
+constexpr int16_t kSunW = 32;
+constexpr int16_t kSunH = 32;
+constexpr int16_t kMoonW = 32;
+constexpr int16_t kMoonH = 32;
+
+struct ImagePack {
+  uint16_t w;
+  uint16_t h;
+  bool hasAlpha;
+  uint16_t paletteCount;
+  const uint16_t *palette;
+  const uint8_t *color;
+  uint32_t colorBytes;
+  const uint8_t *alpha;
+  uint32_t alphaBytes;
+};
+
+extern const ImagePack kImagePacks[IMAGE_ASSET_COUNT];
@@ -7,8 +7,10 @@
 
 #include "config.h"
 #include "feeding.h"
+#include "flashStats.h"
 #include "moistureSensor.h"
 #include "rtc.h"
+#include "soilTempSensor.h"
 
 namespace {
 constexpr uint8_t kLogMetaSize = 3;
@@ -27,6 +29,30 @@ static uint16_t g_log_epoch = 0;
 static uint16_t g_browse_epoch = 0;
 static LogEntry g_log_buffer = {};
 
+// Day totals only change when a log is written, so the UI's per-tick query
+// is answered from here instead of re-walking the flash ring.
+struct DailyTotalsCache {
+  bool valid;
+  uint16_t key;
+  uint16_t total;
+  uint8_t minVal;
+  uint8_t maxVal;
+};
+static DailyTotalsCache g_daily_cache = {};
+
+// Hourly moisture/feed rollup behind the history chart. It is rebuilt from
+// flash once at boot and extended on every write, so drawing never walks
+// the log ring. Bucket i holds the hour with hour % LOG_HISTORY_HOURS == i.
+struct HistoryBucket {
+  uint32_t hour;
+  uint16_t moistureSum;
+  uint8_t moistureCount;
+  uint16_t feedMl;
+};
+static HistoryBucket g_history[LOG_HISTORY_HOURS] = {};
+static uint16_t g_history_revision = 0;
+static uint32_t g_history_changed_hour = 0;
+
 /*
  * ensure_fs
  * Mounts LittleFS so logs can be read/written.
@@ -46,38 +72,35 @@ static bool ensure_fs() {
  *   ensure_log_file_size(kLogStoreBytes);
  */
 static bool ensure_log_file_size(size_t size) {
+  flashStatsOpen(FLASH_FILE_LOGS, FLASH_TAG_LOG_FORMAT);
   File f = LittleFS.open(kLogFilePath, "r");
-  if (!f) {
-    File nf = LittleFS.open(kLogFilePath, "w+");
-    if (!nf) return false;
-    if (size > 0) {
-      nf.seek(size - 1);
-      nf.write(static_cast<uint8_t>(0));
-    }
-    nf.close();
-    return true;
+  if (f) {
+    size_t existing = f.size();
+    f.close();
+    if (existing == size) return true;
+    LittleFS.remove(kLogFilePath);
   }
-  size_t existing = f.size();
-  f.close();
-  if (existing == size) return true;
-  LittleFS.remove(kLogFilePath);
+  flashStatsOpen(FLASH_FILE_LOGS, FLASH_TAG_LOG_FORMAT);
   File nf = LittleFS.open(kLogFilePath, "w+");
   if (!nf) return false;
   if (size > 0) {
     nf.seek(size - 1);
     nf.write(static_cast<uint8_t>(0));
+    flashStatsWrite(FLASH_FILE_LOGS, FLASH_TAG_LOG_FORMAT, size);
   }
   nf.close();
+  flashStatsFlush(FLASH_FILE_LOGS, FLASH_TAG_LOG_FORMAT, 0, static_cast<uint32_t>(size));
   return true;
 }
 
 /*
  * read_block
- * Reads a byte range from the log file.
+ * Reads a byte range from the log file, accounted to tag.
  * Example:
- *   read_block(offset, buffer, sizeof(buffer));
+ *   read_block(offset, buffer, sizeof(buffer), FLASH_TAG_LOG_ENTRY);
  */
-static bool read_block(uint32_t offset, void *buffer, size_t len) {
+static bool read_block(uint32_t offset, void *buffer, size_t len, FlashTag tag) {
+  flashStatsOpen(FLASH_FILE_LOGS, tag);
   File f = LittleFS.open(kLogFilePath, "r");
   if (!f) return false;
   if (!f.seek(offset)) {
@@ -86,16 +109,18 @@ static bool read_block(uint32_t offset, void *buffer, size_t len) {
   }
   size_t read_len = f.read(static_cast<uint8_t *>(buffer), len);
   f.close();
+  flashStatsRead(FLASH_FILE_LOGS, tag, read_len);
   return read_len == len;
 }
 
 /*
  * write_block
- * Writes a byte range into the log file.
+ * Writes a byte range into the log file, accounted to tag.
  * Example:
- *   write_block(offset, data, sizeof(data));
+ *   write_block(offset, data, sizeof(data), FLASH_TAG_LOG_HEAD);
  */
-static bool write_block(uint32_t offset, const void *data, size_t len) {
+static bool write_block(uint32_t offset, const void *data, size_t len, FlashTag tag) {
+  flashStatsOpen(FLASH_FILE_LOGS, tag);
   File f = LittleFS.open(kLogFilePath, "r+");
   if (!f) return false;
   if (!f.seek(offset)) {
@@ -105,6 +130,8 @@ static bool write_block(uint32_t offset, const void *data, size_t len) {
   size_t written = f.write(static_cast<const uint8_t *>(data), len);
   f.flush();
   f.close();
+  flashStatsWrite(FLASH_FILE_LOGS, tag, written);
+  flashStatsFlush(FLASH_FILE_LOGS, tag, offset, static_cast<uint32_t>(kLogStoreBytes));
   return written == len;
 }
 
@@ -127,7 +154,7 @@ static uint32_t slot_offset(int16_t slot) {
  */
 static bool read_slot(int16_t slot, LogEntry *out) {
   if (!out || slot < 0 || slot >= static_cast<int16_t>(g_total_slots)) return false;
-  if (!read_block(slot_offset(slot), out, sizeof(LogEntry))) {
+  if (!read_block(slot_offset(slot), out, sizeof(LogEntry), FLASH_TAG_LOG_ENTRY)) {
     memset(out, 0, sizeof(LogEntry));
     return false;
   }
@@ -138,11 +165,11 @@ static bool read_slot(int16_t slot, LogEntry *out) {
  * write_slot
  * Writes a log entry into the specified slot.
  * Example:
- *   write_slot(0, entry);
+ *   write_slot(0, entry, FLASH_TAG_LOG_ENTRY);
  */
-static bool write_slot(int16_t slot, const LogEntry &entry) {
+static bool write_slot(int16_t slot, const LogEntry &entry, FlashTag tag) {
   if (slot < 0 || slot >= static_cast<int16_t>(g_total_slots)) return false;
-  return write_block(slot_offset(slot), &entry, sizeof(LogEntry));
+  return write_block(slot_offset(slot), &entry, sizeof(LogEntry), tag);
 }
 
 /*
@@ -181,31 +208,6 @@ static bool calcDrybackFromBaseline(uint8_t soilPercent, uint8_t *outPercent) {
   return true;
 }
 
-/*
- * calcLightDayKey
- * Creates a day key aligned to lights-on time.
- * Example:
- *   uint16_t key = 0;
- *   calcLightDayKey(y, m, d, h, min, lightsOnMinutes, &key);
- */
-static bool calcLightDayKey(uint8_t year, uint8_t month, uint8_t day,
-                            uint8_t hour, uint8_t minute, uint16_t lightsOnMinutes,
-                            uint16_t *outKey) {
-  if (hour > 23 || minute > 59) return false;
-  if (month == 0 || month > 12 || day == 0 || day > 31) return false;
-  if (lightsOnMinutes > 1439) lightsOnMinutes = 0;
-
-  uint16_t key = static_cast<uint16_t>(year) * 372u +
-                 static_cast<uint16_t>(month) * 31u + day;
-  uint16_t minutes = static_cast<uint16_t>(hour) * 60u + minute;
-  if (minutes < lightsOnMinutes) {
-    if (key == 0) return false;
-    key--;
-  }
-  if (outKey) *outKey = key;
-  return true;
-}
-
 /*
  * readEpochFromFlash
  * Loads the persisted epoch counter.
@@ -214,7 +216,7 @@ static bool calcLightDayKey(uint8_t year, uint8_t month, uint8_t day,
  */
 static uint16_t readEpochFromFlash() {
   uint8_t data[2] = {0};
-  if (!read_block(0, data, sizeof(data))) return 0;
+  if (!read_block(0, data, sizeof(data), FLASH_TAG_LOG_META)) return 0;
   if (data[0] == 0xFF && data[1] == 0xFF) return 0;
   return static_cast<uint16_t>(data[0]) | (static_cast<uint16_t>(data[1]) << 8);
 }
@@ -229,7 +231,7 @@ static void writeEpochToFlash(uint16_t epoch) {
   uint8_t data[2];
   data[0] = static_cast<uint8_t>(epoch & 0xFF);
   data[1] = static_cast<uint8_t>((epoch >> 8) & 0xFF);
-  write_block(0, data, sizeof(data));
+  write_block(0, data, sizeof(data), FLASH_TAG_LOG_META);
 }
 
 /*
@@ -240,7 +242,7 @@ static void writeEpochToFlash(uint16_t epoch) {
  */
 static uint8_t readVersionFromFlash() {
   uint8_t version = 0;
-  if (!read_block(2, &version, 1)) return 0;
+  if (!read_block(2, &version, 1, FLASH_TAG_LOG_META)) return 0;
   if (version == 0xFF) return 0;
   return version;
 }
@@ -252,7 +254,7 @@ static uint8_t readVersionFromFlash() {
  *   writeVersionToFlash(LOG_FORMAT_VERSION);
  */
 static void writeVersionToFlash(uint8_t version) {
-  write_block(2, &version, 1);
+  write_block(2, &version, 1, FLASH_TAG_LOG_META);
 }
 
 /*
@@ -271,7 +273,7 @@ static void writeHeadRecord(uint16_t seq, uint16_t slot) {
   data[1] = static_cast<uint8_t>(seq >> 8);
   data[2] = static_cast<uint8_t>(slot & 0xFF);
   data[3] = static_cast<uint8_t>(slot >> 8);
-  write_block(addr, data, sizeof(data));
+  write_block(addr, data, sizeof(data), FLASH_TAG_LOG_HEAD);
 }
 
 /*
@@ -283,25 +285,80 @@ static void writeHeadRecord(uint16_t seq, uint16_t slot) {
 static void stampLightDayKey(LogEntry *entry) {
   if (!entry) return;
 
-  uint8_t year = entry->startYear;
-  uint8_t month = entry->startMonth;
-  uint8_t day = entry->startDay;
-  uint8_t hour = entry->startHour;
-  uint8_t minute = entry->startMinute;
-
-  if (entry->entryType == 1 && entry->endMonth && entry->endDay) {
-    year = entry->endYear;
-    month = entry->endMonth;
-    day = entry->endDay;
-    hour = entry->endHour;
-    minute = entry->endMinute;
-  }
+  EpochTime at = entry->startTime;
+  if (entry->entryType == 1 && entry->endTime != EPOCH_UNSET) at = entry->endTime;
+  entry->lightDayKey = epochLightDayKey(at, config.lightsOnMinutes);
+}
 
-  uint16_t key = 0;
-  if (!calcLightDayKey(year, month, day, hour, minute, config.lightsOnMinutes, &key)) {
-    key = 0;
+/*
+ * history_bucket
+ * Returns the rollup bucket for a timestamp, recycling the slot if it holds
+ * an older hour; nullptr when unset or when the slot already holds a newer one.
+ * Example:
+ *   HistoryBucket *bucket = history_bucket(entry.startTime);
+ */
+static HistoryBucket *history_bucket(EpochTime at) {
+  if (at == EPOCH_UNSET) return nullptr;
+  uint32_t hour = epochHours(at);
+  HistoryBucket &bucket = g_history[hour % LOG_HISTORY_HOURS];
+  if (bucket.hour == hour) return &bucket;
+  if (bucket.hour > hour) return nullptr;
+  bucket = {};
+  bucket.hour = hour;
+  return &bucket;
+}
+
+/*
+ * history_add_sample
+ * Folds one moisture reading into its hour.
+ * Example:
+ *   history_add_sample(entry.startTime, entry.soilMoistureBefore);
+ */
+static void history_add_sample(EpochTime at, uint8_t moisture) {
+  if (moisture > 100) return;
+  HistoryBucket *bucket = history_bucket(at);
+  if (!bucket || bucket->moistureCount == UINT8_MAX) return;
+  bucket->moistureSum = static_cast<uint16_t>(bucket->moistureSum + moisture);
+  bucket->moistureCount++;
+}
+
+/*
+ * history_add_entry
+ * Folds a value or feed log into the rollup; other types are ignored.
+ * A feed contributes its before/after moisture and its volume.
+ * Example:
+ *   history_add_entry(entry);
+ */
+static void history_add_entry(const LogEntry &entry) {
+  EpochTime at = entry.startTime;
+  if (entry.entryType == 2) {
+    history_add_sample(at, entry.soilMoistureBefore);
+  } else if (entry.entryType == 1) {
+    history_add_sample(at, entry.soilMoistureBefore);
+    if (entry.endTime != EPOCH_UNSET) at = entry.endTime;
+    history_add_sample(at, entry.soilMoistureAfter);
+    HistoryBucket *bucket = history_bucket(at);
+    if (bucket) {
+      uint32_t total = static_cast<uint32_t>(bucket->feedMl) + entry.feedMl;
+      bucket->feedMl = static_cast<uint16_t>(total > UINT16_MAX ? UINT16_MAX : total);
+    }
+  } else {
+    return;
   }
-  entry->lightDayKey = key;
+  g_history_revision++;
+  if (at != EPOCH_UNSET) g_history_changed_hour = epochHours(at);
+}
+
+/*
+ * history_clear
+ * Empties the rollup.
+ * Example:
+ *   history_clear();
+ */
+static void history_clear() {
+  memset(g_history, 0, sizeof(g_history));
+  g_history_changed_hour = 0;
+  g_history_revision++;
 }
 
 /*
@@ -366,6 +423,40 @@ static void refresh_ram_logs() {
   }
   g_log_index = 0;
 }
+
+/*
+ * rebuild_history
+ * Walks the log ring newest-first, stopping once entries fall outside the
+ * LOG_HISTORY_HOURS window, and refills the hourly rollup.
+ * Example:
+ *   rebuild_history();
+ */
+static void rebuild_history() {
+  history_clear();
+  int16_t savedSlot = g_current_slot;
+  uint16_t savedEpoch = g_browse_epoch;
+  uint32_t newestHour = 0;
+
+  goToLatestSlot();
+  if (g_current_slot >= 0) {
+    do {
+      const LogEntry &entry = g_log_buffer;
+      if (entry.startTime == EPOCH_UNSET) continue;
+      uint32_t hour = epochHours(entry.startTime);
+      if (newestHour == 0) newestHour = hour;
+      if (hour + LOG_HISTORY_HOURS <= newestHour) break;
+      history_add_entry(entry);
+    } while (goToPreviousLogSlot());
+  }
+
+  g_browse_epoch = savedEpoch;
+  if (savedSlot >= 0) {
+    g_current_slot = savedSlot;
+    readLogEntry();
+  } else {
+    g_current_slot = savedSlot;
+  }
+}
 } // namespace
 
 void logs_init() {
@@ -394,12 +485,13 @@ void logs_init() {
   g_browse_epoch = g_log_epoch;
   g_latest_slot = -1;
   g_head_index = -1;
+  g_daily_cache.valid = false;
 
   uint16_t bestSeq = 0;
   for (uint16_t i = 0; i < g_head_record_count; ++i) {
     uint8_t data[4];
     uint32_t addr = kLogMetaSize + static_cast<uint32_t>(i) * kHeadRecordSize;
-    if (!read_block(addr, data, sizeof(data))) continue;
+    if (!read_block(addr, data, sizeof(data), FLASH_TAG_LOG_HEAD)) continue;
     uint16_t seq = static_cast<uint16_t>(data[0]) | (static_cast<uint16_t>(data[1]) << 8);
     uint16_t slot = static_cast<uint16_t>(data[2]) | (static_cast<uint16_t>(data[3]) << 8);
     if (seq == 0 || slot >= g_total_slots) continue;
@@ -421,6 +513,7 @@ void logs_init() {
   g_logs_ready = true;
 
   refresh_ram_logs();
+  rebuild_history();
 }
 
 void logs_wipe() {
@@ -437,9 +530,9 @@ LogEntry build_value_log() {
   LogEntry entry = {};
   uint8_t soilMoisture = soilMoistureAsPercentage(getSoilMoisture());
   initLogEntryCommon(&entry, 2, LOG_STOP_NONE, LOG_START_NONE, 0, 0, soilMoisture, 0);
+  if (soilTempReady()) entry.soilTempDeciC = getSoilTempDeciC();
   entry.millisStart = millis();
-  rtcReadDateTime(&entry.startHour, &entry.startMinute, &entry.startDay,
-                  &entry.startMonth, &entry.startYear);
+  rtcReadEpoch(&entry.startTime);
   return entry;
 }
 
@@ -449,8 +542,18 @@ LogEntry build_boot_log() {
   initLogEntryCommon(&entry, 0, LOG_STOP_NONE, LOG_START_NONE, 0, 0, soilMoistureBefore, 0);
   entry.millisStart = 0;
   entry.millisEnd = millis();
-  rtcReadDateTime(&entry.startHour, &entry.startMinute, &entry.startDay,
-                  &entry.startMonth, &entry.startYear);
+  rtcReadEpoch(&entry.startTime);
+  return entry;
+}
+
+LogEntry build_sensor_log() {
+  LogEntry entry = {};
+  uint8_t soilMoisture = soilMoistureAsPercentage(getSoilMoisture());
+  uint8_t fault = (soilSensorHealth() == SENSOR_FAILED) ? soilSensorFault() : SENSOR_FAULT_NONE;
+  initLogEntryCommon(&entry, 3, fault, LOG_START_NONE, 0, 0, soilMoisture, 0);
+  entry.feedMl = soilSensorWindowLastRaw();
+  entry.millisStart = millis();
+  rtcReadEpoch(&entry.startTime);
   return entry;
 }
 
@@ -459,8 +562,7 @@ LogEntry build_feed_log() {
   uint8_t soilMoisture = soilMoistureAsPercentage(getSoilMoisture());
   initLogEntryCommon(&entry, 1, LOG_STOP_NONE, LOG_START_USER, 0, 0, soilMoisture, soilMoisture);
   entry.millisStart = millis();
-  rtcReadDateTime(&entry.startHour, &entry.startMinute, &entry.startDay,
-                  &entry.startMonth, &entry.startYear);
+  rtcReadEpoch(&entry.startTime);
   return entry;
 }
 
@@ -507,12 +609,14 @@ void writeLogEntry(void *buffer) {
   LogEntry *entry = static_cast<LogEntry *>(buffer);
   entry->seq = newSeq;
   stampLightDayKey(entry);
-  write_slot(g_current_slot, *entry);
+  write_slot(g_current_slot, *entry, FLASH_TAG_LOG_ENTRY);
 
   readLogEntry();
   writeHeadRecord(newSeq, static_cast<uint16_t>(g_current_slot));
   g_latest_slot = g_current_slot;
 
+  g_daily_cache.valid = false;
+  history_add_entry(*entry);
   cache_log_entry(*entry);
 }
 
@@ -582,6 +686,7 @@ void clearLogEntry(void *buffer) {
   LogEntry *entry = static_cast<LogEntry *>(buffer);
   entry->baselinePercent = LOG_BASELINE_UNSET;
   entry->drybackPercent = LOG_BASELINE_UNSET;
+  entry->soilTempDeciC = LOG_SOIL_TEMP_UNSET;
 }
 
 void initLogEntryCommon(LogEntry *entry, uint8_t entryType, uint8_t stopReason,
@@ -607,13 +712,13 @@ void wipeLogs() {
     memset(blank, 0xFF, sizeof(blank));
     for (uint16_t i = 0; i < g_head_record_count; ++i) {
       uint32_t addr = kLogMetaSize + static_cast<uint32_t>(i) * kHeadRecordSize;
-      write_block(addr, blank, sizeof(blank));
+      write_block(addr, blank, sizeof(blank), FLASH_TAG_LOG_FORMAT);
     }
   }
 
   LogEntry blankEntry = {};
   for (uint16_t slot = 0; slot < g_total_slots; ++slot) {
-    write_slot(static_cast<int16_t>(slot), blankEntry);
+    write_slot(static_cast<int16_t>(slot), blankEntry, FLASH_TAG_LOG_FORMAT);
   }
 
   g_log_epoch = 0;
@@ -623,13 +728,15 @@ void wipeLogs() {
   g_current_slot = -1;
   g_latest_slot = -1;
   g_head_index = -1;
+  g_daily_cache.valid = false;
+  history_clear();
   clearLogEntry(&g_log_buffer);
 }
 
 bool patchLogBaselinePercent(int16_t slot, uint8_t baselinePercent) {
   if (slot < 0 || slot >= static_cast<int16_t>(g_total_slots)) return false;
   uint32_t offset = slot_offset(slot) + static_cast<uint32_t>(offsetof(LogEntry, baselinePercent));
-  return write_block(offset, &baselinePercent, sizeof(baselinePercent));
+  return write_block(offset, &baselinePercent, sizeof(baselinePercent), FLASH_TAG_LOG_PATCH);
 }
 
 bool findLatestBaselineEntries(LogEntry *outLatestSetter, int16_t *outLatestSetterSlot,
@@ -684,10 +791,14 @@ uint32_t getAbsoluteLogNumber() {
   return (static_cast<uint32_t>(g_browse_epoch) << 16) | g_log_buffer.seq;
 }
 
-uint16_t getDailyFeedTotalMlAt(uint8_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t minute,
-                               uint8_t *outMin, uint8_t *outMax) {
-  uint16_t targetKey = 0;
-  if (!calcLightDayKey(year, month, day, hour, minute, config.lightsOnMinutes, &targetKey)) return 0;
+uint16_t getDailyFeedTotalMlAt(EpochTime at, uint8_t *outMin, uint8_t *outMax) {
+  uint16_t targetKey = epochLightDayKey(at, config.lightsOnMinutes);
+  if (targetKey == 0) return 0;
+  if (g_daily_cache.valid && g_daily_cache.key == targetKey) {
+    if (outMin) *outMin = g_daily_cache.minVal;
+    if (outMax) *outMax = g_daily_cache.maxVal;
+    return g_daily_cache.total;
+  }
 
   int16_t savedSlot = g_current_slot;
   uint16_t savedBrowseEpoch = g_browse_epoch;
@@ -728,6 +839,12 @@ uint16_t getDailyFeedTotalMlAt(uint8_t year, uint8_t month, uint8_t day, uint8_t
     g_current_slot = savedSlot;
   }
 
+  g_daily_cache.valid = true;
+  g_daily_cache.key = targetKey;
+  g_daily_cache.total = total;
+  g_daily_cache.minVal = minVal;
+  g_daily_cache.maxVal = maxVal;
+
   if (outMin) *outMin = minVal;
   if (outMax) *outMax = maxVal;
 
@@ -735,14 +852,9 @@ uint16_t getDailyFeedTotalMlAt(uint8_t year, uint8_t month, uint8_t day, uint8_t
 }
 
 uint16_t getDailyFeedTotalMlNow(uint8_t *outMin, uint8_t *outMax) {
-  uint8_t hour = 0;
-  uint8_t minute = 0;
-  uint8_t day = 0;
-  uint8_t month = 0;
-  uint8_t year = 0;
-
-  if (!rtcReadDateTime(&hour, &minute, &day, &month, &year)) return 0;
-  return getDailyFeedTotalMlAt(year, month, day, hour, minute, outMin, outMax);
+  EpochTime now = EPOCH_UNSET;
+  if (!rtcReadEpoch(&now)) return 0;
+  return getDailyFeedTotalMlAt(now, outMin, outMax);
 }
 
 bool getDrybackPercent(uint8_t *outPercent) {
@@ -751,3 +863,20 @@ bool getDrybackPercent(uint8_t *outPercent) {
   uint8_t soilPercent = soilMoistureAsPercentage(getSoilMoisture());
   return calcDrybackFromBaseline(soilPercent, outPercent);
 }
+
+bool getMoistureHistoryHour(uint32_t hour, uint8_t *outMoisture, uint16_t *outFeedMl) {
+  const HistoryBucket &bucket = g_history[hour % LOG_HISTORY_HOURS];
+  bool found = bucket.hour == hour && (bucket.moistureCount > 0 || bucket.feedMl > 0);
+  if (outMoisture) {
+    *outMoisture = (found && bucket.moistureCount)
+                       ? static_cast<uint8_t>((bucket.moistureSum + bucket.moistureCount / 2) / bucket.moistureCount)
+                       : LOG_HISTORY_UNSET;
+  }
+  if (outFeedMl) *outFeedMl = found ? bucket.feedMl : 0;
+  return found;
+}
+
+uint16_t getMoistureHistoryRevision(uint32_t *outChangedHour) {
+  if (outChangedHour) *outChangedHour = g_history_changed_hour;
+  return g_history_revision;
+}
@@ -1,8 +1,11 @@
 #pragma once
 
-#include "app_state.h"
+#include <stddef.h>
+#include <stdint.h>
 
-#define LOG_FORMAT_VERSION 9
+#include "epochTime.h"
+
+#define LOG_FORMAT_VERSION 11
 
 enum LogStopReason : uint8_t {
   LOG_STOP_NONE = 0,
@@ -27,7 +30,44 @@ enum LogStartReason : uint8_t {
 #define LOG_FLAG_RUNOFF_ANY (LOG_FLAG_RUNOFF_MISSING | LOG_FLAG_RUNOFF_UNEXPECTED)
 #define LOG_FLAG_BASELINE_SETTER 0x04
 #define LOG_FLAG_RUNOFF_SEEN 0x08
+#define LOG_FLAG_SENSOR_FALLBACK 0x10
 #define LOG_BASELINE_UNSET 0xFF
+#define LOG_SOIL_TEMP_UNSET INT16_MIN
+#define LOG_HISTORY_HOURS 168
+#define LOG_HISTORY_UNSET 0xFF
+
+constexpr int kMaxLogs = 24;
+constexpr size_t kLogStoreBytes = 48 * 1024;
+// Cadence of the periodic moisture/temperature value entries.
+constexpr uint32_t kLogValuesIntervalMs = 3600000;
+
+struct LogEntry {
+  uint16_t seq;
+  uint8_t entryType;
+  uint8_t stopReason;
+  uint8_t startReason;
+  uint8_t slotIndex;
+  uint8_t flags;
+  uint8_t soilMoistureBefore;
+  uint8_t soilMoistureAfter;
+  uint8_t baselinePercent;
+  uint8_t drybackPercent;
+  uint16_t feedMl;
+  uint16_t dailyTotalMl;
+  uint16_t lightDayKey;
+  int16_t soilTempDeciC;
+  EpochTime startTime;
+  EpochTime endTime;
+  uint32_t millisStart;
+  uint32_t millisEnd;
+};
+
+// RAM copies of the most recent entries for the log browser; defined with
+// the rest of the app state.
+extern LogEntry g_logs[kMaxLogs];
+extern LogEntry newLogEntry;
+extern int g_log_count;
+extern int g_log_index;
 
 /*
  * logs_init
@@ -69,6 +109,15 @@ LogEntry build_value_log();
  */
 LogEntry build_boot_log();
 
+/*
+ * build_sensor_log
+ * Builds a type-3 sensor health log; stopReason holds the SoilSensorFault
+ * (SENSOR_FAULT_NONE marks recovery) and feedMl the last raw reading.
+ * Example:
+ *   LogEntry entry = build_sensor_log();
+ */
+LogEntry build_sensor_log();
+
 /*
  * build_feed_log
  * Builds a type-1 feed log from the current feeding state.
@@ -195,12 +244,11 @@ uint32_t getAbsoluteLogNumber();
 
 /*
  * getDailyFeedTotalMlAt
- * Calculates the daily total at a specified date/time.
+ * Calculates the daily total for the light day containing the given time.
  * Example:
- *   uint16_t total = getDailyFeedTotalMlAt(y, m, d, h, min);
+ *   uint16_t total = getDailyFeedTotalMlAt(entry.endTime);
  */
-uint16_t getDailyFeedTotalMlAt(uint8_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t minute,
-                               uint8_t *outMin = nullptr, uint8_t *outMax = nullptr);
+uint16_t getDailyFeedTotalMlAt(EpochTime at, uint8_t *outMin = nullptr, uint8_t *outMax = nullptr);
 
 /*
  * getDailyFeedTotalMlNow
@@ -218,3 +266,25 @@ uint16_t getDailyFeedTotalMlNow(uint8_t *outMin = nullptr, uint8_t *outMax = nul
  *   if (getDrybackPercent(&db)) { ... }
  */
 bool getDrybackPercent(uint8_t *outPercent);
+
+/*
+ * getMoistureHistoryHour
+ * Reads the hourly rollup for an hour index (epochHours()): mean soil moisture
+ * from value and feed logs (LOG_HISTORY_UNSET without samples) and ml fed.
+ * Returns false for hours outside the last LOG_HISTORY_HOURS or with no logs.
+ * Example:
+ *   uint8_t moisture = 0;
+ *   uint16_t fedMl = 0;
+ *   if (getMoistureHistoryHour(hour, &moisture, &fedMl)) { ... }
+ */
+bool getMoistureHistoryHour(uint32_t hour, uint8_t *outMoisture, uint16_t *outFeedMl);
+
+/*
+ * getMoistureHistoryRevision
+ * Returns a counter that changes whenever the hourly rollup does, plus the
+ * hour the most recent append landed in.
+ * Example:
+ *   uint32_t hour = 0;
+ *   uint16_t rev = getMoistureHistoryRevision(&hour);
+ */
+uint16_t getMoistureHistoryRevision(uint32_t *outChangedHour = nullptr);
@@ -0,0 +1,43 @@
+#include "loopPacing.h"
+
+// Reduce LVGL tick rate in Wokwi to avoid slow webview refresh.
+#ifdef WOKWI_SIM
+static const uint32_t kMinLoopDelayMs = 16;
+static const uint32_t kMaxLoopDelayMs = 50;
+#else
+static const uint32_t kMinLoopDelayMs = 5;
+static const uint32_t kMaxLoopDelayMs = 20;
+#endif
+
+static unsigned long windowStartedAt = 0;
+static uint32_t windowWakes = 0;
+static uint32_t wakesPerMinute = 0;
+
+uint32_t loopPacingDelayMs(uint32_t timerNextMs, uint32_t controlIdleMs) {
+  uint32_t delayMs = timerNextMs;
+  uint32_t maxMs = kMaxLoopDelayMs;
+  if (controlIdleMs != LOOP_PACING_FULL_RATE) {
+    // Idle: LVGL's own next deadline (UI timer, refresh, indev poll) and the
+    // control deadline decide; nothing else needs the CPU before then.
+    if (controlIdleMs < delayMs) delayMs = controlIdleMs;
+    maxMs = LOOP_PACING_IDLE_MAX_MS;
+  }
+  if (delayMs < kMinLoopDelayMs) delayMs = kMinLoopDelayMs;
+  else if (delayMs > maxMs) delayMs = maxMs;
+  return delayMs;
+}
+
+void loopPacingCountWake() {
+  unsigned long now = millis();
+  windowWakes++;
+  unsigned long elapsed = now - windowStartedAt;
+  if (elapsed < LOOP_PACING_WINDOW_MS) return;
+  // A long light sleep can stretch the window; scale back to per-minute.
+  wakesPerMinute = static_cast<uint32_t>((static_cast<uint64_t>(windowWakes) * 60000ULL) / elapsed);
+  windowWakes = 0;
+  windowStartedAt = now;
+}
+
+uint32_t loopPacingWakesPerMinute() {
+  return wakesPerMinute;
+}
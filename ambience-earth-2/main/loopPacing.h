@@ -0,0 +1,34 @@
+#pragma once
+
+#include <Arduino.h>
+
+#define LOOP_PACING_IDLE_MAX_MS 1000UL
+#define LOOP_PACING_WINDOW_MS 60000UL
+#define LOOP_PACING_FULL_RATE 0UL
+
+/*
+ * loopPacingDelayMs
+ * Picks how long the main loop may block. timerNextMs is what
+ * lv_timer_handler() returned; controlIdleMs is how long the control side
+ * can wait, or LOOP_PACING_FULL_RATE while touch, a feed or an animation
+ * needs the normal 5-20 ms cadence.
+ * Example:
+ *   uint32_t waitMs = loopPacingDelayMs(lv_timer_handler(), ui_pacing_idle_ms());
+ */
+uint32_t loopPacingDelayMs(uint32_t timerNextMs, uint32_t controlIdleMs);
+
+/*
+ * loopPacingCountWake
+ * Records one pass through loop(); call once at the top of every pass.
+ * Example:
+ *   loopPacingCountWake();
+ */
+void loopPacingCountWake();
+
+/*
+ * loopPacingWakesPerMinute
+ * Returns loop passes per minute over the last completed window.
+ * Example:
+ *   uint32_t wakes = loopPacingWakesPerMinute();
+ */
+uint32_t loopPacingWakesPerMinute();
@@ -0,0 +1,58 @@
+#include "lowPower.h"
+
+#ifndef WOKWI_SIM
+#include <driver/gpio.h>
+#include <esp_sleep.h>
+#endif
+
+static int8_t wakePinNumber = LOW_POWER_NO_WAKE_PIN;
+static uint32_t sleepCount = 0;
+static uint32_t sleptMs = 0;
+
+void initLowPower(int8_t wakePin) {
+  wakePinNumber = wakePin;
+#ifndef WOKWI_SIM
+  if (wakePinNumber >= 0) {
+    pinMode(wakePinNumber, INPUT_PULLUP);
+    esp_sleep_enable_gpio_wakeup();
+  }
+#endif
+}
+
+bool lowPowerIdle(uint32_t sleepMs) {
+  if (sleepMs < LOW_POWER_MIN_SLEEP_MS) return false;
+  if (sleepMs > LOW_POWER_MAX_SLEEP_MS) sleepMs = LOW_POWER_MAX_SLEEP_MS;
+  // Without a touch interrupt the panel must still be polled often enough to feel responsive.
+  if (wakePinNumber < 0 && sleepMs > LOW_POWER_TOUCH_POLL_MS) sleepMs = LOW_POWER_TOUCH_POLL_MS;
+
+  unsigned long startedAt = millis();
+#ifdef WOKWI_SIM
+  // The simulator has no light sleep; idle in one long delay so the pacing matches.
+  delay(sleepMs);
+#else
+  // A finger already on the panel holds INT low and would wake us immediately.
+  if (wakePinNumber >= 0 && !digitalRead(wakePinNumber)) return false;
+  Serial.flush();
+  // Light-sleep wake needs a level trigger, but the touch driver's ISR is
+  // edge-triggered on the same pin; arm the level only around the sleep.
+  gpio_num_t wakeGpio = static_cast<gpio_num_t>(wakePinNumber);
+  if (wakePinNumber >= 0) gpio_wakeup_enable(wakeGpio, GPIO_INTR_LOW_LEVEL);
+  esp_sleep_enable_timer_wakeup(static_cast<uint64_t>(sleepMs) * 1000ULL);
+  esp_light_sleep_start();
+  if (wakePinNumber >= 0) {
+    gpio_wakeup_disable(wakeGpio);
+    gpio_set_intr_type(wakeGpio, GPIO_INTR_NEGEDGE);
+  }
+#endif
+  sleepCount++;
+  sleptMs += static_cast<uint32_t>(millis() - startedAt);
+  return true;
+}
+
+uint32_t lowPowerSleepCount() {
+  return sleepCount;
+}
+
+uint32_t lowPowerSleptMs() {
+  return sleptMs;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <Arduino.h>
+
+#define LOW_POWER_MIN_SLEEP_MS 30UL
+#define LOW_POWER_MAX_SLEEP_MS 60000UL
+#define LOW_POWER_TOUCH_POLL_MS 100UL
+#define LOW_POWER_NO_WAKE_PIN -1
+
+/*
+ * initLowPower
+ * Configures the touch interrupt pin used to wake from light sleep.
+ * Example:
+ *   initLowPower(LOW_POWER_NO_WAKE_PIN);
+ */
+void initLowPower(int8_t wakePin);
+
+/*
+ * lowPowerIdle
+ * Light-sleeps for up to sleepMs when it is long enough to be worth it.
+ * Returns true if the CPU actually slept.
+ * Example:
+ *   if (lowPowerIdle(ui_idle_sleep_ms())) return;
+ */
+bool lowPowerIdle(uint32_t sleepMs);
+
+/*
+ * lowPowerSleepCount
+ * Returns how many light-sleep cycles have been entered since boot.
+ * Example:
+ *   uint32_t n = lowPowerSleepCount();
+ */
+uint32_t lowPowerSleepCount();
+
+/*
+ * lowPowerSleptMs
+ * Returns the total milliseconds spent in light sleep since boot.
+ * Example:
+ *   uint32_t ms = lowPowerSleptMs();
+ */
+uint32_t lowPowerSleptMs();
@@ -24,12 +24,23 @@
 #define LV_USE_KEYBOARD 1
 #define LV_USE_TEXTAREA 1
 
+/* tools/gen-ui-fonts.py writes subset fonts next to this file. When present
+ * they replace the full built-in Montserrat sizes (see ui_fonts.h). */
+#if defined(__has_include)
+#if __has_include("ui_fonts_data.h")
+#define UI_FONTS_SUBSET 1
+#endif
+#endif
+
+#ifdef UI_FONTS_SUBSET
+#define LV_FONT_MONTSERRAT_14 0
+#define LV_FONT_CUSTOM_DECLARE LV_FONT_DECLARE(ui_font_montserrat_14)
+#define LV_FONT_DEFAULT &ui_font_montserrat_14
+#else
 #define LV_FONT_MONTSERRAT_12 1
 #define LV_FONT_MONTSERRAT_14 1
 #define LV_FONT_MONTSERRAT_18 1
-#define LV_FONT_MONTSERRAT_22 1
-#define LV_FONT_MONTSERRAT_28 1
-#define LV_FONT_MONTSERRAT_32 1
+#endif
 
 #define LV_USE_THEME_DEFAULT 1
 #define LV_THEME_DEFAULT_DARK 1
@@ -1,19 +1,15 @@
 #include <Arduino.h>
 
+#include "flashStats.h"
 #include "logs.h"
+#include "loopPacing.h"
+#include "lowPower.h"
 #include "platform_display.h"
+#include "profiler.h"
+#include "serialConsole.h"
 #include "sim.h"
 #include "ui_flow.h"
 
-// Reduce LVGL tick rate in Wokwi to avoid slow webview refresh.
-#ifdef WOKWI_SIM
-static const uint32_t kMinLoopDelayMs = 16;
-static const uint32_t kMaxLoopDelayMs = 50;
-#else
-static const uint32_t kMinLoopDelayMs = 5;
-static const uint32_t kMaxLoopDelayMs = 20;
-#endif
-
 /*
  * setup
  * Arduino entry point that initializes display, simulation, and UI.
@@ -25,20 +21,34 @@ void setup() {
   lv_display_t *disp = platform_display_init();
   randomSeed(micros());
   logs_init();
+  flashStatsInit();
   sim_init();
   build_ui();
+  initLowPower(platform_touch_int_pin());
   lv_refr_now(disp);
 }
 
 /*
  * loop
- * Arduino main loop that runs the LVGL task handler.
+ * Arduino main loop that runs the LVGL task handler, light-sleeps on the
+ * screensaver, and otherwise waits as long as the pacing policy allows.
  * Example:
  *   // Called automatically by the Arduino core after setup().
  */
 void loop() {
-  uint32_t delayMs = lv_timer_handler();
-  if (delayMs < kMinLoopDelayMs) delayMs = kMinLoopDelayMs;
-  else if (delayMs > kMaxLoopDelayMs) delayMs = kMaxLoopDelayMs;
-  delay(delayMs);
+  loopPacingCountWake();
+  serialConsoleService();
+  platform_touch_service();
+  uint32_t timerNextMs = 0;
+  {
+    PROFILE_SCOPE(PROF_LVGL_HANDLER);
+    timerNextMs = lv_timer_handler();
+  }
+  uint32_t idleMs = ui_idle_sleep_ms();
+  if (idleMs >= LOW_POWER_MIN_SLEEP_MS) {
+    lv_refr_now(nullptr);
+    platform_display_wait_idle();
+    if (lowPowerIdle(idleMs)) return;
+  }
+  platform_touch_wait(loopPacingDelayMs(timerNextMs, ui_pacing_idle_ms()));
 }
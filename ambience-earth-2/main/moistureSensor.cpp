@@ -1,6 +1,7 @@
 #include "moistureSensor.h"
 
 #include "config.h"
+#include "soilTempSensor.h"
 
 extern Config config;
 
@@ -42,8 +43,20 @@ static uint16_t windowCount = 0;
 static uint16_t windowMinRaw = 0;
 static uint16_t windowMaxRaw = 0;
 static uint16_t windowLastRaw = 0;
+static uint16_t windowRailLowCount = 0;
+static uint16_t windowRailHighCount = 0;
 static bool moistureReady = false;
 
+static uint8_t railFailedWindows = 0;
+static uint8_t realtimeRailStreak = 0;
+static bool railSuspect = false;
+static bool railHigh = false;
+static uint8_t flatWindows = 0;
+static uint8_t noResponseFeeds = 0;
+static uint8_t noResponsePercent = 0;
+static bool responsePending = false;
+static uint8_t responseStartPercent = 0;
+
 static unsigned long windowDurationMs() {
   return (windowOwner == WINDOW_OWNER_CALIBRATION) ? SENSOR_CAL_WINDOW_DURATION : SENSOR_WINDOW_DURATION;
 }
@@ -97,6 +110,62 @@ static void resetWindowAccum() {
   windowMinRaw = 0xFFFF;
   windowMaxRaw = 0;
   windowLastRaw = 0;
+  windowRailLowCount = 0;
+  windowRailHighCount = 0;
+}
+
+/*
+ * trackRailSample
+ * Counts window samples pinned at either ADC rail.
+ * Example:
+ *   trackRailSample(raw);
+ */
+static void trackRailSample(uint16_t raw) {
+  if (raw <= SENSOR_RAIL_LOW_RAW) windowRailLowCount++;
+  else if (raw >= SENSOR_RAIL_HIGH_RAW) windowRailHighCount++;
+}
+
+/*
+ * updateWindowHealth
+ * Scores a finished window for rail-stuck and zero-variance faults.
+ * Example:
+ *   updateWindowHealth();
+ */
+static void updateWindowHealth() {
+  if (windowCount == 0) return;
+  uint16_t railCount = windowRailLowCount + windowRailHighCount;
+  uint8_t railPct = static_cast<uint8_t>((static_cast<uint32_t>(railCount) * 100UL) / windowCount);
+  if (railCount > 0) railHigh = windowRailHighCount > windowRailLowCount;
+  railSuspect = railPct >= SENSOR_RAIL_SUSPECT_PCT;
+  if (railPct >= SENSOR_RAIL_FAILED_PCT) {
+    if (railFailedWindows < 0xFF) railFailedWindows++;
+  } else {
+    railFailedWindows = 0;
+    realtimeRailStreak = 0;
+  }
+
+#ifndef WOKWI_SIM
+  // A live probe always shows a few counts of ADC noise; the simulator's slider does not.
+  if (windowCount >= SENSOR_FLAT_MIN_SAMPLES && railCount == 0 && windowMinRaw == windowMaxRaw) {
+    if (flatWindows < 0xFF) flatWindows++;
+  } else {
+    flatWindows = 0;
+  }
+#endif
+}
+
+/*
+ * clearNoResponseOnMove
+ * Clears the no-response count once lazy readings drift on their own, since
+ * a probe that tracks drying or a hand watering is reading the soil again.
+ * Example:
+ *   clearNoResponseOnMove(avg);
+ */
+static void clearNoResponseOnMove(uint16_t raw) {
+  if (noResponseFeeds == 0) return;
+  uint8_t percent = soilMoistureAsPercentage(raw);
+  uint8_t moved = (percent > noResponsePercent) ? percent - noResponsePercent : noResponsePercent - percent;
+  if (moved >= SENSOR_NO_RESPONSE_CLEAR_MOVE) noResponseFeeds = 0;
 }
 
 /*
@@ -116,9 +185,11 @@ static void finalizeWindow(SoilSensorWindowStats *out) {
     return;
   }
 
+  updateWindowHealth();
   uint16_t avg = static_cast<uint16_t>(windowSum / windowCount);
   lazyValue = avg;
   moistureReady = true;
+  if (windowOwner == WINDOW_OWNER_LAZY) clearNoResponseOnMove(avg);
   lastWindowEndAt = millis();
   if (out) {
     out->minRaw = windowMinRaw;
@@ -171,6 +242,7 @@ static bool tickWindow(SoilSensorWindowStats *out) {
         windowLastRaw = raw;
         windowSum += raw;
         windowCount++;
+        trackRailSample(raw);
         if (raw < windowMinRaw) windowMinRaw = raw;
         if (raw > windowMaxRaw) windowMaxRaw = raw;
         nextSampleAt = now + SENSOR_SAMPLE_INTERVAL;
@@ -229,6 +301,12 @@ static void tickRealtime(bool forceSample) {
   uint16_t raw = readMedian3FromPin(SOIL_MOISTURE_SENSOR_PIN);
   realtimeRaw = raw;
   moistureReady = true;
+  if (raw <= SENSOR_RAIL_LOW_RAW || raw >= SENSOR_RAIL_HIGH_RAW) {
+    if (realtimeRailStreak < 0xFF) realtimeRailStreak++;
+    railHigh = raw >= SENSOR_RAIL_HIGH_RAW;
+  } else {
+    realtimeRailStreak = 0;
+  }
 
   if (!realtimeSeeded) {
     realtimeAvgQ8 = static_cast<int32_t>(raw) << 8;
@@ -266,6 +344,14 @@ void initMoistureSensor() {
   moistureReady = false;
   lastWindowEndAt = 0;
 
+  railFailedWindows = 0;
+  realtimeRailStreak = 0;
+  railSuspect = false;
+  railHigh = false;
+  flatWindows = 0;
+  noResponseFeeds = 0;
+  responsePending = false;
+
   startWindow(WINDOW_OWNER_LAZY);
 }
 
@@ -333,6 +419,14 @@ unsigned long soilSensorLastWindowEndAt() {
   return lastWindowEndAt;
 }
 
+uint32_t soilSensorIdleMs() {
+  if (readMode != READ_MODE_LAZY || windowOwner != WINDOW_OWNER_LAZY) return 0;
+  if (lazyState != LAZY_STATE_IDLE || sensorPowered) return 0;
+  unsigned long now = millis();
+  if (static_cast<long>(nextWindowAt - now) <= 0) return 0;
+  return static_cast<uint32_t>(nextWindowAt - now);
+}
+
 uint32_t soilSensorCalWindowRemainingMs() {
   if (windowOwner != WINDOW_OWNER_CALIBRATION) return 0;
   if (lazyState == LAZY_STATE_WARMING) return SENSOR_CAL_WINDOW_DURATION;
@@ -418,5 +512,70 @@ uint8_t soilMoistureAsPercentage(uint16_t soilMoisture) {
   if (shifted < 0) shifted = 0;
   if (shifted > delta) shifted = delta;
 
-  return static_cast<uint8_t>((shifted * 100) / delta);
+  int32_t percent = (shifted * 100) / delta;
+  if (config.moistTempCompPer10C != 0 && soilTempReady()) {
+    int32_t offsetDeciC = static_cast<int32_t>(getSoilTempDeciC()) - SOIL_TEMP_REFERENCE_DECI_C;
+    percent -= (offsetDeciC * config.moistTempCompPer10C) / 100;
+    if (percent < 0) percent = 0;
+    if (percent > 100) percent = 100;
+  }
+
+  return static_cast<uint8_t>(percent);
+}
+
+/*
+ * railFailed
+ * Returns true when the probe has sat on an ADC rail long enough to be failed.
+ * Example:
+ *   if (railFailed()) { ... }
+ */
+static bool railFailed() {
+  return railFailedWindows >= SENSOR_RAIL_FAILED_WINDOWS ||
+         realtimeRailStreak >= SENSOR_RAIL_REALTIME_STREAK;
+}
+
+SoilSensorHealth soilSensorHealth() {
+  if (railFailed() || flatWindows >= SENSOR_FLAT_FAILED_WINDOWS ||
+      noResponseFeeds >= SENSOR_NO_RESPONSE_FAILED_FEEDS) {
+    return SENSOR_FAILED;
+  }
+  if (soilSensorFault() != SENSOR_FAULT_NONE) return SENSOR_SUSPECT;
+  return SENSOR_OK;
+}
+
+SoilSensorFault soilSensorFault() {
+  if (railFailed() || railSuspect || railFailedWindows > 0 ||
+      realtimeRailStreak >= SENSOR_RAIL_REALTIME_STREAK / 2) {
+    return railHigh ? SENSOR_FAULT_RAIL_HIGH : SENSOR_FAULT_RAIL_LOW;
+  }
+  if (flatWindows >= SENSOR_FLAT_SUSPECT_WINDOWS) return SENSOR_FAULT_STUCK;
+  if (noResponseFeeds > 0) return SENSOR_FAULT_NO_RESPONSE;
+  return SENSOR_FAULT_NONE;
+}
+
+void soilSensorFeedStarted() {
+  responsePending = moistureReady;
+  responseStartPercent = soilMoistureAsPercentage(lazyValue);
+}
+
+void soilSensorFeedProgress(uint32_t pumpOnMs) {
+  if (!responsePending || !soilSensorRealtimeReady()) return;
+
+  uint8_t percent = soilMoistureAsPercentage(soilSensorGetRealtimeAvg());
+  bool rose = percent >= responseStartPercent + SENSOR_RESPONSE_MIN_RISE;
+  bool saturated = responseStartPercent + SENSOR_RESPONSE_MIN_RISE > 100;
+  if (rose || saturated) {
+    responsePending = false;
+    noResponseFeeds = 0;
+    return;
+  }
+  if (pumpOnMs < SENSOR_RESPONSE_WINDOW_MS) return;
+
+  responsePending = false;
+  noResponsePercent = percent;
+  if (noResponseFeeds < 0xFF) noResponseFeeds++;
+}
+
+void soilSensorFeedEnded() {
+  responsePending = false;
 }
@@ -13,6 +13,34 @@
 #define SENSOR_FEED_TAU_FAST_MS 700UL
 #define SENSOR_FEED_TAU_SLOW_MS 7000UL
 
+#define SENSOR_RAIL_LOW_RAW 4
+#define SENSOR_RAIL_HIGH_RAW 1019
+#define SENSOR_RAIL_SUSPECT_PCT 25
+#define SENSOR_RAIL_FAILED_PCT 75
+#define SENSOR_RAIL_FAILED_WINDOWS 2
+#define SENSOR_RAIL_REALTIME_STREAK 20
+#define SENSOR_FLAT_MIN_SAMPLES 20
+#define SENSOR_FLAT_SUSPECT_WINDOWS 3
+#define SENSOR_FLAT_FAILED_WINDOWS 10
+#define SENSOR_RESPONSE_WINDOW_MS 180000UL
+#define SENSOR_RESPONSE_MIN_RISE 2
+#define SENSOR_NO_RESPONSE_FAILED_FEEDS 3
+#define SENSOR_NO_RESPONSE_CLEAR_MOVE 5
+
+enum SoilSensorHealth : uint8_t {
+  SENSOR_OK = 0,
+  SENSOR_SUSPECT = 1,
+  SENSOR_FAILED = 2
+};
+
+enum SoilSensorFault : uint8_t {
+  SENSOR_FAULT_NONE = 0,
+  SENSOR_FAULT_RAIL_LOW = 1,
+  SENSOR_FAULT_RAIL_HIGH = 2,
+  SENSOR_FAULT_STUCK = 3,
+  SENSOR_FAULT_NO_RESPONSE = 4
+};
+
 struct SoilSensorWindowStats {
   uint16_t minRaw;
   uint16_t maxRaw;
@@ -157,6 +185,14 @@ unsigned long soilSensorLastWindowEndAt();
  */
 uint32_t soilSensorCalWindowRemainingMs();
 
+/*
+ * soilSensorIdleMs
+ * Returns milliseconds until the next lazy window needs the CPU, or 0 when busy.
+ * Example:
+ *   uint32_t idle = soilSensorIdleMs();
+ */
+uint32_t soilSensorIdleMs();
+
 /*
  * initMoistureSensor
  * Configures the moisture sensor pins and state machine.
@@ -168,7 +204,49 @@ void initMoistureSensor();
 /*
  * soilMoistureAsPercentage
  * Converts a raw soil reading into a percentage using calibration.
+ * When config.moistTempCompPer10C is set and a soil temperature is available,
+ * subtracts that many percent per 10C above SOIL_TEMP_REFERENCE_DECI_C.
  * Example:
  *   uint8_t pct = soilMoistureAsPercentage(raw);
  */
 uint8_t soilMoistureAsPercentage(uint16_t soilMosture);
+
+/*
+ * soilSensorHealth
+ * Returns the probe health derived from rail, variance and response checks.
+ * Example:
+ *   if (soilSensorHealth() == SENSOR_FAILED) { ... }
+ */
+SoilSensorHealth soilSensorHealth();
+
+/*
+ * soilSensorFault
+ * Returns the most severe active fault, or SENSOR_FAULT_NONE.
+ * Example:
+ *   SoilSensorFault fault = soilSensorFault();
+ */
+SoilSensorFault soilSensorFault();
+
+/*
+ * soilSensorFeedStarted
+ * Records the moisture at pump start for the response check.
+ * Example:
+ *   soilSensorFeedStarted();
+ */
+void soilSensorFeedStarted();
+
+/*
+ * soilSensorFeedProgress
+ * Judges probe response once enough pump-on time has accumulated.
+ * Example:
+ *   soilSensorFeedProgress(session.onElapsedMs);
+ */
+void soilSensorFeedProgress(uint32_t pumpOnMs);
+
+/*
+ * soilSensorFeedEnded
+ * Closes the response check for the current feed.
+ * Example:
+ *   soilSensorFeedEnded();
+ */
+void soilSensorFeedEnded();
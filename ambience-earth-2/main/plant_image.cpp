@@ -1,791 +0,0 @@
-#include "plant_image.h"
-
-const int16_t kPlantW = 64;
-const int16_t kPlantH = 64;
-
-const uint8_t kPlantImageData[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x38,
-  0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x6C, 0x9E, 0xE1, 0x30, 0x20, 0x18, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10,
-  0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x60, 0x18, 0x43, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x78, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x39, 0x00, 0x18, 0x00, 0x10,
-  0x00, 0x10, 0x00, 0x18, 0x40, 0x20, 0xA1, 0x30, 0x03, 0x39, 0x64, 0x49, 0xA5, 0x51, 0xA5, 0x51,
-  0xA5, 0x51, 0x43, 0x41, 0x02, 0x39, 0x81, 0x28, 0x20, 0x20, 0x00, 0x18, 0x00, 0x10, 0x00, 0x18,
-  0x22, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xA0, 0x10, 0x20, 0x20, 0x00, 0x18, 0x00, 0x20, 0x03, 0x39, 0x67, 0x62,
-  0xEA, 0x8B, 0x2D, 0xAD, 0x2E, 0xC6, 0xAF, 0xCE, 0x2F, 0xD7, 0x4D, 0xD7, 0x6D, 0xD7, 0x8E, 0xD7,
-  0x6D, 0xD7, 0x2D, 0xCF, 0x0E, 0xCF, 0x6D, 0xC6, 0xAC, 0xB5, 0x6A, 0x94, 0xE7, 0x72, 0x43, 0x41,
-  0x00, 0x20, 0x00, 0x18, 0xA1, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x61, 0x20, 0x60, 0x28, 0xE2, 0x38, 0x08, 0x73, 0x6C, 0xAD, 0xEE, 0xCE, 0xAC, 0xD7,
-  0xA9, 0xCF, 0x66, 0xBF, 0x24, 0xAF, 0x02, 0xA7, 0xC1, 0x9E, 0x2B, 0xBF, 0x72, 0xDF, 0xA2, 0x9E,
-  0xE7, 0xAE, 0xB4, 0xE7, 0xB4, 0xE7, 0xD3, 0xEF, 0xF3, 0xEF, 0xF2, 0xE7, 0xF0, 0xDF, 0x4F, 0xDF,
-  0x8E, 0xB5, 0x86, 0x62, 0x40, 0x28, 0x00, 0x20, 0xE2, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x80, 0x18, 0x81, 0x28, 0xA0, 0x30, 0x44, 0x7D, 0xA8, 0xC7, 0x23, 0xAF, 0xA0, 0x9E, 0x80, 0x96,
-  0x60, 0x96, 0x80, 0x96, 0x60, 0x96, 0x60, 0x96, 0x60, 0x8E, 0xA5, 0xA6, 0x2B, 0xC7, 0xE2, 0xA6,
-  0x05, 0xAF, 0x6F, 0xD7, 0xB3, 0xE7, 0xD7, 0xF7, 0xD8, 0xFF, 0xD8, 0xFF, 0xD7, 0xF7, 0x2B, 0xBF,
-  0x69, 0xBF, 0xF1, 0xEF, 0x0F, 0xC6, 0xE4, 0x51, 0x00, 0x20, 0xA1, 0x28, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x28, 0x81, 0x20, 0x61, 0x28, 0x00, 0x31, 0x80, 0x54, 0x60, 0x86, 0xA0, 0x9E, 0xA0, 0x9E,
-  0xC2, 0xAE, 0x25, 0xBF, 0x25, 0xBF, 0x04, 0xB7, 0x83, 0xA6, 0x01, 0x8E, 0x80, 0x75, 0x60, 0x6D,
-  0x80, 0x75, 0x00, 0x7E, 0x80, 0x96, 0xE2, 0xAE, 0x06, 0xB7, 0x2B, 0xC7, 0x6F, 0xD7, 0xE7, 0xB6,
-  0x60, 0x8E, 0x81, 0x96, 0x8B, 0xCF, 0xF2, 0xF7, 0xA8, 0x83, 0x00, 0x20, 0x60, 0x28, 0xA2, 0x28,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x80, 0x20, 0x41, 0x28, 0x81, 0x30, 0x40, 0x4C, 0x20, 0x7E, 0xA0, 0x9E,
-  0xA0, 0x9E, 0xA0, 0x9E, 0xC1, 0xA6, 0x23, 0xB7, 0x65, 0xBF, 0x86, 0xCF, 0x86, 0xC7, 0xE5, 0xB6,
-  0x04, 0x96, 0x02, 0x6D, 0x80, 0x54, 0xC0, 0x5C, 0xC0, 0x7D, 0xA0, 0x9E, 0xC0, 0x9E, 0xA0, 0x96,
-  0x80, 0x9E, 0xA0, 0x9E, 0x60, 0x8E, 0xC5, 0xAE, 0xF2, 0xF7, 0xCB, 0x9C, 0x20, 0x20, 0x81, 0x28,
-  0xE3, 0x18, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0xC1, 0x20, 0x61, 0x28, 0xA0, 0x30, 0x60, 0x4C, 0xE0, 0x75,
-  0xA0, 0x9E, 0xA0, 0x9E, 0x80, 0x9E, 0x80, 0x96, 0x80, 0x96, 0xA0, 0x9E, 0xE2, 0xA6, 0x44, 0xBF,
-  0xA5, 0xCF, 0xA6, 0xCF, 0x05, 0xB7, 0xA3, 0x85, 0x41, 0x4C, 0x00, 0x44, 0x20, 0x6D, 0x80, 0x9E,
-  0xE0, 0xA6, 0xA0, 0x9E, 0x80, 0x9E, 0x80, 0x96, 0x82, 0x9E, 0xF0, 0xF7, 0x8A, 0x94, 0x00, 0x20,
-  0xA1, 0x28, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0xA1, 0x20, 0x41, 0x28, 0x00, 0x31, 0xE0, 0x4C,
-  0x00, 0x7E, 0xC0, 0xA6, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0x80, 0x96, 0x80, 0x96,
-  0x80, 0x9E, 0xC1, 0x9E, 0x02, 0xAF, 0x63, 0xBF, 0x44, 0xBF, 0x03, 0x96, 0x21, 0x4C, 0x80, 0x33,
-  0x00, 0x65, 0xA0, 0x9E, 0xC0, 0xA6, 0x80, 0x9E, 0x80, 0x96, 0x62, 0x96, 0xEE, 0xE7, 0x05, 0x6B,
-  0x00, 0x20, 0xA1, 0x28, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0xA0, 0x28, 0x21, 0x28, 0x20, 0x3A,
-  0x40, 0x55, 0xE0, 0x7D, 0xC0, 0xA6, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E,
-  0xA0, 0x9E, 0xA0, 0x9E, 0x80, 0x96, 0x80, 0x96, 0xA0, 0x9E, 0xE0, 0xA6, 0x01, 0xAF, 0xA1, 0x85,
-  0x80, 0x33, 0x60, 0x2B, 0xA0, 0x7D, 0xE0, 0xA6, 0xA0, 0x9E, 0x80, 0x96, 0x02, 0x7E, 0x0A, 0xC7,
-  0x21, 0x39, 0x40, 0x20, 0xA1, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x81, 0x28, 0x21, 0x28,
-  0x80, 0x43, 0x60, 0x55, 0x20, 0x86, 0xC0, 0xA6, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E,
-  0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0x80, 0x9E, 0x80, 0x96, 0xE0, 0xA6,
-  0xC0, 0xA6, 0xC0, 0x64, 0xE0, 0x1A, 0x40, 0x4C, 0x40, 0x86, 0x00, 0x7E, 0xE0, 0x4C, 0x63, 0x8E,
-  0xC5, 0x8C, 0x00, 0x20, 0xA1, 0x28, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x50, 0x00, 0x00, 0x00, 0x50, 0x00, 0x38, 0x00, 0x38,
-  0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x18, 0x61, 0x28,
-  0xA0, 0x28, 0x80, 0x4C, 0x20, 0x55, 0x20, 0x86, 0xC0, 0xA6, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E,
-  0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0x80, 0x9E,
-  0xA0, 0x9E, 0xE0, 0xA6, 0xE0, 0x85, 0x20, 0x2B, 0x00, 0x1B, 0x20, 0x55, 0x60, 0x5D, 0x00, 0x55,
-  0x62, 0x96, 0x61, 0x41, 0x40, 0x20, 0xE0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x81, 0x20,
-  0x41, 0x28, 0x40, 0x31, 0x00, 0x55, 0x00, 0x55, 0xE0, 0x7D, 0xC0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E,
-  0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E,
-  0xA0, 0x9E, 0x80, 0x9E, 0xC0, 0x9E, 0x00, 0x8E, 0x80, 0x3B, 0xE0, 0x1A, 0x20, 0x5D, 0x00, 0x55,
-  0xC0, 0x6D, 0x61, 0x63, 0x01, 0x20, 0xA1, 0x20, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x18,
-  0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x18, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10,
-  0x00, 0x08, 0x00, 0x10, 0xC6, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-  0x81, 0x28, 0x21, 0x28, 0xE0, 0x31, 0x40, 0x55, 0xE0, 0x4C, 0x60, 0x65, 0x60, 0x96, 0xC0, 0xA6,
-  0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E,
-  0xA0, 0x9E, 0xA0, 0x9E, 0xC0, 0xA6, 0x40, 0x65, 0xC0, 0x7D, 0x60, 0x3B, 0xC0, 0x12, 0x00, 0x55,
-  0x40, 0x55, 0x80, 0x64, 0x61, 0x28, 0x80, 0x20, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x31, 0x00, 0x18, 0x00, 0x18, 0xA1, 0x30,
-  0xC4, 0x51, 0xE6, 0x72, 0xA7, 0x83, 0x49, 0x94, 0x6B, 0x94, 0x6B, 0x94, 0xC9, 0x8B, 0x08, 0x73,
-  0xE5, 0x51, 0xC2, 0x30, 0x00, 0x18, 0x00, 0x10, 0x40, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x08, 0x81, 0x28, 0x21, 0x28, 0x20, 0x3A, 0x40, 0x55, 0xE0, 0x4C, 0xE0, 0x54, 0xA0, 0x75,
-  0x60, 0x96, 0xC0, 0x9E, 0xC0, 0xA6, 0xC0, 0xA6, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xC0, 0x9E,
-  0xC0, 0xA6, 0xE0, 0xA6, 0x40, 0x8E, 0xC0, 0x4C, 0xC0, 0x44, 0x80, 0x75, 0xC0, 0x22, 0x20, 0x23,
-  0x40, 0x55, 0xE0, 0x5C, 0xC1, 0x30, 0x60, 0x20, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xC2, 0x21, 0x60, 0x28, 0x00, 0x20, 0xA4, 0x51, 0x6B, 0x9C, 0x6D, 0xC6,
-  0x90, 0xDF, 0xF2, 0xEF, 0xF4, 0xEF, 0xEF, 0xDF, 0x86, 0xBF, 0xA6, 0xC7, 0xA7, 0xC7, 0x89, 0xC7,
-  0x6B, 0xCF, 0xAD, 0xC6, 0x2C, 0xAD, 0xC7, 0x6A, 0xA1, 0x30, 0x60, 0x20, 0x40, 0x20, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x41, 0x18, 0x81, 0x28, 0x21, 0x28, 0xC0, 0x31, 0xE0, 0x54, 0x40, 0x55, 0xC0, 0x4C,
-  0xE0, 0x4C, 0x60, 0x65, 0xC0, 0x75, 0x20, 0x86, 0x60, 0x96, 0x80, 0x96, 0x80, 0x96, 0x60, 0x8E,
-  0x20, 0x86, 0x80, 0x6D, 0xC0, 0x4C, 0xC0, 0x4C, 0xA0, 0x44, 0xE0, 0x4C, 0x60, 0x4C, 0x40, 0x0A,
-  0x00, 0x34, 0x00, 0x55, 0x00, 0x29, 0x40, 0x20, 0xC0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xE1, 0x28, 0x20, 0x20, 0xA1, 0x30, 0xAB, 0x9C, 0x6E, 0xDF, 0x46, 0xB7, 0x4C, 0xC7,
-  0xD8, 0xF7, 0xD6, 0xF7, 0xB2, 0xE7, 0xE7, 0xAE, 0x20, 0x86, 0x00, 0x86, 0x40, 0x8E, 0x80, 0x9E,
-  0x80, 0x96, 0xC0, 0x9E, 0x23, 0xAF, 0xA7, 0xBF, 0xA2, 0x74, 0x60, 0x28, 0x61, 0x20, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x80, 0x28, 0x41, 0x28, 0xE0, 0x30, 0xA0, 0x43, 0x40, 0x55,
-  0x20, 0x55, 0xC0, 0x4C, 0xA0, 0x44, 0xC0, 0x4C, 0xE0, 0x4C, 0x00, 0x55, 0xE0, 0x4C, 0xE0, 0x4C,
-  0xC0, 0x44, 0xA0, 0x44, 0xC0, 0x4C, 0xC0, 0x4C, 0xC0, 0x4C, 0xA0, 0x44, 0xC0, 0x4C, 0x20, 0x23,
-  0x60, 0x12, 0xA0, 0x4C, 0x20, 0x31, 0x40, 0x20, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xE1, 0x28, 0x20, 0x20, 0x42, 0x41, 0x6B, 0xBE, 0x67, 0xBF, 0x80, 0x96, 0x60, 0x8E, 0x04, 0xAF,
-  0x06, 0xB7, 0xE1, 0x85, 0x00, 0x65, 0x20, 0x6D, 0x04, 0x96, 0xE7, 0xBE, 0x69, 0xD7, 0x26, 0xBF,
-  0x80, 0x96, 0xA0, 0x9E, 0x60, 0x8E, 0xE0, 0x54, 0x20, 0x31, 0x61, 0x28, 0x80, 0x20, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x28, 0x61, 0x28, 0x41, 0x28, 0xC0, 0x31,
-  0x20, 0x4C, 0x20, 0x55, 0x40, 0x55, 0x00, 0x4D, 0xC0, 0x4C, 0xC0, 0x4C, 0xC0, 0x4C, 0xC0, 0x4C,
-  0xC0, 0x4C, 0xC0, 0x4C, 0xC0, 0x4C, 0xA0, 0x44, 0xA0, 0x44, 0xA0, 0x44, 0xC0, 0x44, 0x40, 0x3C,
-  0x40, 0x0A, 0x20, 0x2B, 0xE0, 0x30, 0x40, 0x20, 0x40, 0x10, 0x00, 0x00, 0x00, 0x50, 0x22, 0x21,
-  0x40, 0x20, 0x02, 0x39, 0xE7, 0x9D, 0xA2, 0x96, 0x60, 0x96, 0xE0, 0xA6, 0xA0, 0x9E, 0x00, 0x65,
-  0x20, 0x44, 0xE3, 0x74, 0x87, 0xB6, 0x89, 0xD7, 0xA9, 0xDF, 0x66, 0xC7, 0xC2, 0xA6, 0x80, 0x96,
-  0xA0, 0x9E, 0x80, 0x96, 0x60, 0x65, 0x41, 0x31, 0x21, 0x28, 0xC0, 0x20, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20, 0x80, 0x28, 0x41, 0x28,
-  0x61, 0x28, 0xA0, 0x31, 0x60, 0x43, 0xA0, 0x4C, 0x20, 0x4D, 0x20, 0x4D, 0x20, 0x4D, 0x00, 0x4D,
-  0x00, 0x4D, 0xE0, 0x4C, 0xE0, 0x4C, 0xE0, 0x4C, 0x00, 0x4D, 0x00, 0x45, 0x00, 0x45, 0xE0, 0x33,
-  0xA0, 0x12, 0x00, 0x1A, 0x60, 0x28, 0x60, 0x20, 0x00, 0x20, 0x00, 0xF8, 0x00, 0x00, 0x60, 0x20,
-  0x41, 0x28, 0xC3, 0x7C, 0x60, 0x5D, 0x60, 0x65, 0x80, 0x96, 0xE0, 0x64, 0x40, 0x2B, 0x41, 0x54,
-  0x65, 0xA6, 0x86, 0xCF, 0x44, 0xBF, 0xE2, 0xAE, 0x80, 0x9E, 0x80, 0x96, 0x80, 0x96, 0xA0, 0x9E,
-  0xA0, 0x9E, 0xE0, 0x6D, 0xA0, 0x3A, 0x21, 0x28, 0xA0, 0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x28,
-  0x81, 0x28, 0x21, 0x28, 0x41, 0x30, 0xC1, 0x30, 0xA0, 0x31, 0x80, 0x3A, 0x40, 0x43, 0xE0, 0x43,
-  0x20, 0x44, 0x40, 0x44, 0x40, 0x44, 0x00, 0x44, 0xA0, 0x43, 0xE0, 0x3A, 0xC0, 0x31, 0xA0, 0x20,
-  0x60, 0x12, 0x40, 0x12, 0x40, 0x20, 0x60, 0x20, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x18, 0x20, 0x20,
-  0x61, 0x52, 0x80, 0x65, 0x20, 0x55, 0xE0, 0x54, 0xE0, 0x1A, 0x40, 0x33, 0x60, 0x7D, 0xA0, 0x9E,
-  0xC0, 0x9E, 0x60, 0x96, 0x80, 0x96, 0x80, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xC0, 0x9E,
-  0xE0, 0x75, 0x60, 0x4C, 0x81, 0x30, 0x81, 0x28, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xC0, 0x20, 0xA1, 0x28, 0x61, 0x28, 0x20, 0x28, 0x21, 0x28, 0x21, 0x28, 0x41, 0x28,
-  0x81, 0x30, 0x81, 0x30, 0x81, 0x30, 0x61, 0x28, 0x41, 0x28, 0x20, 0x20, 0x20, 0x20, 0x40, 0x28,
-  0x60, 0x19, 0x20, 0x1B, 0xC0, 0x42, 0x40, 0x20, 0x60, 0x18, 0x00, 0x00, 0x60, 0x20, 0x61, 0x28,
-  0x40, 0x54, 0x60, 0x55, 0x40, 0x44, 0x60, 0x12, 0xC0, 0x43, 0xA0, 0x7D, 0x60, 0x65, 0x60, 0x96,
-  0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xC0, 0x9E, 0xA0, 0x9E, 0xA0, 0x6D,
-  0x40, 0x55, 0xA0, 0x39, 0x41, 0x28, 0xC1, 0x20, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x11, 0xE0, 0x20, 0xA0, 0x28, 0x81, 0x28,
-  0x81, 0x28, 0x60, 0x28, 0x60, 0x28, 0x81, 0x28, 0xA0, 0x28, 0xC1, 0x20, 0xE0, 0x07, 0x60, 0x20,
-  0x80, 0x28, 0xE0, 0x33, 0xA0, 0x8E, 0x80, 0x39, 0x00, 0x18, 0x00, 0x00, 0x20, 0x20, 0x20, 0x31,
-  0x40, 0x55, 0xE0, 0x3B, 0x20, 0x0A, 0xA0, 0x33, 0x20, 0x5D, 0x80, 0x3C, 0x80, 0x6D, 0xE0, 0xAE,
-  0xA0, 0x9E, 0xA0, 0x9E, 0xA0, 0x9E, 0xC0, 0xA6, 0xC0, 0xA6, 0x40, 0x8E, 0x60, 0x65, 0x60, 0x55,
-  0x80, 0x3A, 0x41, 0x28, 0x80, 0x28, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x18,
-  0x20, 0x28, 0xA0, 0x32, 0x40, 0x7E, 0x40, 0x74, 0x00, 0x18, 0xE0, 0x18, 0x00, 0x20, 0x60, 0x3A,
-  0x40, 0x3C, 0x00, 0x0A, 0x80, 0x2B, 0xE0, 0x4C, 0xA0, 0x44, 0xA0, 0x44, 0xE0, 0x4C, 0x00, 0x86,
-  0x80, 0x96, 0x80, 0x96, 0x60, 0x96, 0x00, 0x86, 0x60, 0x65, 0x40, 0x55, 0x20, 0x55, 0x60, 0x3A,
-  0x41, 0x30, 0x81, 0x28, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
-  0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x11,
-  0x20, 0x20, 0x40, 0x29, 0x40, 0x5D, 0x40, 0x96, 0xE0, 0x28, 0x20, 0x18, 0x20, 0x20, 0x00, 0x2A,
-  0xA0, 0x12, 0x60, 0x23, 0x20, 0x4D, 0xC0, 0x44, 0xC0, 0x44, 0xA0, 0x44, 0xA0, 0x44, 0xA0, 0x44,
-  0xE0, 0x4C, 0x00, 0x55, 0x20, 0x55, 0x20, 0x4D, 0x20, 0x4D, 0xC0, 0x4B, 0x40, 0x31, 0x41, 0x30,
-  0x81, 0x28, 0xA0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
-  0x60, 0x20, 0x80, 0x28, 0x20, 0x44, 0xA0, 0x8E, 0x40, 0x5B, 0x00, 0x18, 0xA0, 0x20, 0x40, 0x23,
-  0xC0, 0x19, 0x60, 0x29, 0x00, 0x3B, 0x00, 0x44, 0xA0, 0x44, 0xE0, 0x4C, 0xE0, 0x4C, 0x00, 0x4D,
-  0xE0, 0x4C, 0xA0, 0x4C, 0x00, 0x44, 0xE0, 0x42, 0x60, 0x39, 0x41, 0x30, 0x41, 0x28, 0xA1, 0x28,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00,
-  0x80, 0x20, 0x20, 0x28, 0x20, 0x3B, 0x00, 0x6E, 0x80, 0x85, 0x00, 0x18, 0xE0, 0x32, 0x60, 0x44,
-  0x40, 0x28, 0x20, 0x20, 0x00, 0x20, 0x60, 0x28, 0xC0, 0x28, 0x20, 0x31, 0x60, 0x31, 0x60, 0x31,
-  0x40, 0x31, 0xC0, 0x30, 0x61, 0x30, 0x21, 0x28, 0x41, 0x28, 0x80, 0x28, 0xA0, 0x20, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xE0, 0x18, 0x20, 0x20, 0x20, 0x3A, 0x40, 0x55, 0x60, 0x8E, 0xE0, 0x39, 0xC0, 0x44, 0x40, 0x3A,
-  0x00, 0x20, 0xE0, 0x18, 0x40, 0x29, 0x60, 0x28, 0x20, 0x20, 0x00, 0x28, 0x00, 0x20, 0x00, 0x20,
-  0x21, 0x28, 0x41, 0x28, 0x80, 0x28, 0xE0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xE0, 0x01, 0x20, 0x20, 0x40, 0x31, 0xE0, 0x4C, 0x20, 0x86, 0x40, 0x6D, 0xA0, 0x44, 0xC0, 0x28,
-  0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-  0x00, 0x00, 0x40, 0x20, 0xC0, 0x30, 0xA0, 0x4C, 0xC0, 0x75, 0x80, 0x8E, 0xC0, 0x43, 0x40, 0x28,
-  0x60, 0x20, 0x00, 0x00, 0x00, 0x28, 0x00, 0x50, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,
-  0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
-  0x00, 0x00, 0x60, 0x20, 0x40, 0x28, 0x20, 0x44, 0x60, 0x5D, 0xA0, 0x96, 0x00, 0x3B, 0x00, 0x20,
-  0xC0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x38, 0x00, 0x38,
-  0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x40, 0x10, 0x20, 0x28, 0x80, 0x43, 0x40, 0x55, 0xA0, 0x96, 0x80, 0x42, 0x00, 0x18,
-  0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x63, 0x00, 0x10,
-  0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x00, 0x10, 0x20, 0x18, 0x40, 0x18, 0x60, 0x28,
-  0x80, 0x30, 0xC0, 0x30, 0x00, 0x20, 0xE0, 0x42, 0x00, 0x4D, 0x60, 0x86, 0x60, 0x42, 0x00, 0x20,
-  0xC0, 0x38, 0x80, 0x30, 0x60, 0x28, 0x40, 0x20, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x08,
-  0x00, 0x08, 0x00, 0x08, 0x41, 0x18, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x6A, 0x40, 0x18, 0x00, 0x10, 0x00, 0x10, 0x20, 0x18, 0x80, 0x30,
-  0x21, 0x49, 0x81, 0x61, 0x01, 0x7A, 0x81, 0x92, 0xE1, 0xAA, 0x21, 0xC3, 0x21, 0xCB, 0x21, 0xC3,
-  0x21, 0xB3, 0x81, 0x92, 0x00, 0x20, 0x60, 0x3A, 0xE0, 0x44, 0x00, 0x7E, 0x80, 0x4A, 0x20, 0x28,
-  0x01, 0xB3, 0x01, 0xBB, 0x21, 0xC3, 0x21, 0xCB, 0x01, 0xBB, 0xC1, 0xAA, 0x61, 0x8A, 0xE1, 0x71,
-  0x81, 0x59, 0xE1, 0x40, 0x60, 0x28, 0x20, 0x18, 0x00, 0x10, 0x00, 0x10, 0x40, 0x20, 0xE0, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x80, 0x28, 0x20, 0x20, 0x00, 0x18, 0x80, 0x28, 0x81, 0x61, 0x81, 0x92, 0x22, 0xB3, 0x62, 0xCB,
-  0x61, 0xDB, 0x01, 0xE3, 0xC1, 0xE2, 0x60, 0xD2, 0xC0, 0xB1, 0x60, 0x89, 0x00, 0x61, 0xA0, 0x38,
-  0x40, 0x20, 0x40, 0x20, 0x00, 0x20, 0x00, 0x32, 0x40, 0x34, 0x20, 0x55, 0xE0, 0x4A, 0x00, 0x20,
-  0x60, 0x28, 0x60, 0x28, 0xA0, 0x38, 0xE0, 0x58, 0x80, 0x89, 0xE0, 0xB9, 0x60, 0xDA, 0xA1, 0xE2,
-  0x01, 0xDB, 0x21, 0xD3, 0x41, 0xC3, 0xE1, 0xAA, 0x61, 0x82, 0x61, 0x51, 0x60, 0x28, 0x00, 0x18,
-  0x40, 0x20, 0xC1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x28,
-  0x20, 0x20, 0xE1, 0x40, 0xA1, 0x9A, 0xE2, 0xDB, 0xA2, 0xE3, 0xA1, 0xD2, 0xE0, 0xC9, 0x60, 0xB9,
-  0x00, 0xA1, 0xC0, 0x88, 0x80, 0x60, 0x60, 0x38, 0xE1, 0x48, 0x02, 0x49, 0x61, 0x28, 0x61, 0x28,
-  0x62, 0x69, 0xE3, 0x81, 0xC1, 0x48, 0xE0, 0x20, 0x20, 0x2B, 0x00, 0x34, 0x40, 0x32, 0x00, 0x20,
-  0x80, 0x30, 0xA1, 0x38, 0xC1, 0x40, 0x81, 0x30, 0x20, 0x18, 0x20, 0x20, 0x60, 0x40, 0xC0, 0x70,
-  0xE0, 0x90, 0x20, 0xA9, 0x60, 0xB9, 0xE0, 0xC9, 0xA1, 0xD2, 0x81, 0xDB, 0xE2, 0xD3, 0x81, 0x8A,
-  0xC1, 0x38, 0x20, 0x20, 0x60, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x60, 0x28, 0x40, 0x28,
-  0xA1, 0x69, 0x42, 0xF4, 0xA2, 0xFC, 0x21, 0xBA, 0xC0, 0x98, 0x00, 0xA9, 0xE0, 0x80, 0xA0, 0x50,
-  0x80, 0x30, 0xA1, 0x30, 0xA1, 0x38, 0xC3, 0x71, 0x26, 0xC3, 0xA5, 0xAA, 0x02, 0x51, 0xC3, 0x81,
-  0x64, 0xA2, 0x64, 0xA2, 0xA4, 0xAA, 0x82, 0x71, 0x60, 0x28, 0x80, 0x20, 0x80, 0x28, 0xC1, 0x40,
-  0x42, 0x61, 0x42, 0x61, 0x22, 0x59, 0x22, 0x59, 0xE1, 0x48, 0xA1, 0x40, 0xA1, 0x38, 0x61, 0x28,
-  0x60, 0x28, 0x80, 0x38, 0xE0, 0x60, 0xE0, 0x80, 0x00, 0xA1, 0x00, 0xA9, 0x00, 0xBA, 0x62, 0xFC,
-  0x42, 0xEC, 0xA1, 0x69, 0x40, 0x28, 0x60, 0x20, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x81, 0x28, 0x40, 0x28,
-  0xA2, 0xD3, 0x82, 0xFC, 0x22, 0xFC, 0x00, 0xB2, 0xC0, 0x90, 0x80, 0x58, 0x40, 0x20, 0x60, 0x28,
-  0x81, 0x30, 0x42, 0x61, 0x42, 0x69, 0x42, 0x61, 0x42, 0x61, 0xE1, 0x48, 0x82, 0x71, 0x43, 0xA2,
-  0x03, 0x92, 0x82, 0x71, 0x82, 0x71, 0x43, 0x9A, 0x23, 0x92, 0xE1, 0x50, 0xE1, 0x50, 0x01, 0x51,
-  0xC3, 0x81, 0xE3, 0x89, 0x01, 0x51, 0x02, 0x51, 0x22, 0x59, 0x22, 0x59, 0x62, 0x71, 0x22, 0x61,
-  0x60, 0x28, 0xA1, 0x38, 0x42, 0x59, 0x61, 0x28, 0x40, 0x30, 0xA0, 0x78, 0x80, 0xA9, 0xE2, 0xF3,
-  0x82, 0xFC, 0x22, 0xEC, 0x80, 0x30, 0x60, 0x28, 0xE0, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x61, 0x28, 0x60, 0x28,
-  0x40, 0xB2, 0xC2, 0xFB, 0x62, 0xFC, 0xA3, 0xFC, 0xA2, 0xCB, 0xE1, 0x69, 0xC0, 0x38, 0x40, 0x20,
-  0x00, 0x18, 0x40, 0x28, 0x81, 0x38, 0x81, 0x38, 0xC1, 0x48, 0x02, 0x51, 0x22, 0x59, 0x62, 0x69,
-  0xA2, 0x79, 0x82, 0x71, 0x02, 0x51, 0x22, 0x59, 0xA2, 0x79, 0xA2, 0x79, 0x22, 0x59, 0x22, 0x59,
-  0x22, 0x59, 0x22, 0x59, 0x22, 0x59, 0x02, 0x59, 0xC1, 0x40, 0x60, 0x28, 0x61, 0x28, 0x41, 0x28,
-  0x20, 0x20, 0x20, 0x18, 0x20, 0x18, 0x80, 0x30, 0x40, 0x51, 0xE1, 0xA2, 0x83, 0xFC, 0xA3, 0xFC,
-  0x22, 0xFC, 0x21, 0xE3, 0xA0, 0x38, 0x60, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x60, 0x28, 0x41, 0x20,
-  0xC0, 0x99, 0x80, 0xEA, 0x00, 0xC2, 0x22, 0xDB, 0x63, 0xFC, 0x24, 0xFD, 0xE4, 0xF4, 0x23, 0xCC,
-  0x23, 0x9B, 0x22, 0x72, 0x81, 0x51, 0xE1, 0x38, 0xA0, 0x30, 0x60, 0x28, 0x40, 0x28, 0x40, 0x28,
-  0x40, 0x28, 0x41, 0x30, 0x61, 0x30, 0x61, 0x30, 0x40, 0x28, 0x40, 0x30, 0x61, 0x30, 0x41, 0x30,
-  0x41, 0x30, 0x40, 0x28, 0x40, 0x28, 0x20, 0x20, 0x20, 0x20, 0x60, 0x28, 0xC0, 0x38, 0x40, 0x49,
-  0xE1, 0x69, 0xC2, 0x92, 0xC3, 0xBB, 0xC5, 0xE4, 0x87, 0xFD, 0xA7, 0xFD, 0xE6, 0xFC, 0xC2, 0xD2,
-  0x60, 0xE2, 0xC0, 0xD2, 0x80, 0x28, 0x60, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x60, 0x28, 0x40, 0x20,
-  0x80, 0x79, 0xC0, 0xF2, 0x40, 0xB1, 0x20, 0xB1, 0xC0, 0xC9, 0xE1, 0xE2, 0x82, 0xF3, 0x64, 0xFC,
-  0xE4, 0xFC, 0x86, 0xFD, 0xC7, 0xFD, 0x67, 0xF5, 0x06, 0xE5, 0x85, 0xCC, 0x25, 0xBC, 0xC4, 0xAB,
-  0x84, 0x9B, 0x03, 0x93, 0xE3, 0x8A, 0xE3, 0x8A, 0xC3, 0x82, 0xC3, 0x82, 0xC3, 0x82, 0xE3, 0x8A,
-  0xE3, 0x8A, 0x23, 0x9B, 0x84, 0xAB, 0xE4, 0xBB, 0x85, 0xD4, 0x07, 0xE5, 0x88, 0xF5, 0xEA, 0xFD,
-  0x2B, 0xFE, 0x4C, 0xFE, 0xC9, 0xFD, 0x28, 0xFD, 0x05, 0xF4, 0x42, 0xEB, 0xA0, 0xEA, 0x60, 0xB9,
-  0x60, 0xE2, 0x80, 0xC2, 0x60, 0x28, 0x60, 0x28, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x20, 0x40, 0x20,
-  0x20, 0x59, 0xE0, 0xF2, 0xA0, 0xB9, 0x60, 0xB9, 0xA0, 0xC1, 0x60, 0xE2, 0x40, 0xE2, 0x40, 0xDA,
-  0x20, 0xDA, 0xE1, 0xEA, 0xE2, 0xFB, 0x03, 0xFC, 0x64, 0xFC, 0xA4, 0xFC, 0xE5, 0xFC, 0x25, 0xFD,
-  0x46, 0xFD, 0x66, 0xFD, 0x86, 0xFD, 0x86, 0xFD, 0xA7, 0xFD, 0xA7, 0xFD, 0xA7, 0xFD, 0x86, 0xFD,
-  0x0A, 0xFE, 0x6D, 0xFE, 0x2C, 0xFE, 0x4C, 0xFE, 0x2C, 0xFE, 0x0C, 0xFE, 0xCB, 0xFD, 0x69, 0xFD,
-  0x48, 0xFD, 0xC6, 0xFC, 0x61, 0xFB, 0xE0, 0xF2, 0x60, 0xEA, 0xA0, 0xEA, 0xC0, 0xEA, 0xA0, 0xB9,
-  0xA0, 0xEA, 0x40, 0xAA, 0x40, 0x20, 0x80, 0x28, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x40, 0x20,
-  0xA0, 0x38, 0xC0, 0xE2, 0x00, 0xD2, 0x60, 0xB1, 0x80, 0xB9, 0x60, 0xE2, 0x80, 0xE2, 0x80, 0xE2,
-  0x60, 0xE2, 0xA0, 0xE2, 0x60, 0xFB, 0x40, 0xFB, 0x40, 0xFB, 0x40, 0xFB, 0x40, 0xFB, 0x40, 0xFB,
-  0x40, 0xFB, 0x60, 0xFB, 0x61, 0xFB, 0x61, 0xFB, 0x61, 0xFB, 0x81, 0xFB, 0x81, 0xFB, 0x61, 0xFB,
-  0x82, 0xFB, 0xA2, 0xFB, 0x61, 0xFB, 0x64, 0xFC, 0xA4, 0xFC, 0x84, 0xFC, 0x84, 0xFC, 0x84, 0xFC,
-  0xC4, 0xFC, 0x23, 0xFC, 0x80, 0xFB, 0x21, 0xF3, 0xC0, 0xEA, 0xE0, 0xEA, 0xA0, 0xE2, 0x80, 0xC1,
-  0xE0, 0xFA, 0xC0, 0x89, 0x41, 0x20, 0x60, 0x28, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x20,
-  0x61, 0x28, 0x00, 0x59, 0xC0, 0xA9, 0x80, 0xB9, 0x80, 0xC1, 0x60, 0xE2, 0x80, 0xE2, 0x60, 0xDA,
-  0x60, 0xDA, 0x60, 0xE2, 0x61, 0xFB, 0x81, 0xFB, 0x81, 0xFB, 0x81, 0xFB, 0x81, 0xFB, 0x81, 0xFB,
-  0x81, 0xFB, 0x81, 0xFB, 0x81, 0xFB, 0x81, 0xFB, 0x60, 0xFB, 0x60, 0xFB, 0x60, 0xFB, 0x60, 0xFB,
-  0x60, 0xFB, 0x60, 0xFB, 0x60, 0xFB, 0x64, 0xFC, 0xC5, 0xFC, 0xA5, 0xFC, 0xC5, 0xFC, 0xE5, 0xFC,
-  0xA5, 0xFC, 0x81, 0xFB, 0x81, 0xFB, 0x00, 0xF3, 0xC0, 0xF2, 0x20, 0xFB, 0xC0, 0xEA, 0x80, 0xB9,
-  0xA0, 0x81, 0x80, 0x30, 0x60, 0x20, 0x81, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x61, 0x20, 0x40, 0x20, 0x40, 0x28, 0xA0, 0x40, 0xE0, 0x70, 0xE0, 0xB9, 0xA0, 0xE2, 0xA0, 0xEA,
-  0xA0, 0xEA, 0x60, 0xEA, 0x61, 0xFB, 0x81, 0xFB, 0x61, 0xFB, 0x61, 0xFB, 0x61, 0xFB, 0x61, 0xFB,
-  0x61, 0xFB, 0x61, 0xFB, 0x61, 0xFB, 0x61, 0xFB, 0x61, 0xFB, 0x61, 0xFB, 0x61, 0xFB, 0x61, 0xFB,
-  0x61, 0xFB, 0x81, 0xFB, 0x40, 0xFB, 0x03, 0xFC, 0xC5, 0xFC, 0xC5, 0xFC, 0xC5, 0xFC, 0x84, 0xFC,
-  0xC1, 0xFB, 0xA1, 0xFB, 0xE1, 0xFB, 0x00, 0xF3, 0xA0, 0xD2, 0x20, 0xAA, 0x20, 0x61, 0x60, 0x30,
-  0x40, 0x20, 0x60, 0x20, 0x60, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-  0x00, 0x00, 0x60, 0x20, 0x60, 0x30, 0x80, 0x38, 0x40, 0x20, 0x40, 0x18, 0xA0, 0x38, 0x20, 0x69,
-  0xA0, 0x91, 0x00, 0xBA, 0xE0, 0xDA, 0xA1, 0xFB, 0xA1, 0xFB, 0xC1, 0xFB, 0xC1, 0xFB, 0xC1, 0xFB,
-  0xC1, 0xFB, 0xA1, 0xFB, 0xA1, 0xFB, 0xA1, 0xFB, 0xA1, 0xFB, 0xA1, 0xFB, 0xA1, 0xFB, 0xA1, 0xFB,
-  0xC1, 0xFB, 0xC1, 0xFB, 0xC1, 0xFB, 0xC1, 0xFB, 0x43, 0xFC, 0x22, 0xFC, 0xA2, 0xF3, 0x21, 0xDB,
-  0xC1, 0xC2, 0x41, 0x9A, 0x80, 0x69, 0xE0, 0x40, 0x60, 0x20, 0x20, 0x18, 0x80, 0x30, 0x60, 0x28,
-  0x60, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x50, 0x60, 0x20, 0x40, 0x20, 0xA0, 0x89, 0x20, 0xCA, 0xE0, 0x78, 0xA0, 0x50, 0x60, 0x30,
-  0x40, 0x18, 0x40, 0x18, 0x60, 0x28, 0xC0, 0x38, 0x20, 0x51, 0x80, 0x69, 0xE0, 0x81, 0x41, 0x9A,
-  0x61, 0xAA, 0xA1, 0xB2, 0xA1, 0xBA, 0xC1, 0xC2, 0xE1, 0xC2, 0xC1, 0xC2, 0xC1, 0xBA, 0x81, 0xB2,
-  0x61, 0xAA, 0x41, 0x9A, 0x01, 0x8A, 0xA0, 0x71, 0x40, 0x59, 0xE0, 0x40, 0xA0, 0x30, 0x60, 0x20,
-  0x20, 0x18, 0x20, 0x18, 0x40, 0x30, 0xA0, 0x50, 0xE0, 0x78, 0x20, 0xC2, 0x40, 0xBA, 0x60, 0x28,
-  0x60, 0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xA1, 0x28, 0x40, 0x20, 0x00, 0x59, 0xC0, 0xF2, 0xA0, 0xC9, 0x80, 0xC1, 0x80, 0xB9,
-  0x60, 0xA9, 0x20, 0x89, 0xE0, 0x70, 0xA0, 0x50, 0x60, 0x40, 0x40, 0x30, 0x20, 0x20, 0x20, 0x18,
-  0x20, 0x18, 0x20, 0x18, 0x20, 0x18, 0x20, 0x18, 0x20, 0x18, 0x20, 0x18, 0x20, 0x10, 0x20, 0x18,
-  0x20, 0x18, 0x20, 0x18, 0x20, 0x20, 0x40, 0x28, 0x60, 0x38, 0xA0, 0x50, 0xE0, 0x68, 0x20, 0x81,
-  0xA0, 0xA1, 0x00, 0xC2, 0xE0, 0xC9, 0xA0, 0xC9, 0xA0, 0xC1, 0xE0, 0xFA, 0xA0, 0x89, 0x41, 0x20,
-  0x80, 0x28, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x20, 0x81, 0x30, 0x80, 0xD2, 0xE0, 0xD1, 0x60, 0xB1, 0x80, 0xB9,
-  0x80, 0xC1, 0x00, 0xDA, 0x80, 0xEA, 0xA0, 0xEA, 0x80, 0xE2, 0x60, 0xDA, 0x20, 0xD2, 0x00, 0xC2,
-  0xE0, 0xB9, 0xC0, 0xB1, 0xA0, 0xA9, 0xA0, 0xA1, 0xA0, 0xA1, 0xA0, 0xA1, 0xC0, 0xA9, 0xE0, 0xB1,
-  0x00, 0xBA, 0x20, 0xC2, 0x40, 0xD2, 0x80, 0xDA, 0xA0, 0xEA, 0xA0, 0xEA, 0x21, 0xF3, 0xC3, 0xFB,
-  0x21, 0xFB, 0x00, 0xFB, 0xE0, 0xC9, 0x60, 0xB9, 0xC0, 0xC1, 0xE0, 0xF2, 0xE0, 0x50, 0x40, 0x20,
-  0xA1, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x38, 0x00, 0x00, 0x61, 0x20, 0x41, 0x20, 0x00, 0xAA, 0x60, 0xEA, 0x60, 0xB1, 0x80, 0xB9,
-  0x60, 0xB9, 0x40, 0xDA, 0xE0, 0xF2, 0xE0, 0xEA, 0x20, 0xF3, 0x40, 0xFB, 0x40, 0xFB, 0x60, 0xFB,
-  0x81, 0xFB, 0x81, 0xFB, 0x81, 0xFB, 0x61, 0xFB, 0x61, 0xFB, 0x61, 0xFB, 0x61, 0xFB, 0x61, 0xFB,
-  0x61, 0xFB, 0x81, 0xFB, 0x81, 0xFB, 0x81, 0xFB, 0xA1, 0xFB, 0x20, 0xF3, 0xE3, 0xFB, 0x03, 0xFC,
-  0x01, 0xF3, 0xC0, 0xEA, 0xA0, 0xC1, 0x60, 0xB9, 0x20, 0xDA, 0xA0, 0xDA, 0x80, 0x30, 0x61, 0x20,
-  0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x81, 0x20, 0x40, 0x18, 0x40, 0x71, 0xC0, 0xF2, 0x80, 0xB9, 0x80, 0xB9,
-  0x60, 0xB9, 0x00, 0xD2, 0xC0, 0xEA, 0xA0, 0xEA, 0xE0, 0xF2, 0x41, 0xFB, 0x64, 0xFC, 0x03, 0xFC,
-  0x61, 0xFB, 0x81, 0xFB, 0x81, 0xFB, 0x81, 0xFB, 0x81, 0xFB, 0x81, 0xFB, 0x81, 0xFB, 0x81, 0xFB,
-  0x81, 0xFB, 0x81, 0xFB, 0x81, 0xFB, 0x61, 0xFB, 0x81, 0xFB, 0x20, 0xF3, 0xE0, 0xF2, 0xE0, 0xF2,
-  0xE0, 0xF2, 0x80, 0xE2, 0x80, 0xB9, 0x80, 0xB9, 0xA0, 0xF2, 0x00, 0xA2, 0x41, 0x20, 0x60, 0x28,
-  0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x21, 0x40, 0x20, 0xC0, 0x40, 0xC0, 0xE2, 0xE0, 0xC9, 0x60, 0xB9,
-  0x80, 0xB9, 0xA0, 0xC1, 0xC0, 0xEA, 0xA0, 0xEA, 0xC0, 0xEA, 0x20, 0xFB, 0xA5, 0xFC, 0xE6, 0xFC,
-  0x81, 0xFB, 0x61, 0xFB, 0x81, 0xFB, 0x81, 0xFB, 0x81, 0xFB, 0x81, 0xFB, 0x81, 0xFB, 0x81, 0xFB,
-  0x81, 0xFB, 0x81, 0xFB, 0x81, 0xFB, 0x81, 0xFB, 0x81, 0xFB, 0xE0, 0xF2, 0xC0, 0xEA, 0xE0, 0xEA,
-  0xE0, 0xF2, 0x20, 0xD2, 0x80, 0xB9, 0xA0, 0xC1, 0xE0, 0xF2, 0x40, 0x69, 0x41, 0x20, 0xA1, 0x28,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x61, 0x28, 0x61, 0x28, 0x40, 0xC2, 0x60, 0xE2, 0x60, 0xB1,
-  0x80, 0xB9, 0x80, 0xB9, 0x80, 0xE2, 0xC0, 0xEA, 0xA0, 0xEA, 0xC0, 0xF2, 0xC2, 0xFB, 0xA5, 0xFC,
-  0x81, 0xFB, 0x61, 0xFB, 0x81, 0xFB, 0x81, 0xFB, 0x81, 0xFB, 0x81, 0xFB, 0x81, 0xFB, 0x61, 0xFB,
-  0x61, 0xFB, 0x81, 0xFB, 0x61, 0xFB, 0x81, 0xFB, 0x41, 0xFB, 0xC0, 0xEA, 0xE0, 0xEA, 0xE0, 0xEA,
-  0xE0, 0xEA, 0xC0, 0xC1, 0x60, 0xB9, 0x00, 0xD2, 0xC0, 0xE2, 0xA0, 0x38, 0x61, 0x20, 0x45, 0x51,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x7B,
-  0xF7, 0xBD, 0x6D, 0x6B, 0x00, 0x00, 0x00, 0x10, 0x40, 0x18, 0x80, 0x89, 0xC0, 0xF2, 0x80, 0xB9,
-  0x80, 0xB9, 0x60, 0xB9, 0x40, 0xDA, 0xC0, 0xEA, 0xA0, 0xEA, 0xA0, 0xEA, 0x21, 0xFB, 0x81, 0xFB,
-  0x61, 0xFB, 0x61, 0xFB, 0x61, 0xFB, 0x61, 0xFB, 0x61, 0xFB, 0x61, 0xFB, 0x61, 0xFB, 0x61, 0xFB,
-  0x61, 0xFB, 0x61, 0xFB, 0x61, 0xFB, 0x81, 0xFB, 0xE0, 0xF2, 0xC0, 0xEA, 0xC0, 0xEA, 0xE0, 0xF2,
-  0x80, 0xE2, 0x80, 0xB9, 0x80, 0xB9, 0x80, 0xEA, 0x40, 0xBA, 0x61, 0x28, 0x20, 0x20, 0x00, 0x00,
-  0x26, 0x9B, 0xF7, 0xFD, 0x55, 0xFD, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x7B, 0x55, 0xFD, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x9C, 0x61, 0x20, 0xC0, 0x50, 0xC0, 0xEA, 0xE0, 0xC9,
-  0x60, 0xB9, 0x60, 0xB9, 0xE0, 0xC9, 0xC0, 0xEA, 0xA0, 0xEA, 0xA0, 0xEA, 0xC0, 0xEA, 0x41, 0xFB,
-  0x61, 0xFB, 0x61, 0xFB, 0x61, 0xFB, 0x61, 0xFB, 0x61, 0xFB, 0x61, 0xFB, 0x61, 0xFB, 0x61, 0xFB,
-  0x61, 0xFB, 0x81, 0xFB, 0x81, 0xFB, 0x00, 0xF3, 0xC0, 0xEA, 0xC0, 0xEA, 0xC0, 0xEA, 0xE0, 0xF2,
-  0x20, 0xD2, 0x60, 0xB9, 0x80, 0xB9, 0xC0, 0xF2, 0x80, 0x81, 0x40, 0x20, 0x27, 0x5A, 0x3C, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x99, 0xE6,
-  0xD9, 0xE6, 0xB9, 0xE6, 0x98, 0xE6, 0x1A, 0xEF, 0x89, 0x62, 0x00, 0x20, 0x60, 0xCA, 0x60, 0xE2,
-  0x60, 0xB1, 0x80, 0xB9, 0x80, 0xB9, 0xA0, 0xE2, 0xA0, 0xEA, 0xA0, 0xEA, 0xA0, 0xEA, 0xC0, 0xEA,
-  0x21, 0xFB, 0x61, 0xFB, 0x61, 0xFB, 0x61, 0xFB, 0x61, 0xFB, 0x61, 0xFB, 0x61, 0xFB, 0x81, 0xFB,
-  0x81, 0xFB, 0x61, 0xFB, 0x00, 0xF3, 0xA0, 0xEA, 0xC0, 0xEA, 0xC0, 0xEA, 0xC0, 0xEA, 0xC0, 0xEA,
-  0xC0, 0xC1, 0x60, 0xB9, 0xE0, 0xC9, 0xE0, 0xEA, 0xA0, 0x40, 0xE3, 0x30, 0x57, 0xDE, 0xB9, 0xE6,
-  0xB9, 0xE6, 0xB9, 0xE6, 0xB9, 0xE6, 0x55, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x77, 0xDE, 0xD9, 0xE6, 0xD9, 0xE6,
-  0x1A, 0xEF, 0x1A, 0xEF, 0xD9, 0xEE, 0x9C, 0xFF, 0xB1, 0xA4, 0x00, 0x10, 0x00, 0x71, 0xE0, 0xD9,
-  0x20, 0xA9, 0x40, 0xB1, 0x60, 0xB9, 0x40, 0xDA, 0xC0, 0xEA, 0xA0, 0xEA, 0xA0, 0xEA, 0xA0, 0xEA,
-  0xA0, 0xEA, 0xE0, 0xEA, 0x20, 0xF3, 0x41, 0xFB, 0x61, 0xFB, 0x61, 0xFB, 0x41, 0xFB, 0x41, 0xF3,
-  0x00, 0xF3, 0xC0, 0xEA, 0xA0, 0xEA, 0xC0, 0xEA, 0xC0, 0xEA, 0xC0, 0xEA, 0xC0, 0xEA, 0x80, 0xE2,
-  0x80, 0xB9, 0x60, 0xB1, 0xE0, 0xD9, 0xA0, 0xA1, 0x00, 0x18, 0x68, 0x62, 0x5B, 0xF7, 0x1A, 0xEF,
-  0xFA, 0xEE, 0x3A, 0xF7, 0xF9, 0xEE, 0xD9, 0xE6, 0xB8, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xEF, 0x7B, 0xFF, 0xFF, 0x98, 0xDE, 0xB9, 0xE6, 0x3A, 0xF7, 0xB9, 0xE6,
-  0xB9, 0xE6, 0xB9, 0xE6, 0x98, 0xDE, 0xEE, 0x93, 0xA5, 0x59, 0x81, 0x30, 0x40, 0x28, 0xE0, 0x78,
-  0x20, 0xA9, 0xE0, 0xA0, 0xE0, 0xA0, 0x80, 0xB9, 0x60, 0xDA, 0x80, 0xE2, 0xA0, 0xE2, 0xA0, 0xEA,
-  0xC0, 0xEA, 0xA0, 0xEA, 0xA0, 0xEA, 0xC0, 0xEA, 0xC0, 0xEA, 0xC0, 0xEA, 0xA0, 0xEA, 0xA0, 0xEA,
-  0xA0, 0xEA, 0xA0, 0xEA, 0xC0, 0xEA, 0xC0, 0xEA, 0xA0, 0xEA, 0x80, 0xE2, 0x60, 0xE2, 0xA0, 0xC9,
-  0x20, 0xB1, 0x20, 0xA9, 0x20, 0x91, 0x60, 0x38, 0x60, 0x20, 0xE2, 0x40, 0x68, 0x6A, 0x53, 0xBD,
-  0xD9, 0xE6, 0x98, 0xDE, 0xB8, 0xE6, 0xD9, 0xE6, 0x5B, 0xF7, 0xB8, 0xE6, 0x00, 0x00, 0xFF, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x98, 0xDE, 0xD9, 0xE6, 0xF9, 0xEE, 0xB9, 0xE6,
-  0xB8, 0xE6, 0xB9, 0xE6, 0x37, 0xD6, 0xE2, 0x40, 0x00, 0x30, 0x80, 0x38, 0x60, 0x28, 0x61, 0x20,
-  0x81, 0x38, 0xA0, 0x58, 0xC0, 0x78, 0xE0, 0x98, 0x80, 0xC1, 0xC0, 0xC9, 0xE0, 0xD1, 0x00, 0xDA,
-  0x40, 0xDA, 0x40, 0xE2, 0x60, 0xE2, 0x80, 0xE2, 0x80, 0xE2, 0x80, 0xE2, 0x80, 0xE2, 0x80, 0xE2,
-  0x60, 0xE2, 0x60, 0xE2, 0x40, 0xE2, 0x20, 0xDA, 0x00, 0xDA, 0xC0, 0xC9, 0xA0, 0xC1, 0x00, 0x91,
-  0xC0, 0x70, 0xA0, 0x48, 0x61, 0x28, 0x61, 0x28, 0x81, 0x30, 0x80, 0x40, 0x00, 0x20, 0x47, 0x62,
-  0xFA, 0xEE, 0x98, 0xDE, 0xB9, 0xDE, 0xB9, 0xE6, 0x5B, 0xF7, 0xB8, 0xE6, 0x00, 0x00, 0xEF, 0x7B,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x7B, 0x00, 0x00, 0x78, 0xDE, 0xF9, 0xEE, 0xFA, 0xEE,
-  0x1A, 0xF7, 0xD9, 0xE6, 0xD9, 0xE6, 0x37, 0xD6, 0x6C, 0x83, 0x64, 0x51, 0x80, 0x30, 0x00, 0x28,
-  0x00, 0x20, 0x00, 0x18, 0x20, 0x20, 0x40, 0x30, 0xA0, 0x48, 0x00, 0x69, 0x40, 0x89, 0x60, 0x99,
-  0xA0, 0xA9, 0xA0, 0xB1, 0xC0, 0xC1, 0xE0, 0xC1, 0xE0, 0xC9, 0xE0, 0xC9, 0xC0, 0xC1, 0xC0, 0xC1,
-  0xC0, 0xB9, 0xA0, 0xB1, 0x80, 0xA1, 0x60, 0x91, 0x20, 0x79, 0xE0, 0x58, 0x80, 0x38, 0x40, 0x28,
-  0x20, 0x18, 0x00, 0x18, 0x00, 0x20, 0x20, 0x28, 0xA1, 0x38, 0xA5, 0x59, 0xEE, 0x93, 0x78, 0xDE,
-  0xD9, 0xE6, 0xFA, 0xEE, 0x3A, 0xF7, 0xD9, 0xE6, 0xD9, 0xE6, 0x57, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xD9, 0xE6,
-  0xD9, 0xE6, 0xD9, 0xE6, 0xB9, 0xE6, 0x3B, 0xF7, 0x9C, 0xFF, 0x1A, 0xEF, 0xF6, 0xCD, 0x90, 0xA4,
-  0x4C, 0x83, 0x27, 0x62, 0x44, 0x49, 0xA1, 0x30, 0x20, 0x20, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10,
-  0x00, 0x18, 0x00, 0x20, 0x00, 0x28, 0x00, 0x30, 0x20, 0x30, 0x20, 0x30, 0x00, 0x30, 0x00, 0x28,
-  0x00, 0x20, 0x00, 0x18, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x20, 0x20, 0xA1, 0x30,
-  0x44, 0x41, 0x27, 0x62, 0x4C, 0x83, 0xB1, 0xAC, 0x37, 0xD6, 0x5B, 0xF7, 0x9C, 0xFF, 0xFA, 0xEE,
-  0xB9, 0xE6, 0xD9, 0xE6, 0xD9, 0xE6, 0xB9, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xAD, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xF7, 0xBD, 0xF9, 0xE6, 0x98, 0xE6, 0x78, 0xDE, 0xB9, 0xE6, 0x1A, 0xEF, 0x3A, 0xEF,
-  0x3A, 0xEF, 0x3A, 0xF7, 0x1A, 0xEF, 0x98, 0xE6, 0x16, 0xD6, 0x94, 0xC5, 0x12, 0xB5, 0x70, 0xA4,
-  0xEE, 0x93, 0xAD, 0x8B, 0x2B, 0x7B, 0x0B, 0x73, 0x0B, 0x73, 0xEA, 0x72, 0xEA, 0x72, 0x0B, 0x73,
-  0x2B, 0x7B, 0xAD, 0x8B, 0xEE, 0x93, 0x70, 0xA4, 0xF2, 0xB4, 0x74, 0xC5, 0x16, 0xD6, 0x98, 0xE6,
-  0xFA, 0xEE, 0x1A, 0xEF, 0x3B, 0xF7, 0x3A, 0xF7, 0xFA, 0xEE, 0xB8, 0xE6, 0x78, 0xDE, 0x98, 0xE6,
-  0xD9, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xAD, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xCD,
-  0x16, 0xD6, 0x57, 0xDE, 0xD9, 0xE6, 0x1A, 0xEF, 0x3B, 0xF7, 0x5B, 0xF7, 0x7B, 0xF7, 0x5B, 0xF7,
-  0x5B, 0xF7, 0x5B, 0xF7, 0x5B, 0xF7, 0x5B, 0xF7, 0x3B, 0xF7, 0x3B, 0xF7, 0x3B, 0xF7, 0x3B, 0xF7,
-  0x5B, 0xF7, 0x5B, 0xF7, 0x7B, 0xF7, 0x5B, 0xF7, 0x7B, 0xF7, 0x5B, 0xFF, 0x3B, 0xF7, 0xFA, 0xEE,
-  0xB8, 0xE6, 0x37, 0xD6, 0xB5, 0xCD, 0x26, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xEF, 0x7B, 0xF7, 0xBD, 0xEF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xBD, 0xF7, 0xFF, 0xF5, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xF7, 0xFD, 0xF7, 0xFF, 0xF5, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x05, 0x1A, 0x30, 0x40, 0x51, 0x59, 0x59,
-  0x59, 0x4C, 0x3E, 0x28, 0x12, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x03, 0x00, 0x00, 0x00, 0x18, 0x4D, 0x8A, 0xBA, 0xDE, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xCE, 0x9D, 0x60, 0x20, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0C, 0x5A, 0xB4, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFB, 0xFB, 0xFB,
-  0xFB, 0xFC, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xB5, 0x4F, 0x00, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0x5F, 0xDD, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xFC, 0xFD, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF,
-  0xFF, 0xFE, 0xFE, 0xFD, 0xFD, 0xFC, 0xFB, 0xFB, 0xFF, 0xFF, 0xFF, 0xC1, 0x3D, 0x00, 0x01, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x2A, 0xFF, 0xFF, 0xF9, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFF, 0xFE, 0xFB, 0xFB, 0xFF, 0xFE, 0x87, 0x01, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x06, 0x7A, 0xFD, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFC, 0xFF, 0xB4, 0x0C,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x47, 0xF1, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF9, 0xFF, 0xC0,
-  0x08, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x05, 0x00, 0x3D, 0xF6, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xF9, 0xFF,
-  0xA7, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x05, 0x00, 0x53, 0xFF, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFA,
-  0xFF, 0x65, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x05, 0x00, 0x8E, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-  0xFD, 0xEE, 0x18, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0xD3, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFA, 0xFF, 0x89, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
-  0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x35, 0xFC, 0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFD, 0xFE, 0xEB, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x7E, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFB, 0xFF, 0x5B, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x02, 0x2C,
-  0x5F, 0x88, 0xA4, 0xB1, 0xB6, 0xAB, 0x9B, 0x7F, 0x57, 0x2A, 0x05, 0x00, 0x00, 0x01, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x01, 0xBB, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFA, 0xFE, 0xA4, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x25, 0x85, 0xD3, 0xFE,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xD9, 0x95, 0x3F, 0x00, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x12, 0xD5, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFD, 0xFF, 0xD5, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0x0D, 0x8C, 0xF5, 0xFF, 0xFF, 0xFF,
-  0xFB, 0xFA, 0xFA, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xBC, 0x2F, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x1D, 0xD8, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xEE, 0x13, 0x00, 0x01, 0x03, 0x00, 0x2A, 0xD3, 0xFF, 0xFF, 0xFA, 0xFD, 0xFE,
-  0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xF9, 0xFF, 0xDB, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x19, 0xC2, 0xFF, 0xFD, 0xFC, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xF6, 0x1C, 0x00, 0x04, 0x00, 0x2A, 0xEA, 0xFF, 0xF9, 0xFE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xE6, 0x4C, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0x8F, 0xFF, 0xFF, 0xFC,
-  0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xF4, 0x18, 0x00, 0x03, 0x0D, 0xD9, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xF3, 0x30, 0x00, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x44, 0xC6, 0xFF,
-  0xFF, 0xFF, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF,
-  0xFF, 0xFD, 0xFF, 0xDB, 0x07, 0x01, 0x00, 0x94, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x6B, 0x00, 0x06, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x51,
-  0xB9, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFB, 0xFB, 0xFB, 0xFB, 0xFC, 0xFD, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFC, 0xFF, 0xC2, 0x00, 0x00, 0x28, 0xFB, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xCD, 0x02, 0x03, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x2A, 0x71, 0xB3, 0xE3, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xD5, 0xFC,
-  0xFF, 0xFE, 0xFD, 0xF9, 0x37, 0x00, 0x94, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xFF, 0x3B, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-  0x02, 0x00, 0x00, 0x00, 0x0B, 0x28, 0x45, 0x5B, 0x69, 0x72, 0x67, 0x56, 0x3D, 0x1E, 0x01, 0xBB,
-  0xFE, 0xFC, 0xFB, 0xFF, 0xA1, 0x00, 0xE0, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xFF, 0x8E, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x02, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53,
-  0xFF, 0xFC, 0xFE, 0xFF, 0xEA, 0x41, 0xF9, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF9, 0xFF, 0xBA, 0x04, 0x03, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x01, 0x0C,
-  0xE8, 0xFF, 0xFD, 0xFE, 0xFF, 0xB5, 0xF9, 0xFF, 0xFF, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFF, 0xFF, 0xB9, 0x0C, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
-  0xA3, 0xFF, 0xFB, 0xFF, 0xFF, 0xFC, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xFB, 0xFB, 0xFB, 0xFB,
-  0xFB, 0xFB, 0xFC, 0xFF, 0xFF, 0xFF, 0xF2, 0x7D, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01,
-  0x5B, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xE2, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFC, 0xD0, 0x83, 0x22, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-  0x23, 0xFA, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFE, 0xF9, 0x29, 0x13, 0x44, 0x66, 0x83, 0x95, 0x96,
-  0x8A, 0x75, 0x54, 0x28, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-  0x04, 0xDB, 0xFF, 0xFD, 0xFF, 0xFF, 0xFC, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03,
-  0x01, 0xB3, 0xFF, 0xFB, 0xFF, 0xFF, 0xFB, 0xFF, 0x74, 0x02, 0x06, 0x03, 0x04, 0x04, 0x04, 0x04,
-  0x04, 0x04, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x03, 0x01, 0x00, 0x02,
-  0x00, 0x84, 0xFF, 0xFB, 0xFF, 0xFE, 0xFD, 0xFF, 0x3B, 0x00, 0x01, 0x00, 0x01, 0x03, 0x04, 0x04,
-  0x04, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x03, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0A,
-  0x10, 0x6D, 0xFF, 0xFC, 0xFF, 0xFE, 0xFF, 0xF9, 0x2E, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x05, 0x22, 0x42, 0x64, 0x85, 0xA0, 0xB7, 0xC9, 0xD8, 0xDF,
-  0xEB, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xEE, 0xEA, 0xDE, 0xD3, 0xC6, 0xB3, 0x9C, 0x7D,
-  0x5C, 0x3B, 0x1B, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-  0x00, 0x00, 0x07, 0x3A, 0x78, 0xB2, 0xDC, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xF4, 0xD4, 0xA7, 0x6D, 0x31, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-  0x29, 0x8D, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFB, 0xFB, 0xFB, 0xFC, 0xFC, 0xFD, 0xFD,
-  0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFD, 0xFC, 0xFC, 0xFB, 0xFB,
-  0xFB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x7C, 0x1C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x82,
-  0xF8, 0xFF, 0xFF, 0xFE, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFB, 0xFF, 0xFF, 0xFF, 0xED, 0x70, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x70, 0xFF,
-  0xFE, 0xFB, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFB, 0xFF, 0xFF, 0x79, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xB3, 0xFC,
-  0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFB, 0xFD, 0xE0, 0x04, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x9B, 0xFF,
-  0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xD9, 0x02, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x7B, 0xFF,
-  0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xC6, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x58, 0xFF,
-  0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xAF, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x35, 0xFE,
-  0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFE, 0x8F, 0x00, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14, 0xF7,
-  0xFC, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0x64, 0x00, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x98,
-  0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xE9, 0x1C, 0x01, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03,
-  0x7A, 0xF1, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xFE, 0xBA, 0x25, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-  0x00, 0x95, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xDA, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-  0x03, 0x51, 0xFF, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x96, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x00, 0x19, 0xF4, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x50, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0xC2, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xF2, 0x17, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x7D, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xBC, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x36, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x77, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x07, 0xE0, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0x33, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x03, 0x00, 0xA0, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xDB, 0x06, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x04, 0x07, 0x00, 0x4B, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x91, 0x00, 0x05, 0x04, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
-  0x00, 0x00, 0x00, 0x29, 0xF1, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x6A, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x1C,
-  0x5F, 0xA0, 0xD0, 0xF0, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xF8, 0xE4, 0xBE, 0x86, 0x41, 0x06, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1F, 0xA1, 0xF0,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x6E, 0x01, 0x01, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x1D, 0xE4, 0xFF, 0xFF,
-  0xFB, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFB, 0xFB, 0xFD, 0xFF, 0xFF, 0xA1, 0x00, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x28, 0xFF, 0xFF, 0xFA,
-  0xFB, 0xFD, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFC, 0xFB, 0xFB, 0xFF, 0xC2, 0x00, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x41, 0xCA, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFB, 0xFA, 0xFB, 0xFD, 0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFD, 0xFC, 0xFB, 0xFB, 0xFD, 0xFF, 0xFF, 0xFF, 0xF8, 0x9D, 0x13, 0x01, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x49,
-  0x99, 0xD7, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFC, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
-  0xFB, 0xFB, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
-  0xFD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0xBE, 0x78, 0x27, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x04, 0x28, 0x56, 0x86, 0xB1, 0xD0, 0xEA, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xF3, 0xDE, 0xC0, 0x9D, 0x6F, 0x3F, 0x14, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x36, 0x4A, 0x5E, 0x71, 0x80, 0x8C, 0x9C,
-  0xA5, 0xAA, 0xB5, 0xBB, 0xBC, 0xBC, 0xBC, 0xBC, 0xB7, 0xAB, 0xA5, 0x99, 0x8C, 0x7F, 0x6B, 0x57,
-  0x42, 0x2D, 0x18, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x02, 0x04, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x04, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-};
-
-const lv_img_dsc_t kPlantImage = {
-  .header = {
-    .magic = LV_IMAGE_HEADER_MAGIC,
-    .cf = LV_COLOR_FORMAT_RGB565A8,
-    .flags = 0,
-    .w = kPlantW,
-    .h = kPlantH,
-    .stride = kPlantW * 2,
-    .reserved_2 = 0
-  },
-  .data_size = sizeof(kPlantImageData),
-  .data = kPlantImageData,
-  .reserved = nullptr,
-  .reserved_2 = nullptr
-};
@@ -1,8 +0,0 @@
-#pragma once
-
-#include "lvgl_config.h"
-#include <stdint.h>
-
-extern const int16_t kPlantW;
-extern const int16_t kPlantH;
-extern const lv_img_dsc_t kPlantImage;
@@ -1,11 +1,17 @@
 #include "platform_display.h"
 
+#include "profiler.h"
 #include <Adafruit_FT6206.h>
 #include <Adafruit_GFX.h>
 #include <Adafruit_ILI9341.h>
 #include <Arduino.h>
 #include <SPI.h>
 #include <Wire.h>
+#ifndef WOKWI_SIM
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
 
 static const uint8_t kTftSclk = 12;
 static const uint8_t kTftMosi = 11;
@@ -23,6 +29,12 @@ static const uint32_t kTftSpiHz = 40000000;
 
 static const uint8_t kTouchSda = 10;
 static const uint8_t kTouchScl = 8;
+// FT6206 INT (active low). The Wokwi cap-touch board does not break it out.
+#ifdef WOKWI_SIM
+static const int8_t kTouchInt = -1;
+#else
+static const int8_t kTouchInt = 14;
+#endif
 
 static Adafruit_ILI9341 tft(kTftCs, kTftDc, kTftRst);
 static Adafruit_FT6206 ctp;
@@ -30,25 +42,221 @@ static Adafruit_FT6206 ctp;
 LV_DRAW_BUF_DEFINE_STATIC(draw_buf, kScreenWidth, kBufferLines, LV_COLOR_FORMAT_RGB565);
 
 static bool touchReady = false;
+static lv_indev_t *touchIndev = nullptr;
+static bool touchIrqMode = false;
+static bool touchDragging = false;
+static volatile bool touchIrqPending = false;
+static uint32_t touchI2cReads = 0;
+#ifndef WOKWI_SIM
+static TaskHandle_t volatile touchWaiter = nullptr;
+#endif
+static uint32_t frameStartUs = 0;
+static uint32_t frameLastUs = 0;
+static uint32_t frameMaxUs = 0;
+static uint32_t frameCount = 0;
+static uint32_t flushBusyUs = 0;
+#ifdef CYCLE_PROFILER
+static uint32_t refrStartCycles = 0;
+static bool refrRendered = false;
+#endif
+
+#ifndef WOKWI_SIM
+// Second band so LVGL renders into one buffer while the other is on the wire.
+LV_DRAW_BUF_DEFINE_STATIC(draw_buf_2, kScreenWidth, kBufferLines, LV_COLOR_FORMAT_RGB565);
+// With PSRAM the bands grow so a full redraw needs fewer flush round trips.
+static const uint16_t kPsramBufferLines = 60;
+static lv_draw_buf_t psram_buf_1;
+static lv_draw_buf_t psram_buf_2;
+static const uint32_t kFlushTaskStack = 3072;
+static const UBaseType_t kFlushTaskPriority = 2;
+static const BaseType_t kFlushTaskCore = 0;
+
+struct FlushJob {
+  lv_display_t *disp;
+  lv_area_t area;
+  uint8_t *px_map;
+  bool last;
+};
+
+static TaskHandle_t flushTask = nullptr;
+static FlushJob flushJob = {};
+static volatile bool flushBusy = false;
+#endif
 
 /*
- * disp_flush
- * LVGL display flush callback that pushes pixel data to the ILI9341.
+ * send_area
+ * Pushes one rendered band to the ILI9341 (blocking on the SPI transfer).
  * Example:
- *   lv_display_set_flush_cb(disp, disp_flush);
+ *   send_area(area, px_map);
  */
-static void disp_flush(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
+static void send_area(const lv_area_t *area, uint8_t *px_map) {
+  PROFILE_SCOPE(PROF_FLUSH);
   uint32_t w = static_cast<uint32_t>(area->x2 - area->x1 + 1);
   uint32_t h = static_cast<uint32_t>(area->y2 - area->y1 + 1);
+  uint32_t startUs = micros();
 
   tft.startWrite();
   tft.setAddrWindow(area->x1, area->y1, w, h);
   tft.writePixels(reinterpret_cast<uint16_t *>(px_map), w * h, true);
   tft.endWrite();
 
+  flushBusyUs += micros() - startUs;
+}
+
+/*
+ * finish_flush
+ * Records frame timing on the last band and releases the buffer to LVGL.
+ * Example:
+ *   finish_flush(disp, lv_display_flush_is_last(disp));
+ */
+static void finish_flush(lv_display_t *disp, bool last) {
+  if (last && frameStartUs) {
+    frameLastUs = micros() - frameStartUs;
+    if (frameLastUs > frameMaxUs) frameMaxUs = frameLastUs;
+    frameCount++;
+    frameStartUs = 0;
+  }
   lv_display_flush_ready(disp);
 }
 
+#ifndef WOKWI_SIM
+/*
+ * flush_task
+ * Core-0 task that performs SPI transfers so core 1 can keep rendering.
+ * Example:
+ *   xTaskCreatePinnedToCore(flush_task, "lv_flush", ...);
+ */
+static void flush_task(void *) {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    send_area(&flushJob.area, flushJob.px_map);
+    finish_flush(flushJob.disp, flushJob.last);
+    flushBusy = false;
+  }
+}
+#endif
+
+/*
+ * disp_flush
+ * LVGL display flush callback that hands a rendered band to the ILI9341.
+ * Example:
+ *   lv_display_set_flush_cb(disp, disp_flush);
+ */
+static void disp_flush(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
+  // flush_is_last must be sampled here: LVGL moves on to the next band
+  // while the transfer task is still sending this one.
+  bool last = lv_display_flush_is_last(disp);
+#ifndef WOKWI_SIM
+  if (flushTask) {
+    flushJob.disp = disp;
+    flushJob.area = *area;
+    flushJob.px_map = px_map;
+    flushJob.last = last;
+    flushBusy = true;
+    xTaskNotifyGive(flushTask);
+    return;
+  }
+#endif
+  send_area(area, px_map);
+  finish_flush(disp, last);
+}
+
+/*
+ * render_start_event
+ * Display event that timestamps the start of each refresh cycle.
+ * Example:
+ *   lv_display_add_event_cb(disp, render_start_event, LV_EVENT_RENDER_START, nullptr);
+ */
+static void render_start_event(lv_event_t *) {
+  if (!frameStartUs) frameStartUs = micros();
+#ifdef CYCLE_PROFILER
+  refrRendered = true;
+#endif
+}
+
+#ifdef CYCLE_PROFILER
+/*
+ * refr_profile_event
+ * Display event that times each LVGL refresh cycle into PROF_RENDER,
+ * skipping cycles that found nothing to redraw.
+ * Example:
+ *   lv_display_add_event_cb(disp, refr_profile_event, LV_EVENT_REFR_START, nullptr);
+ */
+static void refr_profile_event(lv_event_t *e) {
+  if (lv_event_get_code(e) == LV_EVENT_REFR_START) {
+    refrStartCycles = profilerCycles();
+    refrRendered = false;
+  } else if (refrRendered) {
+    profilerRecord(PROF_RENDER, profilerCycles() - refrStartCycles);
+  }
+}
+#endif
+
+/*
+ * init_draw_buffers
+ * Attaches one band (sim, or DISPLAY_SINGLE_BUFFER builds) or two bands
+ * (hardware, PSRAM-backed when present).
+ * Example:
+ *   init_draw_buffers(disp);
+ */
+static void init_draw_buffers(lv_display_t *disp) {
+#if defined(WOKWI_SIM) || defined(DISPLAY_SINGLE_BUFFER)
+  LV_DRAW_BUF_INIT_STATIC(draw_buf);
+  lv_display_set_draw_buffers(disp, &draw_buf, nullptr);
+#else
+  if (psramFound()) {
+    uint32_t stride = lv_draw_buf_width_to_stride(kScreenWidth, LV_COLOR_FORMAT_RGB565);
+    uint32_t size = stride * kPsramBufferLines;
+    void *mem_1 = heap_caps_aligned_alloc(LV_DRAW_BUF_ALIGN, size, MALLOC_CAP_SPIRAM);
+    void *mem_2 = heap_caps_aligned_alloc(LV_DRAW_BUF_ALIGN, size, MALLOC_CAP_SPIRAM);
+    if (mem_1 && mem_2 &&
+        lv_draw_buf_init(&psram_buf_1, kScreenWidth, kPsramBufferLines, LV_COLOR_FORMAT_RGB565,
+                         stride, mem_1, size) == LV_RESULT_OK &&
+        lv_draw_buf_init(&psram_buf_2, kScreenWidth, kPsramBufferLines, LV_COLOR_FORMAT_RGB565,
+                         stride, mem_2, size) == LV_RESULT_OK) {
+      lv_display_set_draw_buffers(disp, &psram_buf_1, &psram_buf_2);
+      return;
+    }
+    if (mem_1) heap_caps_free(mem_1);
+    if (mem_2) heap_caps_free(mem_2);
+  }
+  LV_DRAW_BUF_INIT_STATIC(draw_buf);
+  LV_DRAW_BUF_INIT_STATIC(draw_buf_2);
+  lv_display_set_draw_buffers(disp, &draw_buf, &draw_buf_2);
+#endif
+}
+
+/*
+ * touch_isr
+ * FT6206 INT falling edge: a touch event is waiting in the controller.
+ * Example:
+ *   attachInterrupt(digitalPinToInterrupt(kTouchInt), touch_isr, FALLING);
+ */
+static void IRAM_ATTR touch_isr() {
+  touchIrqPending = true;
+#ifndef WOKWI_SIM
+  if (touchWaiter) {
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(touchWaiter, &woken);
+    if (woken) portYIELD_FROM_ISR();
+  }
+#endif
+}
+
+/*
+ * touch_set_dragging
+ * Polls the panel on the indev timer while a finger is down, and goes back
+ * to waiting for INT once it lifts.
+ * Example:
+ *   touch_set_dragging(true);
+ */
+static void touch_set_dragging(bool dragging) {
+  if (touchDragging == dragging) return;
+  touchDragging = dragging;
+  if (!touchIrqMode) return;
+  lv_indev_set_mode(touchIndev, dragging ? LV_INDEV_MODE_TIMER : LV_INDEV_MODE_EVENT);
+}
+
 /*
  * touch_read
  * LVGL input read callback that maps FT6206 touches into display coords.
@@ -56,10 +264,28 @@ static void disp_flush(lv_display_t *disp, const lv_area_t *area, uint8_t *px_ma
  *   lv_indev_set_read_cb(indev, touch_read);
  */
 static void touch_read(lv_indev_t *, lv_indev_data_t *data) {
-  if (!touchReady || !ctp.touched()) {
+  if (!touchReady) {
+    data->state = LV_INDEV_STATE_RELEASED;
+    return;
+  }
+  // Idle with INT wired: skip the I2C round trip unless the controller flagged an event.
+  // INT also stays low while a finger rests on the panel, which covers a missed edge.
+  if (touchIrqMode && !touchDragging) {
+    bool pending = touchIrqPending || !digitalRead(kTouchInt);
+    touchIrqPending = false;
+    if (!pending) {
+      data->state = LV_INDEV_STATE_RELEASED;
+      return;
+    }
+  }
+
+  touchI2cReads++;
+  if (!ctp.touched()) {
     data->state = LV_INDEV_STATE_RELEASED;
+    touch_set_dragging(false);
     return;
   }
+  touch_set_dragging(true);
 
   TS_Point p = ctp.getPoint();
   int32_t px = map(p.x, 0, kTouchWidth, kTouchWidth, 0);
@@ -100,6 +326,86 @@ static void touch_read(lv_indev_t *, lv_indev_data_t *data) {
   g_screensaver_active = false;
 }
 
+/*
+ * platform_touch_int_pin
+ * Returns the touch controller interrupt pin, or -1 when it is not wired.
+ * Example:
+ *   initLowPower(platform_touch_int_pin());
+ */
+int8_t platform_touch_int_pin() {
+  return kTouchInt;
+}
+
+/*
+ * platform_touch_service
+ * Feeds a pending touch interrupt to the indev while it is in event mode.
+ * Call before lv_timer_handler() so the press lands in the same pass.
+ * Example:
+ *   platform_touch_service();
+ */
+void platform_touch_service() {
+  if (!touchIrqMode || touchDragging || !touchIrqPending) return;
+  lv_indev_read(touchIndev);
+}
+
+/*
+ * platform_touch_wait
+ * Blocks the calling task for up to ms, returning early when the touch
+ * interrupt fires. Without a wired INT this is a plain delay().
+ * Example:
+ *   platform_touch_wait(loopPacingDelayMs(next, idle));
+ */
+void platform_touch_wait(uint32_t ms) {
+#ifndef WOKWI_SIM
+  if (touchIrqMode) {
+    touchWaiter = xTaskGetCurrentTaskHandle();
+    if (!touchIrqPending) ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(ms));
+    touchWaiter = nullptr;
+    return;
+  }
+#endif
+  delay(ms);
+}
+
+/*
+ * platform_touch_i2c_reads
+ * Returns how many times the touch controller has been read over I2C.
+ * Example:
+ *   uint32_t reads = platform_touch_i2c_reads();
+ */
+uint32_t platform_touch_i2c_reads() {
+  return touchI2cReads;
+}
+
+/*
+ * platform_display_wait_idle
+ * Blocks until any in-flight band has finished transferring.
+ * Example:
+ *   platform_display_wait_idle();
+ */
+void platform_display_wait_idle() {
+#ifndef WOKWI_SIM
+  while (flushBusy) {
+    vTaskDelay(1);
+  }
+#endif
+}
+
+/*
+ * platform_display_frame_stats
+ * Reports the last and worst full-refresh time (first band rendered to
+ * last band sent), the frame count, and total time spent on SPI transfers.
+ * Example:
+ *   uint32_t last = 0, worst = 0, frames = 0, spi = 0;
+ *   platform_display_frame_stats(&last, &worst, &frames, &spi);
+ */
+void platform_display_frame_stats(uint32_t *lastUs, uint32_t *maxUs, uint32_t *frames, uint32_t *spiBusyUs) {
+  if (lastUs) *lastUs = frameLastUs;
+  if (maxUs) *maxUs = frameMaxUs;
+  if (frames) *frames = frameCount;
+  if (spiBusyUs) *spiBusyUs = flushBusyUs;
+}
+
 /*
  * platform_display_init
  * Initializes SPI/I2C, TFT, touch, and the LVGL display/indev bindings.
@@ -125,8 +431,16 @@ lv_display_t *platform_display_init() {
   lv_display_t *disp = lv_display_create(kScreenWidth, kScreenHeight);
   lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
   lv_display_set_flush_cb(disp, disp_flush);
-  LV_DRAW_BUF_INIT_STATIC(draw_buf);
-  lv_display_set_draw_buffers(disp, &draw_buf, nullptr);
+  init_draw_buffers(disp);
+  lv_display_add_event_cb(disp, render_start_event, LV_EVENT_RENDER_START, nullptr);
+#ifdef CYCLE_PROFILER
+  lv_display_add_event_cb(disp, refr_profile_event, LV_EVENT_REFR_START, nullptr);
+  lv_display_add_event_cb(disp, refr_profile_event, LV_EVENT_REFR_READY, nullptr);
+#endif
+#if !defined(WOKWI_SIM) && !defined(DISPLAY_SINGLE_BUFFER)
+  xTaskCreatePinnedToCore(flush_task, "lv_flush", kFlushTaskStack, nullptr,
+                          kFlushTaskPriority, &flushTask, kFlushTaskCore);
+#endif
   lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_PARTIAL);
   lv_display_set_default(disp);
 
@@ -134,6 +448,16 @@ lv_display_t *platform_display_init() {
   lv_indev_set_type(indev, LV_INDEV_TYPE_POINTER);
   lv_indev_set_read_cb(indev, touch_read);
   lv_indev_set_display(indev, disp);
+  touchIndev = indev;
+
+  // With INT wired the indev sleeps until the controller raises an event;
+  // the Wokwi board has no INT, so it keeps polling on the indev timer.
+  if (touchReady && kTouchInt >= 0) {
+    pinMode(kTouchInt, INPUT_PULLUP);
+    attachInterrupt(digitalPinToInterrupt(kTouchInt), touch_isr, FALLING);
+    touchIrqMode = true;
+    lv_indev_set_mode(indev, LV_INDEV_MODE_EVENT);
+  }
 
   return disp;
 }
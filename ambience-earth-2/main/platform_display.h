@@ -3,3 +3,9 @@
 #include "app_state.h"
 
 lv_display_t *platform_display_init();
+int8_t platform_touch_int_pin();
+void platform_touch_service();
+void platform_touch_wait(uint32_t ms);
+uint32_t platform_touch_i2c_reads();
+void platform_display_wait_idle();
+void platform_display_frame_stats(uint32_t *lastUs, uint32_t *maxUs, uint32_t *frames, uint32_t *spiBusyUs);
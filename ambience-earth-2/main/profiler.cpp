@@ -0,0 +1,161 @@
+#include "profiler.h"
+
+#ifdef CYCLE_PROFILER
+#include <esp_cpu.h>
+#include <string.h>
+
+struct SectionStats {
+  uint32_t count;
+  uint32_t minCycles;
+  uint32_t maxCycles;
+  uint64_t totalCycles;
+  // Half-octave buckets: bucket 2*m + h holds [2^m + h*2^(m-1), 2^m + (h+1)*2^(m-1)).
+  uint16_t hist[PROFILER_HIST_BUCKETS];
+};
+
+// Each section has a single writer (PROF_FLUSH runs in the flush task on
+// core 0, the rest in loop()), so samples need no locking; readers may see
+// a sample half-applied, which only skews one row of one printout.
+static SectionStats stats[PROF_SECTION_COUNT];
+
+static uint8_t bucketFor(uint32_t cycles) {
+  if (cycles < 2) return 0;
+  uint8_t msb = static_cast<uint8_t>(31 - __builtin_clz(cycles));
+  uint8_t half = static_cast<uint8_t>((cycles >> (msb - 1)) & 1U);
+  return static_cast<uint8_t>(msb * 2 + half);
+}
+
+static uint32_t bucketUpper(uint8_t bucket) {
+  if (bucket < 2) return 1;
+  uint8_t msb = bucket / 2;
+  uint8_t half = bucket % 2;
+  uint64_t upper = (1ULL << msb) + ((static_cast<uint64_t>(half) + 1) << (msb - 1)) - 1;
+  return upper > 0xFFFFFFFFULL ? 0xFFFFFFFFUL : static_cast<uint32_t>(upper);
+}
+#endif
+
+bool profilerEnabled() {
+#ifdef CYCLE_PROFILER
+  return true;
+#else
+  return false;
+#endif
+}
+
+uint32_t profilerCycles() {
+#ifdef CYCLE_PROFILER
+  return static_cast<uint32_t>(esp_cpu_get_cycle_count());
+#else
+  return 0;
+#endif
+}
+
+void profilerRecord(ProfilerSection section, uint32_t cycles) {
+#ifdef CYCLE_PROFILER
+  if (section >= PROF_SECTION_COUNT) return;
+  SectionStats &s = stats[section];
+  if (s.count == 0 || cycles < s.minCycles) s.minCycles = cycles;
+  if (cycles > s.maxCycles) s.maxCycles = cycles;
+  s.count++;
+  s.totalCycles += cycles;
+  uint16_t &slot = s.hist[bucketFor(cycles)];
+  if (slot == 0xFFFF) {
+    // Halve the whole histogram so the shape (and p99) keeps tracking
+    // recent behaviour instead of saturating.
+    for (uint8_t i = 0; i < PROFILER_HIST_BUCKETS; ++i) s.hist[i] >>= 1;
+  }
+  slot++;
+#else
+  (void)section;
+  (void)cycles;
+#endif
+}
+
+void profilerReset() {
+#ifdef CYCLE_PROFILER
+  memset(stats, 0, sizeof(stats));
+#endif
+}
+
+bool profilerGetSummary(ProfilerSection section, ProfilerSummary *out) {
+  if (!out) return false;
+  *out = {};
+#ifdef CYCLE_PROFILER
+  if (section >= PROF_SECTION_COUNT) return false;
+  const SectionStats &s = stats[section];
+  if (s.count == 0) return false;
+  out->count = s.count;
+  out->minCycles = s.minCycles;
+  out->maxCycles = s.maxCycles;
+  out->avgCycles = static_cast<uint32_t>(s.totalCycles / s.count);
+
+  uint32_t histTotal = 0;
+  for (uint8_t i = 0; i < PROFILER_HIST_BUCKETS; ++i) histTotal += s.hist[i];
+  uint32_t target = histTotal - histTotal / 100;
+  uint32_t seen = 0;
+  out->p99Cycles = s.maxCycles;
+  for (uint8_t i = 0; i < PROFILER_HIST_BUCKETS; ++i) {
+    seen += s.hist[i];
+    if (seen >= target && seen > 0) {
+      uint32_t upper = bucketUpper(i);
+      out->p99Cycles = upper < s.maxCycles ? upper : s.maxCycles;
+      break;
+    }
+  }
+  return true;
+#else
+  (void)section;
+  return false;
+#endif
+}
+
+const char *profilerSectionName(ProfilerSection section) {
+  switch (section) {
+    case PROF_LVGL_HANDLER: return "lvgl";
+    case PROF_UI_TIMER: return "ui_timer";
+    case PROF_SIM_TICK: return "sim_tick";
+    case PROF_SENSORS: return "sensors";
+    case PROF_FEEDING: return "feeding";
+    case PROF_LOGGING: return "logging";
+    case PROF_SCREENSAVER: return "saver";
+    case PROF_SYNC_FEEDING: return "sync_feed";
+    case PROF_UPDATE_SCREEN: return "update";
+    case PROF_RENDER: return "render";
+    case PROF_FLUSH: return "flush";
+    default: return "?";
+  }
+}
+
+uint32_t profilerCyclesToUs10(uint32_t cycles) {
+#ifdef CYCLE_PROFILER
+  uint32_t mhz = getCpuFrequencyMhz();
+  if (mhz == 0) return 0;
+  return static_cast<uint32_t>((static_cast<uint64_t>(cycles) * 10ULL) / mhz);
+#else
+  (void)cycles;
+  return 0;
+#endif
+}
+
+void profilerPrint() {
+  if (!profilerEnabled()) {
+    Serial.printf("[PROF] not compiled in (build with -DCYCLE_PROFILER)\r\n");
+    return;
+  }
+  Serial.printf("[PROF] %-10s %8s %9s %9s %9s %9s (us)\r\n", "section", "count", "min", "avg", "p99", "max");
+  for (uint8_t i = 0; i < PROF_SECTION_COUNT; ++i) {
+    ProfilerSection section = static_cast<ProfilerSection>(i);
+    ProfilerSummary s = {};
+    if (!profilerGetSummary(section, &s)) continue;
+    uint32_t minUs10 = profilerCyclesToUs10(s.minCycles);
+    uint32_t avgUs10 = profilerCyclesToUs10(s.avgCycles);
+    uint32_t p99Us10 = profilerCyclesToUs10(s.p99Cycles);
+    uint32_t maxUs10 = profilerCyclesToUs10(s.maxCycles);
+    Serial.printf("[PROF] %-10s %8u %7u.%u %7u.%u %7u.%u %7u.%u\r\n", profilerSectionName(section),
+                  static_cast<unsigned>(s.count),
+                  static_cast<unsigned>(minUs10 / 10), static_cast<unsigned>(minUs10 % 10),
+                  static_cast<unsigned>(avgUs10 / 10), static_cast<unsigned>(avgUs10 % 10),
+                  static_cast<unsigned>(p99Us10 / 10), static_cast<unsigned>(p99Us10 % 10),
+                  static_cast<unsigned>(maxUs10 / 10), static_cast<unsigned>(maxUs10 % 10));
+  }
+}
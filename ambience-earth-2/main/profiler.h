@@ -0,0 +1,117 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Probes are compiled into sim (debug) builds; pass -DCYCLE_PROFILER to
+// profile hardware builds too. Without it PROFILE_SCOPE expands to nothing.
+#if defined(WOKWI_SIM) && !defined(CYCLE_PROFILER)
+#define CYCLE_PROFILER
+#endif
+
+#define PROFILER_HIST_BUCKETS 64
+
+enum ProfilerSection : uint8_t {
+  PROF_LVGL_HANDLER = 0, // lv_timer_handler(): input, ui_timer_cb and rendering
+  PROF_UI_TIMER,         // ui_timer_cb()
+  PROF_SIM_TICK,         // sim_tick()
+  PROF_SENSORS,          // soil moisture + soil temperature
+  PROF_FEEDING,          // feedingTick() + feedingBaselineTick()
+  PROF_LOGGING,          // sensor/value logs written from controlLoopTick()
+  PROF_SCREENSAVER,      // update_screensaver()
+  PROF_SYNC_FEEDING,     // sync_feeding_screen()
+  PROF_UPDATE_SCREEN,    // update_active_screen()
+  PROF_RENDER,           // one LVGL refresh that drew something
+  PROF_FLUSH,            // one disp_flush band on the wire
+  PROF_SECTION_COUNT
+};
+
+struct ProfilerSummary {
+  uint32_t count;
+  uint32_t minCycles;
+  uint32_t avgCycles;
+  uint32_t maxCycles;
+  uint32_t p99Cycles;
+};
+
+/*
+ * profilerEnabled
+ * Returns true when this build carries the cycle probes.
+ * Example:
+ *   if (!profilerEnabled()) Serial.println("profiler off");
+ */
+bool profilerEnabled();
+
+/*
+ * profilerCycles
+ * Returns the CPU cycle counter of the calling core.
+ * Example:
+ *   uint32_t start = profilerCycles();
+ */
+uint32_t profilerCycles();
+
+/*
+ * profilerRecord
+ * Adds one sample of cycles to a section's min/avg/max and histogram.
+ * Example:
+ *   profilerRecord(PROF_RENDER, profilerCycles() - start);
+ */
+void profilerRecord(ProfilerSection section, uint32_t cycles);
+
+/*
+ * profilerReset
+ * Clears every section's statistics.
+ * Example:
+ *   profilerReset();
+ */
+void profilerReset();
+
+/*
+ * profilerGetSummary
+ * Fills min/avg/max/p99 for a section; returns false when it has no samples.
+ * Example:
+ *   ProfilerSummary s = {};
+ *   if (profilerGetSummary(PROF_SIM_TICK, &s)) { ... }
+ */
+bool profilerGetSummary(ProfilerSection section, ProfilerSummary *out);
+
+/*
+ * profilerSectionName
+ * Returns the short name printed for a section.
+ * Example:
+ *   Serial.println(profilerSectionName(PROF_FLUSH));
+ */
+const char *profilerSectionName(ProfilerSection section);
+
+/*
+ * profilerCyclesToUs10
+ * Converts cycles to tenths of a microsecond at the current CPU clock.
+ * Example:
+ *   uint32_t us10 = profilerCyclesToUs10(s.avgCycles);
+ */
+uint32_t profilerCyclesToUs10(uint32_t cycles);
+
+/*
+ * profilerPrint
+ * Writes the per-section table to Serial.
+ * Example:
+ *   profilerPrint();
+ */
+void profilerPrint();
+
+#ifdef CYCLE_PROFILER
+struct ProfileScope {
+  explicit ProfileScope(ProfilerSection s) : section(s), start(profilerCycles()) {}
+  ~ProfileScope() { profilerRecord(section, profilerCycles() - start); }
+  ProfilerSection section;
+  uint32_t start;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+// Times the rest of the enclosing block into section.
+#define PROFILE_SCOPE(section) ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(section)
+#else
+#define PROFILE_SCOPE(section) \
+  do {                         \
+  } while (0)
+#endif
@@ -9,6 +9,19 @@ const uint8_t kRtcAddress = 0x68;
 const uint8_t kI2cSda = 10;
 const uint8_t kI2cScl = 8;
 
+// Software clock: epoch milliseconds since 2000-01-01 at clockBaseMillis.
+bool clockValid = false;
+uint64_t clockBaseMs = 0;
+uint32_t clockBaseMillis = 0;
+uint64_t lastReturnedMs = 0;
+int32_t driftPpm = 0;
+uint32_t driftAnchorSec = 0;
+uint32_t driftAnchorMillis = 0;
+uint32_t lastDisciplineAt = 0;
+uint32_t lastAttemptAt = 0;
+bool attempted = false;
+uint32_t hardwareReads = 0;
+
 uint8_t bcdToDec(uint8_t value) {
   return static_cast<uint8_t>((value >> 4) * 10 + (value & 0x0F));
 }
@@ -29,10 +42,6 @@ uint8_t decodeHour(uint8_t value) {
   return bcdToDec(value & 0x3F);
 }
 
-uint16_t makeDayKey(uint8_t year, uint8_t month, uint8_t day) {
-  return static_cast<uint16_t>(year) * 372u + static_cast<uint16_t>(month) * 31u + day;
-}
-
 bool readRegisters(uint8_t startReg, uint8_t *buffer, uint8_t length) {
   for (uint8_t attempt = 0; attempt < 2; ++attempt) {
     Wire.beginTransmission(kRtcAddress);
@@ -50,62 +59,128 @@ bool readRegisters(uint8_t startReg, uint8_t *buffer, uint8_t length) {
   }
   return false;
 }
-} // namespace
 
-uint8_t daysInMonth(uint8_t month, uint8_t year) {
-  static const uint8_t kDays[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
-  if (month == 0 || month > 12) return 31;
-  uint8_t days = kDays[month - 1];
-  if (month == 2 && (year % 4u) == 0) days = 29;
-  return days;
+bool readHardwareEpoch(uint32_t *outEpochSec) {
+  uint8_t data[7];
+  hardwareReads++;
+  if (!readRegisters(0x00, data, sizeof(data))) return false;
+
+  uint8_t secondVal = bcdToDec(data[0] & 0x7F);
+  uint8_t minuteVal = bcdToDec(data[1] & 0x7F);
+  uint8_t hourVal = decodeHour(data[2]);
+  uint8_t dayVal = bcdToDec(data[4] & 0x3F);
+  uint8_t monthVal = bcdToDec(data[5] & 0x1F);
+  uint8_t yearVal = bcdToDec(data[6]);
+
+  if (!epochFieldsValid(yearVal, monthVal, dayVal, hourVal, minuteVal, secondVal)) return false;
+
+  *outEpochSec = epochFromFields(yearVal, monthVal, dayVal, hourVal, minuteVal, secondVal);
+  return true;
 }
 
-void initRtc() {
-  Wire.begin(kI2cSda, kI2cScl);
+uint64_t softClockMs(uint32_t nowMillis) {
+  uint32_t elapsed = nowMillis - clockBaseMillis;
+  int64_t trim = static_cast<int64_t>(elapsed) * driftPpm / 1000000;
+  return clockBaseMs + static_cast<uint64_t>(static_cast<int64_t>(elapsed) + trim);
 }
 
-bool rtcReadMinutesAndDay(uint16_t *minutesOfDay, uint16_t *dayKey) {
-  uint8_t hourVal = 0;
-  uint8_t minuteVal = 0;
-  uint8_t dayVal = 0;
-  uint8_t monthVal = 0;
-  uint8_t yearVal = 0;
-  if (!rtcReadDateTime(&hourVal, &minuteVal, &dayVal, &monthVal, &yearVal)) return false;
+void rebaseClock(uint32_t nowMillis, uint64_t epochMs) {
+  clockBaseMs = epochMs;
+  clockBaseMillis = nowMillis;
+}
+
+void anchorClock(uint32_t epochSec, uint32_t nowMillis, uint16_t subSecondMs) {
+  rebaseClock(nowMillis, static_cast<uint64_t>(epochSec) * 1000u + subSecondMs);
+  driftAnchorSec = epochSec;
+  driftAnchorMillis = nowMillis;
+  lastDisciplineAt = nowMillis;
+  lastReturnedMs = 0;
+  clockValid = true;
+}
+
+void disciplineClock(uint32_t epochSec, uint32_t nowMillis) {
+  uint64_t softMs = softClockMs(nowMillis);
+  int64_t errorMs = static_cast<int64_t>(epochSec) * 1000 + 500 - static_cast<int64_t>(softMs);
+  if (errorMs > RTC_STEP_THRESHOLD_MS || errorMs < -RTC_STEP_THRESHOLD_MS) {
+    anchorClock(epochSec, nowMillis, 500);
+    return;
+  }
+
+  // Rate is measured over a long span so the 1 s register granularity averages out.
+  uint32_t span = nowMillis - driftAnchorMillis;
+  if (span >= RTC_DRIFT_MIN_SPAN_MS) {
+    int64_t rtcSpanMs = static_cast<int64_t>(epochSec - driftAnchorSec) * 1000;
+    int64_t ppm = (rtcSpanMs - static_cast<int64_t>(span)) * 1000000 / static_cast<int64_t>(span);
+    if (ppm > RTC_DRIFT_MAX_PPM) ppm = RTC_DRIFT_MAX_PPM;
+    if (ppm < -RTC_DRIFT_MAX_PPM) ppm = -RTC_DRIFT_MAX_PPM;
+    driftPpm = static_cast<int32_t>(ppm);
+    if (span >= 24UL * RTC_DRIFT_MIN_SPAN_MS) {
+      driftAnchorSec = epochSec;
+      driftAnchorMillis = nowMillis;
+    }
+  }
+
+  // Slew a quarter of the residual instead of stepping.
+  rebaseClock(nowMillis, static_cast<uint64_t>(static_cast<int64_t>(softMs) + errorMs / 4));
+  lastDisciplineAt = nowMillis;
+}
 
-  if (minutesOfDay) {
-    *minutesOfDay = static_cast<uint16_t>(hourVal) * 60u + minuteVal;
+bool ensureClock() {
+  uint32_t now = millis();
+  if (clockValid && now - lastDisciplineAt < RTC_DISCIPLINE_INTERVAL_MS) return true;
+  if (!clockValid && attempted && now - lastAttemptAt < RTC_RETRY_INTERVAL_MS) return false;
+
+  attempted = true;
+  lastAttemptAt = now;
+  uint32_t epochSec = 0;
+  if (!readHardwareEpoch(&epochSec)) {
+    if (clockValid) {
+      // Free-run on millis() until the next discipline attempt.
+      rebaseClock(now, softClockMs(now));
+      lastDisciplineAt = now;
+    }
+    return clockValid;
   }
-  if (dayKey) {
-    *dayKey = makeDayKey(yearVal, monthVal, dayVal);
+
+  if (clockValid) {
+    disciplineClock(epochSec, now);
+  } else {
+    // The DS1307 only reports whole seconds; assume we are mid-second.
+    anchorClock(epochSec, now, 500);
   }
   return true;
 }
+} // namespace
 
-bool rtcReadDateTime(uint8_t *hour, uint8_t *minute, uint8_t *day, uint8_t *month, uint8_t *year) {
-  uint8_t data[7];
-  if (!readRegisters(0x00, data, sizeof(data))) return false;
+void initRtc() {
+  Wire.begin(kI2cSda, kI2cScl);
+}
 
-  uint8_t minuteVal = bcdToDec(data[1] & 0x7F);
-  uint8_t hourVal = decodeHour(data[2]);
-  uint8_t dayVal = bcdToDec(data[4] & 0x3F);
-  uint8_t monthVal = bcdToDec(data[5] & 0x1F);
-  uint8_t yearVal = bcdToDec(data[6]);
+uint64_t rtcNowMs() {
+  if (!ensureClock()) return 0;
+  uint64_t nowMs = softClockMs(millis());
+  if (nowMs < lastReturnedMs) nowMs = lastReturnedMs;
+  lastReturnedMs = nowMs;
+  return nowMs;
+}
 
-  if (minuteVal > 59 || hourVal > 23 || dayVal == 0 || monthVal == 0 || monthVal > 12) return false;
-  if (dayVal > daysInMonth(monthVal, yearVal)) return false;
+uint32_t rtcHardwareReadCount() {
+  return hardwareReads;
+}
+
+int32_t rtcDriftPpm() {
+  return driftPpm;
+}
 
-  if (minute) *minute = minuteVal;
-  if (hour) *hour = hourVal;
-  if (day) *day = dayVal;
-  if (month) *month = monthVal;
-  if (year) *year = yearVal;
+bool rtcReadEpoch(EpochTime *outTime) {
+  uint64_t nowMs = rtcNowMs();
+  if (nowMs < 1000u) return false;
+  if (outTime) *outTime = static_cast<EpochTime>(nowMs / 1000u);
   return true;
 }
 
 bool rtcSetDateTime(uint8_t hour, uint8_t minute, uint8_t second, uint8_t day, uint8_t month, uint8_t year) {
-  if (hour > 23 || minute > 59 || second > 59) return false;
-  if (day == 0 || month == 0 || month > 12) return false;
-  if (day > daysInMonth(month, year)) return false;
+  if (!epochFieldsValid(year, month, day, hour, minute, second)) return false;
 
   Wire.beginTransmission(kRtcAddress);
   Wire.write(static_cast<uint8_t>(0x00));
@@ -116,7 +191,12 @@ bool rtcSetDateTime(uint8_t hour, uint8_t minute, uint8_t second, uint8_t day, u
   Wire.write(decToBcd(day));
   Wire.write(decToBcd(month));
   Wire.write(decToBcd(year));
-  return Wire.endTransmission() == 0;
+  if (Wire.endTransmission() != 0) return false;
+
+  // Writing the seconds register restarts the DS1307 countdown chain.
+  anchorClock(epochFromFields(year, month, day, hour, minute, second), millis(), 0);
+  attempted = true;
+  return true;
 }
 
 bool rtcIsWithinWindow(uint16_t nowMinutes, uint16_t startMinutes, uint16_t durationMinutes) {
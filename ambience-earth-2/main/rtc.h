@@ -2,6 +2,15 @@
 
 #include <stdint.h>
 
+#include "epochTime.h"
+
+// The DS1307 is read once at boot and then only to re-discipline the software clock.
+#define RTC_DISCIPLINE_INTERVAL_MS 300000UL
+#define RTC_RETRY_INTERVAL_MS 5000UL
+#define RTC_STEP_THRESHOLD_MS 2000L
+#define RTC_DRIFT_MIN_SPAN_MS 3600000UL
+#define RTC_DRIFT_MAX_PPM 20000L
+
 /*
  * initRtc
  * Initializes the RTC subsystem.
@@ -11,27 +20,41 @@
 void initRtc();
 
 /*
- * rtcReadMinutesAndDay
- * Reads minutes-of-day and a day key from the RTC.
+ * rtcNowMs
+ * Returns milliseconds since 2000-01-01 from the disciplined software clock, or 0 if unset.
+ * Example:
+ *   uint64_t nowMs = rtcNowMs();
+ */
+uint64_t rtcNowMs();
+
+/*
+ * rtcHardwareReadCount
+ * Returns how many I2C date/time reads the DS1307 has served since boot.
+ * Example:
+ *   uint32_t reads = rtcHardwareReadCount();
+ */
+uint32_t rtcHardwareReadCount();
+
+/*
+ * rtcDriftPpm
+ * Returns the current millis() rate correction in parts per million.
  * Example:
- *   uint16_t minutes = 0;
- *   uint16_t dayKey = 0;
- *   rtcReadMinutesAndDay(&minutes, &dayKey);
+ *   int32_t ppm = rtcDriftPpm();
  */
-bool rtcReadMinutesAndDay(uint16_t *minutesOfDay, uint16_t *dayKey);
+int32_t rtcDriftPpm();
 
 /*
- * rtcReadDateTime
- * Reads the current RTC date/time fields.
+ * rtcReadEpoch
+ * Reads the current time from the software clock as an EpochTime.
  * Example:
- *   uint8_t h = 0, m = 0, d = 0, mo = 0, y = 0;
- *   rtcReadDateTime(&h, &m, &d, &mo, &y);
+ *   EpochTime now = EPOCH_UNSET;
+ *   if (rtcReadEpoch(&now)) { ... }
  */
-bool rtcReadDateTime(uint8_t *hour, uint8_t *minute, uint8_t *day, uint8_t *month, uint8_t *year);
+bool rtcReadEpoch(EpochTime *outTime);
 
 /*
  * rtcSetDateTime
- * Updates the RTC date/time fields.
+ * Updates the RTC date/time fields and re-anchors the software clock.
  * Example:
  *   rtcSetDateTime(10, 30, 0, 14, 2, 25);
  */
@@ -44,11 +67,3 @@ bool rtcSetDateTime(uint8_t hour, uint8_t minute, uint8_t second, uint8_t day, u
  *   if (rtcIsWithinWindow(now, start, duration)) { ... }
  */
 bool rtcIsWithinWindow(uint16_t nowMinutes, uint16_t startMinutes, uint16_t durationMinutes);
-
-/*
- * daysInMonth
- * Returns the number of days in the given month for a 2-digit year.
- * Example:
- *   uint8_t dim = daysInMonth(month, year);
- */
-uint8_t daysInMonth(uint8_t month, uint8_t year);
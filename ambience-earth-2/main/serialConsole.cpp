@@ -0,0 +1,37 @@
+#include "serialConsole.h"
+
+#include "flashStats.h"
+#include "profiler.h"
+#include <string.h>
+
+static char lineBuf[SERIAL_CONSOLE_LINE_MAX];
+static uint8_t lineLen = 0;
+
+static void runCommand(const char *line) {
+  if (strcmp(line, "prof") == 0) {
+    profilerPrint();
+  } else if (strcmp(line, "prof reset") == 0) {
+    profilerReset();
+    Serial.printf("[PROF] reset\r\n");
+  } else if (strcmp(line, "flash") == 0) {
+    flashStatsPrint();
+  } else if (strcmp(line, "help") == 0) {
+    Serial.printf("[CMD] prof | prof reset | flash | help\r\n");
+  } else if (line[0]) {
+    Serial.printf("[CMD] unknown '%s' (try help)\r\n", line);
+  }
+}
+
+void serialConsoleService() {
+  while (Serial.available() > 0) {
+    int c = Serial.read();
+    if (c < 0) break;
+    if (c == '\r' || c == '\n') {
+      lineBuf[lineLen] = '\0';
+      runCommand(lineBuf);
+      lineLen = 0;
+    } else if (lineLen < SERIAL_CONSOLE_LINE_MAX - 1) {
+      lineBuf[lineLen++] = static_cast<char>(c);
+    }
+  }
+}
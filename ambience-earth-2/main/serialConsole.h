@@ -0,0 +1,14 @@
+#pragma once
+
+#include <Arduino.h>
+
+#define SERIAL_CONSOLE_LINE_MAX 32
+
+/*
+ * serialConsoleService
+ * Reads pending Serial input without blocking and runs each completed line
+ * as a diagnostics command ("help" lists them).
+ * Example:
+ *   serialConsoleService(); // once per loop()
+ */
+void serialConsoleService();
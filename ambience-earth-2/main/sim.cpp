@@ -2,19 +2,21 @@
 
 #include "app_utils.h"
 #include "config.h"
+#include "controlLoop.h"
 #include "feedSlots.h"
 #include "feeding.h"
 #include "feedingUtils.h"
 #include "logs.h"
 #include "moistureSensor.h"
+#include "profiler.h"
 #include "pumps.h"
 #include "rtc.h"
 #include "runoffSensor.h"
+#include "soilTempSensor.h"
 #include "volume.h"
 
 static uint32_t g_last_tick_ms = 0;
 static uint32_t g_last_toggle_ms = 0;
-static uint32_t g_last_values_log_ms = 0;
 static const uint8_t kMoistureBaselineSentinel = 127;
 static const uint8_t kDefaultRtcHour = 9;
 static const uint8_t kDefaultRtcMinute = 16;
@@ -24,25 +26,12 @@ static const uint8_t kDefaultRtcYear = 25;
 
 /*
  * sync_sim_time_from_rtc
- * Copies the RTC date/time into g_sim.now.
+ * Copies the software clock time into g_sim.now.
  * Example:
  *   if (!sync_sim_time_from_rtc()) { ... }
  */
 static bool sync_sim_time_from_rtc() {
-  uint8_t hour = 0;
-  uint8_t minute = 0;
-  uint8_t day = 0;
-  uint8_t month = 0;
-  uint8_t year = 0;
-  if (!rtcReadDateTime(&hour, &minute, &day, &month, &year)) return false;
-
-  g_sim.now.hour = hour;
-  g_sim.now.minute = minute;
-  g_sim.now.day = day;
-  g_sim.now.month = month;
-  g_sim.now.year = 2000 + year;
-  g_sim.now.second = 0;
-  return true;
+  return rtcReadEpoch(&g_sim.now);
 }
 
 /*
@@ -58,88 +47,6 @@ static void seed_rtc_if_invalid() {
   sync_sim_time_from_rtc();
 }
 
-/*
- * slot_pack_matches
- * Returns true if the given packed slot is all zeros.
- * Example:
- *   if (slot_pack_matches(config.feedSlotsPacked[i])) { ... }
- */
-static bool slot_pack_matches(const uint8_t packed[FEED_SLOT_PACKED_SIZE]) {
-  for (int i = 0; i < FEED_SLOT_PACKED_SIZE; ++i) {
-    if (packed[i] != 0) return false;
-  }
-  return true;
-}
-
-/*
- * slots_are_empty
- * Returns true if all stored slot packs are empty.
- * Example:
- *   if (slots_are_empty()) { seed_default_slots(); }
- */
-static bool slots_are_empty() {
-  for (int i = 0; i < FEED_SLOT_COUNT; ++i) {
-    if (!slot_pack_matches(config.feedSlotsPacked[i])) return false;
-    if (config.feedSlotNames[i][0] != '\0') return false;
-  }
-  return true;
-}
-
-/*
- * seed_default_slots
- * Seeds default feed slots into config for simulation.
- * Example:
- *   seed_default_slots();
- */
-static void seed_default_slots() {
-  for (int i = 0; i < FEED_SLOT_COUNT; ++i) {
-    FeedSlot slot = {};
-    if (i == 0) {
-      slot.windowStartMinutes = 0;
-      slot.windowDurationMinutes = 0;
-      slot.minGapMinutes = 60;
-      slot.maxVolumeMl = 50;
-      slot.runoffHold5s = 0;
-      slot.flags = static_cast<uint8_t>(FEED_SLOT_ENABLED | FEED_SLOT_HAS_TIME_WINDOW |
-                                        FEED_SLOT_RUNOFF_AVOID);
-      config.runoffExpectation[i] = 2;
-      strncpy(config.feedSlotNames[i], "INIT", FEED_SLOT_NAME_LENGTH);
-      config.feedSlotNames[i][FEED_SLOT_NAME_LENGTH] = '\0';
-    } else if (i == 1) {
-      slot.windowStartMinutes = 30;
-      slot.windowDurationMinutes = 0;
-      slot.minGapMinutes = 60;
-      slot.maxVolumeMl = 800;
-      slot.runoffHold5s = 6;
-      slot.flags = static_cast<uint8_t>(FEED_SLOT_ENABLED | FEED_SLOT_HAS_TIME_WINDOW |
-                                        FEED_SLOT_RUNOFF_REQUIRED | FEED_SLOT_BASELINE_SETTER);
-      config.runoffExpectation[i] = 1;
-      strncpy(config.feedSlotNames[i], "SOAK", FEED_SLOT_NAME_LENGTH);
-      config.feedSlotNames[i][FEED_SLOT_NAME_LENGTH] = '\0';
-    } else if (i == 2) {
-      slot.windowStartMinutes = 120;
-      slot.windowDurationMinutes = 14 * 60;
-      slot.moistureBelow = kMoistureBaselineSentinel;
-      slot.moistureTarget = kMoistureBaselineSentinel;
-      slot.minGapMinutes = 60;
-      slot.maxVolumeMl = 50;
-      slot.runoffHold5s = 0;
-      slot.flags = static_cast<uint8_t>(FEED_SLOT_ENABLED | FEED_SLOT_HAS_TIME_WINDOW |
-                                        FEED_SLOT_HAS_MOISTURE_BELOW | FEED_SLOT_HAS_MOISTURE_TARGET |
-                                        FEED_SLOT_RUNOFF_AVOID | FEED_SLOT_BASELINE_SETTER);
-      config.runoffExpectation[i] = 2;
-      strncpy(config.feedSlotNames[i], "REC", FEED_SLOT_NAME_LENGTH);
-      config.feedSlotNames[i][FEED_SLOT_NAME_LENGTH] = '\0';
-    } else {
-      slot.flags = 0;
-      config.feedSlotNames[i][0] = '\0';
-      config.runoffExpectation[i] = 0;
-    }
-    packFeedSlot(config.feedSlotsPacked[i], &slot);
-  }
-  saveConfig();
-}
-
 /*
  * update_setup_flags
  * Updates g_setup flags based on the config state.
@@ -239,6 +146,9 @@ static void update_sim_values() {
   uint16_t raw = soilSensorWindowLastRaw();
   g_sim.moisture_raw = raw;
   g_sim.moisture = soilMoistureAsPercentage(getSoilMoisture());
+  g_sim.sensor_health = soilSensorHealth();
+  g_sim.soil_temp_ready = soilTempReady();
+  g_sim.soil_temp_deci_c = g_sim.soil_temp_ready ? getSoilTempDeciC() : 0;
 
   uint8_t dryback = 0;
   g_sim.dryback = getDrybackPercent(&dryback) ? dryback : 0;
@@ -280,10 +190,9 @@ void sim_init() {
   initRunoffSensor();
   initPumps();
   initMoistureSensor();
+  initSoilTempSensor();
 
-  if (slots_are_empty()) {
-    seed_default_slots();
-  }
+  if (seedDefaultSlotsIfEmpty()) flushConfig();
 
   seed_rtc_if_invalid();
   g_sim.uptime_sec = 0;
@@ -294,25 +203,27 @@ void sim_init() {
 
   sync_slots_from_config();
   update_setup_flags();
+  feedingInit();
   feedingBaselineInit();
   setSoilSensorLazy();
 
   g_last_tick_ms = millis();
   g_last_toggle_ms = g_last_tick_ms;
-  g_last_values_log_ms = g_last_tick_ms;
+  controlLoopInit();
 
   add_log(build_boot_log());
 }
 
 void sim_factory_reset() {
   restoreDefaultConfig();
-  saveConfig();
   applySimDefaults();
   logs_wipe();
 
-  if (slots_are_empty()) {
-    seed_default_slots();
-  }
+  seedDefaultSlotsIfEmpty();
+  // Every field may have changed; listeners resync and the reset is on
+  // flash before anything else happens.
+  markConfigDirty(CONFIG_FIELD_ALL);
+  flushConfig();
   sync_slots_from_config();
   update_setup_flags();
 
@@ -327,30 +238,29 @@ void sim_factory_reset() {
 
   g_last_tick_ms = millis();
   g_last_toggle_ms = g_last_tick_ms;
-  g_last_values_log_ms = g_last_tick_ms;
+  controlLoopInit();
 
   add_log(build_boot_log());
 }
 
+uint32_t sim_idle_ms() {
+  return controlLoopIdleMs();
+}
+
 void sim_tick() {
+  PROFILE_SCOPE(PROF_SIM_TICK);
   uint32_t now_ms = millis();
   if (g_last_tick_ms == 0) g_last_tick_ms = now_ms;
+  uint32_t elapsed_sec = 0;
   while (now_ms - g_last_tick_ms >= 1000) {
     g_last_tick_ms += 1000;
     g_sim.uptime_sec += 1;
-    if (!sync_sim_time_from_rtc()) {
-      advance_time_one_sec(&g_sim.now);
-    }
+    elapsed_sec++;
   }
-
-  runSoilSensorLazyReadings();
-  feedingTick();
-  feedingBaselineTick();
-
-  if (soilSensorReady() && (now_ms - g_last_values_log_ms >= kLogValuesIntervalMs)) {
-    g_last_values_log_ms = now_ms;
-    add_log(build_value_log());
+  if (elapsed_sec > 0 && !sync_sim_time_from_rtc()) {
+    g_sim.now += elapsed_sec;
   }
+  controlLoopTick(g_sim.now);
 
   if (now_ms - g_last_toggle_ms >= 5000) {
     g_last_toggle_ms = now_ms;
@@ -6,6 +6,15 @@ void sim_init();
 void sim_tick();
 void sim_start_feed(int slot_index);
 
+/*
+ * sim_idle_ms
+ * Returns milliseconds until sim_tick next has work: a sensor window or
+ * conversion, the hourly values log, or the next RTC minute.
+ * Example:
+ *   uint32_t idle = sim_idle_ms();
+ */
+uint32_t sim_idle_ms();
+
 /*
  * sim_factory_reset
  * Restores defaults, clears logs, and resets simulation state.
@@ -0,0 +1,243 @@
+#include "soilTempSensor.h"
+
+enum TempState : uint8_t {
+  TEMP_STATE_IDLE = 0,
+  TEMP_STATE_CONVERTING
+};
+
+static const uint8_t kCmdSkipRom = 0xCC;
+static const uint8_t kCmdConvertT = 0x44;
+static const uint8_t kCmdReadScratchpad = 0xBE;
+static const uint8_t kScratchpadSize = 9;
+static const int16_t kPowerOnResetRaw = 0x0550;
+
+static portMUX_TYPE busMux = portMUX_INITIALIZER_UNLOCKED;
+static TempState tempState = TEMP_STATE_IDLE;
+static unsigned long convertStartedAt = 0;
+static unsigned long nextConvertAt = 0;
+static unsigned long lastReadAt = 0;
+static int16_t tempDeciC = 0;
+static bool tempValid = false;
+static bool sensorPresent = false;
+
+/*
+ * busLow
+ * Drives the 1-Wire bus low.
+ * Example:
+ *   busLow();
+ */
+static inline void busLow() {
+  digitalWrite(SOIL_TEMP_SENSOR_PIN, LOW);
+  pinMode(SOIL_TEMP_SENSOR_PIN, OUTPUT);
+}
+
+/*
+ * busRelease
+ * Releases the 1-Wire bus so the pull-up can raise it.
+ * Example:
+ *   busRelease();
+ */
+static inline void busRelease() {
+  pinMode(SOIL_TEMP_SENSOR_PIN, INPUT_PULLUP);
+}
+
+/*
+ * busReset
+ * Issues a reset pulse and returns true if a device answered with presence.
+ * Example:
+ *   if (!busReset()) return;
+ */
+static bool busReset() {
+  busRelease();
+  if (!digitalRead(SOIL_TEMP_SENSOR_PIN)) return false;
+
+  portENTER_CRITICAL(&busMux);
+  busLow();
+  delayMicroseconds(480);
+  busRelease();
+  delayMicroseconds(70);
+  bool present = !digitalRead(SOIL_TEMP_SENSOR_PIN);
+  portEXIT_CRITICAL(&busMux);
+  delayMicroseconds(410);
+  return present;
+}
+
+/*
+ * writeBit
+ * Writes a single bit using standard-speed slot timing.
+ * Example:
+ *   writeBit(1);
+ */
+static void writeBit(uint8_t bit) {
+  portENTER_CRITICAL(&busMux);
+  busLow();
+  if (bit) {
+    delayMicroseconds(6);
+    busRelease();
+    delayMicroseconds(64);
+  } else {
+    delayMicroseconds(60);
+    busRelease();
+    delayMicroseconds(10);
+  }
+  portEXIT_CRITICAL(&busMux);
+}
+
+/*
+ * readBit
+ * Reads a single bit from the bus.
+ * Example:
+ *   uint8_t bit = readBit();
+ */
+static uint8_t readBit() {
+  portENTER_CRITICAL(&busMux);
+  busLow();
+  delayMicroseconds(6);
+  busRelease();
+  delayMicroseconds(9);
+  uint8_t bit = digitalRead(SOIL_TEMP_SENSOR_PIN) ? 1 : 0;
+  portEXIT_CRITICAL(&busMux);
+  delayMicroseconds(55);
+  return bit;
+}
+
+/*
+ * writeByte
+ * Writes a byte LSB first.
+ * Example:
+ *   writeByte(kCmdSkipRom);
+ */
+static void writeByte(uint8_t value) {
+  for (uint8_t i = 0; i < 8; ++i) {
+    writeBit(value & 0x01);
+    value >>= 1;
+  }
+}
+
+/*
+ * readByte
+ * Reads a byte LSB first.
+ * Example:
+ *   uint8_t b = readByte();
+ */
+static uint8_t readByte() {
+  uint8_t value = 0;
+  for (uint8_t i = 0; i < 8; ++i) {
+    value |= static_cast<uint8_t>(readBit() << i);
+  }
+  return value;
+}
+
+/*
+ * crc8
+ * Computes the Dallas/Maxim CRC8 of a buffer.
+ * Example:
+ *   if (crc8(buf, 8) != buf[8]) { ... }
+ */
+static uint8_t crc8(const uint8_t *data, uint8_t len) {
+  uint8_t crc = 0;
+  while (len--) {
+    uint8_t in = *data++;
+    for (uint8_t i = 0; i < 8; ++i) {
+      uint8_t mix = (crc ^ in) & 0x01;
+      crc >>= 1;
+      if (mix) crc ^= 0x8C;
+      in >>= 1;
+    }
+  }
+  return crc;
+}
+
+/*
+ * startConversion
+ * Broadcasts Convert T; returns false when no sensor is on the bus.
+ * Example:
+ *   if (startConversion()) { ... }
+ */
+static bool startConversion() {
+  sensorPresent = busReset();
+  if (!sensorPresent) return false;
+  writeByte(kCmdSkipRom);
+  writeByte(kCmdConvertT);
+  return true;
+}
+
+/*
+ * collectConversion
+ * Reads the scratchpad and stores the temperature when the CRC matches.
+ * Example:
+ *   collectConversion();
+ */
+static bool collectConversion() {
+  sensorPresent = busReset();
+  if (!sensorPresent) return false;
+  writeByte(kCmdSkipRom);
+  writeByte(kCmdReadScratchpad);
+
+  uint8_t scratchpad[kScratchpadSize];
+  for (uint8_t i = 0; i < kScratchpadSize; ++i) {
+    scratchpad[i] = readByte();
+  }
+  if (crc8(scratchpad, kScratchpadSize - 1) != scratchpad[kScratchpadSize - 1]) return false;
+
+  int16_t raw = static_cast<int16_t>((scratchpad[1] << 8) | scratchpad[0]);
+  if (raw == kPowerOnResetRaw && !tempValid) return false;
+
+  tempDeciC = static_cast<int16_t>((static_cast<int32_t>(raw) * 10) / 16);
+  return true;
+}
+
+void initSoilTempSensor() {
+  busRelease();
+  tempState = TEMP_STATE_IDLE;
+  tempValid = false;
+  sensorPresent = false;
+  nextConvertAt = millis();
+}
+
+void runSoilTempSensor() {
+  unsigned long now = millis();
+
+  if (tempState == TEMP_STATE_IDLE) {
+    if (static_cast<long>(now - nextConvertAt) < 0) return;
+    if (!startConversion()) {
+      nextConvertAt = now + SOIL_TEMP_RETRY_INTERVAL;
+      return;
+    }
+    convertStartedAt = now;
+    tempState = TEMP_STATE_CONVERTING;
+    return;
+  }
+
+  if (now - convertStartedAt < SOIL_TEMP_CONVERSION_TIME) return;
+  tempState = TEMP_STATE_IDLE;
+  if (collectConversion()) {
+    tempValid = true;
+    lastReadAt = now;
+    nextConvertAt = convertStartedAt + SOIL_TEMP_READ_INTERVAL;
+  } else {
+    nextConvertAt = now + (sensorPresent ? SOIL_TEMP_READ_INTERVAL : SOIL_TEMP_RETRY_INTERVAL);
+  }
+}
+
+uint32_t soilTempIdleMs() {
+  unsigned long now = millis();
+  unsigned long dueAt = (tempState == TEMP_STATE_CONVERTING)
+                          ? convertStartedAt + SOIL_TEMP_CONVERSION_TIME
+                          : nextConvertAt;
+  if (static_cast<long>(dueAt - now) <= 0) return 0;
+  return static_cast<uint32_t>(dueAt - now);
+}
+
+bool soilTempReady() {
+  if (!tempValid) return false;
+  return (millis() - lastReadAt) < SOIL_TEMP_STALE_AFTER;
+}
+
+bool soilTempPresent() {
+  return sensorPresent;
+}
+
+int16_t getSoilTempDeciC() {
+  return tempDeciC;
+}
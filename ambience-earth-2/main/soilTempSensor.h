@@ -0,0 +1,59 @@
+#pragma once
+
+#include <Arduino.h>
+
+#define SOIL_TEMP_SENSOR_PIN 5
+
+#define SOIL_TEMP_CONVERSION_TIME 750UL
+#define SOIL_TEMP_READ_INTERVAL 10000UL
+#define SOIL_TEMP_RETRY_INTERVAL 30000UL
+#define SOIL_TEMP_STALE_AFTER 60000UL
+#define SOIL_TEMP_REFERENCE_DECI_C 250
+
+/*
+ * initSoilTempSensor
+ * Releases the 1-Wire bus and schedules the first conversion.
+ * Example:
+ *   initSoilTempSensor();
+ */
+void initSoilTempSensor();
+
+/*
+ * runSoilTempSensor
+ * Advances the non-blocking convert/read state machine.
+ * Example:
+ *   runSoilTempSensor();
+ */
+void runSoilTempSensor();
+
+/*
+ * soilTempIdleMs
+ * Returns milliseconds until the state machine next needs to run.
+ * Example:
+ *   uint32_t idle = soilTempIdleMs();
+ */
+uint32_t soilTempIdleMs();
+
+/*
+ * soilTempReady
+ * Returns true when a recent, CRC-checked temperature is available.
+ * Example:
+ *   if (soilTempReady()) { ... }
+ */
+bool soilTempReady();
+
+/*
+ * soilTempPresent
+ * Returns true if a sensor answered the last bus reset.
+ * Example:
+ *   if (!soilTempPresent()) { ... }
+ */
+bool soilTempPresent();
+
+/*
+ * getSoilTempDeciC
+ * Returns the latest soil temperature in tenths of a degree Celsius.
+ * Example:
+ *   int16_t t = getSoilTempDeciC();
+ */
+int16_t getSoilTempDeciC();
@@ -2,6 +2,55 @@
 
 #include "app_state.h"
 #include "app_utils.h"
+#include "ui_fonts.h"
+#include <stdarg.h>
+#include <string.h>
+
+static const size_t kLabelFmtBufSize = 96;
+
+/*
+ * set_label_text
+ * Sets label text only when it differs from what the label already shows,
+ * so periodic refreshes do not reallocate text or invalidate unchanged areas.
+ * Example:
+ *   set_label_text(g_info_refs.time_value, time_buf);
+ */
+static void set_label_text(lv_obj_t *label, const char *text) {
+  if (!label || !text) return;
+  const char *current = lv_label_get_text(label);
+  if (current && strcmp(current, text) == 0) return;
+  lv_label_set_text(label, text);
+}
+
+/*
+ * set_label_fmt
+ * printf-style variant of set_label_text.
+ * Example:
+ *   set_label_fmt(g_info_refs.today_value, "%dml", daily_total);
+ */
+static void set_label_fmt(lv_obj_t *label, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+static void set_label_fmt(lv_obj_t *label, const char *fmt, ...) {
+  if (!label || !fmt) return;
+  char buf[kLabelFmtBufSize];
+  va_list args;
+  va_start(args, fmt);
+  vsnprintf(buf, sizeof(buf), fmt, args);
+  va_end(args);
+  set_label_text(label, buf);
+}
+
+/*
+ * set_obj_hidden
+ * Adds or clears LV_OBJ_FLAG_HIDDEN only when the state actually changes.
+ * Example:
+ *   set_obj_hidden(g_info_refs.status_row, !show_status);
+ */
+static void set_obj_hidden(lv_obj_t *obj, bool hidden) {
+  if (!obj) return;
+  if (lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN) == hidden) return;
+  if (hidden) lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+  else lv_obj_clear_flag(obj, LV_OBJ_FLAG_HIDDEN);
+}
 
 /*
  * update_number_label
@@ -15,8 +64,7 @@
  */
 static void update_number_label(NumberBinding *binding) {
   if (!binding || !binding->label) return;
-  if (binding->fmt) lv_label_set_text_fmt(binding->label, binding->fmt, *binding->value);
-  else lv_label_set_text_fmt(binding->label, "%d", *binding->value);
+  set_label_fmt(binding->label, binding->fmt ? binding->fmt : "%d", *binding->value);
 }
 
 /*
@@ -83,7 +131,7 @@ static lv_obj_t *create_header(lv_obj_t *parent, const char *title, bool show_ba
 
   lv_obj_t *title_label = lv_label_create(header);
   lv_label_set_text(title_label, title);
-  lv_obj_set_style_text_font(title_label, &lv_font_montserrat_18, 0);
+  lv_obj_set_style_text_font(title_label, UI_FONT_18, 0);
   lv_obj_align(title_label, LV_ALIGN_CENTER, 0, 0);
 
   if (show_back) {
@@ -280,7 +328,7 @@ static lv_obj_t *create_number_selector_vertical(lv_obj_t *parent, const char *l
 
   lv_obj_t *label = lv_label_create(block);
   lv_label_set_text(label, label_text);
-  lv_obj_set_style_text_font(label, &lv_font_montserrat_12, 0);
+  lv_obj_set_style_text_font(label, UI_FONT_12, 0);
 
   lv_obj_t *row = lv_obj_create(block);
   lv_obj_set_width(row, LV_PCT(100));
@@ -389,7 +437,7 @@ static lv_obj_t *create_time_input_block(lv_obj_t *parent, const char *title, in
   lv_obj_t *label = lv_label_create(block);
   lv_label_set_text(label, title);
   lv_obj_set_style_text_color(label, kColorMuted, 0);
-  lv_obj_set_style_text_font(label, &lv_font_montserrat_12, 0);
+  lv_obj_set_style_text_font(label, UI_FONT_12, 0);
 
   lv_obj_t *row = lv_obj_create(block);
   lv_obj_set_width(row, LV_PCT(100));
@@ -498,7 +546,7 @@ static void show_prompt(const char *title, const char *message, const char **opt
 
   lv_obj_t *title_label = lv_label_create(box);
   lv_label_set_text(title_label, title);
-  lv_obj_set_style_text_font(title_label, &lv_font_montserrat_18, 0);
+  lv_obj_set_style_text_font(title_label, UI_FONT_18, 0);
 
   lv_obj_t *message_label = lv_label_create(box);
   lv_label_set_text(message_label, message);
@@ -5,16 +5,57 @@
 #include "feedSlots.h"
 #include "feeding.h"
 #include "feedingUtils.h"
+#include "image_assets.h"
 #include "logs.h"
+#include "loopPacing.h"
 #include "moistureSensor.h"
+#include "platform_display.h"
+#include "profiler.h"
 #include "pumps.h"
 #include "rtc.h"
 #include "sim.h"
 #include "ui_components.h"
+#include "ui_memory.h"
 #include "ui_screens.h"
 #include <Arduino.h>
 #include <string.h>
 
+/*
+ * ui_screen_name
+ * Returns the short tag used for a screen in the debug label and logs.
+ * Example:
+ *   Serial.printf("[UI] %s\r\n", ui_screen_name(SCREEN_MENU));
+ */
+const char *ui_screen_name(ScreenId id) {
+  switch (id) {
+    case SCREEN_INFO: return "INFO";
+    case SCREEN_FEEDING_STATUS: return "FEED";
+    case SCREEN_MENU: return "MENU";
+    case SCREEN_LOGS: return "LOGS";
+    case SCREEN_HISTORY: return "HIST";
+    case SCREEN_FEEDING_MENU: return "FMENU";
+    case SCREEN_SLOTS_LIST: return "SLOTS";
+    case SCREEN_SLOT_SUMMARY: return "SLOT";
+    case SCREEN_SLOT_WIZARD: return "EDIT";
+    case SCREEN_SETTINGS_MENU: return "SET";
+    case SCREEN_TIME_DATE: return "TIME";
+    case SCREEN_CAL_MENU: return "CAL";
+    case SCREEN_CAL_MOIST: return "CALM";
+    case SCREEN_CAL_FLOW: return "CALF";
+    case SCREEN_TEST_MENU: return "TEST";
+    case SCREEN_TEST_SENSORS: return "SENS";
+    case SCREEN_TEST_PUMPS: return "PUMP";
+    case SCREEN_RESET_MENU: return "RST";
+    case SCREEN_INITIAL_SETUP: return "SETUP";
+    case SCREEN_NUMBER_INPUT: return "NUM";
+    case SCREEN_TIME_RANGE_INPUT: return "LIGHT";
+    case SCREEN_UI_MEMORY: return "MEM";
+    case SCREEN_PROFILER: return "PROF";
+    case SCREEN_FLASH_STATS: return "FLASH";
+    default: return "UI";
+  }
+}
+
 /*
  * set_active_screen
  * Updates the active screen id and debug label text.
@@ -23,35 +64,18 @@
  */
 static void set_active_screen(ScreenId id) {
   g_active_screen = id;
+  ui_mem_screen_shown(id);
   if (!g_debug_label) return;
-  const char *name = "";
-  switch (id) {
-    case SCREEN_INFO: name = "INFO"; break;
-    case SCREEN_FEEDING_STATUS: name = "FEED"; break;
-    case SCREEN_MENU: name = "MENU"; break;
-    case SCREEN_LOGS: name = "LOGS"; break;
-    case SCREEN_FEEDING_MENU: name = "FEED"; break;
-    case SCREEN_SLOTS_LIST: name = "SLOTS"; break;
-    case SCREEN_SLOT_SUMMARY: name = "SLOT"; break;
-    case SCREEN_SLOT_WIZARD: name = "EDIT"; break;
-    case SCREEN_SETTINGS_MENU: name = "SET"; break;
-    case SCREEN_TIME_DATE: name = "TIME"; break;
-    case SCREEN_CAL_MENU: name = "CAL"; break;
-    case SCREEN_CAL_MOIST: name = "CALM"; break;
-    case SCREEN_CAL_FLOW: name = "CALF"; break;
-    case SCREEN_TEST_MENU: name = "TEST"; break;
-    case SCREEN_TEST_SENSORS: name = "SENS"; break;
-    case SCREEN_TEST_PUMPS: name = "PUMP"; break;
-    case SCREEN_RESET_MENU: name = "RST"; break;
-    case SCREEN_INITIAL_SETUP: name = "SETUP"; break;
-    case SCREEN_NUMBER_INPUT: name = "NUM"; break;
-    case SCREEN_TIME_RANGE_INPUT: name = "LIGHT"; break;
-    default: name = "UI"; break;
-  }
-  lv_label_set_text_fmt(g_debug_label, "[%s]", name);
+  lv_label_set_text_fmt(g_debug_label, "[%s]", ui_screen_name(id));
 }
 
-static uint32_t count_obj_tree(lv_obj_t *root) {
+/*
+ * count_obj_tree
+ * Returns the number of objects in a widget tree, root included.
+ * Example:
+ *   uint32_t objs = count_obj_tree(lv_screen_active());
+ */
+uint32_t count_obj_tree(lv_obj_t *root) {
   if (!root) return 0;
   uint32_t total = 1;
   uint32_t child_count = lv_obj_get_child_count(root);
@@ -66,15 +90,134 @@ static void log_ui_memory(const char *tag) {
   lv_mem_monitor(&mon);
   lv_obj_t *active = lv_screen_active();
   uint32_t obj_count = count_obj_tree(active);
-  Serial.printf("[UI_MEM] %s stack=%d active=%d objs=%u lv_used=%u%% lv_free=%u lv_big=%u frag=%u%%\r\n",
+  int cached = 0;
+  for (int i = 0; i < kScreenCacheSlots; ++i) {
+    if (g_screen_cache[i].root) cached++;
+  }
+  UiMemStats stats = {};
+  ui_mem_get_stats(&stats);
+  Serial.printf("[UI_MEM] %s stack=%d cached=%d active=%d objs=%u lv_used=%u%% lv_free=%u lv_big=%u frag=%u%% "
+                "hw=%u trend=%+d%%/%umin over=%u img=%u\r\n",
                 tag ? tag : "(null)",
                 g_screen_stack_size,
+                cached,
                 static_cast<int>(g_active_screen),
                 static_cast<unsigned>(obj_count),
                 static_cast<unsigned>(mon.used_pct),
                 static_cast<unsigned>(mon.free_size),
                 static_cast<unsigned>(mon.free_biggest_size),
-                static_cast<unsigned>(mon.frag_pct));
+                static_cast<unsigned>(mon.frag_pct),
+                static_cast<unsigned>(stats.high_water_bytes),
+                static_cast<int>(stats.frag_trend_pct),
+                static_cast<unsigned>(stats.trend_minutes),
+                static_cast<unsigned>(stats.budget_violations),
+                static_cast<unsigned>(image_asset_cache_bytes()));
+  uint32_t frame_us = 0;
+  uint32_t frame_max_us = 0;
+  uint32_t frames = 0;
+  uint32_t spi_us = 0;
+  platform_display_frame_stats(&frame_us, &frame_max_us, &frames, &spi_us);
+  Serial.printf("[DISP] frames=%u last=%uus max=%uus spi_total=%ums touch_i2c=%u\r\n",
+                static_cast<unsigned>(frames),
+                static_cast<unsigned>(frame_us),
+                static_cast<unsigned>(frame_max_us),
+                static_cast<unsigned>(spi_us / 1000UL),
+                static_cast<unsigned>(platform_touch_i2c_reads()));
+  Serial.printf("[PACE] wakes_per_min=%u\r\n", static_cast<unsigned>(loopPacingWakesPerMinute()));
+}
+
+/*
+ * screen_cache_bytes
+ * Returns the LVGL heap bytes held by cached (off-screen) trees.
+ * Example:
+ *   uint32_t held = screen_cache_bytes();
+ */
+static uint32_t screen_cache_bytes() {
+  uint32_t total = 0;
+  for (int i = 0; i < kScreenCacheSlots; ++i) {
+    if (g_screen_cache[i].root) total += g_screen_cache[i].bytes;
+  }
+  return total;
+}
+
+/*
+ * screen_cache_evict_lru
+ * Deletes the least recently used cached screen; returns false if the cache is empty.
+ * Example:
+ *   while (over_budget && screen_cache_evict_lru()) { ... }
+ */
+static bool screen_cache_evict_lru() {
+  int victim = -1;
+  for (int i = 0; i < kScreenCacheSlots; ++i) {
+    if (!g_screen_cache[i].root) continue;
+    if (victim < 0 || g_screen_cache[i].last_used < g_screen_cache[victim].last_used) victim = i;
+  }
+  if (victim < 0) return false;
+  lv_obj_del(g_screen_cache[victim].root);
+  g_screen_cache[victim] = {};
+  return true;
+}
+
+/*
+ * acquire_screen
+ * Returns the cached tree for id (refreshed for this visit) or builds a new one.
+ * Example:
+ *   lv_obj_t *root = acquire_screen(SCREEN_MENU);
+ */
+static lv_obj_t *acquire_screen(ScreenId id) {
+  for (int i = 0; i < kScreenCacheSlots; ++i) {
+    if (g_screen_cache[i].root && g_screen_cache[i].id == id) {
+      lv_obj_t *root = g_screen_cache[i].root;
+      g_screen_cache[i] = {};
+      refresh_cached_screen(id);
+      return root;
+    }
+  }
+  ui_mem_reserve(screen_mem_budget(id));
+  uint32_t before = ui_mem_used_bytes();
+  lv_obj_t *root = build_screen(id);
+  uint32_t after = ui_mem_used_bytes();
+  ui_mem_screen_built(id, (after > before) ? after - before : 0, count_obj_tree(root));
+  return root;
+}
+
+/*
+ * release_screen
+ * Keeps a screen leaving the display in the LRU cache when it is cacheable
+ * and fits the LVGL memory budget; otherwise deletes it.
+ * Example:
+ *   release_screen(SCREEN_LOGS, old_root);
+ */
+static void release_screen(ScreenId id, lv_obj_t *root) {
+  if (!root) return;
+  uint32_t bytes = ui_mem_screen_stats(id).last_build_bytes;
+  if (!screen_is_cacheable(id) || bytes > kScreenCacheBudgetBytes) {
+    lv_obj_del(root);
+    return;
+  }
+
+  while (screen_cache_bytes() + bytes > kScreenCacheBudgetBytes) {
+    if (!screen_cache_evict_lru()) break;
+  }
+  while (ui_mem_free_bytes() < kScreenCacheMinFreeBytes) {
+    if (!screen_cache_evict_lru()) break;
+  }
+  if (ui_mem_free_bytes() < kScreenCacheMinFreeBytes) {
+    lv_obj_del(root);
+    return;
+  }
+
+  int slot = -1;
+  for (int i = 0; i < kScreenCacheSlots && slot < 0; ++i) {
+    if (!g_screen_cache[i].root) slot = i;
+  }
+  if (slot < 0) {
+    screen_cache_evict_lru();
+    for (int i = 0; i < kScreenCacheSlots && slot < 0; ++i) {
+      if (!g_screen_cache[i].root) slot = i;
+    }
+  }
+  g_screen_cache[slot] = {id, root, bytes, ++g_screen_cache_clock};
 }
 
 /*
@@ -101,12 +244,13 @@ static void replace_top_screen(ScreenId id) {
   if (g_screen_stack_size <= 0) return;
   if (g_screen_stack[g_screen_stack_size - 1].id == id) return;
   prompt_close();
+  ScreenId old_id = g_screen_stack[g_screen_stack_size - 1].id;
   lv_obj_t *old = g_screen_stack[g_screen_stack_size - 1].root;
-  lv_obj_t *root = build_screen(id);
+  lv_obj_t *root = acquire_screen(id);
   g_screen_stack[g_screen_stack_size - 1] = {id, root};
   lv_scr_load(root);
   set_active_screen(id);
-  if (old) lv_obj_del(old);
+  release_screen(old_id, old);
   log_ui_memory("replace_top");
 }
 
@@ -117,6 +261,7 @@ static void replace_top_screen(ScreenId id) {
  *   sync_feeding_screen();
  */
 static void sync_feeding_screen() {
+  PROFILE_SCOPE(PROF_SYNC_FEEDING);
   bool feeding = feedingIsActive();
   if (feeding) {
     if (g_active_screen == SCREEN_INFO) {
@@ -144,9 +289,9 @@ static void push_screen(ScreenId id) {
   if (g_screen_stack_size > 0) {
     lv_obj_t *old_top = g_screen_stack[g_screen_stack_size - 1].root;
     g_screen_stack[g_screen_stack_size - 1].root = nullptr;
-    if (old_top) lv_obj_del(old_top);
+    release_screen(g_screen_stack[g_screen_stack_size - 1].id, old_top);
   }
-  lv_obj_t *root = build_screen(id);
+  lv_obj_t *root = acquire_screen(id);
   g_screen_stack[g_screen_stack_size++] = {id, root};
   lv_scr_load(root);
   set_active_screen(id);
@@ -166,7 +311,7 @@ static void pop_screen() {
   lv_obj_t *old = g_screen_stack[g_screen_stack_size - 1].root;
   g_screen_stack_size--;
   ScreenId next_id = g_screen_stack[g_screen_stack_size - 1].id;
-  lv_obj_t *next_root = build_screen(next_id);
+  lv_obj_t *next_root = acquire_screen(next_id);
   g_screen_stack[g_screen_stack_size - 1].root = next_root;
   lv_scr_load(next_root);
   set_active_screen(next_id);
@@ -179,7 +324,7 @@ static void pop_screen() {
     feedingResumeAfterUi();
   }
   handle_popped_screen_side_effects(popped_id);
-  if (old) lv_obj_del(old);
+  release_screen(popped_id, old);
   log_ui_memory("pop");
 }
 
@@ -193,6 +338,7 @@ static void pop_to_root() {
   if (g_screen_stack_size <= 1) return;
   prompt_close();
 
+  ScreenId old_top_id = g_screen_stack[g_screen_stack_size - 1].id;
   lv_obj_t *old_top = g_screen_stack[g_screen_stack_size - 1].root;
   for (int i = g_screen_stack_size - 1; i >= 1; --i) {
     handle_popped_screen_side_effects(g_screen_stack[i].id);
@@ -201,14 +347,14 @@ static void pop_to_root() {
   g_screen_stack_size = 1;
 
   ScreenId root_id = g_screen_stack[0].id;
-  lv_obj_t *root = build_screen(root_id);
+  lv_obj_t *root = acquire_screen(root_id);
   g_screen_stack[0].root = root;
   lv_scr_load(root);
   set_active_screen(root_id);
   if (root_id == SCREEN_INFO) {
     feedingResumeAfterUi();
   }
-  if (old_top) lv_obj_del(old_top);
+  release_screen(old_top_id, old_top);
   log_ui_memory("pop_to_root");
 }
 
@@ -219,11 +365,24 @@ static void pop_to_root() {
  *   lv_timer_create(ui_timer_cb, 200, nullptr);
  */
 static void ui_timer_cb(lv_timer_t *) {
+  PROFILE_SCOPE(PROF_UI_TIMER);
   uint32_t now_ms = millis();
   sim_tick();
   update_screensaver(now_ms);
   sync_feeding_screen();
   update_active_screen();
+  ui_mem_sample(now_ms);
+
+  // Labels only show HH:MM and slow sensor values, so refresh them less often while idle.
+  // An open or due soil sensor window keeps the full rate so its samples show up on time.
+  uint32_t sensor_idle_ms = soilSensorIdleMs();
+  uint32_t period = kUiTimerIdlePeriodMs;
+  if (sensor_idle_ms == 0 || ui_pacing_idle_ms() == LOOP_PACING_FULL_RATE) {
+    period = kUiTimerPeriodMs;
+  } else if (sensor_idle_ms < period) {
+    period = sensor_idle_ms < kUiTimerPeriodMs ? kUiTimerPeriodMs : sensor_idle_ms;
+  }
+  if (lv_timer_get_period(g_ui_timer) != period) lv_timer_set_period(g_ui_timer, period);
 }
 
 /*
@@ -259,6 +418,16 @@ void open_logs_event(lv_event_t *) {
   push_screen(SCREEN_LOGS);
 }
 
+/*
+ * open_history_event
+ * Event handler that opens the moisture history chart.
+ * Example:
+ *   lv_obj_add_event_cb(btn, open_history_event, LV_EVENT_CLICKED, nullptr);
+ */
+void open_history_event(lv_event_t *) {
+  push_screen(SCREEN_HISTORY);
+}
+
 /*
  * open_feeding_event
  * Event handler that opens the feeding menu.
@@ -327,17 +496,14 @@ void open_settings_menu_event(lv_event_t *) {
  *   lv_obj_add_event_cb(btn, open_time_date_event, LV_EVENT_CLICKED, nullptr);
  */
 void open_time_date_event(lv_event_t *) {
-  uint8_t hour = 0;
-  uint8_t minute = 0;
-  uint8_t day = 1;
-  uint8_t month = 1;
-  uint8_t year = 25;
-  rtcReadDateTime(&hour, &minute, &day, &month, &year);
-  g_time_date_edit.year = 2000 + year;
-  g_time_date_edit.month = month;
-  g_time_date_edit.day = day;
-  g_time_date_edit.hour = hour;
-  g_time_date_edit.minute = minute;
+  EpochTime now = epochFromFields(25, 1, 1, 0, 0, 0);
+  rtcReadEpoch(&now);
+  EpochFields fields = epochToFields(now);
+  g_time_date_edit.year = 2000 + fields.year;
+  g_time_date_edit.month = fields.month;
+  g_time_date_edit.day = fields.day;
+  g_time_date_edit.hour = fields.hour;
+  g_time_date_edit.minute = fields.minute;
   g_time_date_edit.second = 0;
   g_time_date_step = 0;
   push_screen(SCREEN_TIME_DATE);
@@ -371,7 +537,9 @@ void open_max_daily_event(lv_event_t *) {
   g_number_ctx.on_done = []() {
     config.maxDailyWaterMl = static_cast<uint16_t>(g_number_ctx.value);
     config.flags |= CONFIG_FLAG_MAX_DAILY_SET;
-    saveConfig();
+    markConfigDirty(CONFIG_FIELD_MAX_DAILY);
+    // The daily cap is a safety limit; don't let a power cut revert it.
+    flushConfig();
     g_setup.max_daily = true;
   };
   push_screen(SCREEN_NUMBER_INPUT);
@@ -393,7 +561,7 @@ void open_baseline_x_event(lv_event_t *) {
   g_number_ctx.target = nullptr;
   g_number_ctx.on_done = []() {
     config.baselineX = clampBaselineOffset(static_cast<uint8_t>(g_number_ctx.value));
-    saveConfig();
+    markConfigDirty(CONFIG_FIELD_BASELINE);
   };
   push_screen(SCREEN_NUMBER_INPUT);
 }
@@ -414,7 +582,7 @@ void open_baseline_y_event(lv_event_t *) {
   g_number_ctx.target = nullptr;
   g_number_ctx.on_done = []() {
     config.baselineY = clampBaselineOffset(static_cast<uint8_t>(g_number_ctx.value));
-    saveConfig();
+    markConfigDirty(CONFIG_FIELD_BASELINE);
   };
   push_screen(SCREEN_NUMBER_INPUT);
 }
@@ -435,7 +603,7 @@ void open_baseline_delay_event(lv_event_t *) {
   g_number_ctx.target = nullptr;
   g_number_ctx.on_done = []() {
     config.baselineDelayMinutes = static_cast<uint8_t>(g_number_ctx.value);
-    saveConfig();
+    markConfigDirty(CONFIG_FIELD_BASELINE);
   };
   push_screen(SCREEN_NUMBER_INPUT);
 }
@@ -455,7 +623,7 @@ void open_lights_event(lv_event_t *) {
   g_time_range_ctx.on_done = []() {
     config.flags |= CONFIG_FLAG_LIGHTS_ON_SET;
     config.flags |= CONFIG_FLAG_LIGHTS_OFF_SET;
-    saveConfig();
+    markConfigDirty(CONFIG_FIELD_LIGHTS);
     g_setup.lights = true;
   };
   push_screen(SCREEN_TIME_RANGE_INPUT);
@@ -545,6 +713,20 @@ void logs_next_event(lv_event_t *) {
   update_logs_screen();
 }
 
+/*
+ * history_range_event
+ * Event handler that switches the history chart between 1, 3 and 7 days.
+ * Example:
+ *   lv_obj_add_event_cb(btn, history_range_event, LV_EVENT_CLICKED,
+ *                       reinterpret_cast<void *>(static_cast<intptr_t>(0)));
+ */
+void history_range_event(lv_event_t *event) {
+  int range = static_cast<int>(reinterpret_cast<intptr_t>(lv_event_get_user_data(event)));
+  if (range < 0 || range >= kHistoryRangeCount) return;
+  g_history_range = range;
+  update_history_screen(true);
+}
+
 /*
  * wizard_apply_name
  * Copies the current text area value into the editable slot name.
@@ -625,7 +807,7 @@ static void save_slot_to_config(int slot_index, const Slot &slot) {
   else if (slot.runoff_mode == RUNOFF_AVOID) pref = 2;
   config.runoffExpectation[slot_index] = pref;
 
-  saveConfig();
+  markConfigDirty(CONFIG_FIELD_SLOTS);
 }
 
 /*
@@ -761,7 +943,7 @@ void time_date_save_event(lv_event_t *) {
                      static_cast<uint8_t>(g_time_date_edit.month),
                      year)) {
     config.flags |= CONFIG_FLAG_TIME_SET;
-    saveConfig();
+    markConfigDirty(CONFIG_FIELD_TIME);
     g_setup.time_date = true;
     maybe_refresh_initial_setup();
   }
@@ -857,6 +1039,27 @@ void open_cal_flow_event(lv_event_t *) {
   push_screen(SCREEN_CAL_FLOW);
 }
 
+/*
+ * open_temp_comp_event
+ * Event handler that opens the moisture temperature-compensation input.
+ * Example:
+ *   lv_obj_add_event_cb(btn, open_temp_comp_event, LV_EVENT_CLICKED, nullptr);
+ */
+void open_temp_comp_event(lv_event_t *) {
+  g_number_ctx.title = "Temp compensation";
+  g_number_ctx.value = config.moistTempCompPer10C;
+  g_number_ctx.min = -20;
+  g_number_ctx.max = 20;
+  g_number_ctx.step = 1;
+  g_number_ctx.unit = "% per 10C (0=off)";
+  g_number_ctx.target = nullptr;
+  g_number_ctx.on_done = []() {
+    config.moistTempCompPer10C = static_cast<int8_t>(g_number_ctx.value);
+    markConfigDirty(CONFIG_FIELD_TEMP_COMP);
+  };
+  push_screen(SCREEN_NUMBER_INPUT);
+}
+
 /*
  * open_test_sensors_event
  * Event handler that opens the sensor test screen.
@@ -878,6 +1081,47 @@ void open_test_pumps_event(lv_event_t *) {
   push_screen(SCREEN_TEST_PUMPS);
 }
 
+/*
+ * open_ui_memory_event
+ * Event handler that opens the LVGL heap debug screen.
+ * Example:
+ *   lv_obj_add_event_cb(btn, open_ui_memory_event, LV_EVENT_CLICKED, nullptr);
+ */
+void open_ui_memory_event(lv_event_t *) {
+  push_screen(SCREEN_UI_MEMORY);
+}
+
+/*
+ * open_profiler_event
+ * Event handler that opens the main loop profiler screen.
+ * Example:
+ *   lv_obj_add_event_cb(btn, open_profiler_event, LV_EVENT_CLICKED, nullptr);
+ */
+void open_profiler_event(lv_event_t *) {
+  push_screen(SCREEN_PROFILER);
+}
+
+/*
+ * open_flash_stats_event
+ * Event handler that opens the flash I/O and wear screen.
+ * Example:
+ *   lv_obj_add_event_cb(btn, open_flash_stats_event, LV_EVENT_CLICKED, nullptr);
+ */
+void open_flash_stats_event(lv_event_t *) {
+  push_screen(SCREEN_FLASH_STATS);
+}
+
+/*
+ * profiler_reset_event
+ * Event handler that clears the profiler statistics.
+ * Example:
+ *   lv_obj_add_event_cb(btn, profiler_reset_event, LV_EVENT_CLICKED, nullptr);
+ */
+void profiler_reset_event(lv_event_t *) {
+  profilerReset();
+  g_profiler_refs.last_update_ms = 0;
+}
+
 /*
  * reset_logs_handler
  * Prompt callback that clears logs and inserts a boot log.
@@ -1024,7 +1268,7 @@ void cal_moist_save_event(lv_event_t *) {
   } else if (g_cal_moist_mode == 2) {
     config.moistSensorCalibrationSoaked = value;
   }
-  saveConfig();
+  markConfigDirty(CONFIG_FIELD_MOIST_CAL);
   g_setup.moisture_cal = true;
   maybe_refresh_initial_setup();
   setSoilSensorLazy();
@@ -1078,7 +1322,7 @@ void cal_flow_action_event(lv_event_t *) {
     config.pulseOffSeconds = off_sec;
     config.flags |= CONFIG_FLAG_DRIPPER_CALIBRATED;
     config.flags |= CONFIG_FLAG_PULSE_SET;
-    saveConfig();
+    markConfigDirty(CONFIG_FIELD_DRIPPER);
 
     g_setup.dripper_cal = true;
     maybe_refresh_initial_setup();
@@ -1128,6 +1372,57 @@ void cal_flow_next_event(lv_event_t *) {
   }
 }
 
+/*
+ * screensaver_move_idle_ms
+ * Returns milliseconds until the screensaver plant is due to move, or 0 when
+ * the move is already due.
+ * Example:
+ *   uint32_t move_idle = screensaver_move_idle_ms();
+ */
+static uint32_t screensaver_move_idle_ms() {
+  uint32_t since_move = millis() - g_last_screensaver_move_ms;
+  return (since_move > kScreensaverMoveMs) ? 0 : kScreensaverMoveMs - since_move + 1;
+}
+
+/*
+ * ui_idle_sleep_ms
+ * Returns how long the device may light-sleep: only while the screensaver is
+ * up and no feed runs, bounded by the next plant move and sim work.
+ * Example:
+ *   uint32_t idle = ui_idle_sleep_ms();
+ */
+uint32_t ui_idle_sleep_ms() {
+  if (!g_screensaver_active || g_active_screen != SCREEN_INFO) return 0;
+  if (feedingIsActive()) return 0;
+
+  uint32_t idle = sim_idle_ms();
+  uint32_t move_idle = screensaver_move_idle_ms();
+  if (move_idle < idle) idle = move_idle;
+  return idle;
+}
+
+/*
+ * ui_pacing_idle_ms
+ * Returns how long the main loop may wait on control work, or
+ * LOOP_PACING_FULL_RATE while a recent touch, a feed or an animation needs
+ * the normal frame cadence.
+ * Example:
+ *   uint32_t wait = loopPacingDelayMs(next, ui_pacing_idle_ms());
+ */
+uint32_t ui_pacing_idle_ms() {
+  if (feedingIsActive()) return LOOP_PACING_FULL_RATE;
+  if (millis() - g_last_touch_ms < kPacingActiveHoldMs) return LOOP_PACING_FULL_RATE;
+  if (lv_anim_count_running() > 0) return LOOP_PACING_FULL_RATE;
+
+  uint32_t idle = sim_idle_ms();
+  if (g_screensaver_active) {
+    uint32_t move_idle = screensaver_move_idle_ms();
+    if (move_idle < idle) idle = move_idle;
+  }
+  // Keep a deadline that is already due distinct from the full-rate marker.
+  return (idle == LOOP_PACING_FULL_RATE) ? 1 : idle;
+}
+
 /*
  * build_ui
  * Applies theme, pushes the initial screen, and starts the UI timer.
@@ -1136,7 +1431,7 @@ void cal_flow_next_event(lv_event_t *) {
  */
 void build_ui() {
   lv_display_t *disp = lv_display_get_default();
-  lv_theme_t *theme = lv_theme_default_init(disp, kColorAccent, kColorMuted, true, &lv_font_montserrat_14);
+  lv_theme_t *theme = lv_theme_default_init(disp, kColorAccent, kColorMuted, true, UI_FONT_14);
   lv_display_set_theme(disp, theme);
 
   // TODO/FIXME: remove forced wizard step after layout tuning is complete.
@@ -1150,10 +1445,5 @@ void build_ui() {
 
   g_debug_label = nullptr;
 
-#ifdef WOKWI_SIM
-  const uint32_t kUiTimerPeriodMs = 1200;
-#else
-  const uint32_t kUiTimerPeriodMs = 200;
-#endif
   g_ui_timer = lv_timer_create(ui_timer_cb, kUiTimerPeriodMs, nullptr);
 }
@@ -1,3 +1,10 @@
 #pragma once
 
+#include "app_state.h"
+#include <stdint.h>
+
 void build_ui();
+uint32_t ui_idle_sleep_ms();
+uint32_t ui_pacing_idle_ms();
+uint32_t count_obj_tree(lv_obj_t *root);
+const char *ui_screen_name(ScreenId id);
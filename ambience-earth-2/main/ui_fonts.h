@@ -0,0 +1,14 @@
+#pragma once
+
+#include "lvgl_config.h"
+
+// Fonts the UI renders with. tools/gen-ui-fonts.py generates ui_fonts_data.h
+// and ui_font_montserrat_*.c holding only the glyphs the UI can show; without
+// them (no Node.js on the build machine) the full built-ins are used.
+#ifdef UI_FONTS_SUBSET
+#include "ui_fonts_data.h"
+#else
+#define UI_FONT_12 (&lv_font_montserrat_12)
+#define UI_FONT_14 (&lv_font_montserrat_14)
+#define UI_FONT_18 (&lv_font_montserrat_18)
+#endif
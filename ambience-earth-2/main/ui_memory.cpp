@@ -0,0 +1,193 @@
+#include "ui_memory.h"
+
+#include "ui_flow.h"
+#include "ui_screens.h"
+#include <Arduino.h>
+#if defined(UI_LVGL_PSRAM_POOL) && !defined(WOKWI_SIM)
+#include <esp_heap_caps.h>
+#endif
+
+static UiMemScreenStats g_screen_stats[SCREEN_COUNT] = {};
+static ScreenId g_shown_screen = SCREEN_COUNT;
+static uint32_t g_shown_base_bytes = 0;
+static uint32_t g_last_sample_ms = 0;
+static uint32_t g_last_trend_ms = 0;
+static uint8_t g_frag_trend[kUiMemTrendSamples] = {};
+static int g_frag_trend_count = 0;
+static int g_frag_trend_head = 0;
+static uint32_t g_min_free_biggest = UINT32_MAX;
+static uint16_t g_budget_violations = 0;
+static uint8_t g_pools_added = 0;
+static uint32_t g_pool_bytes_added = 0;
+
+/*
+ * grow_pool
+ * Adds a PSRAM chunk to the LVGL heap (TLSF supports extra pools); returns
+ * false when PSRAM pools are disabled, absent or used up.
+ * Example:
+ *   if (ui_mem_free_bytes() < kScreenCacheMinFreeBytes) grow_pool();
+ */
+static bool grow_pool() {
+#if defined(UI_LVGL_PSRAM_POOL) && !defined(WOKWI_SIM)
+  if (g_pools_added >= kLvglPsramPoolMax || !psramFound()) return false;
+  void *mem = heap_caps_malloc(kLvglPsramPoolBytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (!mem) return false;
+  lv_mem_add_pool(mem, kLvglPsramPoolBytes);
+  g_pools_added++;
+  g_pool_bytes_added += kLvglPsramPoolBytes;
+  Serial.printf("[UI_MEM] added %u byte PSRAM pool (%u extra)\r\n", static_cast<unsigned>(kLvglPsramPoolBytes),
+                static_cast<unsigned>(g_pool_bytes_added));
+  return true;
+#else
+  return false;
+#endif
+}
+
+/*
+ * ui_mem_used_bytes
+ * Returns bytes currently allocated from the LVGL heap.
+ * Example:
+ *   uint32_t before = ui_mem_used_bytes();
+ */
+uint32_t ui_mem_used_bytes() {
+  lv_mem_monitor_t mon = {};
+  lv_mem_monitor(&mon);
+  return static_cast<uint32_t>(mon.total_size - mon.free_size);
+}
+
+/*
+ * ui_mem_free_bytes
+ * Returns bytes still free in the LVGL heap.
+ * Example:
+ *   if (ui_mem_free_bytes() < kScreenCacheMinFreeBytes) { ... }
+ */
+uint32_t ui_mem_free_bytes() {
+  lv_mem_monitor_t mon = {};
+  lv_mem_monitor(&mon);
+  return static_cast<uint32_t>(mon.free_size);
+}
+
+/*
+ * ui_mem_reserve
+ * Makes sure a block of bytes is likely to fit before a screen is built,
+ * growing the heap from PSRAM when that is enabled.
+ * Example:
+ *   ui_mem_reserve(screen_mem_budget(id));
+ */
+void ui_mem_reserve(uint32_t bytes) {
+  lv_mem_monitor_t mon = {};
+  lv_mem_monitor(&mon);
+  if (mon.free_biggest_size < bytes) grow_pool();
+}
+
+/*
+ * ui_mem_screen_built
+ * Records what a fresh build of a screen cost and checks it against the
+ * screen's budget in UI_MEM_CHECKS builds.
+ * Example:
+ *   ui_mem_screen_built(SCREEN_LOGS, after - before, count_obj_tree(root));
+ */
+void ui_mem_screen_built(ScreenId id, uint32_t bytes, uint32_t objs) {
+  if (id >= SCREEN_COUNT) return;
+  UiMemScreenStats &stats = g_screen_stats[id];
+  stats.last_build_bytes = bytes;
+  if (bytes > stats.max_build_bytes) stats.max_build_bytes = bytes;
+  stats.last_objs = static_cast<uint16_t>(objs > UINT16_MAX ? UINT16_MAX : objs);
+  if (stats.builds < UINT16_MAX) stats.builds++;
+
+  uint32_t budget = screen_mem_budget(id);
+  bool over = false;
+#ifdef UI_MEM_CHECKS
+  if (bytes > budget) {
+    over = true;
+    if (stats.over_budget < UINT16_MAX) stats.over_budget++;
+    if (g_budget_violations < UINT16_MAX) g_budget_violations++;
+  }
+#endif
+  Serial.printf("[UI_MEM] build %s bytes=%u max=%u budget=%u objs=%u%s\r\n", ui_screen_name(id),
+                static_cast<unsigned>(bytes), static_cast<unsigned>(stats.max_build_bytes),
+                static_cast<unsigned>(budget), static_cast<unsigned>(objs), over ? " OVER BUDGET" : "");
+}
+
+/*
+ * ui_mem_screen_shown
+ * Marks the heap level when a screen becomes active, for runtime growth.
+ * Example:
+ *   ui_mem_screen_shown(SCREEN_INFO);
+ */
+void ui_mem_screen_shown(ScreenId id) {
+  g_shown_screen = id;
+  g_shown_base_bytes = ui_mem_used_bytes();
+}
+
+/*
+ * ui_mem_sample
+ * Periodically samples the LVGL heap: high-water, largest free block,
+ * the active screen's growth and the fragmentation trend.
+ * Example:
+ *   ui_mem_sample(millis());
+ */
+void ui_mem_sample(uint32_t now_ms) {
+  if (g_last_sample_ms != 0 && now_ms - g_last_sample_ms < kUiMemSampleMs) return;
+  g_last_sample_ms = now_ms;
+
+  lv_mem_monitor_t mon = {};
+  lv_mem_monitor(&mon);
+  uint32_t used = static_cast<uint32_t>(mon.total_size - mon.free_size);
+  if (mon.free_biggest_size < g_min_free_biggest) g_min_free_biggest = static_cast<uint32_t>(mon.free_biggest_size);
+
+  if (g_shown_screen < SCREEN_COUNT && used > g_shown_base_bytes) {
+    UiMemScreenStats &stats = g_screen_stats[g_shown_screen];
+    uint32_t grown = used - g_shown_base_bytes;
+    if (grown > stats.max_active_bytes) stats.max_active_bytes = grown;
+  }
+
+  if (g_frag_trend_count == 0 || now_ms - g_last_trend_ms >= kUiMemTrendMs) {
+    g_last_trend_ms = now_ms;
+    g_frag_trend[g_frag_trend_head] = mon.frag_pct;
+    g_frag_trend_head = (g_frag_trend_head + 1) % kUiMemTrendSamples;
+    if (g_frag_trend_count < kUiMemTrendSamples) g_frag_trend_count++;
+  }
+
+  if (mon.free_size < kScreenCacheMinFreeBytes) grow_pool();
+}
+
+/*
+ * ui_mem_get_stats
+ * Fills a snapshot of the heap-wide counters.
+ * Example:
+ *   UiMemStats stats = {};
+ *   ui_mem_get_stats(&stats);
+ */
+void ui_mem_get_stats(UiMemStats *out) {
+  if (!out) return;
+  lv_mem_monitor_t mon = {};
+  lv_mem_monitor(&mon);
+  *out = {};
+  out->total_bytes = static_cast<uint32_t>(mon.total_size);
+  out->used_bytes = static_cast<uint32_t>(mon.total_size - mon.free_size);
+  out->high_water_bytes = static_cast<uint32_t>(mon.max_used);
+  out->free_biggest_bytes = static_cast<uint32_t>(mon.free_biggest_size);
+  out->min_free_biggest_bytes = (g_min_free_biggest == UINT32_MAX) ? out->free_biggest_bytes : g_min_free_biggest;
+  out->frag_pct = mon.frag_pct;
+  if (g_frag_trend_count > 1) {
+    int oldest = (g_frag_trend_count < kUiMemTrendSamples) ? 0 : g_frag_trend_head;
+    int newest = (g_frag_trend_head + kUiMemTrendSamples - 1) % kUiMemTrendSamples;
+    out->frag_trend_pct = static_cast<int8_t>(g_frag_trend[newest] - g_frag_trend[oldest]);
+    out->trend_minutes = static_cast<uint8_t>((g_frag_trend_count - 1) * (kUiMemTrendMs / 60000UL));
+  }
+  out->pools_added = g_pools_added;
+  out->pool_bytes_added = g_pool_bytes_added;
+  out->budget_violations = g_budget_violations;
+}
+
+/*
+ * ui_mem_screen_stats
+ * Returns the accounting record for one screen.
+ * Example:
+ *   uint32_t bytes = ui_mem_screen_stats(SCREEN_LOGS).last_build_bytes;
+ */
+const UiMemScreenStats &ui_mem_screen_stats(ScreenId id) {
+  static const UiMemScreenStats kEmpty = {};
+  return (id < SCREEN_COUNT) ? g_screen_stats[id] : kEmpty;
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "app_state.h"
+
+struct UiMemScreenStats {
+  uint32_t last_build_bytes;
+  uint32_t max_build_bytes;
+  // Growth on top of the build while the screen was shown (label text etc.).
+  uint32_t max_active_bytes;
+  uint16_t last_objs;
+  uint16_t builds;
+  uint16_t over_budget;
+};
+
+struct UiMemStats {
+  uint32_t total_bytes;
+  uint32_t used_bytes;
+  uint32_t high_water_bytes;
+  uint32_t free_biggest_bytes;
+  uint32_t min_free_biggest_bytes;
+  uint8_t frag_pct;
+  int8_t frag_trend_pct;
+  uint8_t trend_minutes;
+  uint8_t pools_added;
+  uint32_t pool_bytes_added;
+  uint16_t budget_violations;
+};
+
+/*
+ * ui_mem_used_bytes
+ * Returns bytes currently allocated from the LVGL heap.
+ * Example:
+ *   uint32_t before = ui_mem_used_bytes();
+ */
+uint32_t ui_mem_used_bytes();
+
+/*
+ * ui_mem_free_bytes
+ * Returns bytes still free in the LVGL heap.
+ * Example:
+ *   if (ui_mem_free_bytes() < kScreenCacheMinFreeBytes) { ... }
+ */
+uint32_t ui_mem_free_bytes();
+
+/*
+ * ui_mem_reserve
+ * Makes sure a block of bytes is likely to fit before a screen is built,
+ * growing the heap from PSRAM when that is enabled.
+ * Example:
+ *   ui_mem_reserve(screen_mem_budget(id));
+ */
+void ui_mem_reserve(uint32_t bytes);
+
+/*
+ * ui_mem_screen_built
+ * Records what a fresh build of a screen cost and checks it against the
+ * screen's budget in UI_MEM_CHECKS builds.
+ * Example:
+ *   ui_mem_screen_built(SCREEN_LOGS, after - before, count_obj_tree(root));
+ */
+void ui_mem_screen_built(ScreenId id, uint32_t bytes, uint32_t objs);
+
+/*
+ * ui_mem_screen_shown
+ * Marks the heap level when a screen becomes active, for runtime growth.
+ * Example:
+ *   ui_mem_screen_shown(SCREEN_INFO);
+ */
+void ui_mem_screen_shown(ScreenId id);
+
+/*
+ * ui_mem_sample
+ * Periodically samples the LVGL heap: high-water, largest free block,
+ * the active screen's growth and the fragmentation trend.
+ * Example:
+ *   ui_mem_sample(millis());
+ */
+void ui_mem_sample(uint32_t now_ms);
+
+/*
+ * ui_mem_get_stats
+ * Fills a snapshot of the heap-wide counters.
+ * Example:
+ *   UiMemStats stats = {};
+ *   ui_mem_get_stats(&stats);
+ */
+void ui_mem_get_stats(UiMemStats *out);
+
+/*
+ * ui_mem_screen_stats
+ * Returns the accounting record for one screen.
+ * Example:
+ *   uint32_t bytes = ui_mem_screen_stats(SCREEN_LOGS).last_build_bytes;
+ */
+const UiMemScreenStats &ui_mem_screen_stats(ScreenId id);
@@ -4,21 +4,26 @@
 #include "config.h"
 #include "feeding.h"
 #include "feedingUtils.h"
+#include "flashStats.h"
 #include "logs.h"
 #include "moistureSensor.h"
+#include "profiler.h"
 #include "pumps.h"
 #include "rtc.h"
 #include "runoffSensor.h"
+#include "soilTempSensor.h"
 #include "ui_components.h"
+#include "ui_flow.h"
+#include "ui_memory.h"
 #include "volume.h"
-#include "day_night_icons.h"
-#include "plant_image.h"
+#include "image_assets.h"
 
 static const uint32_t kPlantScale = 256; // 1x
 static const int16_t kPlantDrawW = static_cast<int16_t>(kPlantW * kPlantScale / 256);
 static const int16_t kPlantDrawH = static_cast<int16_t>(kPlantH * kPlantScale / 256);
 static const uint32_t kDayNightScale = 112; // ~14px for 32px icons
 static const int16_t kPlantIconGap = 8;
+static const uint32_t kDiagRefreshMs = 1000;
 
 #include <Arduino.h>
 #include <stdio.h>
@@ -27,6 +32,7 @@ static const int16_t kPlantIconGap = 8;
 void back_event(lv_event_t *);
 void open_menu_event(lv_event_t *);
 void open_logs_event(lv_event_t *);
+void open_history_event(lv_event_t *);
 void open_feeding_event(lv_event_t *);
 void open_force_feed_event(lv_event_t *);
 void toggle_pause_event(lv_event_t *);
@@ -43,6 +49,7 @@ void edit_slot_event(lv_event_t *);
 void feed_now_event(lv_event_t *);
 void logs_prev_event(lv_event_t *);
 void logs_next_event(lv_event_t *);
+void history_range_event(lv_event_t *);
 void wizard_back_event(lv_event_t *);
 void wizard_next_event(lv_event_t *);
 void wizard_save_event(lv_event_t *);
@@ -55,8 +62,13 @@ void open_test_menu_event(lv_event_t *);
 void open_reset_menu_event(lv_event_t *);
 void open_cal_moist_event(lv_event_t *);
 void open_cal_flow_event(lv_event_t *);
+void open_temp_comp_event(lv_event_t *);
 void open_test_sensors_event(lv_event_t *);
 void open_test_pumps_event(lv_event_t *);
+void open_ui_memory_event(lv_event_t *);
+void open_profiler_event(lv_event_t *);
+void open_flash_stats_event(lv_event_t *);
+void profiler_reset_event(lv_event_t *);
 void reset_logs_event(lv_event_t *);
 void reset_factory_event(lv_event_t *);
 void open_initial_setup_event(lv_event_t *);
@@ -89,13 +101,8 @@ static bool setup_complete() {
  */
 static void toggle_day_night_icons(bool day_now) {
   if (!g_info_refs.day_night_icon || !g_info_refs.night_icon) return;
-  if (day_now) {
-    lv_obj_clear_flag(g_info_refs.day_night_icon, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_add_flag(g_info_refs.night_icon, LV_OBJ_FLAG_HIDDEN);
-  } else {
-    lv_obj_add_flag(g_info_refs.day_night_icon, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_clear_flag(g_info_refs.night_icon, LV_OBJ_FLAG_HIDDEN);
-  }
+  set_obj_hidden(g_info_refs.day_night_icon, !day_now);
+  set_obj_hidden(g_info_refs.night_icon, day_now);
 }
 
 /*
@@ -108,31 +115,31 @@ static void update_info_screen() {
   if (!g_info_refs.moist_value) return;
 
   if (g_screensaver_active) {
-    lv_obj_add_flag(g_info_refs.main, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_add_flag(g_info_refs.menu_row, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_clear_flag(g_info_refs.screensaver_root, LV_OBJ_FLAG_HIDDEN);
-    if (g_info_refs.play_pause_icon) lv_obj_add_flag(g_info_refs.play_pause_icon, LV_OBJ_FLAG_HIDDEN);
-    if (g_debug_label) lv_obj_add_flag(g_debug_label, LV_OBJ_FLAG_HIDDEN);
+    set_obj_hidden(g_info_refs.main, true);
+    set_obj_hidden(g_info_refs.menu_row, true);
+    set_obj_hidden(g_info_refs.screensaver_root, false);
+    set_obj_hidden(g_info_refs.play_pause_icon, true);
+    set_obj_hidden(g_debug_label, true);
     if (feedingRunoffWarning()) {
-      lv_label_set_text(g_info_refs.screensaver_icon, "!");
+      set_label_text(g_info_refs.screensaver_icon, "!");
     } else {
-      lv_label_set_text(g_info_refs.screensaver_icon,
-                        feedingIsEnabled() ? LV_SYMBOL_PLAY : LV_SYMBOL_PAUSE);
+      set_label_text(g_info_refs.screensaver_icon,
+                     feedingIsEnabled() ? LV_SYMBOL_PLAY : LV_SYMBOL_PAUSE);
     }
-    lv_obj_clear_flag(g_info_refs.screensaver_icon, LV_OBJ_FLAG_HIDDEN);
+    set_obj_hidden(g_info_refs.screensaver_icon, false);
     return;
   }
 
-  lv_obj_clear_flag(g_info_refs.main, LV_OBJ_FLAG_HIDDEN);
-  lv_obj_clear_flag(g_info_refs.menu_row, LV_OBJ_FLAG_HIDDEN);
-  lv_obj_add_flag(g_info_refs.screensaver_root, LV_OBJ_FLAG_HIDDEN);
-  if (g_info_refs.play_pause_icon) lv_obj_clear_flag(g_info_refs.play_pause_icon, LV_OBJ_FLAG_HIDDEN);
-  if (g_debug_label) lv_obj_clear_flag(g_debug_label, LV_OBJ_FLAG_HIDDEN);
+  set_obj_hidden(g_info_refs.main, false);
+  set_obj_hidden(g_info_refs.menu_row, false);
+  set_obj_hidden(g_info_refs.screensaver_root, true);
+  set_obj_hidden(g_info_refs.play_pause_icon, false);
+  set_obj_hidden(g_debug_label, false);
 
   char time_buf[8] = {0};
   format_time(g_sim.now, time_buf, sizeof(time_buf));
 
-  uint16_t now_minutes = static_cast<uint16_t>(g_sim.now.hour * 60 + g_sim.now.minute);
+  uint16_t now_minutes = epochMinuteOfDay(g_sim.now);
   uint16_t on_minutes = config.lightsOnMinutes;
   uint16_t off_minutes = config.lightsOffMinutes;
   uint16_t duration = (off_minutes >= on_minutes)
@@ -163,47 +170,46 @@ static void update_info_screen() {
   FeedStatus status = {};
   if (feedingGetStatus(&status)) {
     bool show_status = true;
-    lv_label_set_text_fmt(g_info_refs.moist_value, "S%d", status.slotIndex + 1);
-    lv_label_set_text(g_info_refs.baseline_value, "--");
-    lv_label_set_text(g_info_refs.dry_value, "--");
-    lv_label_set_text(g_info_refs.minmax_value, "--/--%");
+    set_label_fmt(g_info_refs.moist_value, "S%d", status.slotIndex + 1);
+    set_label_text(g_info_refs.baseline_value, "--");
+    set_label_text(g_info_refs.dry_value, "--");
+    set_label_text(g_info_refs.minmax_value, "--/--%");
 
-    lv_label_set_text(g_info_refs.time_value, time_buf);
-    lv_label_set_text(g_info_refs.last_value, last_buf);
+    set_label_text(g_info_refs.time_value, time_buf);
+    set_label_text(g_info_refs.last_value, last_buf);
     if (g_info_refs.play_pause_icon) {
-      lv_label_set_text(g_info_refs.play_pause_icon, feedingIsEnabled() ? LV_SYMBOL_PLAY : LV_SYMBOL_PAUSE);
+      set_label_text(g_info_refs.play_pause_icon, feedingIsEnabled() ? LV_SYMBOL_PLAY : LV_SYMBOL_PAUSE);
     }
     // DEBUG: simulation preview for Today value. TODO: remove debug override.
     // lv_label_set_text(g_info_refs.today_value, "5000ml");
-    lv_label_set_text_fmt(g_info_refs.today_value, "%dml", daily_total);
+    set_label_fmt(g_info_refs.today_value, "%dml", daily_total);
     toggle_day_night_icons(day_now);
-    lv_obj_add_flag(g_info_refs.status_icon, LV_OBJ_FLAG_HIDDEN);
+    set_obj_hidden(g_info_refs.status_icon, true);
     if (status.moistureReady) {
-      lv_label_set_text_fmt(g_info_refs.status_value, "Pump %s | Mst %d%% | %ds",
-                            status.pumpOn ? "ON" : "OFF",
-                            status.moisturePercent, status.elapsedSeconds);
+      set_label_fmt(g_info_refs.status_value, "Pump %s | Mst %d%% | %ds",
+                    status.pumpOn ? "ON" : "OFF",
+                    status.moisturePercent, status.elapsedSeconds);
     } else {
-      lv_label_set_text_fmt(g_info_refs.status_value, "Pump %s | Mst --%% | %ds",
-                            status.pumpOn ? "ON" : "OFF",
-                            status.elapsedSeconds);
+      set_label_fmt(g_info_refs.status_value, "Pump %s | Mst --%% | %ds",
+                    status.pumpOn ? "ON" : "OFF",
+                    status.elapsedSeconds);
     }
 
     uint16_t delivered = msToVolumeMl(static_cast<uint32_t>(status.elapsedSeconds) * 1000UL,
                                       config.dripperMsPerLiter);
     if (g_info_refs.totals_value) {
-      lv_label_set_text_fmt(g_info_refs.totals_value, "Max %dml | W %dml",
-                            status.maxVolumeMl, delivered);
-    }
-    if (g_info_refs.status_row) {
-      if (show_status) lv_obj_clear_flag(g_info_refs.status_row, LV_OBJ_FLAG_HIDDEN);
-      else lv_obj_add_flag(g_info_refs.status_row, LV_OBJ_FLAG_HIDDEN);
+      set_label_fmt(g_info_refs.totals_value, "Max %dml | W %dml",
+                    status.maxVolumeMl, delivered);
     }
+    set_obj_hidden(g_info_refs.status_row, !show_status);
     return;
   }
 
   uint8_t dryback = 0;
-  bool has_dryback = getDrybackPercent(&dryback);
-  lv_label_set_text_fmt(g_info_refs.moist_value, "%d%%", g_sim.moisture);
+  bool sensor_failed = g_sim.sensor_health == SENSOR_FAILED;
+  bool has_dryback = !sensor_failed && getDrybackPercent(&dryback);
+  if (sensor_failed) set_label_text(g_info_refs.moist_value, "Err");
+  else set_label_fmt(g_info_refs.moist_value, "%d%%", g_sim.moisture);
 
   char baseline_buf[8] = {0};
   char dryback_buf[8] = {0};
@@ -227,30 +233,32 @@ static void update_info_screen() {
     snprintf(minmax_buf, sizeof(minmax_buf), "--/--%%");
   }
 
-  lv_label_set_text(g_info_refs.baseline_value, baseline_buf);
-  lv_label_set_text(g_info_refs.dry_value, dryback_buf);
-  lv_label_set_text(g_info_refs.minmax_value, minmax_buf);
+  set_label_text(g_info_refs.baseline_value, baseline_buf);
+  set_label_text(g_info_refs.dry_value, dryback_buf);
+  set_label_text(g_info_refs.minmax_value, minmax_buf);
+  if (g_info_refs.soil_temp_value) {
+    char temp_buf[10] = {0};
+    if (g_sim.soil_temp_ready) {
+      format_deci_celsius(g_sim.soil_temp_deci_c, temp_buf, sizeof(temp_buf));
+    } else {
+      snprintf(temp_buf, sizeof(temp_buf), "--C");
+    }
+    set_label_text(g_info_refs.soil_temp_value, temp_buf);
+  }
   if (g_info_refs.play_pause_icon) {
-    lv_label_set_text(g_info_refs.play_pause_icon, feedingIsEnabled() ? LV_SYMBOL_PLAY : LV_SYMBOL_PAUSE);
+    set_label_text(g_info_refs.play_pause_icon, feedingIsEnabled() ? LV_SYMBOL_PLAY : LV_SYMBOL_PAUSE);
   }
   // DEBUG: simulation preview for Today value. TODO: remove debug override.
   // lv_label_set_text(g_info_refs.today_value, "5000ml");
-  lv_label_set_text_fmt(g_info_refs.today_value, "%dml", daily_total);
-  lv_label_set_text(g_info_refs.time_value, time_buf);
-  lv_label_set_text(g_info_refs.last_value, last_buf);
+  set_label_fmt(g_info_refs.today_value, "%dml", daily_total);
+  set_label_text(g_info_refs.time_value, time_buf);
+  set_label_text(g_info_refs.last_value, last_buf);
   toggle_day_night_icons(day_now);
-  bool show_status = feedingRunoffWarning();
-  lv_label_set_text(g_info_refs.status_value, "");
-  if (show_status) {
-    lv_label_set_text(g_info_refs.status_icon, "!");
-    lv_obj_clear_flag(g_info_refs.status_icon, LV_OBJ_FLAG_HIDDEN);
-  } else {
-    lv_obj_add_flag(g_info_refs.status_icon, LV_OBJ_FLAG_HIDDEN);
-  }
-  if (g_info_refs.status_row) {
-    if (show_status) lv_obj_clear_flag(g_info_refs.status_row, LV_OBJ_FLAG_HIDDEN);
-    else lv_obj_add_flag(g_info_refs.status_row, LV_OBJ_FLAG_HIDDEN);
-  }
+  bool show_status = feedingRunoffWarning() || sensor_failed;
+  set_label_text(g_info_refs.status_value, sensor_failed ? "Sensor" : "");
+  if (show_status) set_label_text(g_info_refs.status_icon, "!");
+  set_obj_hidden(g_info_refs.status_icon, !show_status);
+  set_obj_hidden(g_info_refs.status_row, !show_status);
 }
 
 /*
@@ -270,39 +278,39 @@ static void update_feeding_screen() {
     snprintf(fallback, sizeof(fallback), "S%d", status.slotIndex + 1);
     slot_name = fallback;
   }
-  lv_label_set_text_fmt(g_feeding_refs.header_value, "Feeding: %s", slot_name);
-  lv_label_set_text_fmt(g_feeding_refs.pulse_value, "%d/%d",
-                        config.pulseOnSeconds,
-                        config.pulseOffSeconds);
+  set_label_fmt(g_feeding_refs.header_value, "Feeding: %s", slot_name);
+  set_label_fmt(g_feeding_refs.pulse_value, "%d/%d",
+                config.pulseOnSeconds,
+                config.pulseOffSeconds);
 
-  lv_label_set_text(g_feeding_refs.pump_value, status.pumpOn ? "ON" : "OFF");
+  set_label_text(g_feeding_refs.pump_value, status.pumpOn ? "ON" : "OFF");
   if (status.moistureReady) {
-    lv_label_set_text_fmt(g_feeding_refs.moisture_value, "%d%%", status.moisturePercent);
+    set_label_fmt(g_feeding_refs.moisture_value, "%d%%", status.moisturePercent);
   } else {
-    lv_label_set_text(g_feeding_refs.moisture_value, "--%");
+    set_label_text(g_feeding_refs.moisture_value, "--%");
   }
-  lv_label_set_text_fmt(g_feeding_refs.time_value, "%ds", status.elapsedSeconds);
+  set_label_fmt(g_feeding_refs.time_value, "%ds", status.elapsedSeconds);
 
   if (status.runoffRequired && status.hasMoistureTarget) {
-    lv_label_set_text_fmt(g_feeding_refs.stop_value, "Runoff or %d%% moisture",
-                          status.moistureTarget);
+    set_label_fmt(g_feeding_refs.stop_value, "Runoff or %d%% moisture",
+                  status.moistureTarget);
   } else if (status.runoffRequired) {
-    lv_label_set_text(g_feeding_refs.stop_value, "Runoff");
+    set_label_text(g_feeding_refs.stop_value, "Runoff");
   } else if (status.hasMoistureTarget) {
-    lv_label_set_text_fmt(g_feeding_refs.stop_value, "%d%% moisture",
-                          status.moistureTarget);
+    set_label_fmt(g_feeding_refs.stop_value, "%d%% moisture",
+                  status.moistureTarget);
   } else {
-    lv_label_set_text(g_feeding_refs.stop_value, "Full delivery");
+    set_label_text(g_feeding_refs.stop_value, "Full delivery");
   }
 
   uint16_t delivered = msToVolumeMl(static_cast<uint32_t>(status.elapsedSeconds) * 1000UL,
                                     config.dripperMsPerLiter);
   if (status.maxVolumeMl) {
-    lv_label_set_text_fmt(g_feeding_refs.max_value, "%dml", status.maxVolumeMl);
+    set_label_fmt(g_feeding_refs.max_value, "%dml", status.maxVolumeMl);
   } else {
-    lv_label_set_text(g_feeding_refs.max_value, "-");
+    set_label_text(g_feeding_refs.max_value, "-");
   }
-  lv_label_set_text_fmt(g_feeding_refs.delivered_value, "%dml", delivered);
+  set_label_fmt(g_feeding_refs.delivered_value, "%dml", delivered);
 }
 
 /*
@@ -314,10 +322,10 @@ static void update_feeding_screen() {
 void update_logs_screen() {
   if (!g_logs_refs.header) return;
   if (g_log_count == 0) {
-    lv_label_set_text(g_logs_refs.header, "No logs");
-    lv_label_set_text(g_logs_refs.line1, "");
-    lv_label_set_text(g_logs_refs.line2, "");
-    lv_label_set_text(g_logs_refs.line3, "");
+    set_label_text(g_logs_refs.header, "No logs");
+    set_label_text(g_logs_refs.line1, "");
+    set_label_text(g_logs_refs.line2, "");
+    set_label_text(g_logs_refs.line3, "");
     return;
   }
 
@@ -325,40 +333,32 @@ void update_logs_screen() {
   if (g_log_index >= g_log_count) g_log_index = g_log_count - 1;
   const LogEntry &entry = g_logs[g_log_index];
 
-  DateTime dt = {};
-  dt.month = entry.startMonth;
-  dt.day = entry.startDay;
-  dt.year = 2000 + entry.startYear;
-  dt.hour = entry.startHour;
-  dt.minute = entry.startMinute;
-  dt.second = 0;
-
   char dt_buf[16] = {0};
-  format_datetime(dt, dt_buf, sizeof(dt_buf));
+  format_datetime(entry.startTime, dt_buf, sizeof(dt_buf));
 
   if (entry.entryType == 0) {
-    lv_label_set_text_fmt(g_logs_refs.header, "# BootUp");
-    lv_label_set_text_fmt(g_logs_refs.line1, "At: %s", dt_buf);
-    lv_label_set_text_fmt(g_logs_refs.line2, "Soil: %d%%", entry.soilMoistureBefore);
+    set_label_fmt(g_logs_refs.header, "# BootUp");
+    set_label_fmt(g_logs_refs.line1, "At: %s", dt_buf);
+    set_label_fmt(g_logs_refs.line2, "Soil: %d%%", entry.soilMoistureBefore);
     if (entry.drybackPercent != LOG_BASELINE_UNSET) {
-      lv_label_set_text_fmt(g_logs_refs.line3, "Db: %d%%", entry.drybackPercent);
+      set_label_fmt(g_logs_refs.line3, "Db: %d%%", entry.drybackPercent);
     } else {
-      lv_label_set_text(g_logs_refs.line3, "Db: --");
+      set_label_text(g_logs_refs.line3, "Db: --");
     }
   } else if (entry.entryType == 1) {
     static const char *kStopLabels[] = {"---", "Mst", "Run", "Max", "Off", "Cfg", "Day", "Cal"};
     uint8_t reason = entry.stopReason;
     if (reason >= (sizeof(kStopLabels) / sizeof(kStopLabels[0]))) reason = 0;
-    lv_label_set_text_fmt(g_logs_refs.header, "# Feed S%d %s", entry.slotIndex + 1, kStopLabels[reason]);
-    lv_label_set_text_fmt(g_logs_refs.line1, "Start: %s", dt_buf);
+    set_label_fmt(g_logs_refs.header, "# Feed S%d %s", entry.slotIndex + 1, kStopLabels[reason]);
+    set_label_fmt(g_logs_refs.line1, "Start: %s", dt_buf);
 
     uint16_t volume_ml = entry.feedMl;
     if (!volume_ml && entry.millisEnd > entry.millisStart) {
       uint32_t elapsed = entry.millisEnd - entry.millisStart;
       volume_ml = msToVolumeMl(elapsed, config.dripperMsPerLiter);
     }
-    lv_label_set_text_fmt(g_logs_refs.line2, "V:%dml Mst:%d-%d%%",
-                          volume_ml, entry.soilMoistureBefore, entry.soilMoistureAfter);
+    set_label_fmt(g_logs_refs.line2, "V:%dml Mst:%d-%d%%",
+                  volume_ml, entry.soilMoistureBefore, entry.soilMoistureAfter);
 
     bool warn = (entry.flags & LOG_FLAG_RUNOFF_ANY) != 0;
     char db_buf[8] = {0};
@@ -367,25 +367,193 @@ void update_logs_screen() {
     } else {
       snprintf(db_buf, sizeof(db_buf), "--");
     }
-    lv_label_set_text_fmt(g_logs_refs.line3, "T:%dml%s Db:%s%s",
-                          entry.dailyTotalMl,
-                          warn ? "!" : "",
-                          db_buf,
-                          (entry.flags & LOG_FLAG_RUNOFF_SEEN) ? " R" : "");
+    set_label_fmt(g_logs_refs.line3, "T:%dml%s Db:%s%s%s",
+                  entry.dailyTotalMl,
+                  warn ? "!" : "",
+                  db_buf,
+                  (entry.flags & LOG_FLAG_RUNOFF_SEEN) ? " R" : "",
+                  (entry.flags & LOG_FLAG_SENSOR_FALLBACK) ? " S!" : "");
+  } else if (entry.entryType == 3) {
+    static const char *kFaultLabels[] = {"Recovered", "Shorted low", "Shorted high", "Stuck", "No response"};
+    uint8_t fault = entry.stopReason;
+    if (fault >= (sizeof(kFaultLabels) / sizeof(kFaultLabels[0]))) fault = 0;
+    set_label_text(g_logs_refs.header, fault ? "# Sensor fault" : "# Sensor OK");
+    set_label_fmt(g_logs_refs.line1, "At: %s", dt_buf);
+    set_label_fmt(g_logs_refs.line2, "State: %s", kFaultLabels[fault]);
+    set_label_fmt(g_logs_refs.line3, "Raw: %d", entry.feedMl);
   } else {
-    lv_label_set_text_fmt(g_logs_refs.header, "# Values");
-    lv_label_set_text_fmt(g_logs_refs.line1, "At: %s", dt_buf);
-    lv_label_set_text_fmt(g_logs_refs.line2, "Moisture: %d%%", entry.soilMoistureBefore);
+    set_label_fmt(g_logs_refs.header, "# Values");
+    set_label_fmt(g_logs_refs.line1, "At: %s", dt_buf);
+    if (entry.soilTempDeciC != LOG_SOIL_TEMP_UNSET) {
+      char temp_buf[10] = {0};
+      format_deci_celsius(entry.soilTempDeciC, temp_buf, sizeof(temp_buf));
+      set_label_fmt(g_logs_refs.line2, "Moisture: %d%% T:%s", entry.soilMoistureBefore, temp_buf);
+    } else {
+      set_label_fmt(g_logs_refs.line2, "Moisture: %d%%", entry.soilMoistureBefore);
+    }
     if (entry.drybackPercent != LOG_BASELINE_UNSET) {
-      lv_label_set_text_fmt(g_logs_refs.line3, "Db: %d%%", entry.drybackPercent);
+      set_label_fmt(g_logs_refs.line3, "Db: %d%%", entry.drybackPercent);
     } else {
-      lv_label_set_text(g_logs_refs.line3, "Db: --");
+      set_label_text(g_logs_refs.line3, "Db: --");
     }
   }
 
   if (g_logs_refs.index_label) {
-    lv_label_set_text_fmt(g_logs_refs.index_label, "%d/%d", g_log_index + 1, g_log_count);
+    set_label_fmt(g_logs_refs.index_label, "%d/%d", g_log_index + 1, g_log_count);
+  }
+}
+
+struct HistoryRange {
+  const char *label;
+  uint16_t hours;
+  uint8_t hours_per_point;
+};
+
+static const HistoryRange kHistoryRanges[kHistoryRangeCount] = {
+  {"1 day", 24, 1},
+  {"3 days", 72, 1},
+  {"7 days", LOG_HISTORY_HOURS, 2},
+};
+
+/*
+ * history_point
+ * Aggregates the rollup hours behind one chart point: mean moisture (or
+ * LV_CHART_POINT_NONE) and total ml fed.
+ * Example:
+ *   history_point(point, 2, &moisture, &fed_ml);
+ */
+static void history_point(uint32_t point, uint8_t hours_per_point, int32_t *out_moisture, uint16_t *out_fed_ml) {
+  uint16_t sum = 0;
+  uint8_t count = 0;
+  uint32_t fed = 0;
+  for (uint8_t i = 0; i < hours_per_point; ++i) {
+    uint8_t moisture = LOG_HISTORY_UNSET;
+    uint16_t ml = 0;
+    if (!getMoistureHistoryHour(point * hours_per_point + i, &moisture, &ml)) continue;
+    if (moisture != LOG_HISTORY_UNSET) {
+      sum = static_cast<uint16_t>(sum + moisture);
+      count++;
+    }
+    fed += ml;
+  }
+  *out_moisture = count ? static_cast<int32_t>((sum + count / 2) / count) : LV_CHART_POINT_NONE;
+  *out_fed_ml = static_cast<uint16_t>(fed > UINT16_MAX ? UINT16_MAX : fed);
+}
+
+/*
+ * update_history_summary
+ * Shows latest/min/max moisture and total fed across the visible range.
+ * Example:
+ *   update_history_summary(first_point, points, range);
+ */
+static void update_history_summary(uint32_t first_point, uint16_t points, const HistoryRange &range) {
+  int32_t latest = LV_CHART_POINT_NONE;
+  int32_t min_val = LV_CHART_POINT_NONE;
+  int32_t max_val = LV_CHART_POINT_NONE;
+  uint32_t fed_total = 0;
+  for (uint16_t i = 0; i < points; ++i) {
+    int32_t moisture = LV_CHART_POINT_NONE;
+    uint16_t fed = 0;
+    history_point(first_point + i, range.hours_per_point, &moisture, &fed);
+    fed_total += fed;
+    if (moisture == LV_CHART_POINT_NONE) continue;
+    latest = moisture;
+    if (min_val == LV_CHART_POINT_NONE || moisture < min_val) min_val = moisture;
+    if (max_val == LV_CHART_POINT_NONE || moisture > max_val) max_val = moisture;
+  }
+
+  if (latest == LV_CHART_POINT_NONE) {
+    set_label_fmt(g_history_refs.summary_label, "No moisture logs in %s", range.label);
+    return;
   }
+  set_label_fmt(g_history_refs.summary_label, "Last %d%%  Min %d%%  Max %d%%  Fed %uml",
+                static_cast<int>(latest), static_cast<int>(min_val), static_cast<int>(max_val),
+                static_cast<unsigned>(fed_total));
+}
+
+/*
+ * update_history_screen
+ * Brings the history chart up to date from the hourly rollup. Time moving on
+ * shifts in empty points, a single new log rewrites its own point, and
+ * anything else (or force) refills the whole series from RAM.
+ * Example:
+ *   update_history_screen(false);
+ */
+void update_history_screen(bool force) {
+  HistoryRefs &refs = g_history_refs;
+  if (!refs.chart) return;
+
+  EpochTime now = EPOCH_UNSET;
+  if (!rtcReadEpoch(&now)) {
+    set_label_text(refs.summary_label, "Set the clock to see history");
+    return;
+  }
+
+  const HistoryRange &range = kHistoryRanges[g_history_range];
+  uint16_t points = static_cast<uint16_t>(range.hours / range.hours_per_point);
+  uint32_t edge_point = epochHours(now) / range.hours_per_point;
+  uint32_t first_point = edge_point + 1 - points;
+  uint32_t changed_hour = 0;
+  uint16_t revision = getMoistureHistoryRevision(&changed_hour);
+  if (!force && refs.drawn && edge_point == refs.drawn_edge_point && revision == refs.drawn_revision) return;
+
+  bool full = force || !refs.drawn;
+  if (!full && revision == refs.drawn_revision) {
+    uint32_t steps = edge_point - refs.drawn_edge_point;
+    if (edge_point < refs.drawn_edge_point || steps >= points) {
+      full = true;
+    } else {
+      for (uint32_t i = 0; i < steps; ++i) {
+        lv_chart_set_next_value(refs.chart, refs.moisture_series, LV_CHART_POINT_NONE);
+        lv_chart_set_next_value(refs.chart, refs.feed_series, LV_CHART_POINT_NONE);
+      }
+    }
+  } else if (!full && edge_point == refs.drawn_edge_point &&
+             revision == static_cast<uint16_t>(refs.drawn_revision + 1)) {
+    uint32_t point = changed_hour / range.hours_per_point;
+    if (point >= first_point && point <= edge_point) {
+      int32_t moisture = LV_CHART_POINT_NONE;
+      uint16_t fed = 0;
+      history_point(point, range.hours_per_point, &moisture, &fed);
+      if (fed > refs.drawn_feed_max) {
+        full = true;
+      } else {
+        uint32_t id = (lv_chart_get_x_start_point(refs.chart, refs.moisture_series) + (point - first_point)) % points;
+        lv_chart_set_value_by_id(refs.chart, refs.moisture_series, id, moisture);
+        lv_chart_set_value_by_id(refs.chart, refs.feed_series, id, fed ? fed : LV_CHART_POINT_NONE);
+      }
+    }
+  } else {
+    full = true;
+  }
+
+  if (full) {
+    for (int i = 0; i < kHistoryRangeCount; ++i) {
+      if (i == g_history_range) lv_obj_add_state(refs.range_btns[i], LV_STATE_CHECKED);
+      else lv_obj_clear_state(refs.range_btns[i], LV_STATE_CHECKED);
+    }
+    lv_chart_set_point_count(refs.chart, points);
+    // Shift mode writes at the start point and wraps, so pushing every point
+    // once leaves them in chronological order.
+    uint16_t fed_max = 0;
+    for (uint16_t i = 0; i < points; ++i) {
+      int32_t moisture = LV_CHART_POINT_NONE;
+      uint16_t fed = 0;
+      history_point(first_point + i, range.hours_per_point, &moisture, &fed);
+      if (fed > fed_max) fed_max = fed;
+      lv_chart_set_next_value(refs.chart, refs.moisture_series, moisture);
+      lv_chart_set_next_value(refs.chart, refs.feed_series, fed ? fed : LV_CHART_POINT_NONE);
+    }
+    uint16_t axis_max = static_cast<uint16_t>(((fed_max + 99) / 100) * 100);
+    if (axis_max < 100) axis_max = 100;
+    lv_chart_set_range(refs.chart, LV_CHART_AXIS_SECONDARY_Y, 0, axis_max);
+    refs.drawn_feed_max = axis_max;
+  }
+
+  update_history_summary(first_point, points, range);
+  refs.drawn = true;
+  refs.drawn_revision = revision;
+  refs.drawn_edge_point = edge_point;
 }
 
 /*
@@ -397,13 +565,7 @@ void update_logs_screen() {
 void update_cal_moist_screen() {
   if (!g_cal_moist_refs.raw_label) return;
 
-  if (g_cal_moist_refs.choice_row) {
-    if (g_cal_moist_mode == 0) {
-      lv_obj_clear_flag(g_cal_moist_refs.choice_row, LV_OBJ_FLAG_HIDDEN);
-    } else {
-      lv_obj_add_flag(g_cal_moist_refs.choice_row, LV_OBJ_FLAG_HIDDEN);
-    }
-  }
+  set_obj_hidden(g_cal_moist_refs.choice_row, g_cal_moist_mode != 0);
 
   SoilSensorWindowStats stats = {};
   if (g_cal_moist_mode != 0 && !g_cal_moist_window_done && soilSensorWindowTick(&stats)) {
@@ -413,34 +575,34 @@ void update_cal_moist_screen() {
   }
 
   if (g_cal_moist_mode == 0) {
-    lv_label_set_text(g_cal_moist_refs.mode_label, "Select Dry or Wet");
-    lv_label_set_text(g_cal_moist_refs.raw_label, "Dry/Wet: --");
-    lv_label_set_text(g_cal_moist_refs.percent_label, "Tap a mode to start 15s average");
+    set_label_text(g_cal_moist_refs.mode_label, "Select Dry or Wet");
+    set_label_text(g_cal_moist_refs.raw_label, "Dry/Wet: --");
+    set_label_text(g_cal_moist_refs.percent_label, "Tap a mode to start 15s average");
     return;
   }
 
   const char *mode_name = (g_cal_moist_mode == 1) ? "Dry" : "Wet";
-  lv_label_set_text_fmt(g_cal_moist_refs.mode_label, "Calibrate %s", mode_name);
+  set_label_fmt(g_cal_moist_refs.mode_label, "Calibrate %s", mode_name);
 
   uint16_t value = g_cal_moist_window_done && g_cal_moist_avg_raw
                      ? g_cal_moist_avg_raw
                      : soilSensorWindowLastRaw();
-  lv_label_set_text_fmt(g_cal_moist_refs.raw_label, "%s: %d", mode_name, value);
+  set_label_fmt(g_cal_moist_refs.raw_label, "%s: %d", mode_name, value);
 
   if (!g_cal_moist_window_done) {
     uint32_t remaining_ms = soilSensorCalWindowRemainingMs();
     uint32_t remaining_s = (remaining_ms + 999) / 1000;
     if (remaining_s > 0) {
-      lv_label_set_text_fmt(g_cal_moist_refs.percent_label,
-                            "Hold sensor %s (%lus left)", mode_name,
-                            static_cast<unsigned long>(remaining_s));
+      set_label_fmt(g_cal_moist_refs.percent_label,
+                    "Hold sensor %s (%lus left)", mode_name,
+                    static_cast<unsigned long>(remaining_s));
     } else {
-      lv_label_set_text_fmt(g_cal_moist_refs.percent_label, "Hold sensor %s (15s avg)", mode_name);
+      set_label_fmt(g_cal_moist_refs.percent_label, "Hold sensor %s (15s avg)", mode_name);
     }
     return;
   }
 
-  lv_label_set_text(g_cal_moist_refs.percent_label, "Average captured");
+  set_label_text(g_cal_moist_refs.percent_label, "Average captured");
 
   if (!g_cal_moist_prompt_shown) {
     if (g_cal_moist_mode == 1) {
@@ -448,7 +610,7 @@ void update_cal_moist_screen() {
     } else if (g_cal_moist_mode == 2) {
       config.moistSensorCalibrationSoaked = g_cal_moist_avg_raw;
     }
-    saveConfig();
+    markConfigDirty(CONFIG_FIELD_MOIST_CAL);
     g_setup.moisture_cal = true;
     maybe_refresh_initial_setup();
     g_cal_moist_prompt_shown = true;
@@ -468,9 +630,19 @@ static void update_test_sensors_screen() {
   getSoilMoisture();
   uint16_t raw = soilSensorGetRealtimeRaw();
   uint8_t pct = soilMoistureAsPercentage(raw);
-  lv_label_set_text_fmt(g_test_sensors_refs.raw_label, "Raw: %d", raw);
-  lv_label_set_text_fmt(g_test_sensors_refs.percent_label, "Moisture: %d%%", pct);
-  lv_label_set_text_fmt(g_test_sensors_refs.runoff_label, "Runoff: %s", runoffDetected() ? "1" : "0");
+  set_label_fmt(g_test_sensors_refs.raw_label, "Raw: %d", raw);
+  static const char *kHealthLabels[] = {"OK", "Suspect", "Failed"};
+  set_label_fmt(g_test_sensors_refs.percent_label, "Moisture: %d%% (%s)",
+                pct, kHealthLabels[soilSensorHealth()]);
+  set_label_fmt(g_test_sensors_refs.runoff_label, "Runoff: %s", runoffDetected() ? "1" : "0");
+  if (soilTempReady()) {
+    char temp_buf[10] = {0};
+    format_deci_celsius(getSoilTempDeciC(), temp_buf, sizeof(temp_buf));
+    set_label_fmt(g_test_sensors_refs.temp_label, "Soil temp: %s", temp_buf);
+  } else {
+    set_label_text(g_test_sensors_refs.temp_label,
+                   soilTempPresent() ? "Soil temp: --" : "Soil temp: missing");
+  }
 }
 
 /*
@@ -485,41 +657,35 @@ void update_cal_flow_screen() {
   if (g_cal_flow_step == 0) step_title = "Prime pump";
   else if (g_cal_flow_step == 1) step_title = "Fill 100ml";
   else step_title = "Compute flow";
-  lv_label_set_text_fmt(g_cal_flow_refs.step_label, "Step %d: %s", g_cal_flow_step + 1, step_title);
+  set_label_fmt(g_cal_flow_refs.step_label, "Step %d: %s", g_cal_flow_step + 1, step_title);
 
   if (g_cal_flow_step == 2) {
     uint32_t per_liter = g_cal_flow_elapsed_ms ? (g_cal_flow_elapsed_ms * 10UL) : 0;
     uint32_t ml_per_hour = per_liter ? (3600000000UL / per_liter) : 0;
     if (ml_per_hour) {
-      lv_label_set_text_fmt(g_cal_flow_refs.status_label, "Flow: %lu ml/h", static_cast<unsigned long>(ml_per_hour));
+      set_label_fmt(g_cal_flow_refs.status_label, "Flow: %lu ml/h", static_cast<unsigned long>(ml_per_hour));
     } else {
-      lv_label_set_text(g_cal_flow_refs.status_label, "Flow: n/a");
+      set_label_text(g_cal_flow_refs.status_label, "Flow: n/a");
     }
   } else {
     if (g_cal_flow_step == 1 && g_cal_flow_running && g_cal_flow_start_ms) {
       uint32_t elapsed = (millis() - g_cal_flow_start_ms) / 1000UL;
-      lv_label_set_text_fmt(g_cal_flow_refs.status_label, "Filling... %lus",
-                            static_cast<unsigned long>(elapsed));
+      set_label_fmt(g_cal_flow_refs.status_label, "Filling... %lus",
+                    static_cast<unsigned long>(elapsed));
     } else {
-      lv_label_set_text_fmt(g_cal_flow_refs.status_label, "State: %s", g_cal_flow_running ? "Running" : "Stopped");
+      set_label_fmt(g_cal_flow_refs.status_label, "State: %s", g_cal_flow_running ? "Running" : "Stopped");
     }
   }
 
   if (g_cal_flow_refs.action_label) {
     if (g_cal_flow_step == 2) {
-      lv_label_set_text(g_cal_flow_refs.action_label, "Save");
+      set_label_text(g_cal_flow_refs.action_label, "Save");
     } else {
-      lv_label_set_text(g_cal_flow_refs.action_label, g_cal_flow_running ? "Stop" : "Start");
+      set_label_text(g_cal_flow_refs.action_label, g_cal_flow_running ? "Stop" : "Start");
     }
   }
 
-  if (g_cal_flow_refs.target_row) {
-    if (g_cal_flow_step == 2) {
-      lv_obj_clear_flag(g_cal_flow_refs.target_row, LV_OBJ_FLAG_HIDDEN);
-    } else {
-      lv_obj_add_flag(g_cal_flow_refs.target_row, LV_OBJ_FLAG_HIDDEN);
-    }
-  }
+  set_obj_hidden(g_cal_flow_refs.target_row, g_cal_flow_step != 2);
 }
 
 /*
@@ -533,7 +699,7 @@ static void update_pump_test_screen() {
   uint32_t now_ms = millis();
   if (g_pump_test_cycle >= 6) {
     closeLineIn();
-    lv_label_set_text(g_pump_test_refs.status_label, "Done. Press Back.");
+    set_label_text(g_pump_test_refs.status_label, "Done. Press Back.");
     return;
   }
   if (now_ms - g_pump_test_last_ms >= 1000) {
@@ -544,11 +710,11 @@ static void update_pump_test_screen() {
   }
   if (g_pump_test_cycle >= 6) {
     closeLineIn();
-    lv_label_set_text(g_pump_test_refs.status_label, "Done. Press Back.");
+    set_label_text(g_pump_test_refs.status_label, "Done. Press Back.");
   } else {
     int cycle = (g_pump_test_cycle / 2) + 1;
     if (cycle > 3) cycle = 3;
-    lv_label_set_text_fmt(g_pump_test_refs.status_label, "Blinking... %d/3", cycle);
+    set_label_fmt(g_pump_test_refs.status_label, "Blinking... %d/3", cycle);
   }
 }
 
@@ -559,6 +725,7 @@ static void update_pump_test_screen() {
  *   update_screensaver(millis());
  */
 void update_screensaver(uint32_t now_ms) {
+  PROFILE_SCOPE(PROF_SCREENSAVER);
   if (g_active_screen != SCREEN_INFO) {
     g_screensaver_active = false;
     return;
@@ -592,6 +759,115 @@ void update_screensaver(uint32_t now_ms) {
   }
 }
 
+/*
+ * update_ui_memory_screen
+ * Refreshes the LVGL heap summary and the per-screen allocation table.
+ * Example:
+ *   update_ui_memory_screen();
+ */
+static void update_ui_memory_screen() {
+  if (!g_ui_memory_refs.summary_label) return;
+  UiMemStats stats = {};
+  ui_mem_get_stats(&stats);
+  set_label_fmt(g_ui_memory_refs.summary_label,
+                "Used %u/%u  High %u\nBig %u (min %u)  Frag %u%% (%+d/%umin)\nPSRAM +%u  Over budget %u",
+                static_cast<unsigned>(stats.used_bytes), static_cast<unsigned>(stats.total_bytes),
+                static_cast<unsigned>(stats.high_water_bytes), static_cast<unsigned>(stats.free_biggest_bytes),
+                static_cast<unsigned>(stats.min_free_biggest_bytes), static_cast<unsigned>(stats.frag_pct),
+                static_cast<int>(stats.frag_trend_pct), static_cast<unsigned>(stats.trend_minutes),
+                static_cast<unsigned>(stats.pool_bytes_added), static_cast<unsigned>(stats.budget_violations));
+
+  // One row per screen built so far: last/max build bytes, growth while
+  // shown, object count and budget.
+  char buf[1024];
+  size_t len = static_cast<size_t>(snprintf(buf, sizeof(buf), "Screen  Last   Max  Live Objs  Budget"));
+  for (int i = 0; i < SCREEN_COUNT && len < sizeof(buf); ++i) {
+    ScreenId id = static_cast<ScreenId>(i);
+    const UiMemScreenStats &screen = ui_mem_screen_stats(id);
+    if (screen.builds == 0) continue;
+    len += static_cast<size_t>(snprintf(buf + len, sizeof(buf) - len, "\n%-6s %5u %5u %5u %4u %6u%s",
+                                        ui_screen_name(id), static_cast<unsigned>(screen.last_build_bytes),
+                                        static_cast<unsigned>(screen.max_build_bytes),
+                                        static_cast<unsigned>(screen.max_active_bytes),
+                                        static_cast<unsigned>(screen.last_objs),
+                                        static_cast<unsigned>(screen_mem_budget(id)),
+                                        screen.over_budget ? " !" : ""));
+  }
+  set_label_text(g_ui_memory_refs.screens_label, buf);
+}
+
+/*
+ * update_profiler_screen
+ * Redraws the per-section timing table, at most once per kDiagRefreshMs.
+ * Example:
+ *   update_profiler_screen();
+ */
+static void update_profiler_screen() {
+  if (!g_profiler_refs.table_label) return;
+  if (!profilerEnabled()) {
+    set_label_text(g_profiler_refs.table_label, "Not compiled in.\nBuild with -DCYCLE_PROFILER.");
+    return;
+  }
+  uint32_t now_ms = millis();
+  if (g_profiler_refs.last_update_ms != 0 && now_ms - g_profiler_refs.last_update_ms < kDiagRefreshMs) return;
+  g_profiler_refs.last_update_ms = now_ms;
+
+  char buf[768];
+  size_t len = static_cast<size_t>(snprintf(buf, sizeof(buf), "Section      Avg     p99     Max (us)"));
+  for (int i = 0; i < PROF_SECTION_COUNT && len < sizeof(buf); ++i) {
+    ProfilerSection section = static_cast<ProfilerSection>(i);
+    ProfilerSummary s = {};
+    if (!profilerGetSummary(section, &s)) continue;
+    len += static_cast<size_t>(snprintf(buf + len, sizeof(buf) - len, "\n%-9s %7u %7u %7u",
+                                        profilerSectionName(section),
+                                        static_cast<unsigned>(profilerCyclesToUs10(s.avgCycles) / 10),
+                                        static_cast<unsigned>(profilerCyclesToUs10(s.p99Cycles) / 10),
+                                        static_cast<unsigned>(profilerCyclesToUs10(s.maxCycles) / 10)));
+  }
+  set_label_text(g_profiler_refs.table_label, buf);
+}
+
+/*
+ * update_flash_stats_screen
+ * Redraws the wear estimate and the per-file/per-caller I/O table, at most
+ * once per kDiagRefreshMs.
+ * Example:
+ *   update_flash_stats_screen();
+ */
+static void update_flash_stats_screen() {
+  if (!g_flash_stats_refs.summary_label) return;
+  uint32_t now_ms = millis();
+  if (g_flash_stats_refs.last_update_ms != 0 && now_ms - g_flash_stats_refs.last_update_ms < kDiagRefreshMs) return;
+  g_flash_stats_refs.last_update_ms = now_ms;
+
+  FlashWearStats wear = {};
+  flashStatsGetWear(&wear);
+  char left_buf[16] = "--";
+  if (wear.daysLeft >= 365) snprintf(left_buf, sizeof(left_buf), "%uy", static_cast<unsigned>(wear.daysLeft / 365));
+  else if (wear.daysLeft > 0) snprintf(left_buf, sizeof(left_buf), "%ud", static_cast<unsigned>(wear.daysLeft));
+  set_label_fmt(g_flash_stats_refs.summary_label,
+                "Erase budget %u.%u%% left, ~%s\nToday %u erases, %u B\nAvg %u erases/day (%u days)",
+                static_cast<unsigned>(wear.budgetLeftPermille / 10), static_cast<unsigned>(wear.budgetLeftPermille % 10),
+                left_buf, static_cast<unsigned>(wear.todayEraseBlocks), static_cast<unsigned>(wear.todayWriteBytes),
+                static_cast<unsigned>(wear.avgDailyEraseBlocks), static_cast<unsigned>(wear.daysTracked));
+
+  // Since-boot counters: files first, then the callers inside them.
+  char buf[768];
+  size_t len = static_cast<size_t>(snprintf(buf, sizeof(buf), "Name    Opens  Reads Writes  Bytes Erase"));
+  for (int i = 0; i < FLASH_FILE_COUNT + FLASH_TAG_COUNT && len < sizeof(buf); ++i) {
+    bool is_file = i < FLASH_FILE_COUNT;
+    const FlashIoCounters &c = is_file ? flashStatsFile(static_cast<FlashFile>(i))
+                                       : flashStatsTag(static_cast<FlashTag>(i - FLASH_FILE_COUNT));
+    const char *name = is_file ? flashStatsFileName(static_cast<FlashFile>(i))
+                               : flashStatsTagName(static_cast<FlashTag>(i - FLASH_FILE_COUNT));
+    len += static_cast<size_t>(snprintf(buf + len, sizeof(buf) - len, "\n%s%-6s %6u %6u %6u %6u %5u",
+                                        is_file ? "" : " ", name, static_cast<unsigned>(c.opens),
+                                        static_cast<unsigned>(c.reads), static_cast<unsigned>(c.writes),
+                                        static_cast<unsigned>(c.writeBytes), static_cast<unsigned>(c.eraseBlocks)));
+  }
+  set_label_text(g_flash_stats_refs.table_label, buf);
+}
+
 /*
  * update_active_screen
  * Routes periodic updates to the currently active screen.
@@ -599,6 +875,7 @@ void update_screensaver(uint32_t now_ms) {
  *   update_active_screen();
  */
 void update_active_screen() {
+  PROFILE_SCOPE(PROF_UPDATE_SCREEN);
   switch (g_active_screen) {
     case SCREEN_INFO:
       update_info_screen();
@@ -609,6 +886,9 @@ void update_active_screen() {
     case SCREEN_LOGS:
       update_logs_screen();
       break;
+    case SCREEN_HISTORY:
+      update_history_screen(false);
+      break;
     case SCREEN_CAL_MOIST:
       update_cal_moist_screen();
       break;
@@ -621,6 +901,15 @@ void update_active_screen() {
     case SCREEN_TEST_PUMPS:
       update_pump_test_screen();
       break;
+    case SCREEN_UI_MEMORY:
+      update_ui_memory_screen();
+      break;
+    case SCREEN_PROFILER:
+      update_profiler_screen();
+      break;
+    case SCREEN_FLASH_STATS:
+      update_flash_stats_screen();
+      break;
     default:
       break;
   }
@@ -662,6 +951,7 @@ static lv_obj_t *build_info_screen() {
   static const int16_t kTimeW = kGroupW;
   static const int16_t kLastW = (kGroupW * 2) + kGroupGap;
   static const int16_t kTodayW = kGroupW;
+  static const int16_t kRow3Y = kRow2Y + 48;
 
   lv_obj_t *moist_group = lv_obj_create(main);
   lv_obj_set_size(moist_group, kGroupW, LV_SIZE_CONTENT);
@@ -681,13 +971,13 @@ static lv_obj_t *build_info_screen() {
 
   lv_obj_t *moist_label = lv_label_create(moist_group);
   lv_label_set_text(moist_label, "Moisture");
-  lv_obj_set_style_text_font(moist_label, &lv_font_montserrat_12, 0);
+  lv_obj_set_style_text_font(moist_label, UI_FONT_12, 0);
   lv_obj_set_style_text_color(moist_label, kColorMuted, 0);
   lv_obj_set_style_text_align(moist_label, LV_TEXT_ALIGN_LEFT, 0);
   lv_obj_set_width(moist_label, LV_PCT(100));
 
   lv_obj_t *moist_value = lv_label_create(moist_group);
-  lv_obj_set_style_text_font(moist_value, &lv_font_montserrat_18, 0);
+  lv_obj_set_style_text_font(moist_value, UI_FONT_18, 0);
   lv_label_set_text(moist_value, "--%");
   lv_obj_set_style_text_align(moist_value, LV_TEXT_ALIGN_LEFT, 0);
   lv_obj_set_width(moist_value, LV_PCT(100));
@@ -710,13 +1000,13 @@ static lv_obj_t *build_info_screen() {
 
   lv_obj_t *baseline_label = lv_label_create(baseline_group);
   lv_label_set_text(baseline_label, "Baseline");
-  lv_obj_set_style_text_font(baseline_label, &lv_font_montserrat_12, 0);
+  lv_obj_set_style_text_font(baseline_label, UI_FONT_12, 0);
   lv_obj_set_style_text_color(baseline_label, kColorMuted, 0);
   lv_obj_set_style_text_align(baseline_label, LV_TEXT_ALIGN_LEFT, 0);
   lv_obj_set_width(baseline_label, LV_PCT(100));
 
   lv_obj_t *baseline_value = lv_label_create(baseline_group);
-  lv_obj_set_style_text_font(baseline_value, &lv_font_montserrat_18, 0);
+  lv_obj_set_style_text_font(baseline_value, UI_FONT_18, 0);
   lv_label_set_text(baseline_value, "--%");
   lv_obj_set_style_text_align(baseline_value, LV_TEXT_ALIGN_LEFT, 0);
   lv_obj_set_width(baseline_value, LV_PCT(100));
@@ -739,13 +1029,13 @@ static lv_obj_t *build_info_screen() {
 
   lv_obj_t *dryback_label = lv_label_create(dryback_group);
   lv_label_set_text(dryback_label, "Dryback");
-  lv_obj_set_style_text_font(dryback_label, &lv_font_montserrat_12, 0);
+  lv_obj_set_style_text_font(dryback_label, UI_FONT_12, 0);
   lv_obj_set_style_text_color(dryback_label, kColorMuted, 0);
   lv_obj_set_style_text_align(dryback_label, LV_TEXT_ALIGN_LEFT, 0);
   lv_obj_set_width(dryback_label, LV_PCT(100));
 
   lv_obj_t *dry_value = lv_label_create(dryback_group);
-  lv_obj_set_style_text_font(dry_value, &lv_font_montserrat_18, 0);
+  lv_obj_set_style_text_font(dry_value, UI_FONT_18, 0);
   lv_label_set_text(dry_value, "--%");
   lv_obj_set_style_text_align(dry_value, LV_TEXT_ALIGN_LEFT, 0);
   lv_obj_set_width(dry_value, LV_PCT(100));
@@ -768,13 +1058,13 @@ static lv_obj_t *build_info_screen() {
 
   lv_obj_t *minmax_label = lv_label_create(minmax_group);
   lv_label_set_text(minmax_label, "Min/Max");
-  lv_obj_set_style_text_font(minmax_label, &lv_font_montserrat_12, 0);
+  lv_obj_set_style_text_font(minmax_label, UI_FONT_12, 0);
   lv_obj_set_style_text_color(minmax_label, kColorMuted, 0);
   lv_obj_set_style_text_align(minmax_label, LV_TEXT_ALIGN_LEFT, 0);
   lv_obj_set_width(minmax_label, LV_PCT(100));
 
   lv_obj_t *minmax_value = lv_label_create(minmax_group);
-  lv_obj_set_style_text_font(minmax_value, &lv_font_montserrat_18, 0);
+  lv_obj_set_style_text_font(minmax_value, UI_FONT_18, 0);
   lv_label_set_text(minmax_value, "--/--%");
   lv_obj_set_style_text_align(minmax_value, LV_TEXT_ALIGN_LEFT, 0);
   lv_obj_set_width(minmax_value, LV_PCT(100));
@@ -818,15 +1108,15 @@ static lv_obj_t *build_info_screen() {
   lv_obj_clear_flag(time_chip, LV_OBJ_FLAG_SCROLLABLE);
 
   lv_obj_t *time_value = lv_label_create(time_chip);
-  lv_obj_set_style_text_font(time_value, &lv_font_montserrat_14, 0);
+  lv_obj_set_style_text_font(time_value, UI_FONT_14, 0);
   lv_label_set_text(time_value, "00:00");
 
   lv_obj_t *day_night_icon = lv_img_create(time_chip);
-  lv_img_set_src(day_night_icon, &kSunImage);
+  lv_img_set_src(day_night_icon, image_asset(IMAGE_ASSET_SUN));
   lv_image_set_scale(day_night_icon, kDayNightScale);
 
   lv_obj_t *night_icon = lv_img_create(time_chip);
-  lv_img_set_src(night_icon, &kMoonImage);
+  lv_img_set_src(night_icon, image_asset(IMAGE_ASSET_MOON));
   lv_image_set_scale(night_icon, kDayNightScale);
   lv_obj_add_flag(night_icon, LV_OBJ_FLAG_HIDDEN);
 
@@ -848,11 +1138,11 @@ static lv_obj_t *build_info_screen() {
 
   lv_obj_t *last_label = lv_label_create(last_group);
   lv_label_set_text(last_label, "Last feed");
-  lv_obj_set_style_text_font(last_label, &lv_font_montserrat_12, 0);
+  lv_obj_set_style_text_font(last_label, UI_FONT_12, 0);
   lv_obj_set_style_text_color(last_label, kColorMuted, 0);
 
   lv_obj_t *last_value = lv_label_create(last_group);
-  lv_obj_set_style_text_font(last_value, &lv_font_montserrat_14, 0);
+  lv_obj_set_style_text_font(last_value, UI_FONT_14, 0);
   lv_label_set_long_mode(last_value, LV_LABEL_LONG_CLIP);
   lv_obj_set_width(last_value, kLastW - 8);
   lv_label_set_text(last_value, "Never");
@@ -875,17 +1165,46 @@ static lv_obj_t *build_info_screen() {
 
   lv_obj_t *today_label = lv_label_create(today_group);
   lv_label_set_text(today_label, "Today");
-  lv_obj_set_style_text_font(today_label, &lv_font_montserrat_12, 0);
+  lv_obj_set_style_text_font(today_label, UI_FONT_12, 0);
   lv_obj_set_style_text_color(today_label, kColorMuted, 0);
   lv_obj_set_style_text_align(today_label, LV_TEXT_ALIGN_LEFT, 0);
   lv_obj_set_width(today_label, kTodayW);
 
   lv_obj_t *today_value = lv_label_create(today_group);
-  lv_obj_set_style_text_font(today_value, &lv_font_montserrat_14, 0);
+  lv_obj_set_style_text_font(today_value, UI_FONT_14, 0);
   lv_label_set_text(today_value, "0ml");
   lv_obj_set_style_text_align(today_value, LV_TEXT_ALIGN_LEFT, 0);
   lv_obj_set_width(today_value, kTodayW - 8);
 
+  lv_obj_t *temp_group = lv_obj_create(main);
+  lv_obj_set_size(temp_group, kGroupW, LV_SIZE_CONTENT);
+  lv_obj_set_pos(temp_group, kCol1X, kRow3Y);
+  lv_obj_set_flex_flow(temp_group, LV_FLEX_FLOW_COLUMN);
+  lv_obj_set_style_bg_color(temp_group, kColorHeader, 0);
+  lv_obj_set_style_bg_opa(temp_group, LV_OPA_40, 0);
+  lv_obj_set_style_border_width(temp_group, 1, 0);
+  lv_obj_set_style_border_color(temp_group, kColorMuted, 0);
+  lv_obj_set_style_border_opa(temp_group, LV_OPA_20, 0);
+  lv_obj_set_style_radius(temp_group, kCardRadius, 0);
+  lv_obj_set_style_pad_all(temp_group, 4, 0);
+  lv_obj_set_style_pad_row(temp_group, 0, 0);
+  lv_obj_set_style_pad_top(temp_group, 0, 0);
+  lv_obj_clear_flag(temp_group, LV_OBJ_FLAG_SCROLLABLE);
+  lv_obj_set_scrollbar_mode(temp_group, LV_SCROLLBAR_MODE_OFF);
+
+  lv_obj_t *temp_label = lv_label_create(temp_group);
+  lv_label_set_text(temp_label, "Soil temp");
+  lv_obj_set_style_text_font(temp_label, UI_FONT_12, 0);
+  lv_obj_set_style_text_color(temp_label, kColorMuted, 0);
+  lv_obj_set_style_text_align(temp_label, LV_TEXT_ALIGN_LEFT, 0);
+  lv_obj_set_width(temp_label, LV_PCT(100));
+
+  lv_obj_t *soil_temp_value = lv_label_create(temp_group);
+  lv_obj_set_style_text_font(soil_temp_value, UI_FONT_14, 0);
+  lv_label_set_text(soil_temp_value, "--C");
+  lv_obj_set_style_text_align(soil_temp_value, LV_TEXT_ALIGN_LEFT, 0);
+  lv_obj_set_width(soil_temp_value, LV_PCT(100));
+
   lv_obj_t *status_row = lv_obj_create(main);
   lv_obj_set_height(status_row, LV_SIZE_CONTENT);
   lv_obj_set_flex_flow(status_row, LV_FLEX_FLOW_ROW);
@@ -903,11 +1222,11 @@ static lv_obj_t *build_info_screen() {
   lv_obj_align(status_row, LV_ALIGN_TOP_RIGHT, -4, kRow2Y);
 
   lv_obj_t *status_value = lv_label_create(status_row);
-  lv_obj_set_style_text_font(status_value, &lv_font_montserrat_14, 0);
+  lv_obj_set_style_text_font(status_value, UI_FONT_14, 0);
   lv_label_set_text(status_value, "DAY");
 
   lv_obj_t *status_icon = lv_label_create(status_row);
-  lv_obj_set_style_text_font(status_icon, &lv_font_montserrat_18, 0);
+  lv_obj_set_style_text_font(status_icon, UI_FONT_18, 0);
   lv_label_set_text(status_icon, "");
   lv_obj_add_flag(status_icon, LV_OBJ_FLAG_HIDDEN);
 
@@ -929,7 +1248,7 @@ static lv_obj_t *build_info_screen() {
 
   lv_obj_t *play_pause = lv_label_create(main);
   lv_label_set_text(play_pause, LV_SYMBOL_PLAY);
-  lv_obj_set_style_text_font(play_pause, &lv_font_montserrat_14, 0);
+  lv_obj_set_style_text_font(play_pause, UI_FONT_14, 0);
   lv_obj_set_pos(play_pause, kScreenWidth - 24, 2);
 
   lv_obj_t *screensaver = lv_obj_create(screen);
@@ -947,12 +1266,12 @@ static lv_obj_t *build_info_screen() {
   lv_obj_clear_flag(plant_wrap, LV_OBJ_FLAG_SCROLLABLE);
 
   lv_obj_t *plant = lv_img_create(plant_wrap);
-  lv_img_set_src(plant, &kPlantImage);
+  lv_img_set_src(plant, image_asset(IMAGE_ASSET_PLANT));
   lv_image_set_scale(plant, kPlantScale);
   lv_obj_align(plant, LV_ALIGN_TOP_MID, 0, 0);
 
   lv_obj_t *status = lv_label_create(plant_wrap);
-  lv_obj_set_style_text_font(status, &lv_font_montserrat_14, 0);
+  lv_obj_set_style_text_font(status, UI_FONT_14, 0);
   lv_obj_set_style_text_color(status, lv_color_white(), 0);
   lv_label_set_text(status, "");
   lv_obj_align(status, LV_ALIGN_TOP_MID, 0, kPlantDrawH - 16);
@@ -975,6 +1294,7 @@ static lv_obj_t *build_info_screen() {
   g_info_refs.night_icon = night_icon;
   g_info_refs.last_value = last_value;
   g_info_refs.totals_value = nullptr;
+  g_info_refs.soil_temp_value = soil_temp_value;
   g_info_refs.screensaver_root = screensaver;
   g_info_refs.screensaver_plant = plant_wrap;
   g_info_refs.screensaver_icon = status;
@@ -1040,7 +1360,7 @@ static lv_obj_t *build_feeding_status_screen() {
 
   lv_obj_t *header_card = create_card(kCardX, kRow1Y, kHeaderW, kCardH);
   lv_obj_t *header_value = lv_label_create(header_card);
-  lv_obj_set_style_text_font(header_value, &lv_font_montserrat_18, 0);
+  lv_obj_set_style_text_font(header_value, UI_FONT_18, 0);
   lv_obj_set_width(header_value, LV_PCT(100));
   lv_obj_set_style_text_align(header_value, LV_TEXT_ALIGN_LEFT, 0);
   lv_label_set_text(header_value, "");
@@ -1049,11 +1369,11 @@ static lv_obj_t *build_feeding_status_screen() {
   lv_obj_t *pulse_label = lv_label_create(pulse_card);
   lv_label_set_text(pulse_label, "Pulse");
   lv_obj_set_style_text_color(pulse_label, kColorMuted, 0);
-  lv_obj_set_style_text_font(pulse_label, &lv_font_montserrat_12, 0);
+  lv_obj_set_style_text_font(pulse_label, UI_FONT_12, 0);
   lv_obj_set_width(pulse_label, LV_PCT(100));
   lv_obj_set_style_text_align(pulse_label, LV_TEXT_ALIGN_LEFT, 0);
   lv_obj_t *pulse_value = lv_label_create(pulse_card);
-  lv_obj_set_style_text_font(pulse_value, &lv_font_montserrat_14, 0);
+  lv_obj_set_style_text_font(pulse_value, UI_FONT_14, 0);
   lv_obj_set_width(pulse_value, LV_PCT(100));
   lv_obj_set_style_text_align(pulse_value, LV_TEXT_ALIGN_LEFT, 0);
   lv_label_set_text(pulse_value, "");
@@ -1063,11 +1383,11 @@ static lv_obj_t *build_feeding_status_screen() {
   lv_obj_t *pump_label = lv_label_create(pump_card);
   lv_label_set_text(pump_label, "Pump");
   lv_obj_set_style_text_color(pump_label, kColorMuted, 0);
-  lv_obj_set_style_text_font(pump_label, &lv_font_montserrat_12, 0);
+  lv_obj_set_style_text_font(pump_label, UI_FONT_12, 0);
   lv_obj_set_width(pump_label, LV_PCT(100));
   lv_obj_set_style_text_align(pump_label, LV_TEXT_ALIGN_LEFT, 0);
   lv_obj_t *pump_value = lv_label_create(pump_card);
-  lv_obj_set_style_text_font(pump_value, &lv_font_montserrat_14, 0);
+  lv_obj_set_style_text_font(pump_value, UI_FONT_14, 0);
   lv_obj_set_width(pump_value, LV_PCT(100));
   lv_obj_set_style_text_align(pump_value, LV_TEXT_ALIGN_LEFT, 0);
   lv_label_set_text(pump_value, "");
@@ -1076,11 +1396,11 @@ static lv_obj_t *build_feeding_status_screen() {
   lv_obj_t *moist_label = lv_label_create(moist_card);
   lv_label_set_text(moist_label, "Moisture");
   lv_obj_set_style_text_color(moist_label, kColorMuted, 0);
-  lv_obj_set_style_text_font(moist_label, &lv_font_montserrat_12, 0);
+  lv_obj_set_style_text_font(moist_label, UI_FONT_12, 0);
   lv_obj_set_width(moist_label, LV_PCT(100));
   lv_obj_set_style_text_align(moist_label, LV_TEXT_ALIGN_LEFT, 0);
   lv_obj_t *moist_value = lv_label_create(moist_card);
-  lv_obj_set_style_text_font(moist_value, &lv_font_montserrat_14, 0);
+  lv_obj_set_style_text_font(moist_value, UI_FONT_14, 0);
   lv_obj_set_width(moist_value, LV_PCT(100));
   lv_obj_set_style_text_align(moist_value, LV_TEXT_ALIGN_LEFT, 0);
   lv_label_set_text(moist_value, "");
@@ -1089,11 +1409,11 @@ static lv_obj_t *build_feeding_status_screen() {
   lv_obj_t *time_label = lv_label_create(time_card);
   lv_label_set_text(time_label, "Pump time");
   lv_obj_set_style_text_color(time_label, kColorMuted, 0);
-  lv_obj_set_style_text_font(time_label, &lv_font_montserrat_12, 0);
+  lv_obj_set_style_text_font(time_label, UI_FONT_12, 0);
   lv_obj_set_width(time_label, LV_PCT(100));
   lv_obj_set_style_text_align(time_label, LV_TEXT_ALIGN_LEFT, 0);
   lv_obj_t *time_value = lv_label_create(time_card);
-  lv_obj_set_style_text_font(time_value, &lv_font_montserrat_14, 0);
+  lv_obj_set_style_text_font(time_value, UI_FONT_14, 0);
   lv_obj_set_width(time_value, LV_PCT(100));
   lv_obj_set_style_text_align(time_value, LV_TEXT_ALIGN_LEFT, 0);
   lv_label_set_text(time_value, "");
@@ -1102,11 +1422,11 @@ static lv_obj_t *build_feeding_status_screen() {
   lv_obj_t *stop_label = lv_label_create(stop_card);
   lv_label_set_text(stop_label, "Stop when");
   lv_obj_set_style_text_color(stop_label, kColorMuted, 0);
-  lv_obj_set_style_text_font(stop_label, &lv_font_montserrat_12, 0);
+  lv_obj_set_style_text_font(stop_label, UI_FONT_12, 0);
   lv_obj_set_width(stop_label, LV_PCT(100));
   lv_obj_set_style_text_align(stop_label, LV_TEXT_ALIGN_LEFT, 0);
   lv_obj_t *stop_value = lv_label_create(stop_card);
-  lv_obj_set_style_text_font(stop_value, &lv_font_montserrat_14, 0);
+  lv_obj_set_style_text_font(stop_value, UI_FONT_14, 0);
   lv_obj_set_width(stop_value, LV_PCT(100));
   lv_obj_set_style_text_align(stop_value, LV_TEXT_ALIGN_LEFT, 0);
   lv_label_set_text(stop_value, "");
@@ -1117,11 +1437,11 @@ static lv_obj_t *build_feeding_status_screen() {
   lv_obj_t *max_label = lv_label_create(max_card);
   lv_label_set_text(max_label, "Max");
   lv_obj_set_style_text_color(max_label, kColorMuted, 0);
-  lv_obj_set_style_text_font(max_label, &lv_font_montserrat_12, 0);
+  lv_obj_set_style_text_font(max_label, UI_FONT_12, 0);
   lv_obj_set_width(max_label, LV_PCT(100));
   lv_obj_set_style_text_align(max_label, LV_TEXT_ALIGN_LEFT, 0);
   lv_obj_t *max_value = lv_label_create(max_card);
-  lv_obj_set_style_text_font(max_value, &lv_font_montserrat_14, 0);
+  lv_obj_set_style_text_font(max_value, UI_FONT_14, 0);
   lv_obj_set_width(max_value, LV_PCT(100));
   lv_obj_set_style_text_align(max_value, LV_TEXT_ALIGN_LEFT, 0);
   lv_label_set_text(max_value, "");
@@ -1130,11 +1450,11 @@ static lv_obj_t *build_feeding_status_screen() {
   lv_obj_t *delivered_label = lv_label_create(delivered_card);
   lv_label_set_text(delivered_label, "Delivered");
   lv_obj_set_style_text_color(delivered_label, kColorMuted, 0);
-  lv_obj_set_style_text_font(delivered_label, &lv_font_montserrat_12, 0);
+  lv_obj_set_style_text_font(delivered_label, UI_FONT_12, 0);
   lv_obj_set_width(delivered_label, LV_PCT(100));
   lv_obj_set_style_text_align(delivered_label, LV_TEXT_ALIGN_LEFT, 0);
   lv_obj_t *delivered_value = lv_label_create(delivered_card);
-  lv_obj_set_style_text_font(delivered_value, &lv_font_montserrat_14, 0);
+  lv_obj_set_style_text_font(delivered_value, UI_FONT_14, 0);
   lv_obj_set_width(delivered_value, LV_PCT(100));
   lv_obj_set_style_text_align(delivered_value, LV_TEXT_ALIGN_LEFT, 0);
   lv_label_set_text(delivered_value, "");
@@ -1183,6 +1503,8 @@ static lv_obj_t *build_menu_screen() {
   int tile_count = 0;
   add_menu_tile(grid, "Logs", open_logs_event, nullptr, nullptr);
   tile_count++;
+  add_menu_tile(grid, "History", open_history_event, nullptr, nullptr);
+  tile_count++;
   add_menu_tile(grid, "Feeding", open_feeding_event, nullptr, nullptr);
   tile_count++;
   add_menu_tile(grid, "Force feed", open_force_feed_event, nullptr, nullptr);
@@ -1221,7 +1543,7 @@ static lv_obj_t *build_logs_screen() {
   lv_obj_clear_flag(content, LV_OBJ_FLAG_SCROLLABLE);
 
   lv_obj_t *header = lv_label_create(content);
-  lv_obj_set_style_text_font(header, &lv_font_montserrat_18, 0);
+  lv_obj_set_style_text_font(header, UI_FONT_18, 0);
 
   lv_obj_t *line1 = lv_label_create(content);
   lv_obj_t *line2 = lv_label_create(content);
@@ -1267,6 +1589,64 @@ static lv_obj_t *build_logs_screen() {
   return screen;
 }
 
+/*
+ * build_history_screen
+ * Builds the moisture history chart with its range selector.
+ * Example:
+ *   lv_obj_t *screen = build_history_screen();
+ */
+static lv_obj_t *build_history_screen() {
+  lv_obj_t *screen = create_screen_root();
+  create_header(screen, "History", true, back_event);
+
+  lv_obj_t *row = lv_obj_create(screen);
+  lv_obj_set_width(row, LV_PCT(100));
+  lv_obj_set_height(row, 32);
+  lv_obj_set_style_bg_opa(row, LV_OPA_TRANSP, 0);
+  lv_obj_set_style_border_width(row, 0, 0);
+  lv_obj_set_style_pad_all(row, 0, 0);
+  lv_obj_set_style_pad_gap(row, 6, 0);
+  lv_obj_set_flex_flow(row, LV_FLEX_FLOW_ROW);
+  lv_obj_clear_flag(row, LV_OBJ_FLAG_SCROLLABLE);
+
+  for (int i = 0; i < kHistoryRangeCount; ++i) {
+    lv_obj_t *btn = lv_btn_create(row);
+    lv_obj_set_flex_grow(btn, 1);
+    lv_obj_add_event_cb(btn, history_range_event, LV_EVENT_CLICKED, reinterpret_cast<void *>(static_cast<intptr_t>(i)));
+    lv_obj_t *label = lv_label_create(btn);
+    lv_label_set_text(label, kHistoryRanges[i].label);
+    lv_obj_center(label);
+    g_history_refs.range_btns[i] = btn;
+  }
+
+  lv_obj_t *chart = lv_chart_create(screen);
+  lv_obj_set_width(chart, LV_PCT(100));
+  lv_obj_set_flex_grow(chart, 1);
+  lv_obj_set_style_bg_opa(chart, LV_OPA_TRANSP, 0);
+  lv_obj_set_style_pad_all(chart, 4, 0);
+  lv_obj_set_style_size(chart, 3, 3, LV_PART_INDICATOR);
+  lv_chart_set_type(chart, LV_CHART_TYPE_LINE);
+  lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_SHIFT);
+  lv_chart_set_div_line_count(chart, 5, 0);
+  lv_chart_set_range(chart, LV_CHART_AXIS_PRIMARY_Y, 0, 100);
+
+  // Moisture on the left axis (0-100 %), feed volume as dots on the right.
+  lv_chart_series_t *moisture_series = lv_chart_add_series(chart, kColorAccent, LV_CHART_AXIS_PRIMARY_Y);
+  lv_chart_series_t *feed_series = lv_chart_add_series(chart, lv_color_hex(0x4ade80), LV_CHART_AXIS_SECONDARY_Y);
+
+  lv_obj_t *summary = lv_label_create(screen);
+  lv_obj_set_style_text_color(summary, kColorMuted, 0);
+
+  g_history_refs.chart = chart;
+  g_history_refs.moisture_series = moisture_series;
+  g_history_refs.feed_series = feed_series;
+  g_history_refs.summary_label = summary;
+  g_history_refs.drawn = false;
+
+  update_history_screen(true);
+  return screen;
+}
+
 /*
  * build_feeding_menu_screen
  * Builds the feeding menu screen layout.
@@ -1425,7 +1805,7 @@ void update_slot_summary_screen() {
   char *lines[4] = {nullptr};
   build_slot_summary_text(g_slots[g_selected_slot], g_selected_slot, lines, 4);
   for (int i = 0; i < 4; ++i) {
-    lv_label_set_text(g_slot_summary_refs.lines[i], lines[i]);
+    set_label_text(g_slot_summary_refs.lines[i], lines[i]);
   }
 }
 
@@ -1461,7 +1841,7 @@ static lv_obj_t *build_slots_list_screen() {
     lv_label_set_text_fmt(name, "S%d %s", i + 1, slot_name);
     lv_label_set_long_mode(name, LV_LABEL_LONG_CLIP);
     lv_obj_set_width(name, LV_PCT(100));
-    lv_obj_set_style_text_font(name, &lv_font_montserrat_12, 0);
+    lv_obj_set_style_text_font(name, UI_FONT_12, 0);
 
     lv_obj_t *summary = lv_label_create(btn);
     char summary_buf[48] = {0};
@@ -1490,7 +1870,7 @@ static lv_obj_t *build_slots_list_screen() {
     lv_label_set_long_mode(summary, LV_LABEL_LONG_CLIP);
     lv_obj_set_width(summary, LV_PCT(100));
     lv_obj_set_style_text_color(summary, kColorMuted, 0);
-    lv_obj_set_style_text_font(summary, &lv_font_montserrat_12, 0);
+    lv_obj_set_style_text_font(summary, UI_FONT_12, 0);
   }
 
   return screen;
@@ -1588,7 +1968,7 @@ static lv_obj_t *build_slot_wizard_screen() {
   lv_obj_set_height(header, 15);
   lv_obj_t *title = lv_obj_get_child(header, 0);
   if (title) {
-    lv_obj_set_style_text_font(title, &lv_font_montserrat_12, 0);
+    lv_obj_set_style_text_font(title, UI_FONT_12, 0);
   }
 
   lv_obj_t *tabview = lv_tabview_create(screen);
@@ -1750,6 +2130,7 @@ static lv_obj_t *build_cal_menu_screen() {
   lv_obj_t *list = create_menu_list(screen);
   add_menu_item(list, "Cal moist sensor", nullptr, open_cal_moist_event, nullptr, nullptr);
   add_menu_item(list, "Calibrate flow", nullptr, open_cal_flow_event, nullptr, nullptr);
+  add_menu_item(list, "Temp compensation", nullptr, open_temp_comp_event, nullptr, nullptr);
 
   return screen;
 }
@@ -1874,6 +2255,9 @@ static lv_obj_t *build_test_menu_screen() {
   lv_obj_t *list = create_menu_list(screen);
   add_menu_item(list, "Test sensors", nullptr, open_test_sensors_event, nullptr, nullptr);
   add_menu_item(list, "Test pumps", nullptr, open_test_pumps_event, nullptr, nullptr);
+  add_menu_item(list, "UI memory", nullptr, open_ui_memory_event, nullptr, nullptr);
+  add_menu_item(list, "Profiler", nullptr, open_profiler_event, nullptr, nullptr);
+  add_menu_item(list, "Flash wear", nullptr, open_flash_stats_event, nullptr, nullptr);
 
   return screen;
 }
@@ -1900,10 +2284,12 @@ static lv_obj_t *build_test_sensors_screen() {
   lv_obj_t *raw_label = lv_label_create(content);
   lv_obj_t *percent_label = lv_label_create(content);
   lv_obj_t *runoff_label = lv_label_create(content);
+  lv_obj_t *temp_label = lv_label_create(content);
 
   g_test_sensors_refs.raw_label = raw_label;
   g_test_sensors_refs.percent_label = percent_label;
   g_test_sensors_refs.runoff_label = runoff_label;
+  g_test_sensors_refs.temp_label = temp_label;
 
   update_test_sensors_screen();
   return screen;
@@ -2105,6 +2491,109 @@ static lv_obj_t *build_time_range_screen() {
   return screen;
 }
 
+/*
+ * build_ui_memory_screen
+ * Builds the LVGL heap debug screen: heap summary plus a scrollable
+ * per-screen allocation table.
+ * Example:
+ *   lv_obj_t *screen = build_ui_memory_screen();
+ */
+static lv_obj_t *build_ui_memory_screen() {
+  lv_obj_t *screen = create_screen_root();
+  create_header(screen, "UI memory", true, back_event);
+
+  lv_obj_t *summary = lv_label_create(screen);
+  lv_obj_set_width(summary, LV_PCT(100));
+
+  lv_obj_t *table = lv_obj_create(screen);
+  lv_obj_set_width(table, LV_PCT(100));
+  lv_obj_set_flex_grow(table, 1);
+  lv_obj_set_style_bg_opa(table, LV_OPA_TRANSP, 0);
+  lv_obj_set_style_border_width(table, 0, 0);
+  lv_obj_set_style_pad_all(table, 0, 0);
+  lv_obj_set_scroll_dir(table, LV_DIR_VER);
+
+  lv_obj_t *screens = lv_label_create(table);
+  lv_obj_set_style_text_font(screens, UI_FONT_12, 0);
+  lv_obj_set_style_text_color(screens, kColorMuted, 0);
+
+  g_ui_memory_refs.summary_label = summary;
+  g_ui_memory_refs.screens_label = screens;
+
+  update_ui_memory_screen();
+  return screen;
+}
+
+/*
+ * build_profiler_screen
+ * Builds the main loop profiler screen: a scrollable timing table and a
+ * reset button.
+ * Example:
+ *   lv_obj_t *screen = build_profiler_screen();
+ */
+static lv_obj_t *build_profiler_screen() {
+  lv_obj_t *screen = create_screen_root();
+  create_header(screen, "Profiler", true, back_event);
+
+  lv_obj_t *table = lv_obj_create(screen);
+  lv_obj_set_width(table, LV_PCT(100));
+  lv_obj_set_flex_grow(table, 1);
+  lv_obj_set_style_bg_opa(table, LV_OPA_TRANSP, 0);
+  lv_obj_set_style_border_width(table, 0, 0);
+  lv_obj_set_style_pad_all(table, 0, 0);
+  lv_obj_set_scroll_dir(table, LV_DIR_VER);
+
+  lv_obj_t *label = lv_label_create(table);
+  lv_obj_set_style_text_font(label, UI_FONT_12, 0);
+
+  lv_obj_t *reset_btn = lv_btn_create(screen);
+  lv_obj_set_width(reset_btn, LV_PCT(100));
+  lv_obj_add_event_cb(reset_btn, profiler_reset_event, LV_EVENT_CLICKED, nullptr);
+  lv_obj_t *reset_label = lv_label_create(reset_btn);
+  lv_label_set_text(reset_label, "Reset");
+  lv_obj_center(reset_label);
+
+  g_profiler_refs.table_label = label;
+  g_profiler_refs.last_update_ms = 0;
+
+  update_profiler_screen();
+  return screen;
+}
+
+/*
+ * build_flash_stats_screen
+ * Builds the flash I/O screen: wear estimate plus a scrollable table of
+ * since-boot counters per file and per caller.
+ * Example:
+ *   lv_obj_t *screen = build_flash_stats_screen();
+ */
+static lv_obj_t *build_flash_stats_screen() {
+  lv_obj_t *screen = create_screen_root();
+  create_header(screen, "Flash wear", true, back_event);
+
+  lv_obj_t *summary = lv_label_create(screen);
+  lv_obj_set_width(summary, LV_PCT(100));
+
+  lv_obj_t *table = lv_obj_create(screen);
+  lv_obj_set_width(table, LV_PCT(100));
+  lv_obj_set_flex_grow(table, 1);
+  lv_obj_set_style_bg_opa(table, LV_OPA_TRANSP, 0);
+  lv_obj_set_style_border_width(table, 0, 0);
+  lv_obj_set_style_pad_all(table, 0, 0);
+  lv_obj_set_scroll_dir(table, LV_DIR_VER);
+
+  lv_obj_t *label = lv_label_create(table);
+  lv_obj_set_style_text_font(label, UI_FONT_12, 0);
+  lv_obj_set_style_text_color(label, kColorMuted, 0);
+
+  g_flash_stats_refs.summary_label = summary;
+  g_flash_stats_refs.table_label = label;
+  g_flash_stats_refs.last_update_ms = 0;
+
+  update_flash_stats_screen();
+  return screen;
+}
+
 /*
  * build_screen
  * Factory that builds a screen based on the screen id.
@@ -2133,11 +2622,82 @@ lv_obj_t *build_screen(ScreenId id) {
     case SCREEN_INITIAL_SETUP: return build_initial_setup_screen();
     case SCREEN_NUMBER_INPUT: return build_number_input_screen();
     case SCREEN_TIME_RANGE_INPUT: return build_time_range_screen();
+    case SCREEN_HISTORY: return build_history_screen();
+    case SCREEN_UI_MEMORY: return build_ui_memory_screen();
+    case SCREEN_PROFILER: return build_profiler_screen();
+    case SCREEN_FLASH_STATS: return build_flash_stats_screen();
     default: break;
   }
   return build_info_screen();
 }
 
+/*
+ * screen_is_cacheable
+ * Returns true for screens whose widget trees can be kept alive off-screen.
+ * Screens built from the shared binding/option pools are always rebuilt.
+ * Example:
+ *   if (screen_is_cacheable(SCREEN_LOGS)) { ... }
+ */
+bool screen_is_cacheable(ScreenId id) {
+  switch (id) {
+    case SCREEN_INFO:
+    case SCREEN_FEEDING_STATUS:
+    case SCREEN_MENU:
+    case SCREEN_LOGS:
+      return true;
+    default:
+      return false;
+  }
+}
+
+/*
+ * screen_mem_budget
+ * Returns the LVGL heap bytes a fresh build of a screen is allowed to take.
+ * Tune against the heap_b column of host/ui_bench when a screen grows.
+ * Example:
+ *   if (bytes > screen_mem_budget(SCREEN_LOGS)) { ... }
+ */
+uint32_t screen_mem_budget(ScreenId id) {
+  switch (id) {
+    case SCREEN_SLOT_WIZARD:
+      return 20U * 1024U; // on-screen keyboard for the slot name
+    case SCREEN_INFO:
+    case SCREEN_FEEDING_STATUS:
+      return 14U * 1024U;
+    case SCREEN_HISTORY:
+    case SCREEN_UI_MEMORY:
+      return 12U * 1024U;
+    default:
+      return 10U * 1024U;
+  }
+}
+
+/*
+ * refresh_cached_screen
+ * Re-applies the per-visit state a cached screen would get from a fresh build.
+ * Example:
+ *   refresh_cached_screen(SCREEN_LOGS);
+ */
+void refresh_cached_screen(ScreenId id) {
+  switch (id) {
+    case SCREEN_INFO:
+      update_info_screen();
+      break;
+    case SCREEN_FEEDING_STATUS:
+      update_feeding_screen();
+      break;
+    case SCREEN_MENU:
+      set_label_text(g_pause_menu_label, feedingIsEnabled() ? "Pause feeding" : "Unpause feeding");
+      break;
+    case SCREEN_LOGS:
+      g_log_index = 0;
+      update_logs_screen();
+      break;
+    default:
+      break;
+  }
+}
+
 /*
  * option_select_event
  * Event handler that updates an OptionGroup and refreshes dependent UI.
@@ -2247,7 +2807,7 @@ static lv_obj_t *create_toggle_block(lv_obj_t *parent, const char *label_text,
   lv_obj_t *label = lv_label_create(block);
   lv_label_set_text(label, label_text);
   lv_obj_set_style_text_color(label, lv_color_white(), 0);
-  lv_obj_set_style_text_font(label, &lv_font_montserrat_12, 0);
+  lv_obj_set_style_text_font(label, UI_FONT_12, 0);
   lv_obj_set_width(label, width);
 
   lv_obj_t *btn = lv_btn_create(block);
@@ -2297,7 +2857,7 @@ static void render_wizard_name_tab(lv_obj_t *parent) {
   lv_obj_t *name_label = lv_label_create(name_block);
   lv_label_set_text(name_label, "Name");
   lv_obj_set_style_text_color(name_label, kColorMuted, 0);
-  lv_obj_set_style_text_font(name_label, &lv_font_montserrat_12, 0);
+  lv_obj_set_style_text_font(name_label, UI_FONT_12, 0);
   lv_obj_set_pos(name_label, 0, kNameLabelY);
 
   lv_obj_t *text_area = lv_textarea_create(name_block);
@@ -2371,7 +2931,7 @@ static void render_wizard_start_tab(lv_obj_t *parent) {
   lv_obj_t *pick_label = lv_label_create(moist_pick);
   lv_label_set_text(pick_label, "Pick one...");
   lv_obj_set_style_text_color(pick_label, kColorMuted, 0);
-  lv_obj_set_style_text_font(pick_label, &lv_font_montserrat_12, 0);
+  lv_obj_set_style_text_font(pick_label, UI_FONT_12, 0);
 
   lv_obj_t *pick_row = lv_obj_create(moist_pick);
   lv_obj_set_width(pick_row, LV_PCT(100));
@@ -2509,7 +3069,7 @@ static void render_wizard_stop_tab(lv_obj_t *parent) {
   lv_obj_t *pick_label = lv_label_create(stop_pick);
   lv_label_set_text(pick_label, "Pick one...");
   lv_obj_set_style_text_color(pick_label, kColorMuted, 0);
-  lv_obj_set_style_text_font(pick_label, &lv_font_montserrat_12, 0);
+  lv_obj_set_style_text_font(pick_label, UI_FONT_12, 0);
 
   lv_obj_t *pick_row = lv_obj_create(stop_pick);
   lv_obj_set_width(pick_row, LV_PCT(100));
@@ -3,10 +3,14 @@
 #include "app_state.h"
 
 lv_obj_t *build_screen(ScreenId id);
+bool screen_is_cacheable(ScreenId id);
+uint32_t screen_mem_budget(ScreenId id);
+void refresh_cached_screen(ScreenId id);
 void update_active_screen();
 void update_screensaver(uint32_t now_ms);
 
 void update_logs_screen();
+void update_history_screen(bool force);
 void update_slot_summary_screen();
 void update_cal_moist_screen();
 void update_cal_flow_screen();
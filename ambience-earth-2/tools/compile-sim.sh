@@ -2,6 +2,8 @@
 set -euo pipefail
 
 date
+python3 tools/gen-image-assets.py
+python3 tools/gen-ui-fonts.py
 arduino-cli compile \
   --fqbn esp32:esp32:esp32s3 \
   --build-path main/build \
@@ -0,0 +1,220 @@
+#!/usr/bin/env python3
+"""Packs assets/*.png into compressed image data for the firmware.
+
+Each image is converted to RGB565 (plus an A8 plane when the PNG has alpha)
+and stored as byte-oriented RLE. Images with at most 256 colors may instead
+be stored as a palette plus RLE indices; whichever is smaller wins. The
+firmware decodes each image once into RAM on first use (image_assets.cpp).
+"""
+import struct
+import sys
+import zlib
+from pathlib import Path
+
+# (enum suffix / constant prefix, source file). Order defines ImageAssetId.
+ASSETS = [
+    ("Plant", "plant.png"),
+    ("Sun", "sun.png"),
+    ("Moon", "moon.png"),
+]
+
+RLE_MAX = 128
+
+
+def read_png(path):
+    data = path.read_bytes()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError(f"{path.name}: not a PNG")
+    pos = 8
+    idat = bytearray()
+    width = height = ctype = None
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, ctype, _, _, interlace = struct.unpack(">IIBBBBB", body)
+            if depth != 8 or ctype not in (2, 6) or interlace:
+                raise ValueError(f"{path.name}: need 8-bit RGB/RGBA, non-interlaced")
+        elif kind == b"IDAT":
+            idat.extend(body)
+        elif kind == b"IEND":
+            break
+
+    bpp = 4 if ctype == 6 else 3
+    stride = width * bpp
+    raw = zlib.decompress(bytes(idat))
+    rows = []
+    prev = bytearray(stride)
+    for y in range(height):
+        filt = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for x in range(stride):
+            left = line[x - bpp] if x >= bpp else 0
+            up = prev[x]
+            upleft = prev[x - bpp] if x >= bpp else 0
+            if filt == 1:
+                line[x] = (line[x] + left) & 0xFF
+            elif filt == 2:
+                line[x] = (line[x] + up) & 0xFF
+            elif filt == 3:
+                line[x] = (line[x] + ((left + up) >> 1)) & 0xFF
+            elif filt == 4:
+                p = left + up - upleft
+                pa, pb, pc = abs(p - left), abs(p - up), abs(p - upleft)
+                pred = left if pa <= pb and pa <= pc else (up if pb <= pc else upleft)
+                line[x] = (line[x] + pred) & 0xFF
+        rows.append(line)
+        prev = line
+
+    colors = []
+    alpha = []
+    for line in rows:
+        for x in range(width):
+            r, g, b = line[x * bpp:x * bpp + 3]
+            a = line[x * bpp + 3] if bpp == 4 else 255
+            color = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+            # Fully transparent pixels never show, so let them join one run.
+            colors.append(color if a else 0)
+            alpha.append(a)
+    return width, height, colors, (alpha if bpp == 4 else None)
+
+
+def rle(values, size):
+    """Control byte c < 0x80: c + 1 literal elements follow.
+    c >= 0x80: the next element repeats (c & 0x7F) + 1 times."""
+    out = bytearray()
+    literal = []
+
+    def put(value):
+        out.extend(value.to_bytes(size, "little"))
+
+    def flush():
+        if literal:
+            out.append(len(literal) - 1)
+            for value in literal:
+                put(value)
+            literal.clear()
+
+    i = 0
+    while i < len(values):
+        j = i
+        while j < len(values) and values[j] == values[i] and j - i < RLE_MAX:
+            j += 1
+        if j - i >= 2:
+            flush()
+            out.append(0x80 | (j - i - 1))
+            put(values[i])
+            i = j
+            continue
+        literal.append(values[i])
+        if len(literal) == RLE_MAX:
+            flush()
+        i += 1
+    flush()
+    return bytes(out)
+
+
+def pack(colors):
+    direct = rle(colors, 2)
+    palette = sorted(set(colors))
+    if len(palette) <= 256:
+        index = {c: i for i, c in enumerate(palette)}
+        indexed = rle([index[c] for c in colors], 1)
+        if len(indexed) + 2 * len(palette) < len(direct):
+            return palette, indexed
+    return [], direct
+
+
+def c_bytes(data, indent="  ", per_line=16):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ", ".join(f"0x{b:02X}" for b in data[i:i + per_line]) + ",")
+    return lines
+
+
+def main() -> int:
+    base = Path(__file__).resolve().parents[1]
+    src = base / "assets"
+    out_h = base / "main" / "image_assets_data.h"
+    out_cpp = base / "main" / "image_assets_data.cpp"
+
+    header = [
+        "#pragma once",
+        "",
+        "// Generated by tools/gen-image-assets.py from assets/*.png. Do not edit.",
+        "",
+        "#include <stdint.h>",
+        "",
+        "enum ImageAssetId : uint8_t {",
+    ]
+    header += [f"  IMAGE_ASSET_{name.upper()}{' = 0' if i == 0 else ''}," for i, (name, _) in enumerate(ASSETS)]
+    header += ["  IMAGE_ASSET_COUNT", "};", ""]
+
+    body = [
+        '#include "image_assets_data.h"',
+        "",
+        "// Generated by tools/gen-image-assets.py from assets/*.png. Do not edit.",
+        "",
+    ]
+    table = []
+    raw_total = 0
+    packed_total = 0
+    for name, filename in ASSETS:
+        width, height, colors, alpha = read_png(src / filename)
+        palette, color_rle = pack(colors)
+        alpha_rle = rle(alpha, 1) if alpha is not None else b""
+        raw = width * height * (3 if alpha is not None else 2)
+        packed = len(color_rle) + len(alpha_rle) + 2 * len(palette)
+        raw_total += raw
+        packed_total += packed
+        print(f"{filename}: {width}x{height} {raw} -> {packed} bytes"
+              f"{' (palette %d)' % len(palette) if palette else ''}")
+
+        header += [f"constexpr int16_t k{name}W = {width};", f"constexpr int16_t k{name}H = {height};"]
+        if palette:
+            body.append(f"static const uint16_t k{name}Palette[] = {{")
+            for i in range(0, len(palette), 8):
+                body.append("  " + ", ".join(f"0x{c:04X}" for c in palette[i:i + 8]) + ",")
+            body += ["};", ""]
+        body.append(f"static const uint8_t k{name}Color[] = {{")
+        body += c_bytes(color_rle)
+        body += ["};", ""]
+        if alpha is not None:
+            body.append(f"static const uint8_t k{name}Alpha[] = {{")
+            body += c_bytes(alpha_rle)
+            body += ["};", ""]
+        table.append(
+            f"  {{{width}, {height}, {'true' if alpha is not None else 'false'}, {len(palette)}, "
+            f"{'k%sPalette' % name if palette else 'nullptr'}, k{name}Color, sizeof(k{name}Color), "
+            f"{'k%sAlpha, sizeof(k%sAlpha)' % (name, name) if alpha is not None else 'nullptr, 0'}}},"
+        )
+
+    header += [
+        "",
+        "struct ImagePack {",
+        "  uint16_t w;",
+        "  uint16_t h;",
+        "  bool hasAlpha;",
+        "  uint16_t paletteCount;",
+        "  const uint16_t *palette;",
+        "  const uint8_t *color;",
+        "  uint32_t colorBytes;",
+        "  const uint8_t *alpha;",
+        "  uint32_t alphaBytes;",
+        "};",
+        "",
+        "extern const ImagePack kImagePacks[IMAGE_ASSET_COUNT];",
+    ]
+    body.append("const ImagePack kImagePacks[IMAGE_ASSET_COUNT] = {")
+    body += table
+    body.append("};")
+
+    out_h.write_text("\n".join(header) + "\n")
+    out_cpp.write_text("\n".join(body) + "\n")
+    print(f"total: {raw_total} -> {packed_total} bytes")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
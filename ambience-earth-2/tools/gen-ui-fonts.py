@@ -0,0 +1,173 @@
+#!/usr/bin/env python3
+"""Generates subset Montserrat fonts holding only the glyphs the UI can show.
+
+The UI sources are scanned for the UI_FONT_<size> macros they use, the
+LV_SYMBOL_* icons they reference and any non-ASCII characters in their string
+and format literals. Slot names typed on the on-screen keyboard reach labels
+of every size, so printable ASCII is always kept. Each size is rendered with
+lv_font_conv from the TTF/WOFF files LVGL ships in scripts/built_in_font/,
+using the same options as LVGL's built-in fonts.
+
+Outputs main/ui_font_montserrat_<size>.c and main/ui_fonts_data.h. When they
+are missing (no Node.js or LVGL checkout), lv_conf.h and ui_fonts.h fall back
+to the full built-in fonts, so this step is optional.
+"""
+import argparse
+import os
+import re
+import shutil
+import subprocess
+import sys
+from pathlib import Path
+
+UI_SOURCES = ["ui_screens.cpp", "ui_flow.cpp", "ui_components.h", "app_utils.h"]
+
+# LV_FONT_DEFAULT: the theme, text areas and the keyboard render with it.
+THEME_SIZE = 14
+# Icons lv_keyboard / lv_textarea draw on their own with the theme font.
+WIDGET_SYMBOLS = ["BACKSPACE", "NEW_LINE", "KEYBOARD", "OK", "CLOSE", "LEFT", "RIGHT"]
+
+ASCII_RANGE = (0x20, 0x7E)
+TEXT_FONT = "Montserrat-Medium.ttf"
+SYMBOL_FONT = "FontAwesome5-Solid+Brands+Regular.woff"
+
+STRING_RE = re.compile(r'"((?:[^"\\\n]|\\.)*)"')
+ESCAPE_RE = re.compile(rb"\\(x[0-9A-Fa-f]{1,2}|[0-7]{1,3}|.)")
+SIMPLE_ESCAPES = {b"n": b"\n", b"t": b"\t", b"r": b"\r", b"\\": b"\\", b'"': b'"', b"'": b"'", b"0": b"\0"}
+
+
+def decode_c_string(body):
+    def unescape(match):
+        token = match.group(1)
+        if token[:1] == b"x":
+            return bytes([int(token[1:], 16)])
+        if token[:1].isdigit() and token != b"0":
+            return bytes([int(token, 8) & 0xFF])
+        return SIMPLE_ESCAPES.get(token, token)
+
+    raw = ESCAPE_RE.sub(unescape, body.encode("utf-8"))
+    return raw.decode("utf-8", errors="ignore")
+
+
+def scan_sources(main_dir):
+    sizes = set()
+    symbols = set()
+    extra_chars = set()
+    for name in UI_SOURCES:
+        text = (main_dir / name).read_text(encoding="utf-8")
+        sizes.update(int(size) for size in re.findall(r"\bUI_FONT_(\d+)\b", text))
+        symbols.update(re.findall(r"\bLV_SYMBOL_([A-Z0-9_]+)\b", text))
+        for body in STRING_RE.findall(text):
+            # Format directives only expand to ASCII (digits, signs, '.', '%').
+            for ch in decode_c_string(body):
+                if ord(ch) > ASCII_RANGE[1]:
+                    extra_chars.add(ord(ch))
+    return sizes, symbols, extra_chars
+
+
+def read_symbol_codepoints(lvgl_dir):
+    header = (lvgl_dir / "src" / "font" / "lv_symbol_def.h").read_text(encoding="utf-8")
+    codepoints = {}
+    for name, body in re.findall(r'#define\s+LV_SYMBOL_(\w+)\s+"((?:\\x[0-9A-Fa-f]{2})+)"', header):
+        text = decode_c_string(body)
+        if len(text) == 1:
+            codepoints[name] = ord(text)
+    return codepoints
+
+
+def find_lvgl(arg):
+    candidates = [arg, os.environ.get("LVGL_DIR"), Path.home() / "Arduino" / "libraries" / "lvgl"]
+    for candidate in candidates:
+        if candidate and (Path(candidate) / "scripts" / "built_in_font" / TEXT_FONT).is_file():
+            return Path(candidate)
+    return None
+
+
+def font_conv_command():
+    if shutil.which("lv_font_conv"):
+        return ["lv_font_conv"]
+    if shutil.which("npx"):
+        return ["npx", "--yes", "lv_font_conv@1.5.3"]
+    return None
+
+
+def ranges_arg(codepoints):
+    points = sorted(codepoints)
+    parts = []
+    start = prev = points[0]
+    for cp in points[1:] + [None]:
+        if cp is not None and cp == prev + 1:
+            prev = cp
+            continue
+        parts.append(f"0x{start:X}" if start == prev else f"0x{start:X}-0x{prev:X}")
+        if cp is not None:
+            start = prev = cp
+    return ",".join(parts)
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--lvgl", help="LVGL checkout (default: $LVGL_DIR or ~/Arduino/libraries/lvgl)")
+    args = parser.parse_args()
+
+    base = Path(__file__).resolve().parents[1]
+    main_dir = base / "main"
+    sizes, symbols, extra_chars = scan_sources(main_dir)
+    if not sizes:
+        print("no UI_FONT_<size> references found", file=sys.stderr)
+        return 1
+
+    lvgl_dir = find_lvgl(args.lvgl)
+    conv = font_conv_command()
+    if lvgl_dir is None or conv is None:
+        missing = "LVGL checkout" if lvgl_dir is None else "lv_font_conv/npx"
+        print(f"gen-ui-fonts: {missing} not found; keeping existing fonts (built-ins if none)")
+        return 0
+
+    symbol_codepoints = read_symbol_codepoints(lvgl_dir)
+    unknown = sorted(s for s in symbols | set(WIDGET_SYMBOLS) if s not in symbol_codepoints)
+    if unknown:
+        print(f"unknown LV_SYMBOL_* names: {', '.join(unknown)}", file=sys.stderr)
+        return 1
+
+    font_dir = lvgl_dir / "scripts" / "built_in_font"
+    text_points = set(range(ASCII_RANGE[0], ASCII_RANGE[1] + 1)) | extra_chars
+    header = [
+        "#pragma once",
+        "",
+        "// Generated by tools/gen-ui-fonts.py. Do not edit.",
+        "",
+        '#include "lvgl_config.h"',
+        "",
+    ]
+    for size in sorted(sizes):
+        names = set(symbols)
+        if size == THEME_SIZE:
+            names.update(WIDGET_SYMBOLS)
+        icon_points = {symbol_codepoints[name] for name in names}
+        font_name = f"ui_font_montserrat_{size}"
+        out_c = main_dir / f"{font_name}.c"
+        cmd = conv + [
+            "--no-compress", "--no-prefilter", "--bpp", "4", "--size", str(size),
+            "--font", str(font_dir / TEXT_FONT), "-r", ranges_arg(text_points),
+        ]
+        if icon_points:
+            cmd += ["--font", str(font_dir / SYMBOL_FONT), "-r", ranges_arg(icon_points)]
+        cmd += ["--format", "lvgl", "--lv-font-name", font_name, "--force-fast-kern-format", "-o", str(out_c)]
+        subprocess.run(cmd, check=True)
+
+        # Resolve lvgl.h the way the rest of the sketch does.
+        source = out_c.read_text(encoding="utf-8")
+        source = re.sub(r'#ifdef LV_LVGL_H_INCLUDE_SIMPLE\s*#include "lvgl.h"\s*#else\s*#include "lvgl/lvgl.h"\s*#endif',
+                        '#include "lvgl_config.h"', source)
+        out_c.write_text(source, encoding="utf-8")
+        print(f"{out_c.name}: {len(text_points)} text + {len(icon_points)} icon glyphs")
+
+        header += [f"LV_FONT_DECLARE({font_name})", f"#define UI_FONT_{size} (&{font_name})", ""]
+
+    (main_dir / "ui_fonts_data.h").write_text("\n".join(header), encoding="utf-8")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,27 @@
+#pragma once
+#include <stdint.h>
+
+// Generated by tools/gen-key-script.py from buttons-chip/scripts/menu-walk.keys.
+
+typedef struct {
+  const char *name;
+  uint16_t adc;  // 1023 = released
+  uint32_t ms;   // 0 = the holdMs attribute
+} key_step_t;
+
+#define KEY_SCRIPT_STEPS 13
+static const key_step_t kKeyScript[KEY_SCRIPT_STEPS] = {
+  {"ok", 700, 0},
+  {"wait", 1023, 1000},
+  {"ok", 700, 0},
+  {"wait", 1023, 800},
+  {"down", 300, 0},
+  {"down", 300, 0},
+  {"down", 300, 0},
+  {"up", 500, 0},
+  {"down", 300, 1400},
+  {"up", 500, 1400},
+  {"left", 900, 0},
+  {"wait", 1023, 800},
+  {"left", 900, 0},
+};
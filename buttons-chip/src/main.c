@@ -5,6 +5,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include "key_script.h"
+
 typedef struct {
   pin_t pin_a;
   pin_t pin_f;
@@ -13,6 +15,17 @@ typedef struct {
   pin_t pin_d;
   pin_t pin_out;
   int last_adc;
+
+  // Scripted playback: the step being played, whether it is in the press or
+  // the release gap after it, and which pass over the script this is.
+  timer_t script_timer;
+  bool script_pressing;
+  uint32_t script_step;
+  uint32_t script_loop;
+  uint32_t script_loops;
+  uint32_t hold_ms;
+  uint32_t gap_ms;
+  int script_adc;
 } chip_state_t;
 
 static float adc_to_volts(int adc) {
@@ -23,8 +36,13 @@ static bool is_pressed(pin_t pin) {
   return pin_read(pin) == LOW;
 }
 
+static double sim_seconds(void) {
+  return get_sim_nanos() / 1e9;
+}
+
+// A physical press wins over the script.
 static void update_output(chip_state_t *chip) {
-  int adc = 1023;
+  int adc = chip->script_adc;
 
   if (is_pressed(chip->pin_a)) adc = 900;
   else if (is_pressed(chip->pin_f)) adc = 700;
@@ -33,7 +51,7 @@ static void update_output(chip_state_t *chip) {
   else if (is_pressed(chip->pin_d)) adc = 100;
 
   if (adc != chip->last_adc) {
-    printf("adc=%d\n", adc);
+    printf("adc=%d t=%.3fs\n", adc, sim_seconds());
     chip->last_adc = adc;
   }
 
@@ -46,6 +64,39 @@ static void chip_pin_change(void *user_data, pin_t pin, uint32_t value) {
   update_output(chip);
 }
 
+static void schedule_step(chip_state_t *chip, uint32_t ms) {
+  timer_start(chip->script_timer, ms * 1000u, false);
+}
+
+static void script_advance(void *user_data) {
+  chip_state_t *chip = (chip_state_t*)user_data;
+
+  // A press always ends in a release gap before the next step.
+  if (chip->script_pressing) {
+    chip->script_pressing = false;
+    chip->script_adc = 1023;
+    update_output(chip);
+    schedule_step(chip, chip->gap_ms);
+    return;
+  }
+
+  if (chip->script_step >= KEY_SCRIPT_STEPS) {
+    chip->script_loop++;
+    printf("keys: %.3fs script pass %u done\n", sim_seconds(), (unsigned)chip->script_loop);
+    if (chip->script_loops && chip->script_loop >= chip->script_loops) return;
+    chip->script_step = 0;
+  }
+
+  const key_step_t *step = &kKeyScript[chip->script_step++];
+  uint32_t ms = step->ms ? step->ms : chip->hold_ms;
+  printf("keys: %.3fs step %u/%u %s %ums\n", sim_seconds(), (unsigned)chip->script_step,
+         (unsigned)KEY_SCRIPT_STEPS, step->name, (unsigned)ms);
+  chip->script_pressing = step->adc != 1023;
+  chip->script_adc = step->adc;
+  update_output(chip);
+  schedule_step(chip, ms);
+}
+
 void chip_init(void) {
   chip_state_t *chip = malloc(sizeof(chip_state_t));
   if (!chip) return;
@@ -56,6 +107,14 @@ void chip_init(void) {
   chip->pin_d = pin_init("D", INPUT_PULLUP);
   chip->pin_out = pin_init("OUT", ANALOG);
   chip->last_adc = -1;
+  chip->script_adc = 1023;
+  chip->script_pressing = false;
+  chip->script_step = 0;
+  chip->script_loop = 0;
+  chip->script_loops = attr_read(attr_init("loops", 1));
+  chip->hold_ms = attr_read(attr_init("holdMs", 150));
+  chip->gap_ms = attr_read(attr_init("gapMs", 350));
+  uint32_t start_ms = attr_read(attr_init("startMs", 3000));
 
   const pin_watch_config_t config = {
     .edge = BOTH,
@@ -69,4 +128,15 @@ void chip_init(void) {
   pin_watch(chip->pin_d, &config);
 
   update_output(chip);
+
+  if (attr_read(attr_init("script", 0))) {
+    const timer_config_t timer_config = {
+      .callback = script_advance,
+      .user_data = chip,
+    };
+    chip->script_timer = timer_init(&timer_config);
+    printf("keys: playing %u steps after %ums, %u pass(es)\n", (unsigned)KEY_SCRIPT_STEPS, (unsigned)start_ms,
+           (unsigned)chip->script_loops);
+    schedule_step(chip, start_ms);
+  }
 }
@@ -4,38 +4,124 @@
 #include "wokwi-api.h"
 #include <stdint.h>
 #include <stdbool.h>
+#include <stdio.h>
 
 #include "eeprom_data.h"
 
-#define EEPROM_SIZE 4096u
-#define EEPROM_MASK (EEPROM_SIZE - 1u)
+// AT24C32 through AT24C256: 4 KiB to 32 KiB, 32 or 64 byte pages.
+#define EEPROM_MIN_SIZE 4096u
+#define EEPROM_MAX_SIZE 32768u
+#define EEPROM_MIN_PAGE 32u
+#define EEPROM_MAX_PAGE 64u
+#define EEPROM_MAX_PAGES (EEPROM_MAX_SIZE / EEPROM_MIN_PAGE)
 
 typedef struct {
+  uint32_t write_cycles;
+  uint32_t write_bytes;
+  uint32_t partial_pages;
+  uint32_t rollovers;
+  uint32_t busy_nacks;
+  uint32_t read_transactions;
+  uint32_t read_bytes;
+  uint64_t busy_ns;
+} eeprom_stats_t;
+
+typedef struct {
+  uint32_t size;
+  uint32_t page_size;
+  uint64_t write_cycle_ns;
+  uint64_t busy_until_ns;
+  bool trace;
+
   uint16_t addr;
   uint8_t addr_stage;
+  // Bytes latched for the page being written, committed on STOP.
+  uint8_t pending[EEPROM_MAX_PAGE];
+  uint64_t pending_mask;
+  uint16_t pending_base;
+  uint32_t pending_count;
+
+  eeprom_stats_t stats;
+  eeprom_stats_t reported;
+  uint16_t page_cycles[EEPROM_MAX_PAGES];
 } chip_state_t;
 
-static uint8_t memory[EEPROM_SIZE];
-static chip_state_t chip_state = {0, 0};
+static uint8_t memory[EEPROM_MAX_SIZE];
+static chip_state_t chip_state;
 
 static void load_memory(void) {
-  uint16_t i = 0;
-  for (; i < EEPROM_DATA_SIZE && i < EEPROM_SIZE; ++i) {
+  uint32_t i = 0;
+  for (; i < EEPROM_DATA_SIZE && i < chip_state.size; ++i) {
     memory[i] = kEepromData[i];
   }
-  for (; i < EEPROM_SIZE; ++i) {
+  for (; i < chip_state.size; ++i) {
     memory[i] = 0;
   }
 }
 
-static inline uint16_t wrap_addr(uint16_t addr) {
-  return (uint16_t)(addr & EEPROM_MASK);
+static inline uint16_t wrap_addr(uint32_t addr) {
+  return (uint16_t)(addr & (chip_state.size - 1u));
+}
+
+static uint32_t pow2_at_most(uint32_t value) {
+  uint32_t result = 1;
+  while (result * 2u <= value) result *= 2u;
+  return result;
+}
+
+static void trace_commit(void) {
+  uint32_t offset = 0;
+  while (offset < chip_state.page_size) {
+    if (!(chip_state.pending_mask & (1ull << offset))) {
+      offset++;
+      continue;
+    }
+    printf("eeprom: W 0x%04x", (unsigned)(chip_state.pending_base + offset));
+    while (offset < chip_state.page_size && (chip_state.pending_mask & (1ull << offset))) {
+      printf(" %02x", chip_state.pending[offset]);
+      offset++;
+    }
+    printf("\n");
+  }
+}
+
+static void commit_page(void) {
+  if (!chip_state.pending_mask) return;
+  uint32_t bytes = 0;
+  for (uint32_t offset = 0; offset < chip_state.page_size; ++offset) {
+    if (!(chip_state.pending_mask & (1ull << offset))) continue;
+    memory[chip_state.pending_base + offset] = chip_state.pending[offset];
+    bytes++;
+  }
+  if (chip_state.trace) trace_commit();
+
+  // The chip reprograms the whole page whatever the byte count, so a write
+  // of one byte costs the same tWR and page wear as a full page.
+  eeprom_stats_t *stats = &chip_state.stats;
+  stats->write_cycles++;
+  stats->write_bytes += bytes;
+  if (bytes < chip_state.page_size) stats->partial_pages++;
+  if (chip_state.pending_count > chip_state.page_size) stats->rollovers++;
+  stats->busy_ns += chip_state.write_cycle_ns;
+  uint32_t page = chip_state.pending_base / chip_state.page_size;
+  if (page < EEPROM_MAX_PAGES && chip_state.page_cycles[page] < 0xFFFFu) chip_state.page_cycles[page]++;
+
+  chip_state.busy_until_ns = get_sim_nanos() + chip_state.write_cycle_ns;
+  chip_state.pending_mask = 0;
+  chip_state.pending_count = 0;
 }
 
 static bool on_i2c_connect(void *user_data, uint32_t address, bool read) {
   (void)user_data;
   (void)address;
-  if (!read) {
+  // No ACK while the write cycle runs; firmware can poll for completion.
+  if (get_sim_nanos() < chip_state.busy_until_ns) {
+    chip_state.stats.busy_nacks++;
+    return false;
+  }
+  if (read) {
+    chip_state.stats.read_transactions++;
+  } else {
     chip_state.addr_stage = 0;
   }
   return true;
@@ -43,9 +129,11 @@ static bool on_i2c_connect(void *user_data, uint32_t address, bool read) {
 
 static uint8_t on_i2c_read(void *user_data) {
   (void)user_data;
+  // Sequential reads roll over the whole array, not the page.
   uint16_t addr = wrap_addr(chip_state.addr);
   uint8_t value = memory[addr];
   chip_state.addr = wrap_addr(chip_state.addr + 1u);
+  chip_state.stats.read_bytes++;
   return value;
 }
 
@@ -57,18 +145,67 @@ static bool on_i2c_write(void *user_data, uint8_t data) {
     return true;
   }
   if (chip_state.addr_stage == 1) {
-    chip_state.addr |= data;
+    chip_state.addr = wrap_addr(chip_state.addr | data);
     chip_state.addr_stage = 2;
+    chip_state.pending_base = (uint16_t)(chip_state.addr & ~(chip_state.page_size - 1u));
+    chip_state.pending_mask = 0;
+    chip_state.pending_count = 0;
     return true;
   }
-  uint16_t addr = wrap_addr(chip_state.addr);
-  memory[addr] = data;
-  chip_state.addr = wrap_addr(chip_state.addr + 1u);
+  // Past the end of the page the address wraps to the page start and
+  // overwrites what was latched there.
+  uint32_t offset = chip_state.addr & (chip_state.page_size - 1u);
+  chip_state.pending[offset] = data;
+  chip_state.pending_mask |= 1ull << offset;
+  chip_state.pending_count++;
+  chip_state.addr = (uint16_t)(chip_state.pending_base + ((offset + 1u) & (chip_state.page_size - 1u)));
   return true;
 }
 
+static void on_i2c_disconnect(void *user_data) {
+  (void)user_data;
+  commit_page();
+}
+
+static void report_stats(void *user_data) {
+  (void)user_data;
+  const eeprom_stats_t *s = &chip_state.stats;
+  if (s->write_cycles == chip_state.reported.write_cycles && s->read_bytes == chip_state.reported.read_bytes &&
+      s->busy_nacks == chip_state.reported.busy_nacks) {
+    return;
+  }
+  chip_state.reported = *s;
+
+  uint32_t pages = chip_state.size / chip_state.page_size;
+  if (pages > EEPROM_MAX_PAGES) pages = EEPROM_MAX_PAGES;
+  uint32_t worst_page = 0;
+  for (uint32_t i = 1; i < pages; ++i) {
+    if (chip_state.page_cycles[i] > chip_state.page_cycles[worst_page]) worst_page = i;
+  }
+  uint32_t avg_fill = s->write_cycles ? (s->write_bytes * 100u) / (s->write_cycles * chip_state.page_size) : 0;
+  printf("eeprom: writes=%u bytes=%u fill=%u%% partial=%u rollover=%u busy=%ums nack=%u | "
+         "reads=%u rbytes=%u | hottest page 0x%04x x%u\n",
+         (unsigned)s->write_cycles, (unsigned)s->write_bytes, (unsigned)avg_fill, (unsigned)s->partial_pages,
+         (unsigned)s->rollovers, (unsigned)(s->busy_ns / 1000000ull), (unsigned)s->busy_nacks,
+         (unsigned)s->read_transactions, (unsigned)s->read_bytes, (unsigned)(worst_page * chip_state.page_size),
+         (unsigned)chip_state.page_cycles[worst_page]);
+}
+
 void chip_init(void) {
+  uint32_t size = attr_read(attr_init("size", 4096));
+  if (size < EEPROM_MIN_SIZE) size = EEPROM_MIN_SIZE;
+  if (size > EEPROM_MAX_SIZE) size = EEPROM_MAX_SIZE;
+  chip_state.size = pow2_at_most(size);
+  uint32_t page = attr_read(attr_init("pageSize", chip_state.size >= 16384u ? 64 : 32));
+  if (page < EEPROM_MIN_PAGE) page = EEPROM_MIN_PAGE;
+  if (page > EEPROM_MAX_PAGE) page = EEPROM_MAX_PAGE;
+  chip_state.page_size = pow2_at_most(page);
+  chip_state.write_cycle_ns = (uint64_t)attr_read(attr_init("writeCycleUs", 5000)) * 1000ull;
+  chip_state.trace = attr_read(attr_init("trace", 0)) != 0;
+  uint32_t stats_ms = attr_read(attr_init("statsMs", 10000));
   load_memory();
+  printf("eeprom: %u bytes, %u byte pages, tWR %u us\n", (unsigned)chip_state.size, (unsigned)chip_state.page_size,
+         (unsigned)(chip_state.write_cycle_ns / 1000ull));
 
   i2c_config_t i2c1 = {
     .address = 0x50,
@@ -77,9 +214,17 @@ void chip_init(void) {
     .connect = on_i2c_connect,
     .read = on_i2c_read,
     .write = on_i2c_write,
-    .disconnect = 0,
+    .disconnect = on_i2c_disconnect,
     .user_data = &chip_state,
   };
 
   i2c_init(&i2c1);
+
+  if (stats_ms) {
+    const timer_config_t timer_config = {
+      .callback = report_stats,
+      .user_data = &chip_state,
+    };
+    timer_start(timer_init(&timer_config), stats_ms * 1000u, true);
+  }
 }
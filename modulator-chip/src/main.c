@@ -5,11 +5,27 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <string.h>
+
+typedef struct {
+  // Water held by the substrate and the pool on top that has not soaked in yet.
+  float root_ml;
+  float surface_ml;
+  float drain_ml_min;
+  // Totals and the clock are doubles: per-tick steps vanish in a float after
+  // a few days.
+  double pumped_ml;
+  double drained_ml;
+  double transpired_ml;
+  double day_s;
+} substrate_t;
 
 typedef struct {
   pin_t pin_in;
   pin_t pin_out;
   pin_t pin_vcc;
+  pin_t pin_pump;
+  pin_t pin_runoff;
   timer_t timer;
   float phase;
   float depth;
@@ -17,6 +33,34 @@ typedef struct {
   float hold_remaining;
   uint32_t rng;
   int last_millivolts;
+
+  bool model;
+  bool pump_active_low;
+  bool last_pump_on;
+  float capacity_ml;
+  float field_capacity_ml;
+  float wilting_ml;
+  float dripper_ml_s;
+  float infiltration_tau_s;
+  float drain_per_s;
+  float et_ml_s;
+  float et_dark_fraction;
+  float lights_on_min;
+  float lights_off_min;
+  float volts_dry;
+  float volts_wet;
+  float time_scale;
+  float report_remaining;
+
+  float runoff_on_ml_min;
+  float runoff_off_ml_min;
+  float runoff_delay_s;
+  float runoff_release_s;
+  // Seconds the flow has been on the far side of the active threshold.
+  float runoff_pending_s;
+  bool runoff_active;
+  uint32_t runoff_events;
+  substrate_t soil;
 } chip_state_t;
 
 static const float kPi = 3.1415927f;
@@ -24,6 +68,7 @@ static const float kTwoPi = 6.2831853f;
 static const float kHalfPi = 1.5707963f;
 static const float kThreeHalfPi = 4.7123890f;
 static const float kTickSeconds = 0.05f;
+static const float kReportSeconds = 60.0f;
 
 static uint32_t lcg_next(uint32_t *state) {
   *state = (*state * 1664525u) + 1013904223u;
@@ -53,6 +98,12 @@ static float absf(float value) {
   return value < 0.0f ? -value : value;
 }
 
+static float clampf(float value, float lo, float hi) {
+  if (value < lo) return lo;
+  if (value > hi) return hi;
+  return value;
+}
+
 static float sin_approx(float value) {
   float x = wrap_pi(value);
   const float B = 4.0f / kPi;
@@ -62,13 +113,123 @@ static float sin_approx(float value) {
   return P * (y * absf(y) - y) + y;
 }
 
+static bool pump_on(chip_state_t *chip) {
+  if (chip->pin_pump == NO_PIN) return false;
+  uint32_t level = pin_read(chip->pin_pump);
+  return chip->pump_active_low ? level == LOW : level == HIGH;
+}
+
+static bool lights_on(chip_state_t *chip) {
+  float minute = (float)(chip->soil.day_s / 60.0);
+  float on = chip->lights_on_min;
+  float off = chip->lights_off_min;
+  if (on == off) return true;
+  if (on < off) return minute >= on && minute < off;
+  return minute >= on || minute < off;
+}
+
+static float moisture_percent(chip_state_t *chip) {
+  return chip->soil.root_ml * 100.0f / chip->capacity_ml;
+}
+
+static void step_substrate(chip_state_t *chip, float dt, bool pumping) {
+  substrate_t *soil = &chip->soil;
+  soil->day_s += dt;
+  while (soil->day_s >= 86400.0) soil->day_s -= 86400.0;
+
+  if (pumping) {
+    float in = chip->dripper_ml_s * dt;
+    soil->surface_ml += in;
+    soil->pumped_ml += in;
+  }
+
+  // Pooled water soaks in over the infiltration time, but only as far as the
+  // substrate has room; the rest runs straight through to the tray.
+  float soak = soil->surface_ml * clampf(dt / chip->infiltration_tau_s, 0.0f, 1.0f);
+  soil->surface_ml -= soak;
+  float room = chip->capacity_ml - soil->root_ml;
+  float absorbed = soak < room ? soak : room;
+  soil->root_ml += absorbed;
+  float drained = soak - absorbed;
+
+  // Above field capacity gravity drains the excess.
+  if (soil->root_ml > chip->field_capacity_ml) {
+    float excess = (soil->root_ml - chip->field_capacity_ml) * clampf(chip->drain_per_s * dt, 0.0f, 1.0f);
+    soil->root_ml -= excess;
+    drained += excess;
+  }
+  soil->drained_ml += drained;
+  soil->drain_ml_min = dt > 0.0f ? drained * 60.0f / dt : 0.0f;
+
+  // Transpiration tapers off linearly from halfway between wilting point and
+  // field capacity down to nothing at wilting point.
+  float et = chip->et_ml_s * dt;
+  if (!lights_on(chip)) et *= chip->et_dark_fraction;
+  float knee = (chip->wilting_ml + chip->field_capacity_ml) * 0.5f;
+  if (soil->root_ml < knee) {
+    float span = knee - chip->wilting_ml;
+    et *= span > 0.0f ? clampf((soil->root_ml - chip->wilting_ml) / span, 0.0f, 1.0f) : 0.0f;
+  }
+  if (et > soil->root_ml) et = soil->root_ml;
+  soil->root_ml -= et;
+  soil->transpired_ml += et;
+}
+
+static float model_volts(chip_state_t *chip) {
+  float fraction = clampf(chip->soil.root_ml / chip->capacity_ml, 0.0f, 1.0f);
+  return chip->volts_dry + (chip->volts_wet - chip->volts_dry) * fraction;
+}
+
+// Drainage reaches the tray sensor after a delay and keeps it wet for a while
+// after the flow stops, so the output switches on one threshold held for the
+// delay and off on a lower one held for the release time.
+static void update_runoff(chip_state_t *chip, float dt) {
+  float flow = chip->soil.drain_ml_min;
+  bool crossing = chip->runoff_active ? flow < chip->runoff_off_ml_min : flow >= chip->runoff_on_ml_min;
+  if (!crossing) {
+    chip->runoff_pending_s = 0.0f;
+    return;
+  }
+  chip->runoff_pending_s += dt;
+  float needed = chip->runoff_active ? chip->runoff_release_s : chip->runoff_delay_s;
+  if (chip->runoff_pending_s < needed) return;
+
+  chip->runoff_pending_s = 0.0f;
+  chip->runoff_active = !chip->runoff_active;
+  if (chip->runoff_active) chip->runoff_events++;
+  // Open drain, like the float switch it stands in for: pull low or let go.
+  pin_mode(chip->pin_runoff, chip->runoff_active ? OUTPUT_LOW : INPUT);
+  printf("runoff=%s drain=%.1fml/min events=%u\n", chip->runoff_active ? "on" : "off", flow,
+         (unsigned)chip->runoff_events);
+}
+
+static void report_substrate(chip_state_t *chip, bool pumping) {
+  substrate_t *soil = &chip->soil;
+  printf("moisture=%.1f%% root=%.0fml pool=%.0fml drain=%.1fml/min pump=%s lights=%s "
+         "pumped=%.0fml drained=%.0fml et=%.0fml\n",
+         moisture_percent(chip), soil->root_ml, soil->surface_ml, soil->drain_ml_min, pumping ? "on" : "off",
+         lights_on(chip) ? "on" : "off", soil->pumped_ml, soil->drained_ml, soil->transpired_ml);
+}
+
 static void update_output(void *user_data) {
   chip_state_t *chip = (chip_state_t *)user_data;
+  if (chip->model) {
+    // The substrate keeps drying while the probe is unpowered.
+    bool pumping = pump_on(chip);
+    step_substrate(chip, kTickSeconds * chip->time_scale, pumping);
+    update_runoff(chip, kTickSeconds * chip->time_scale);
+    chip->report_remaining -= kTickSeconds * chip->time_scale;
+    if (pumping != chip->last_pump_on || chip->report_remaining <= 0.0f) {
+      report_substrate(chip, pumping);
+      chip->last_pump_on = pumping;
+      chip->report_remaining = kReportSeconds;
+    }
+  }
   if (chip->pin_vcc != NO_PIN && pin_read(chip->pin_vcc) == LOW) {
     pin_dac_write(chip->pin_out, 0.0f);
     return;
   }
-  float volts = pin_adc_read(chip->pin_in);
+  float volts = chip->model ? model_volts(chip) : pin_adc_read(chip->pin_in);
   if (volts < 0.0f) volts = 0.0f;
   if (volts > 5.0f) volts = 5.0f;
 
@@ -81,7 +242,7 @@ static void update_output(void *user_data) {
   if (modulated > 5.0f) modulated = 5.0f;
 
   int millivolts = (int)(volts * 1000.0f + 0.5f);
-  if (millivolts != chip->last_millivolts) {
+  if (!chip->model && millivolts != chip->last_millivolts) {
     printf("in=%.3fV\n", volts);
     chip->last_millivolts = millivolts;
   }
@@ -114,18 +275,61 @@ static void update_output(void *user_data) {
   chip->phase = next_phase;
 }
 
+static void init_substrate(chip_state_t *chip) {
+  chip->model = attr_read(attr_init("model", 0)) != 0;
+  chip->pump_active_low = attr_read(attr_init("pumpActiveLow", 1)) != 0;
+  chip->capacity_ml = attr_read_float(attr_init_float("capacityMl", 4000.0f));
+  if (chip->capacity_ml < 1.0f) chip->capacity_ml = 1.0f;
+  float field_pct = clampf(attr_read_float(attr_init_float("fieldCapacity", 80.0f)), 1.0f, 100.0f);
+  float wilting_pct = clampf(attr_read_float(attr_init_float("wiltingPoint", 20.0f)), 0.0f, field_pct);
+  chip->field_capacity_ml = chip->capacity_ml * field_pct / 100.0f;
+  chip->wilting_ml = chip->capacity_ml * wilting_pct / 100.0f;
+  chip->dripper_ml_s = attr_read_float(attr_init_float("dripperMlH", 6000.0f)) / 3600.0f;
+  chip->infiltration_tau_s = attr_read_float(attr_init_float("infiltrationSeconds", 90.0f));
+  if (chip->infiltration_tau_s < kTickSeconds) chip->infiltration_tau_s = kTickSeconds;
+  chip->drain_per_s = attr_read_float(attr_init_float("drainPerMin", 0.15f)) / 60.0f;
+  chip->et_ml_s = attr_read_float(attr_init_float("etMlH", 30.0f)) / 3600.0f;
+  chip->et_dark_fraction = clampf(attr_read_float(attr_init_float("etDark", 0.1f)), 0.0f, 1.0f);
+  chip->lights_on_min = clampf(attr_read_float(attr_init_float("lightsOn", 360.0f)), 0.0f, 1439.0f);
+  chip->lights_off_min = clampf(attr_read_float(attr_init_float("lightsOff", 1080.0f)), 0.0f, 1439.0f);
+  float start_minute = clampf(attr_read_float(attr_init_float("startMinute", 360.0f)), 0.0f, 1439.0f);
+  chip->volts_dry = clampf(attr_read_float(attr_init_float("voltsDry", 2.8f)), 0.0f, 5.0f);
+  chip->volts_wet = clampf(attr_read_float(attr_init_float("voltsWet", 1.2f)), 0.0f, 5.0f);
+  chip->time_scale = attr_read_float(attr_init_float("timeScale", 1.0f));
+  if (chip->time_scale <= 0.0f) chip->time_scale = 1.0f;
+
+  float start_pct = clampf(attr_read_float(attr_init_float("startPercent", 55.0f)), 0.0f, 100.0f);
+  memset(&chip->soil, 0, sizeof(chip->soil));
+  chip->soil.root_ml = chip->capacity_ml * start_pct / 100.0f;
+  chip->soil.day_s = start_minute * 60.0;
+  chip->last_pump_on = false;
+  chip->report_remaining = 0.0f;
+
+  chip->runoff_on_ml_min = attr_read_float(attr_init_float("runoffOnMlMin", 5.0f));
+  chip->runoff_off_ml_min = attr_read_float(attr_init_float("runoffOffMlMin", 2.0f));
+  if (chip->runoff_off_ml_min > chip->runoff_on_ml_min) chip->runoff_off_ml_min = chip->runoff_on_ml_min;
+  chip->runoff_delay_s = attr_read_float(attr_init_float("runoffDelaySeconds", 20.0f));
+  chip->runoff_release_s = attr_read_float(attr_init_float("runoffReleaseSeconds", 30.0f));
+  chip->runoff_pending_s = 0.0f;
+  chip->runoff_active = false;
+  chip->runoff_events = 0;
+}
+
 void chip_init(void) {
   chip_state_t *chip = malloc(sizeof(chip_state_t));
   if (!chip) return;
   chip->pin_in = pin_init("IN", ANALOG);
   chip->pin_out = pin_init("OUT", ANALOG);
   chip->pin_vcc = pin_init("VCC", INPUT);
+  chip->pin_pump = pin_init("PUMP", INPUT);
+  chip->pin_runoff = pin_init("RUNOFF", INPUT);
   chip->phase = 0.0f;
   chip->hold_remaining = 0.0f;
   chip->rng = (uint32_t)get_sim_nanos();
   if (chip->rng == 0) chip->rng = 1;
   chip->last_millivolts = -1;
   choose_cycle(chip);
+  init_substrate(chip);
 
   const timer_config_t timer_config = {
     .callback = update_output,
@@ -2,11 +2,14 @@
 set -euo pipefail
 
 repo_root="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
-chip_dir="${repo_root}/eeprom-chip"
-image_tag="ambience-earth-wokwi-chips"
+chip_name="${1:-eeprom-chip}"
+chip_dir="${repo_root}/${chip_name}"
+image_tag="ambience-earth-${chip_name}"
+wasi_sysroot="${WASI_SYSROOT:-/opt/wasi-libc}"
 
-if command -v clang >/dev/null 2>&1 && command -v wasm-ld >/dev/null 2>&1; then
-  make -C "${chip_dir}"
+# The chips link against wasi-libc, so plain clang without the sysroot is not enough.
+if command -v clang >/dev/null 2>&1 && command -v wasm-ld >/dev/null 2>&1 && [ -d "${wasi_sysroot}" ]; then
+  make -C "${chip_dir}" WASI_SYSROOT="${wasi_sysroot}"
   exit 0
 fi
 
@@ -17,7 +20,7 @@ if command -v devcontainer >/dev/null 2>&1; then
 fi
 
 if ! command -v docker >/dev/null 2>&1; then
-  echo "Missing docker/devcontainer; install one or run make inside the eeprom-chip dev container." >&2
+  echo "Missing docker/devcontainer; install one or run make inside the ${chip_name} dev container." >&2
   exit 1
 fi
 
@@ -25,4 +28,4 @@ if ! docker image inspect "${image_tag}" >/dev/null 2>&1; then
   docker build -t "${image_tag}" -f "${chip_dir}/.devcontainer/Dockerfile" "${chip_dir}/.devcontainer"
 fi
 
-docker run --rm -v "${chip_dir}:/workspaces/eeprom-chip" -w /workspaces/eeprom-chip "${image_tag}" make
+docker run --rm -v "${chip_dir}:/workspaces/${chip_name}" -w "/workspaces/${chip_name}" "${image_tag}" make
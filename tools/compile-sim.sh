@@ -1,5 +1,7 @@
 #!/bin/bash
 set -e
 
-bash tools/build-eeprom-chip.sh
+bash tools/build-wokwi-chip.sh eeprom-chip
+bash tools/build-wokwi-chip.sh buttons-chip
+bash tools/build-wokwi-chip.sh modulator-chip
 arduino-cli compile --fqbn arduino:avr:mega -e main --build-property build.extra_flags=-DWOKWI_SIM
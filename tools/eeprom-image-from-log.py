@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+import argparse
+import re
+import sys
+from pathlib import Path
+
+# Rebuilds an EEPROM image from the chip's write trace. Run the simulation with
+# the eeprom chip's "trace" attribute set, save the chip log, then:
+#   tools/eeprom-image-from-log.py chip.log -o eeprom.bin
+#   python3 tools/gen-eeprom-chip-data.py --image eeprom.bin
+# and rebuild the chip; the next run starts with the logged contents.
+
+WRITE_LINE = re.compile(r"eeprom: W 0x([0-9a-fA-F]+)((?: [0-9a-fA-F]{2})+)")
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="Replay eeprom chip write traces into a binary image.")
+    parser.add_argument("log", type=Path, help="captured chip output")
+    parser.add_argument("-o", "--out", type=Path, required=True, help="image to write")
+    parser.add_argument("--base", type=Path, help="image the run started from (default: all zeros)")
+    parser.add_argument("--size", type=int, default=4096, help="EEPROM size in bytes (default 4096)")
+    args = parser.parse_args()
+
+    image = bytearray(args.size)
+    if args.base:
+        base = args.base.read_bytes()[:args.size]
+        image[:len(base)] = base
+
+    writes = 0
+    for line in args.log.read_text(errors="replace").splitlines():
+        match = WRITE_LINE.search(line)
+        if not match:
+            continue
+        addr = int(match.group(1), 16)
+        for value in match.group(2).split():
+            image[addr % args.size] = int(value, 16)
+            addr += 1
+        writes += 1
+
+    if not writes:
+        print(f"No eeprom write lines in {args.log}; was the chip's trace attribute set?", file=sys.stderr)
+        return 1
+    args.out.write_bytes(image)
+    print(f"{writes} writes -> {args.out} ({args.size} bytes)")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
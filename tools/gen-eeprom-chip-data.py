@@ -1,4 +1,5 @@
 #!/usr/bin/env python3
+import argparse
 import re
 import sys
 from pathlib import Path
@@ -9,6 +10,12 @@ def decode_c_string(s: str) -> str:
 
 
 def main() -> int:
+    parser = argparse.ArgumentParser(description="Generate the EEPROM chip's initial contents.")
+    parser.add_argument("--image", type=Path,
+                        help="binary image to start from (see eeprom-image-from-log.py); "
+                             "the message strings are written over its start")
+    args = parser.parse_args()
+
     base = Path(__file__).resolve().parents[1]
     src = base / "main" / "messages_def.h"
     out = base / "eeprom-chip" / "src" / "eeprom_data.h"
@@ -24,11 +31,19 @@ def main() -> int:
         print("No messages found in messages_def.h", file=sys.stderr)
         return 1
 
-    data = bytearray()
+    messages = bytearray()
     for s in strings:
         decoded = decode_c_string(s)
-        data.extend(decoded.encode("utf-8"))
-        data.append(0)
+        messages.extend(decoded.encode("utf-8"))
+        messages.append(0)
+
+    data = bytearray(args.image.read_bytes()) if args.image else bytearray()
+    if len(data) < len(messages):
+        data.extend(bytes(len(messages) - len(data)))
+    data[:len(messages)] = messages
+    # The chip zero-fills past the data, so trailing zeros need not be stored.
+    while len(data) > len(messages) and data[-1] == 0:
+        del data[-1]
 
     per_line = 16
     lines = []
@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+import argparse
+import sys
+from pathlib import Path
+
+# Builds buttons-chip/src/key_script.h from a .keys script; see
+# buttons-chip/scripts/menu-walk.keys for the format. Rebuild the chip after.
+
+# Ladder levels the keyladder chip outputs, named the way the WOKWI_SIM build
+# in main/main.ino maps them.
+KEY_LEVELS = {
+    "left": ("a", 900),
+    "ok": ("f", 700),
+    "up": ("e", 500),
+    "down": ("x", 300),
+    "right": ("d", 100),
+}
+PIN_ALIASES = {pin: name for name, (pin, _) in KEY_LEVELS.items()}
+RELEASED = 1023
+
+
+def parse(path: Path):
+    steps = []
+    for number, raw in enumerate(path.read_text().splitlines(), 1):
+        line = raw.split("#", 1)[0].strip().lower()
+        if not line:
+            continue
+        words = line.split()
+        key = PIN_ALIASES.get(words[0], words[0])
+        try:
+            ms = int(words[1]) if len(words) > 1 else 0
+        except ValueError:
+            raise SystemExit(f"{path}:{number}: bad duration '{words[1]}'")
+        if len(words) > 2 or ms < 0:
+            raise SystemExit(f"{path}:{number}: expected '<key> [hold_ms]' or 'wait <ms>'")
+        if key == "wait":
+            if ms == 0:
+                raise SystemExit(f"{path}:{number}: wait needs a duration")
+            steps.append(("wait", RELEASED, ms))
+        elif key in KEY_LEVELS:
+            steps.append((key, KEY_LEVELS[key][1], ms))
+        else:
+            raise SystemExit(f"{path}:{number}: unknown key '{words[0]}'")
+    return steps
+
+
+def main() -> int:
+    base = Path(__file__).resolve().parents[1]
+    parser = argparse.ArgumentParser(description="Generate the keyladder chip's built-in key script.")
+    parser.add_argument("script", type=Path, nargs="?", default=base / "buttons-chip" / "scripts" / "menu-walk.keys")
+    args = parser.parse_args()
+
+    steps = parse(args.script)
+    if not steps:
+        print(f"No steps in {args.script}", file=sys.stderr)
+        return 1
+
+    try:
+        source = args.script.resolve().relative_to(base)
+    except ValueError:
+        source = args.script.name
+    lines = [f'  {{"{name}", {adc}, {ms}}},' for name, adc, ms in steps]
+    out = base / "buttons-chip" / "src" / "key_script.h"
+    out.write_text(
+        "\n".join(
+            [
+                "#pragma once",
+                "#include <stdint.h>",
+                "",
+                f"// Generated by tools/gen-key-script.py from {source}.",
+                "",
+                "typedef struct {",
+                "  const char *name;",
+                "  uint16_t adc;  // 1023 = released",
+                "  uint32_t ms;   // 0 = the holdMs attribute",
+                "} key_step_t;",
+                "",
+                f"#define KEY_SCRIPT_STEPS {len(steps)}",
+                "static const key_step_t kKeyScript[KEY_SCRIPT_STEPS] = {",
+                *lines,
+                "};",
+                "",
+            ]
+        )
+    )
+    print(f"{len(steps)} steps -> {out.relative_to(base)}")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())